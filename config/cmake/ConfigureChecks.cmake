@@ -196,6 +196,25 @@ option (HDF5_ENABLE_ROS3_VFD "Build the ROS3 Virtual File Driver" OFF)
     endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+  # Off by default: the driver has not yet been built and tested with liburing
+  option (HDF5_ENABLE_URING_VFD "Build the experimental io_uring Virtual File Driver (requires liburing)" OFF)
+  if (HDF5_ENABLE_URING_VFD)
+    find_path (URING_INCLUDE_DIR liburing.h)
+    find_library (URING_LIBRARY NAMES uring)
+    if (URING_INCLUDE_DIR AND URING_LIBRARY)
+      set (${HDF_PREFIX}_HAVE_URING_VFD 1)
+      list (APPEND LINK_LIBS ${URING_LIBRARY})
+      INCLUDE_DIRECTORIES (${URING_INCLUDE_DIR})
+    else ()
+      message (FATAL_ERROR "The io_uring VFD was requested but cannot be built.\nPlease check that liburing is available on your\nsystem, and/or re-configure without option HDF5_ENABLE_URING_VFD.")
+    endif ()
+  endif ()
+endif ()
+
 # ----------------------------------------------------------------------
 # Check whether we can build the Mirror VFD
 # Header-check flags set in config/cmake_ext_mod/ConfigureChecks.cmake
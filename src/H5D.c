@@ -26,6 +26,7 @@
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5FLprivate.h" /* Free lists                               */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
@@ -596,6 +597,196 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dget_offset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dget_mapped_ptr
+ *
+ * Purpose:     Gives read access to raw data without copying it, when the
+ *              file was opened with the mmap driver.  For a contiguous
+ *              dataset *PTR points to all of the dataset's data and OFFSET
+ *              is ignored; for a chunked dataset it points to the chunk
+ *              at logical OFFSET.  *SIZE is the number of bytes there.
+ *
+ *              MEM_TYPE_ID must describe the data without requiring any
+ *              conversion from the dataset's datatype.
+ *
+ *              If the data can't be accessed in place (e.g. a different
+ *              driver is used, the storage isn't allocated or the chunk
+ *              is filtered), *PTR is set to NULL and the application
+ *              should fall back to H5Dread().  The pointer stays valid
+ *              until the file is closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_mapped_ptr(hid_t dset_id, hid_t mem_type_id, const hsize_t *offset, const void **ptr /*out*/,
+                  size_t *size /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* Dataset for this operation   */
+    herr_t         ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ii*hxx", dset_id, mem_type_id, offset, ptr, size);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+    if (H5I_DATATYPE != H5I_get_type(mem_type_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+    if (NULL == ptr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "ptr cannot be NULL")
+    if (NULL == size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "size cannot be NULL")
+
+    /* Get the pointer */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_GET_MAPPED_PTR, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, mem_type_id, offset, ptr, size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get pointer to mapped data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_mapped_ptr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dget_chunk_cache_stats
+ *
+ * Purpose:     Retrieves the number of hits, misses and evictions in the
+ *              chunk cache of a chunked dataset since it was opened or
+ *              its statistics were last reset.  An eviction is a chunk
+ *              of the dataset preempted from the cache to make room for
+ *              another chunk, of this or (with a shared chunk cache)
+ *              another dataset.  Any of the pointers may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_cache_stats(hid_t dset_id, unsigned *hits /*out*/, unsigned *misses /*out*/,
+                         unsigned *evictions /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* Dataset for this operation   */
+    herr_t         ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", dset_id, hits, misses, evictions);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+
+    /* Get the statistics */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_GET_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, hits, misses, evictions) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get chunk cache statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_cache_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dreset_chunk_cache_stats
+ *
+ * Purpose:     Resets the chunk cache statistics of a chunked dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dreset_chunk_cache_stats(hid_t dset_id)
+{
+    H5VL_object_t *vol_obj;             /* Dataset for this operation   */
+    herr_t         ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", dset_id);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+
+    /* Reset the statistics */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_RESET_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "unable to reset chunk cache statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dreset_chunk_cache_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dget_sieve_stats
+ *
+ * Purpose:     Retrieves the number of hits, misses and bypasses of the
+ *              sieve buffer of a contiguous dataset since it was opened
+ *              or its statistics were last reset, and the current size
+ *              of its sieve buffer.  A hit is an access served from the
+ *              sieve buffer, a miss one that (re)filled it and a bypass
+ *              one made directly to the file.  The sieve buffer's size
+ *              adapts to the accesses, starting from the size set with
+ *              H5Pset_sieve_buf_size(), and is reported as 0 while the
+ *              buffer is bypassed.  Any of the pointers may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_sieve_stats(hid_t dset_id, unsigned *hits /*out*/, unsigned *misses /*out*/,
+                   unsigned *bypasses /*out*/, size_t *buf_size /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* Dataset for this operation   */
+    herr_t         ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ixxxx", dset_id, hits, misses, bypasses, buf_size);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+
+    /* Get the statistics */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_GET_SIEVE_STATS, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, hits, misses, bypasses, buf_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get sieve buffer statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_sieve_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dreset_sieve_stats
+ *
+ * Purpose:     Resets the sieve buffer statistics of a contiguous dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dreset_sieve_stats(hid_t dset_id)
+{
+    H5VL_object_t *vol_obj;             /* Dataset for this operation   */
+    herr_t         ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", dset_id);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+
+    /* Reset the statistics */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_RESET_SIEVE_STATS, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "unable to reset sieve buffer statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dreset_sieve_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dread
  *
@@ -661,6 +852,88 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Reads (part of) COUNT datasets into application memory, in
+ *              one operation.  Entry I of each array describes the read
+ *              from dataset DSET_ID[I] exactly as the corresponding
+ *              arguments of H5Dread() would.  All the reads share the
+ *              transfer properties in DXPL_ID.
+ *
+ *              With the native VOL connector, the raw data that needs
+ *              no datatype conversion is gathered across all of the
+ *              datasets and passed to the file driver as a single
+ *              vector read per file.  Otherwise the datasets are read
+ *              one after another.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[], const hid_t mem_space_id[],
+              const hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/)
+{
+    H5VL_object_t **vol_obj   = NULL;    /* Datasets for this operation */
+    void **         obj       = NULL;    /* Native datasets for this operation */
+    hbool_t         is_native = TRUE;    /* Whether all the datasets use the native VOL connector */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*iix", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id || !mem_type_id || !mem_space_id || !file_space_id || !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL array argument")
+
+    /* Get dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (H5_VOL_NATIVE != vol_obj[u]->connector->cls->value)
+            is_native = FALSE;
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Read the data */
+    if (is_native) {
+        if (NULL == (obj = (void **)H5MM_malloc(count * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+        for (u = 0; u < count; u++)
+            obj[u] = vol_obj[u]->data;
+
+        if (H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_READ_MULTI, dxpl_id, H5_REQUEST_NULL,
+                                  count, obj, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5VL_dataset_read(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                  buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(vol_obj);
+    H5MM_xfree(obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dread_chunk
  *
@@ -707,6 +980,123 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_chunks
+ *
+ * Purpose:     Reads COUNT entire chunks from the file directly, with
+ *              one I/O request for all of them.  The chunk starting at
+ *              OFFSETS[i] is read into BUFS[i], which must be large
+ *              enough for the chunk as stored, and its filter mask is
+ *              returned in FILTERS[i].
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const hsize_t *offsets[],
+               uint32_t filters[] /*out*/, void *bufs[] /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    size_t         u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iiz**hxx", dset_id, dxpl_id, count, offsets, filters, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (count > UINT32_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many chunks")
+    if (!bufs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs cannot be NULL")
+    if (!offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+    if (!filters)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters cannot be NULL")
+    for (u = 0; u < count; u++)
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs[%zu] cannot be NULL", u)
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Read the raw chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_READ_MULTI, dxpl_id, H5_REQUEST_NULL, count,
+                              offsets, filters, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dprefetch
+ *
+ * Purpose:     Hints that the elements selected in FILE_SPACE_ID are
+ *              about to be read.  The chunks holding them are read, and
+ *              decoded when the dataset is filtered, into the dataset's
+ *              chunk cache, so that the later H5Dread() finds them
+ *              there instead of going to the file.
+ *
+ *              FILE_SPACE_ID can be H5S_ALL, for the whole dataset.
+ *              No more chunks are loaded than fit in the chunk cache,
+ *              and nothing is loaded for datasets that aren't chunked.
+ *
+ *              The call is synchronous: the chunks have been loaded
+ *              when it returns, and it takes about as long as reading
+ *              them would.  The library isn't safe to enter from
+ *              several threads at once (thread-safe builds hold a
+ *              global lock for the whole of every API call), so the
+ *              chunks can't be loaded in the background while the
+ *              application goes on using the library.  What it saves
+ *              is the cost of finding and reading the chunks one at a
+ *              time in the later H5Dread(): they are read in file
+ *              order, and filtered ones decoded on the filter threads.
+ *              An application can overlap the loading with its own
+ *              work by calling it from a thread of its own, as long as
+ *              no other thread calls the library until it returns.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dprefetch(hid_t dset_id, hid_t file_space_id, hid_t dxpl_id)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iii", dset_id, file_space_id, dxpl_id);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (file_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataspace ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Load the chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_PREFETCH, dxpl_id, H5_REQUEST_NULL,
+                              file_space_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't prefetch data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dprefetch() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite
  *
@@ -773,6 +1163,88 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Writes (part of) COUNT datasets from application memory,
+ *              in one operation.  Entry I of each array describes the
+ *              write to dataset DSET_ID[I] exactly as the corresponding
+ *              arguments of H5Dwrite() would.  All the writes share the
+ *              transfer properties in DXPL_ID.
+ *
+ *              With the native VOL connector, the raw data that needs
+ *              no datatype conversion is gathered across all of the
+ *              datasets and passed to the file driver as a single
+ *              vector write per file.  Otherwise the datasets are
+ *              written one after another.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[], const hid_t mem_space_id[],
+               const hid_t file_space_id[], hid_t dxpl_id, const void *buf[])
+{
+    H5VL_object_t **vol_obj   = NULL;    /* Datasets for this operation */
+    void **         obj       = NULL;    /* Native datasets for this operation */
+    hbool_t         is_native = TRUE;    /* Whether all the datasets use the native VOL connector */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id || !mem_type_id || !mem_space_id || !file_space_id || !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL array argument")
+
+    /* Get dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (H5_VOL_NATIVE != vol_obj[u]->connector->cls->value)
+            is_native = FALSE;
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Write the data */
+    if (is_native) {
+        if (NULL == (obj = (void **)H5MM_malloc(count * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+        for (u = 0; u < count; u++)
+            obj[u] = vol_obj[u]->data;
+
+        if (H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_WRITE_MULTI, dxpl_id, H5_REQUEST_NULL,
+                                  count, obj, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5VL_dataset_write(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                   buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(vol_obj);
+    H5MM_xfree(obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
  *
@@ -826,6 +1298,76 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_chunks
+ *
+ * Purpose:     Writes COUNT entire chunks to the file directly.  The
+ *              chunk starting at OFFSETS[i] is written from BUFS[i],
+ *              which holds DATA_SIZES[i] bytes that have been through
+ *              the filters not set in FILTERS[i].
+ *
+ *              Unlike calling H5Dwrite_chunk() for each chunk, the file
+ *              space for all the new chunks is allocated at once, in
+ *              chunk order, and the data of all the chunks is written
+ *              with one I/O request.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const uint32_t filters[],
+                const hsize_t *offsets[], const size_t data_sizes[], const void *bufs[])
+{
+    H5VL_object_t *vol_obj = NULL;
+    size_t         u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*Iu**h*z**x", dset_id, dxpl_id, count, filters, offsets, data_sizes, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset ID")
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (count > UINT32_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many chunks")
+    if (!bufs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs cannot be NULL")
+    if (!offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+    if (!filters)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters cannot be NULL")
+    if (!data_sizes)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data_sizes cannot be NULL")
+    for (u = 0; u < count; u++) {
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs[%zu] cannot be NULL", u)
+        if (0 == data_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data_sizes[%zu] cannot be zero", u)
+
+        /* Make sure data size is less than 4 GiB */
+        if (data_sizes[u] != (size_t)(uint32_t)data_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid data_sizes[%zu] - chunks cannot be > 4 GiB",
+                        u)
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Write the chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI, dxpl_id, H5_REQUEST_NULL,
+                              count, filters, offsets, data_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_chunks() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dscatter
  *
@@ -1607,3 +2149,60 @@ H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *offset, unsigned *filte
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dget_chunk_info_by_coord() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dchunk_iter
+ *
+ * Purpose:     Iterates over all the allocated chunks of a chunked
+ *              dataset, calling CB once for each of them with the
+ *              chunk's logical offset, filter mask, file address and
+ *              stored size.
+ *
+ *              The chunk index is walked only once, and the chunks are
+ *              visited in increasing file address order, so the whole
+ *              chunk map of a dataset can be built in a single pass,
+ *              unlike with repeated calls to H5Dget_chunk_info().
+ *
+ *              CB returns zero to continue the iteration, a positive
+ *              value to stop it early (successfully), or a negative
+ *              value to stop it and fail.
+ *
+ * Parameters:
+ *              hid_t dset_id;           IN: Chunked dataset ID
+ *              hid_t dxpl_id;           IN: Dataset transfer property list ID
+ *              H5D_chunk_iter_op_t cb;  IN: Callback for each chunk
+ *              void *op_data;           IN: User data passed to CB
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dchunk_iter(hid_t dset_id, hid_t dxpl_id, H5D_chunk_iter_op_t cb, void *op_data)
+{
+    H5VL_object_t *vol_obj   = NULL; /* Dataset for this operation */
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iiDC*x", dset_id, dxpl_id, cb, op_data);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+    if (NULL == cb)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "callback function pointer is NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Iterate over the chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_ITER, dxpl_id, H5_REQUEST_NULL, cb,
+                              op_data) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dchunk_iter() */
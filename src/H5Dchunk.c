@@ -36,6 +36,24 @@
  *        be added to the cache the heap is pruned by preempting
  *        entries near the front of the list to make room for the new
  *        entry which is added to the end of the list.
+ *
+ *        A dataset with a replacement policy (H5Pset_chunk_cache_policy)
+ *        or using the file's shared chunk cache (H5Pset_shared_chunk_cache)
+ *        has no slot table.  Its chunks are kept in an open hash table,
+ *        keyed by dataset and chunk offset, whose chains resolve
+ *        collisions, so chunks are only preempted when the cache's byte
+ *        budget is exhausted.  The victim is the least recently used
+ *        unlocked chunk (LRU, and always for the shared cache), the
+ *        first unlocked chunk not used since a clock hand last passed
+ *        it (CLOCK), or the least frequently used unlocked chunk (LFU).
+ *        A shared cache's budget covers all the datasets using it, and
+ *        a chunk of any of them may be preempted to make room.
+ *
+ *        A dataset opened with H5Pset_chunk_index_cache keeps a copy of
+ *        its chunk index in a hash table keyed by scaled offset, read in
+ *        full by the first lookup that misses the cache.  Lookups are
+ *        answered from it instead of the on-disk index, so every insert
+ *        into or removal from the on-disk index updates it as well.
  */
 
 /****************/
@@ -59,6 +77,7 @@
 #include "H5Iprivate.h"  /* IDs                      */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5MFprivate.h" /* File memory management               */
+#include "H5UCprivate.h" /* Reference counted objects            */
 #include "H5VMprivate.h" /* Vector and array functions        */
 
 /****************/
@@ -80,6 +99,39 @@
              (H5D_CHUNK_IDX_SINGLE == (storage)->idx_type && H5D_COPS_SINGLE == (storage)->ops) ||           \
              (H5D_CHUNK_IDX_NONE == (storage)->idx_type && H5D_COPS_NONE == (storage)->ops));
 
+/* The filter pipeline can only be run over several chunks at once, on worker
+ * threads, when Pthreads are available.  H5D__chunk_filter_concurrent()
+ * decides whether it is for each dataset.
+ */
+#if defined(H5_HAVE_PTHREAD_H) && defined(H5_HAVE_LIBPTHREAD)
+#define H5D_CHUNK_CONCURRENT_FILTERS
+#include <pthread.h>
+#endif
+
+/* Number of chunks handed to each filter thread in one batch */
+#define H5D_CHUNK_FILTER_JOBS_PER_THREAD 2
+
+/* Initial number of hash chains in a shared chunk cache (a power of two) */
+#define H5D_CHUNK_OPEN_NBUCKETS_INIT 64
+
+/* Initial number of records and hash chains in an in-memory chunk index (a power of two) */
+#define H5D_CHUNK_IDX_CACHE_NENTS_INIT 256
+
+/* Initial number of chunk records gathered by H5D__chunk_iter() */
+#define H5D_CHUNK_ITER_NENTS_INIT 256
+
+/* Largest gap, in bytes, between two unfiltered chunks that are still read
+ * together by H5D__chunk_read_coalesced(), and largest single read it issues
+ */
+#define H5D_CHUNK_COALESCE_GAP      (64 * 1024)
+#define H5D_CHUNK_COALESCE_MAX_READ (8 * 1024 * 1024)
+
+/* Largest number of chunks, and of bytes of chunks, that H5D__chunk_allocate()
+ * allocates and fills together
+ */
+#define H5D_CHUNK_ALLOC_BATCH_NCHUNKS 1024
+#define H5D_CHUNK_ALLOC_BATCH_SIZE    (64 * 1024 * 1024)
+
 /*
  * Feature: If this constant is defined then every cache preemption and load
  *        causes a character to be printed on the standard error stream:
@@ -128,14 +180,62 @@ typedef struct H5D_rdcc_ent_t {
     H5F_block_t            chunk_block;              /*offset/length of chunk in file        */
     hsize_t                chunk_idx;                /*index of chunk in dataset             */
     uint8_t *              chunk;                    /*the unfiltered chunk data        */
+    void *                 image;                    /*filtered copy of 'chunk', if encoded ahead */
+    size_t                 image_size;               /*bytes of data in 'image'        */
+    unsigned               image_mask;               /*filters skipped for 'image'        */
     unsigned               idx;                      /*index in hash table            */
     struct H5D_rdcc_ent_t *next;                     /*next item in doubly-linked list    */
     struct H5D_rdcc_ent_t *prev;                     /*previous item in doubly-linked list    */
     struct H5D_rdcc_ent_t *tmp_next;                 /*next item in temporary doubly-linked list */
     struct H5D_rdcc_ent_t *tmp_prev;                 /*previous item in temporary doubly-linked list */
+    H5D_shared_t *         owner;                    /*dataset of the chunk, in a shared cache */
+    struct H5D_rdcc_ent_t *hnext;                    /*next item in hash chain of a shared cache */
+    struct H5D_rdcc_ent_t *lru_next;                 /*next (more recently used) item in a shared cache */
+    struct H5D_rdcc_ent_t *lru_prev;                 /*previous item in a shared cache */
+    hbool_t                referenced;               /*used since the clock hand last passed */
+    unsigned               nrefs;                    /*number of uses, for LFU replacement */
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+/* Open-hashing raw data chunk cache, private to a dataset or shared by the
+ * datasets of a file */
+typedef struct H5D_rdcc_open_t {
+    struct {
+        unsigned nhits;      /* Number of cache hits */
+        unsigned nmisses;    /* Number of cache misses */
+        unsigned nevictions; /* Number of chunks preempted to make room */
+    } stats;
+    H5D_chunk_cache_policy_t policy;      /* Replacement policy */
+    hbool_t                  shared;      /* Whether the cache is the file's shared cache */
+    size_t                   nbytes_max;  /* Maximum cached raw data in bytes, for all datasets */
+    size_t                   nbytes_used; /* Current cached raw data in bytes */
+    size_t                   nused;       /* Number of chunks in the cache */
+    size_t                   nbuckets;    /* Number of hash chains (a power of two) */
+    H5D_rdcc_ent_ptr_t *     bucket;      /* Hash chains, linked through 'hnext' */
+    H5D_rdcc_ent_t *         head;        /* Least recently used (or inserted) chunk */
+    H5D_rdcc_ent_t *         tail;        /* Most recently used (or inserted) chunk */
+    H5D_rdcc_ent_t *         hand;        /* Next chunk the clock hand considers */
+} H5D_rdcc_open_t;
+
+/* Record of a chunk in the in-memory copy of a chunk index */
+typedef struct H5D_chunk_idx_cache_ent_t {
+    haddr_t  addr;        /* Address of chunk in file, or HADDR_UNDEF once removed */
+    uint32_t nbytes;      /* Size of stored data */
+    uint32_t filter_mask; /* Excluded filters */
+    size_t   next;        /* Next record in the hash chain plus one, or 0 at the end of the chain */
+} H5D_chunk_idx_cache_ent_t;
+
+/* In-memory copy of a dataset's chunk index */
+typedef struct H5D_chunk_idx_cache_t {
+    unsigned                   ndims;    /* Number of scaled coordinates of a chunk */
+    size_t                     nents;    /* Number of records */
+    size_t                     nalloc;   /* Number of records allocated */
+    H5D_chunk_idx_cache_ent_t *ent;      /* Records */
+    hsize_t *                  scaled;   /* Scaled offsets of the records, 'ndims' per record */
+    size_t                     nbuckets; /* Number of hash chains (a power of two) */
+    size_t *                   bucket;   /* First record of each hash chain plus one, or 0 */
+} H5D_chunk_idx_cache_t;
+
 /* Callback info for iteration to prune chunks */
 typedef struct H5D_chunk_it_ud1_t {
     H5D_chunk_common_ud_t     common;          /* Common info for B-tree user data (must be first) */
@@ -229,6 +329,54 @@ typedef struct H5D_chunk_info_iter_ud_t {
     hbool_t  found;                    /* Whether the chunk was found */
 } H5D_chunk_info_iter_ud_t;
 
+/* Info recorded for each chunk visited by H5D__chunk_iter() */
+typedef struct H5D_chunk_iter_ent_t {
+    haddr_t  addr;        /* Address of the chunk in file */
+    uint32_t nbytes;      /* Size of stored data in the chunk */
+    unsigned filter_mask; /* Excluded filters */
+    size_t   scaled_idx;  /* Index of the chunk's scaled offset in the offset array */
+} H5D_chunk_iter_ent_t;
+
+/* Callback info for recording the chunks in H5D__chunk_iter() */
+typedef struct H5D_chunk_iter_ud_t {
+    unsigned              ndims;  /* Number of dimensions in the dataset */
+    size_t                nused;  /* Number of chunks recorded */
+    size_t                nalloc; /* Number of chunk records allocated */
+    H5D_chunk_iter_ent_t *ent;    /* Chunk records */
+    hsize_t *             scaled; /* Scaled offsets of the chunks, NDIMS per chunk */
+} H5D_chunk_iter_ud_t;
+
+/* One chunk of a batched direct chunk read or write */
+typedef struct H5D_chunk_direct_ent_t {
+    hsize_t        scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    H5D_chunk_ud_t udata;                    /* Chunk info from the index */
+    H5F_block_t    old_chunk;                /* File block of the chunk being replaced (writing) */
+    hbool_t        alloc;                    /* Whether the chunk gets file space from the batch (writing) */
+    hbool_t        need_insert;              /* Whether the chunk needs to be inserted into the index */
+    size_t         idx;                      /* Position of the chunk in the caller's arrays */
+} H5D_chunk_direct_ent_t;
+
+/* A chunk loaded into the chunk cache by H5D__chunk_prefetch() */
+typedef struct H5D_chunk_prefetch_ent_t {
+    hsize_t        scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    H5D_chunk_ud_t udata;                    /* Chunk info from the index */
+} H5D_chunk_prefetch_ent_t;
+
+/* A chunk read by H5D__chunk_read_coalesced() */
+typedef struct H5D_chunk_coalesce_ent_t {
+    haddr_t           addr;       /* Address of the chunk in the file */
+    H5D_chunk_info_t *chunk_info; /* Chunk selection information */
+} H5D_chunk_coalesce_ent_t;
+
+/* A chunk allocated (and filled) in a batch by H5D__chunk_allocate() */
+typedef struct H5D_chunk_alloc_ent_t {
+    hsize_t        scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    H5D_chunk_ud_t udata;                    /* Chunk info for the index */
+    hbool_t        alloc;                    /* Whether the chunk gets file space from the batch */
+    hbool_t        need_insert;              /* Whether the chunk needs to be inserted into the index */
+    const void *   fill_buf;                 /* Fill value image to write to the chunk, or NULL */
+} H5D_chunk_alloc_ent_t;
+
 /* Callback info for file selection iteration */
 typedef struct H5D_chunk_file_iter_ud_t {
     H5D_chunk_map_t *fm; /* File->memory chunk mapping info */
@@ -237,6 +385,36 @@ typedef struct H5D_chunk_file_iter_ud_t {
 #endif                            /* H5_HAVE_PARALLEL */
 } H5D_chunk_file_iter_ud_t;
 
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+/* One chunk to run through the filter pipeline on a filter thread.  Chunks
+ * being decoded are read from the file at 'addr' into 'buf' beforehand;
+ * chunks being encoded are copied from 'src' by the worker first, so that
+ * the cached chunk stays usable.
+ */
+typedef struct H5D_chunk_filter_job_t {
+    hsize_t         scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    haddr_t         addr;                     /* Address of the chunk in the file (decoding) */
+    H5D_rdcc_ent_t *ent;                      /* Cache entry of the chunk (encoding) */
+    const void *    src;                      /* Unfiltered chunk to copy (encoding) */
+    void *          buf;                      /* Buffer run through the pipeline */
+    size_t          nbytes;                   /* Bytes of data in 'buf' */
+    size_t          buf_size;                 /* Bytes allocated for 'buf' */
+    unsigned        filter_mask;              /* Filters skipped for the chunk */
+    hbool_t         failed;                   /* Whether the pipeline failed on the chunk */
+} H5D_chunk_filter_job_t;
+
+/* A batch of filter jobs, shared by the threads working on it */
+typedef struct H5D_chunk_filter_pool_t {
+    const H5O_pline_t *     pline;      /* Filter pipeline to run */
+    unsigned                flags;      /* Pipeline flags (direction) */
+    H5Z_EDC_t               err_detect; /* Error detection setting, when decoding */
+    H5D_chunk_filter_job_t *jobs;       /* The jobs */
+    size_t                  njobs;      /* Number of jobs */
+    size_t                  next;       /* Next job to hand out */
+    pthread_mutex_t         mutex;      /* Protects 'next' */
+} H5D_chunk_filter_pool_t;
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+
 #ifdef H5_HAVE_PARALLEL
 /* information to construct a collective I/O operation for filling chunks */
 typedef struct H5D_chunk_coll_info_t {
@@ -261,6 +439,10 @@ static herr_t H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *typ
                               const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
 static herr_t H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
                                const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
+static herr_t H5D__chunk_read_coalesced(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                        H5D_chunk_map_t *fm, H5D_io_info_t *cpt_io_info,
+                                        H5D_chunk_ud_t **udata_out);
+static int    H5D__chunk_coalesce_cmp(const void *_ent1, const void *_ent2);
 static herr_t H5D__chunk_flush(H5D_t *dset);
 static herr_t H5D__chunk_io_term(const H5D_chunk_map_t *fm);
 static herr_t H5D__chunk_dest(H5D_t *dset);
@@ -269,6 +451,16 @@ static herr_t H5D__chunk_dest(H5D_t *dset);
 static int H5D__get_num_chunks_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 static int H5D__get_chunk_info_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 static int H5D__get_chunk_info_by_coord_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_iter_cmp(const void *_ent1, const void *_ent2);
+static int H5D__chunk_prefetch_cmp(const void *_ent1, const void *_ent2);
+
+/* Batched direct chunk I/O helpers */
+static herr_t H5D__chunk_direct_lookup(const H5D_t *dset, const hsize_t *offset, H5D_chunk_direct_ent_t *ent);
+static herr_t H5D__chunk_direct_io(const H5D_t *dset, size_t count, H5D_chunk_direct_ent_t *ents,
+                                   const void *wbufs[], void *rbufs[]);
+static int    H5D__chunk_direct_scaled_cmp(const void *_ent1, const void *_ent2);
+static int    H5D__chunk_direct_addr_cmp(const void *_ent1, const void *_ent2);
 
 /* "Nonexistent" layout operation callback */
 static ssize_t H5D__nonexistent_readvv(const H5D_io_info_t *io_info, size_t chunk_max_nseq,
@@ -285,9 +477,21 @@ static herr_t   H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned nd
 static void *   H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline);
 static void *   H5D__chunk_mem_xfree(void *chk, const void *pline);
 static void *   H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline);
+static herr_t   H5D__chunk_allocate_batch(const H5D_t *dset, const H5D_chk_idx_info_t *idx_info,
+                                          size_t nents, H5D_chunk_alloc_ent_t *ents);
 static herr_t   H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last);
 static herr_t   H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *udata);
 static hbool_t  H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *udata);
+static herr_t   H5D__chunk_idx_cache_load(const H5D_t *dset);
+static int      H5D__chunk_idx_cache_load_cb(const H5D_chunk_rec_t *chunk_rec, void *_cache);
+static herr_t   H5D__chunk_idx_cache_add(H5D_chunk_idx_cache_t *cache, const hsize_t *scaled, haddr_t addr,
+                                         uint32_t nbytes, uint32_t filter_mask);
+static H5D_chunk_idx_cache_ent_t *H5D__chunk_idx_cache_find(const H5D_chunk_idx_cache_t *cache,
+                                                            const hsize_t *         scaled);
+static hsize_t  H5D__chunk_idx_cache_chunk_idx(const H5O_layout_chunk_t *layout, H5D_chunk_index_t idx_type,
+                                               const hsize_t *scaled);
+static size_t   H5D__chunk_idx_cache_hash(const H5D_chunk_idx_cache_t *cache, const hsize_t *scaled);
+static void     H5D__chunk_idx_cache_free(H5D_chunk_idx_cache_t *cache);
 static herr_t   H5D__free_chunk_info(void *item, void *key, void *opdata);
 static herr_t   H5D__create_chunk_map_single(H5D_chunk_map_t *fm, const H5D_io_info_t *io_info);
 static herr_t   H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t *io_info);
@@ -308,7 +512,37 @@ static void *   H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *ud
 static herr_t   H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbool_t dirty,
                                   void *chunk, uint32_t naccessed);
 static herr_t   H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
+static herr_t   H5D__chunk_file_alloc_check(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+                                            H5F_block_t *new_chunk, hbool_t *alloc_chunk);
+static H5D_rdcc_ent_t *H5D__chunk_cache_find(const H5D_shared_t *shared, unsigned idx,
+                                             const hsize_t *scaled);
+static H5D_rdcc_open_t *H5D__chunk_open_cache_create(H5D_chunk_cache_policy_t policy, size_t nbytes_max);
+static herr_t           H5D__chunk_shared_cache_attach(H5F_t *f, const H5D_t *dset);
+static herr_t           H5D__chunk_open_cache_free(void *_cache);
+static unsigned         H5D__chunk_open_hash_val(const H5D_rdcc_open_t *cache, const H5D_shared_t *owner,
+                                                   const hsize_t *scaled);
+static herr_t           H5D__chunk_open_cache_insert(H5D_rdcc_open_t *cache, H5D_rdcc_ent_t *ent);
+static void             H5D__chunk_open_cache_remove(H5D_rdcc_open_t *cache, H5D_rdcc_ent_t *ent);
+static void             H5D__chunk_open_cache_touch(H5D_rdcc_open_t *cache, H5D_rdcc_ent_t *ent);
+static H5D_rdcc_ent_t * H5D__chunk_open_cache_victim(H5D_rdcc_open_t *cache);
+static herr_t           H5D__chunk_open_cache_prune(const H5D_t *dset, size_t size);
 static herr_t   H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+static htri_t H5D__chunk_filter_concurrent(const H5D_t *dset, unsigned *nthreads);
+static herr_t H5D__chunk_filter_run(H5D_chunk_filter_pool_t *pool, unsigned nthreads);
+static void * H5D__chunk_filter_worker(void *_pool);
+static herr_t H5D__chunk_decode_ahead(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                      const H5D_chunk_map_t *fm, H5SL_node_t *chunk_node, unsigned nthreads,
+                                      hbool_t write_op, H5SL_node_t **end_node);
+static herr_t H5D__chunk_decode_init(const H5D_t *dset, H5D_chunk_filter_pool_t *pool, size_t max_jobs);
+static herr_t H5D__chunk_decode_add(const H5D_t *dset, H5D_chunk_filter_pool_t *pool, const hsize_t *scaled,
+                                    const H5D_chunk_ud_t *udata);
+static herr_t H5D__chunk_decode_run(const H5D_t *dset, H5D_chunk_filter_pool_t *pool, unsigned nthreads);
+static void * H5D__chunk_take_decoded(H5D_rdcc_t *rdcc, unsigned ndims, const hsize_t *scaled, haddr_t addr,
+                                      unsigned *filter_mask);
+static void   H5D__chunk_free_decoded(H5D_rdcc_t *rdcc);
+static herr_t H5D__chunk_encode_ahead(const H5D_t *dset, H5D_rdcc_ent_t *ent);
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, H5D_chunk_coll_info_t *chunk_info,
                                          size_t chunk_size, const void *fill_buf);
@@ -348,6 +582,12 @@ H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ent_ptr_t);
 /* Declare a free list to manage H5D_rdcc_ent_t objects */
 H5FL_DEFINE_STATIC(H5D_rdcc_ent_t);
 
+/* Declare a free list to manage H5D_rdcc_open_t objects */
+H5FL_DEFINE_STATIC(H5D_rdcc_open_t);
+
+/* Declare a free list to manage H5D_chunk_idx_cache_t objects */
+H5FL_DEFINE_STATIC(H5D_chunk_idx_cache_t);
+
 /* Declare a free list to manage the H5D_chunk_info_t struct */
 H5FL_DEFINE(H5D_chunk_info_t);
 
@@ -449,9 +689,9 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
     /* Evict the (old) entry from the cache if present, but do not flush
      * it to disk */
     if (UINT_MAX != udata.idx_hint) {
-        const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /*raw data chunk cache */
+        H5D_rdcc_ent_t *ent = H5D__chunk_cache_find(dset->shared, udata.idx_hint, scaled);
 
-        if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], FALSE) < 0)
+        if (H5D__chunk_cache_evict(dset, ent, FALSE) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
     } /* end if */
 
@@ -467,6 +707,8 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
 
         if ((layout->storage.u.chunk.ops->insert)(&idx_info, &udata, dset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+        if (H5D__chunk_idx_cache_insert(dset, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update in-memory chunk index")
     } /* end if */
 
 done:
@@ -488,11 +730,10 @@ done:
 herr_t
 H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, void *buf)
 {
-    const H5O_layout_t *layout = &(dset->shared->layout);      /* Dataset layout */
-    const H5D_rdcc_t *  rdcc   = &(dset->shared->cache.chunk); /* raw data chunk cache */
-    H5D_chunk_ud_t      udata;                                 /* User data for querying chunk info */
-    hsize_t             scaled[H5S_MAX_RANK];                  /* Scaled coordinates for this chunk */
-    herr_t              ret_value = SUCCEED;                   /* Return value */
+    const H5O_layout_t *layout = &(dset->shared->layout); /* Dataset layout */
+    H5D_chunk_ud_t      udata;                            /* User data for querying chunk info */
+    hsize_t             scaled[H5S_MAX_RANK];             /* Scaled coordinates for this chunk */
+    herr_t              ret_value = SUCCEED;              /* Return value */
 
     FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
 
@@ -528,17 +769,16 @@ H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, vo
 
     /* Check if the requested chunk exists in the chunk cache */
     if (UINT_MAX != udata.idx_hint) {
-        H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
+        H5D_rdcc_ent_t *ent = H5D__chunk_cache_find(dset->shared, udata.idx_hint, scaled);
         hbool_t         flush;
 
         /* Sanity checks  */
-        HDassert(udata.idx_hint < rdcc->nslots);
-        HDassert(rdcc->slot[udata.idx_hint]);
+        HDassert(ent);
 
         flush = (ent->dirty == TRUE) ? TRUE : FALSE;
 
         /* Flush the chunk to disk and clear the cache entry */
-        if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], flush) < 0)
+        if (H5D__chunk_cache_evict(dset, ent, flush) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
         /* Reset fields about the chunk we are looking for */
@@ -569,2281 +809,3880 @@ done:
 } /* end H5D__chunk_direct_read() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__get_chunk_storage_size
+ * Function:    H5D__chunk_direct_lookup
  *
- * Purpose:     Internal routine to read the storage size of a chunk on disk.
+ * Purpose:     Finds the scaled coordinates and the index info of the
+ *              chunk at OFFSET, for a batched direct chunk read or write.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Matthew Strong (GE Healthcare)
- *              20 October 2016
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage_size)
+static herr_t
+H5D__chunk_direct_lookup(const H5D_t *dset, const hsize_t *offset, H5D_chunk_direct_ent_t *ent)
 {
-    const H5O_layout_t *layout = &(dset->shared->layout);      /* Dataset layout */
-    const H5D_rdcc_t *  rdcc   = &(dset->shared->cache.chunk); /* raw data chunk cache */
-    hsize_t             scaled[H5S_MAX_RANK];                  /* Scaled coordinates for this chunk */
-    H5D_chunk_ud_t      udata;                                 /* User data for querying chunk info */
-    herr_t              ret_value = SUCCEED;                   /* Return value */
+    hsize_t offset_copy[H5O_LAYOUT_NDIMS]; /* Internal copy of chunk offset */
+    herr_t  ret_value = SUCCEED;           /* Return value */
 
-    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+    FUNC_ENTER_STATIC
 
-    /* Check args */
-    HDassert(dset && H5D_CHUNKED == layout->type);
-    HDassert(offset);
-    HDassert(storage_size);
+    HDassert(dset);
+    HDassert(ent);
 
-    *storage_size = 0;
+    if (!offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset cannot be NULL")
 
-    /* Allocate dataspace and initialize it if it hasn't been. */
-    if (!(*layout->ops->is_space_alloc)(&layout->storage))
-        HGOTO_DONE(SUCCEED)
+    /* Copy the user's offset array so we can be sure it's terminated properly */
+    if (H5D__get_offset_copy(dset, offset, offset_copy) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
 
     /* Calculate the index of this chunk */
-    H5VM_chunk_scaled(dset->shared->ndims, offset, layout->u.chunk.dim, scaled);
-    scaled[dset->shared->ndims] = 0;
-
-    /* Reset fields about the chunk we are looking for */
-    udata.chunk_block.offset = HADDR_UNDEF;
-    udata.chunk_block.length = 0;
-    udata.idx_hint           = UINT_MAX;
+    H5VM_chunk_scaled(dset->shared->ndims, offset_copy, dset->shared->layout.u.chunk.dim, ent->scaled);
+    ent->scaled[dset->shared->ndims] = 0;
 
-    /* Find out the file address of the chunk */
-    if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+    /* Find out the file address of the chunk (if any) */
+    if (H5D__chunk_lookup(dset, ent->scaled, &ent->udata) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
     /* Sanity check */
-    HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-             (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
-
-    /* The requested chunk is not in cache or on disk */
-    if (!H5F_addr_defined(udata.chunk_block.offset) && UINT_MAX == udata.idx_hint)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk storage is not allocated")
-
-    /* Check if there are filters registered to the dataset */
-    if (dset->shared->dcpl_cache.pline.nused > 0) {
-        /* Check if the requested chunk exists in the chunk cache */
-        if (UINT_MAX != udata.idx_hint) {
-            H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
-
-            /* Sanity checks  */
-            HDassert(udata.idx_hint < rdcc->nslots);
-            HDassert(rdcc->slot[udata.idx_hint]);
-
-            /* If the cached chunk is dirty, it must be flushed to get accurate size */
-            if (ent->dirty == TRUE) {
-                /* Flush the chunk to disk and clear the cache entry */
-                if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], TRUE) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
-
-                /* Reset fields about the chunk we are looking for */
-                udata.chunk_block.offset = HADDR_UNDEF;
-                udata.chunk_block.length = 0;
-                udata.idx_hint           = UINT_MAX;
-
-                /* Get the new file address / chunk size after flushing */
-                if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
-            }
-        }
-
-        /* Make sure the address of the chunk is returned. */
-        if (!H5F_addr_defined(udata.chunk_block.offset))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
-
-        /* Return the chunk size on disk */
-        *storage_size = udata.chunk_block.length;
-    }
-    /* There are no filters registered, return the chunk size from the storage layout */
-    else
-        *storage_size = dset->shared->layout.u.chunk.size;
+    HDassert((H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length > 0) ||
+             (!H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length == 0));
 
 done:
-    FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* H5D__get_chunk_storage_size */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_lookup() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_set_info_real
+ * Function:    H5D__chunk_direct_io
  *
- * Purpose:    Internal routine to set the information about chunks for a dataset
- *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Reads or writes the data of the chunks in ENTS with one
+ *              vector I/O request, sorted by file address so that the
+ *              file driver can merge chunks that are next to each other
+ *              into one transfer.  The data is written from WBUFS when
+ *              it isn't NULL, otherwise it is read into RBUFS.
  *
- * Programmer:    Quincey Koziol
- *              Tuesday, June 30, 2009
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims, const hsize_t *curr_dims,
-                         const hsize_t *max_dims)
+H5D__chunk_direct_io(const H5D_t *dset, size_t count, H5D_chunk_direct_ent_t *ents, const void *wbufs[],
+                     void *rbufs[])
 {
-    unsigned u;                   /* Local index variable */
-    herr_t   ret_value = SUCCEED; /* Return value */
+    H5D_chunk_direct_ent_t **by_addr = NULL;      /* Chunks, sorted by address */
+    H5FD_mem_t *             types   = NULL;      /* Memory types of the I/O vector */
+    haddr_t *                addrs   = NULL;      /* Addresses of the I/O vector */
+    size_t *                 sizes   = NULL;      /* Sizes of the I/O vector */
+    const void **            vwbufs  = NULL;      /* Buffers of the I/O vector (writing) */
+    void **                  vrbufs  = NULL;      /* Buffers of the I/O vector (reading) */
+    size_t                   u;                   /* Local index variable */
+    herr_t                   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity checks */
-    HDassert(layout);
-    HDassert(ndims > 0);
-    HDassert(curr_dims);
-
-    /* Compute the # of chunks in dataset dimensions */
-    for (u = 0, layout->nchunks = 1, layout->max_nchunks = 1; u < ndims; u++) {
-        /* Round up to the next integer # of chunks, to accommodate partial chunks */
-        layout->chunks[u] = ((curr_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
-        if (H5S_UNLIMITED == max_dims[u])
-            layout->max_chunks[u] = H5S_UNLIMITED;
-        else {
-            /* Sanity check */
-            if (layout->dim[u] == 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dimension size must be > 0, dim = %u ", u)
-
-            layout->max_chunks[u] = ((max_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
-        }
-
-        /* Accumulate the # of chunks */
-        layout->nchunks *= layout->chunks[u];
-        layout->max_nchunks *= layout->max_chunks[u];
+    HDassert(dset);
+    HDassert(ents);
+    HDassert(!wbufs != !rbufs);
+    HDassert(count <= UINT32_MAX);
+
+    if (NULL == (by_addr = (H5D_chunk_direct_ent_t **)H5MM_malloc(count * sizeof(H5D_chunk_direct_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk list")
+    if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(count * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+    if (NULL == (addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+    if (NULL == (sizes = (size_t *)H5MM_malloc(count * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+    if (wbufs) {
+        if (NULL == (vwbufs = (const void **)H5MM_malloc(count * sizeof(const void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+    } /* end if */
+    else if (NULL == (vrbufs = (void **)H5MM_malloc(count * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+
+    /* Put the chunks in file address order */
+    for (u = 0; u < count; u++)
+        by_addr[u] = &ents[u];
+    HDqsort(by_addr, count, sizeof(H5D_chunk_direct_ent_t *), H5D__chunk_direct_addr_cmp);
+
+    /* Build the I/O vector */
+    for (u = 0; u < count; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = by_addr[u]->udata.chunk_block.offset;
+        H5_CHECKED_ASSIGN(sizes[u], size_t, by_addr[u]->udata.chunk_block.length, hsize_t);
+        if (wbufs)
+            vwbufs[u] = wbufs[by_addr[u]->idx];
+        else
+            vrbufs[u] = rbufs[by_addr[u]->idx];
     } /* end for */
 
-    /* Get the "down" sizes for each dimension */
-    if (H5VM_array_down(ndims, layout->chunks, layout->down_chunks) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
-    if (H5VM_array_down(ndims, layout->max_chunks, layout->max_down_chunks) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
+    /* Issue the I/O */
+    if (wbufs) {
+        if (H5F_shared_vector_write(H5F_SHARED(dset->oloc.file), (uint32_t)count, types, addrs, sizes,
+                                    vwbufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    } /* end if */
+    else if (H5F_shared_vector_read(H5F_SHARED(dset->oloc.file), (uint32_t)count, types, addrs, sizes,
+                                    vrbufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
 
 done:
+    H5MM_xfree(by_addr);
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(vwbufs);
+    H5MM_xfree(vrbufs);
+
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_set_info_real() */
+} /* end H5D__chunk_direct_io() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_set_info
- *
- * Purpose:    Sets the information about chunks for a dataset
+ * Function:    H5D__chunk_direct_scaled_cmp
  *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Compares two batched direct I/O chunks by their scaled
+ *              coordinates, for HDqsort().
  *
- * Programmer:    Quincey Koziol
- *              Tuesday, June 30, 2009
+ * Return:      <0, 0 or >0 as the first chunk comes before, at or after
+ *              the second one
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_set_info(const H5D_t *dset)
+static int
+H5D__chunk_direct_scaled_cmp(const void *_ent1, const void *_ent2)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
-
-    FUNC_ENTER_PACKAGE
-
-    /* Sanity checks */
-    HDassert(dset);
+    const H5D_chunk_direct_ent_t *ent1 = (const H5D_chunk_direct_ent_t *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = (const H5D_chunk_direct_ent_t *)_ent2;
+    unsigned                      u;             /* Local index variable */
+    int                           ret_value = 0; /* Return value */
 
-    /* Set the base layout information */
-    if (H5D__chunk_set_info_real(&dset->shared->layout.u.chunk, dset->shared->ndims, dset->shared->curr_dims,
-                                 dset->shared->max_dims) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set layout's chunk info")
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Call the index's "resize" callback */
-    if (dset->shared->layout.storage.u.chunk.ops->resize &&
-        (dset->shared->layout.storage.u.chunk.ops->resize)(&dset->shared->layout.u.chunk) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to resize chunk index information")
+    for (u = 0; u < H5O_LAYOUT_NDIMS; u++)
+        if (ent1->scaled[u] != ent2->scaled[u])
+            HGOTO_DONE(ent1->scaled[u] < ent2->scaled[u] ? -1 : 1)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_set_info() */
+} /* end H5D__chunk_direct_scaled_cmp() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_set_sizes
- *
- * Purpose:     Sets chunk and type sizes.
+ * Function:    H5D__chunk_direct_addr_cmp
  *
- * Return:      SUCCEED/FAIL
+ * Purpose:     Compares two pointers to batched direct I/O chunks by the
+ *              file addresses of the chunks, for HDqsort().
  *
- * Programmer:    Dana Robinson
- *              December 2015
+ * Return:      <0, 0 or >0 as the first chunk comes before, at or after
+ *              the second one
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_set_sizes(H5D_t *dset)
+static int
+H5D__chunk_direct_addr_cmp(const void *_ent1, const void *_ent2)
 {
-    uint64_t chunk_size;            /* Size of chunk in bytes */
-    unsigned max_enc_bytes_per_dim; /* Max. number of bytes required to encode this dimension */
-    unsigned u;                     /* Iterator */
-    herr_t   ret_value = SUCCEED;   /* Return value */
-
-    FUNC_ENTER_NOAPI(FAIL)
-
-    /* Sanity checks */
-    HDassert(dset);
-
-    /* Increment # of chunk dimensions, to account for datatype size as last element */
-    dset->shared->layout.u.chunk.ndims++;
-
-    /* Set the last dimension of the chunk size to the size of the datatype */
-    dset->shared->layout.u.chunk.dim[dset->shared->layout.u.chunk.ndims - 1] =
-        (uint32_t)H5T_GET_SIZE(dset->shared->type);
-
-    /* Compute number of bytes to use for encoding chunk dimensions */
-    max_enc_bytes_per_dim = 0;
-    for (u = 0; u < (unsigned)dset->shared->layout.u.chunk.ndims; u++) {
-        unsigned enc_bytes_per_dim; /* Number of bytes required to encode this dimension */
-
-        /* Get encoded size of dim, in bytes */
-        enc_bytes_per_dim = (H5VM_log2_gen(dset->shared->layout.u.chunk.dim[u]) + 8) / 8;
-
-        /* Check if this is the largest value so far */
-        if (enc_bytes_per_dim > max_enc_bytes_per_dim)
-            max_enc_bytes_per_dim = enc_bytes_per_dim;
-    } /* end for */
-    HDassert(max_enc_bytes_per_dim > 0 && max_enc_bytes_per_dim <= 8);
-    dset->shared->layout.u.chunk.enc_bytes_per_dim = max_enc_bytes_per_dim;
-
-    /* Compute and store the total size of a chunk */
-    /* (Use 64-bit value to ensure that we can detect >4GB chunks) */
-    for (u = 1, chunk_size = (uint64_t)dset->shared->layout.u.chunk.dim[0];
-         u < dset->shared->layout.u.chunk.ndims; u++)
-        chunk_size *= (uint64_t)dset->shared->layout.u.chunk.dim[u];
-
-    /* Check for chunk larger than can be represented in 32-bits */
-    /* (Chunk size is encoded in 32-bit value in v1 B-tree records) */
-    if (chunk_size > (uint64_t)0xffffffff)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be < 4GB")
+    const H5D_chunk_direct_ent_t *ent1 = *(const H5D_chunk_direct_ent_t *const *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = *(const H5D_chunk_direct_ent_t *const *)_ent2;
 
-    H5_CHECKED_ASSIGN(dset->shared->layout.u.chunk.size, uint32_t, chunk_size, uint64_t);
+    FUNC_ENTER_STATIC_NOERR
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_set_sizes */
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->udata.chunk_block.offset, ent2->udata.chunk_block.offset))
+} /* end H5D__chunk_direct_addr_cmp() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_construct
- *
- * Purpose:    Constructs new chunked layout information for dataset
+ * Function:    H5D__chunk_direct_write_multi
  *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Internal routine to write COUNT chunks directly into the
+ *              file.  File space for all the chunks that need new space
+ *              is allocated as one block, the data of all the chunks is
+ *              written with one vector request, and the index is updated
+ *              afterwards in chunk order.
  *
- * Programmer:    Quincey Koziol
- *              Thursday, May 22, 2008
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_construct(H5F_t H5_ATTR_UNUSED *f, H5D_t *dset)
+herr_t
+H5D__chunk_direct_write_multi(const H5D_t *dset, size_t count, const uint32_t filters[],
+                              const hsize_t *offsets[], const size_t data_sizes[], const void *bufs[])
 {
-    unsigned u;                   /* Local index variable */
-    herr_t   ret_value = SUCCEED; /* Return value */
+    const H5O_layout_t *    layout = &(dset->shared->layout); /* Dataset layout */
+    H5D_chk_idx_info_t      idx_info;                         /* Chunked index info */
+    H5D_chunk_direct_ent_t *ents       = NULL;                /* Info for each chunk */
+    hsize_t                 alloc_size = 0;                   /* Bytes of file space for new chunks */
+    size_t                  u;                                /* Local index variable */
+    herr_t                  ret_value = SUCCEED;              /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
 
     /* Sanity checks */
-    HDassert(f);
-    HDassert(dset);
+    HDassert(layout->type == H5D_CHUNKED);
+    HDassert(filters);
+    HDassert(offsets);
+    HDassert(data_sizes);
+    HDassert(bufs);
 
-    /* Check for invalid chunk dimension rank */
-    if (0 == dset->shared->layout.u.chunk.ndims)
-        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "no chunk information set?")
-    if (dset->shared->layout.u.chunk.ndims != dset->shared->ndims)
-        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dimensionality of chunks doesn't match the dataspace")
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
 
-    /* Set chunk sizes */
-    if (H5D__chunk_set_sizes(dset) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unable to set chunk sizes")
-    HDassert((unsigned)(dset->shared->layout.u.chunk.ndims) <= NELMTS(dset->shared->layout.u.chunk.dim));
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if (!H5D__chunk_is_space_alloc(&layout->storage)) {
+        H5D_io_info_t io_info; /* to hold the dset info */
 
-    /* Chunked storage is not compatible with external storage (currently) */
-    if (dset->shared->dcpl_cache.efl.nused > 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "external storage not supported with chunked layout")
-
-    /* Sanity check dimensions */
-    for (u = 0; u < dset->shared->layout.u.chunk.ndims - 1; u++) {
-        /* Don't allow zero-sized chunk dimensions */
-        if (0 == dset->shared->layout.u.chunk.dim[u])
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be > 0, dim = %u ", u)
-
-        /*
-         * The chunk size of a dimension with a fixed size cannot exceed
-         * the maximum dimension size. If any dimension size is zero, there
-         * will be no such restriction.
-         */
-        if (dset->shared->curr_dims[u] && dset->shared->max_dims[u] != H5S_UNLIMITED &&
-            dset->shared->max_dims[u] < dset->shared->layout.u.chunk.dim[u])
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                        "chunk size must be <= maximum dimension size for fixed-sized dimensions")
-    } /* end for */
+        io_info.dset = dset;
+        io_info.f_sh = H5F_SHARED(dset->oloc.file);
 
-    /* Reset address and pointer of the array struct for the chunked storage index */
-    if (H5D_chunk_idx_reset(&dset->shared->layout.storage.u.chunk, TRUE) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to reset chunked storage index")
+        /* Allocate storage */
+        if (H5D__alloc_storage(&io_info, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+    }
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_construct() */
+    if (NULL == (ents = (H5D_chunk_direct_ent_t *)H5MM_calloc(count * sizeof(H5D_chunk_direct_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk info")
 
-/*-------------------------------------------------------------------------
- * Function:    H5D__chunk_init
- *
- * Purpose:    Initialize the raw data chunk cache for a dataset.  This is
- *        called when the dataset is initialized.
- *
- * Return:    Non-negative on success/Negative on failure
- *
- * Programmer:    Robb Matzke
- *              Monday, May 18, 1998
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
-{
-    H5D_chk_idx_info_t idx_info;                            /* Chunked index info */
-    H5D_rdcc_t *       rdcc = &(dset->shared->cache.chunk); /* Convenience pointer to dataset's chunk cache */
-    H5P_genplist_t *   dapl;                                /* Data access property list object pointer */
-    H5O_storage_chunk_t *sc        = &(dset->shared->layout.storage.u.chunk);
-    herr_t               ret_value = SUCCEED; /* Return value */
+    /* Look up all the chunks */
+    for (u = 0; u < count; u++) {
+        if (H5D__chunk_direct_lookup(dset, offsets[u], &ents[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk")
+        ents[u].idx = u;
+    } /* end for */
 
-    FUNC_ENTER_STATIC
+    /* Sort the chunks, so the index is updated in chunk order and a chunk
+     * given more than once can be found.
+     */
+    HDqsort(ents, count, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_scaled_cmp);
+    for (u = 0; u < count; u++) {
+        if (u > 0 && 0 == H5D__chunk_direct_scaled_cmp(&ents[u - 1], &ents[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk written more than once")
 
-    /* Sanity check */
-    HDassert(f);
-    HDassert(dset);
-    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+        /* The chunks moved, point them back at their own coordinates */
+        ents[u].udata.common.scaled = ents[u].scaled;
+    } /* end for */
 
-    if (NULL == (dapl = (H5P_genplist_t *)H5I_object(dapl_id)))
-        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for fapl ID")
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &(dset->shared->dcpl_cache.pline);
+    idx_info.layout  = &(dset->shared->layout.u.chunk);
+    idx_info.storage = &(dset->shared->layout.storage.u.chunk);
 
-    /* Use the properties in dapl_id if they have been set, otherwise use the properties from the file */
-    if (H5P_get(dapl, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &rdcc->nslots) < 0)
-        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache number of slots")
-    if (rdcc->nslots == H5D_CHUNK_CACHE_NSLOTS_DEFAULT)
-        rdcc->nslots = H5F_RDCC_NSLOTS(f);
+    /* Work out where each chunk goes */
+    for (u = 0; u < count; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
 
-    if (H5P_get(dapl, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc->nbytes_max) < 0)
-        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache byte size")
-    if (rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
-        rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+        /* Set the file block information for the old chunk */
+        ent->old_chunk = ent->udata.chunk_block;
 
-    if (H5P_get(dapl, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &rdcc->w0) < 0)
-        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get preempt read chunks")
-    if (rdcc->w0 < 0)
-        rdcc->w0 = H5F_RDCC_W0(f);
+        /* Set up the size of chunk for user data */
+        ent->udata.chunk_block.length = (hsize_t)data_sizes[ent->idx];
 
-    /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
-    if (!rdcc->nbytes_max || !rdcc->nslots)
-        rdcc->nbytes_max = rdcc->nslots = 0;
-    else {
-        rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
-        if (NULL == rdcc->slot)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if (0 == idx_info.pline->nused && ent->udata.chunk_block.length != idx_info.layout->size)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data size doesn't match the size of the chunks")
 
-        /* Reset any cached chunk info for this dataset */
-        H5D__chunk_cinfo_cache_reset(&(rdcc->last));
-    } /* end else */
+        if (0 == idx_info.pline->nused && H5F_addr_defined(ent->old_chunk.offset))
+            /* If there are no filters and we are overwriting the chunk we can just set values */
+            ent->need_insert = FALSE;
+        else if (H5D_CHUNK_IDX_NONE == idx_info.storage->idx_type) {
+            /* The index knows the address of the chunk already */
+            if (H5D__chunk_file_alloc(&idx_info, &ent->old_chunk, &ent->udata.chunk_block,
+                                      &ent->need_insert, ent->scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+        } /* end if */
+        else {
+            /* Check if the chunk needs new space, which is allocated below */
+            if (H5D__chunk_file_alloc_check(&idx_info, &ent->old_chunk, &ent->udata.chunk_block,
+                                            &ent->alloc) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+            if (ent->alloc)
+                alloc_size += ent->udata.chunk_block.length;
+        } /* end else */
+    }     /* end for */
 
-    /* Compute scaled dimension info, if dataset dims > 1 */
-    if (dset->shared->ndims > 1) {
-        unsigned u; /* Local index value */
+    /* Allocate one block of file space for all the new chunks, laid out
+     * in chunk order
+     */
+    if (alloc_size > 0) {
+        haddr_t alloc_addr; /* Address of the next new chunk */
 
-        for (u = 0; u < dset->shared->ndims; u++) {
-            hsize_t scaled_power2up; /* Scaled value, rounded to next power of 2 */
+        if (HADDR_UNDEF == (alloc_addr = H5MF_alloc(idx_info.f, H5FD_MEM_DRAW, alloc_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
 
-            /* Initial scaled dimension sizes */
-            if (dset->shared->layout.u.chunk.dim[u] == 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+        for (u = 0; u < count; u++)
+            if (ents[u].alloc) {
+                ents[u].udata.chunk_block.offset = alloc_addr;
+                ents[u].need_insert              = TRUE;
+                alloc_addr += ents[u].udata.chunk_block.length;
+            } /* end if */
+    }         /* end if */
 
-            /* Round up to the next integer # of chunks, to accommodate partial chunks */
-            rdcc->scaled_dims[u] = (dset->shared->curr_dims[u] + dset->shared->layout.u.chunk.dim[u] - 1) /
-                                   dset->shared->layout.u.chunk.dim[u];
+    for (u = 0; u < count; u++) {
+        /* Make sure the address of the chunk is known */
+        if (!H5F_addr_defined(ents[u].udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk address isn't defined")
 
-            if (!(scaled_power2up = H5VM_power2up(rdcc->scaled_dims[u])))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
+        /* Cache the new chunk information */
+        if (ents[u].need_insert || idx_info.pline->nused > 0)
+            H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &ents[u].udata);
 
-            /* Inital 'power2up' values for scaled dimensions */
-            rdcc->scaled_power2up[u] = scaled_power2up;
+        /* Evict the (old) entry from the cache if present, but do not flush
+         * it to disk */
+        if (UINT_MAX != ents[u].udata.idx_hint) {
+            H5D_rdcc_ent_t *ent = H5D__chunk_cache_find(dset->shared, ents[u].udata.idx_hint, ents[u].scaled);
 
-            /* Number of bits required to encode scaled dimension size */
-            rdcc->scaled_encode_bits[u] = H5VM_log2_gen(rdcc->scaled_power2up[u]);
-        } /* end for */
-    }     /* end if */
+            if (H5D__chunk_cache_evict(dset, ent, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+        } /* end if */
+    }     /* end for */
 
-    /* Compose chunked index info struct */
-    idx_info.f       = f;
-    idx_info.pline   = &dset->shared->dcpl_cache.pline;
-    idx_info.layout  = &dset->shared->layout.u.chunk;
-    idx_info.storage = sc;
+    /* Write the data of all the chunks */
+    if (H5D__chunk_direct_io(dset, count, ents, bufs, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
 
-    /* Allocate any indexing structures */
-    if (sc->ops->init && (sc->ops->init)(&idx_info, dset->shared->space, dset->oloc.addr) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize indexing information")
+    /* Insert the new chunk records into the index */
+    if (layout->storage.u.chunk.ops->insert)
+        for (u = 0; u < count; u++)
+            if (ents[u].need_insert) {
+                /* Set the chunk's filter mask to the new settings */
+                ents[u].udata.filter_mask = filters[ents[u].idx];
 
-    /* Set the number of chunks in dataset, etc. */
-    if (H5D__chunk_set_info(dset) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set # of chunks for dataset")
+                if ((layout->storage.u.chunk.ops->insert)(&idx_info, &ents[u].udata, dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                if (H5D__chunk_idx_cache_insert(dset, &ents[u].udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update in-memory chunk index")
+            } /* end if */
 
 done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_init() */
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_write_multi() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_is_space_alloc
- *
- * Purpose:    Query if space is allocated for layout
+ * Function:    H5D__chunk_direct_read_multi
  *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Internal routine to read COUNT chunks directly from the
+ *              file, with one vector request for the data of all the
+ *              chunks.
  *
- * Programmer:    Quincey Koziol
- *              Thursday, January 15, 2009
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-hbool_t
-H5D__chunk_is_space_alloc(const H5O_storage_t *storage)
+herr_t
+H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count, const hsize_t *offsets[], uint32_t filters[],
+                             void *bufs[])
 {
-    const H5O_storage_chunk_t *sc        = &(storage->u.chunk);
-    hbool_t                    ret_value = FALSE; /* Return value */
+    const H5O_layout_t *    layout    = &(dset->shared->layout); /* Dataset layout */
+    H5D_chunk_direct_ent_t *ents      = NULL;                    /* Info for each chunk */
+    size_t                  u;                                   /* Local index variable */
+    herr_t                  ret_value = SUCCEED;                 /* Return value */
 
-    FUNC_ENTER_PACKAGE_NOERR
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
 
-    /* Sanity checks */
-    HDassert(storage);
-    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(offsets);
+    HDassert(filters);
+    HDassert(bufs);
 
-    /* Query index layer */
-    ret_value = (sc->ops->is_space_alloc)(sc);
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_is_space_alloc() */
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if (!H5D__chunk_is_space_alloc(&layout->storage) && !H5D__chunk_is_data_cached(dset->shared))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "storage is not initialized")
+
+    if (NULL == (ents = (H5D_chunk_direct_ent_t *)H5MM_calloc(count * sizeof(H5D_chunk_direct_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk info")
+
+    for (u = 0; u < count; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+
+        ent->idx = u;
+
+        /* Find out the file address of the chunk */
+        if (H5D__chunk_direct_lookup(dset, offsets[u], ent) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk")
+
+        /* Check if the requested chunk exists in the chunk cache */
+        if (UINT_MAX != ent->udata.idx_hint) {
+            H5D_rdcc_ent_t *cache_ent = H5D__chunk_cache_find(dset->shared, ent->udata.idx_hint, ent->scaled);
+
+            /* Sanity checks  */
+            HDassert(cache_ent);
+
+            /* Flush the chunk to disk and clear the cache entry */
+            if (H5D__chunk_cache_evict(dset, cache_ent, cache_ent->dirty) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+
+            /* Get the new file address / chunk size after flushing */
+            if (H5D__chunk_lookup(dset, ent->scaled, &ent->udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        } /* end if */
+
+        /* Make sure the address of the chunk is returned. */
+        if (!H5F_addr_defined(ent->udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
+
+        /* Return the filter mask */
+        filters[u] = ent->udata.filter_mask;
+    } /* end for */
+
+    /* Read the data of all the chunks into the supplied buffers */
+    if (H5D__chunk_direct_io(dset, count, ents, NULL, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+done:
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_read_multi() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_is_data_cached
+ * Function:    H5D__chunk_get_mapped_ptr
  *
- * Purpose:     Query if raw data is cached for dataset
+ * Purpose:     Internal routine to find the chunk at logical OFFSET in a
+ *              file mapped into memory.  Only unfiltered chunks that have
+ *              been written to the file can be accessed in place; for any
+ *              other chunk *PTR is set to NULL.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Neil Fortner
- *              Wednessday, March 6, 2016
- *
  *-------------------------------------------------------------------------
  */
-hbool_t
-H5D__chunk_is_data_cached(const H5D_shared_t *shared_dset)
+herr_t
+H5D__chunk_get_mapped_ptr(const H5D_t *dset, const hsize_t *offset, const void **ptr /*out*/,
+                          size_t *size /*out*/)
 {
-    FUNC_ENTER_PACKAGE_NOERR
+    const H5O_layout_t *layout = &(dset->shared->layout); /* Dataset layout */
+    H5D_chunk_ud_t      udata;                            /* User data for querying chunk info */
+    hsize_t             offset_copy[H5O_LAYOUT_NDIMS];    /* Internal copy of chunk offset */
+    hsize_t             scaled[H5S_MAX_RANK];             /* Scaled coordinates for this chunk */
+    herr_t              ret_value = SUCCEED;              /* Return value */
 
-    /* Sanity checks */
-    HDassert(shared_dset);
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
 
-    FUNC_LEAVE_NOAPI(shared_dset->cache.chunk.nused > 0)
-} /* end H5D__chunk_is_data_cached() */
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(offset);
+    HDassert(ptr);
+    HDassert(size);
+
+    *ptr  = NULL;
+    *size = 0;
+
+    /* Filtered chunks must go through the pipeline */
+    if (dset->shared->dcpl_cache.pline.nused > 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Copy the user's offset array so we can be sure it's terminated properly */
+    if (H5D__get_offset_copy(dset, offset, offset_copy) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+
+    /* Calculate the index of this chunk */
+    H5VM_chunk_scaled(dset->shared->ndims, offset_copy, layout->u.chunk.dim, scaled);
+    scaled[dset->shared->ndims] = 0;
+
+    /* Reset fields about the chunk we are looking for */
+    udata.filter_mask        = 0;
+    udata.chunk_block.offset = HADDR_UNDEF;
+    udata.chunk_block.length = 0;
+    udata.idx_hint           = UINT_MAX;
+
+    /* Find out the file address of the chunk */
+    if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* The file copy of a chunk modified in the cache is stale */
+    if (UINT_MAX != udata.idx_hint && H5D__chunk_cache_find(dset->shared, udata.idx_hint, scaled)->dirty)
+        HGOTO_DONE(SUCCEED)
+
+    /* Chunks that were never written aren't in the file */
+    if (!H5F_addr_defined(udata.chunk_block.offset))
+        HGOTO_DONE(SUCCEED)
+
+    if (H5F_shared_get_mapped_ptr(H5F_SHARED(dset->oloc.file), udata.chunk_block.offset,
+                                  (size_t)udata.chunk_block.length, ptr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get pointer to raw data chunk")
+    if (*ptr)
+        *size = (size_t)udata.chunk_block.length;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_get_mapped_ptr() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_io_init
+ * Function:    H5D__get_chunk_storage_size
  *
- * Purpose:    Performs initialization before any sort of I/O on the raw data
+ * Purpose:     Internal routine to read the storage size of a chunk on disk.
  *
- * Return:    Non-negative on success/Negative on failure
+ * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *              Thursday, March 20, 2008
+ * Programmer:  Matthew Strong (GE Healthcare)
+ *              20 October 2016
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
-                   const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm)
+herr_t
+H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage_size)
 {
-    const H5D_t *dataset = io_info->dset;       /* Local pointer to dataset info */
-    hssize_t     old_offset[H5O_LAYOUT_NDIMS];  /* Old selection offset */
-    htri_t       file_space_normalized = FALSE; /* File dataspace was normalized */
-    unsigned     f_ndims;                       /* The number of dimensions of the file's dataspace */
-    int          sm_ndims;            /* The number of dimensions of the memory buffer's dataspace (signed) */
-    unsigned     u;                   /* Local index variable */
-    herr_t       ret_value = SUCCEED; /* Return value        */
+    const H5O_layout_t *layout = &(dset->shared->layout); /* Dataset layout */
+    hsize_t             scaled[H5S_MAX_RANK];             /* Scaled coordinates for this chunk */
+    H5D_chunk_ud_t      udata;                            /* User data for querying chunk info */
+    herr_t              ret_value = SUCCEED;              /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(offset);
+    HDassert(storage_size);
+
+    *storage_size = 0;
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if (!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Calculate the index of this chunk */
+    H5VM_chunk_scaled(dset->shared->ndims, offset, layout->u.chunk.dim, scaled);
+    scaled[dset->shared->ndims] = 0;
+
+    /* Reset fields about the chunk we are looking for */
+    udata.chunk_block.offset = HADDR_UNDEF;
+    udata.chunk_block.length = 0;
+    udata.idx_hint           = UINT_MAX;
+
+    /* Find out the file address of the chunk */
+    if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* Sanity check */
+    HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
+             (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+
+    /* The requested chunk is not in cache or on disk */
+    if (!H5F_addr_defined(udata.chunk_block.offset) && UINT_MAX == udata.idx_hint)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk storage is not allocated")
+
+    /* Check if there are filters registered to the dataset */
+    if (dset->shared->dcpl_cache.pline.nused > 0) {
+        /* Check if the requested chunk exists in the chunk cache */
+        if (UINT_MAX != udata.idx_hint) {
+            H5D_rdcc_ent_t *ent = H5D__chunk_cache_find(dset->shared, udata.idx_hint, scaled);
+
+            /* Sanity checks  */
+            HDassert(ent);
+
+            /* If the cached chunk is dirty, it must be flushed to get accurate size */
+            if (ent->dirty == TRUE) {
+                /* Flush the chunk to disk and clear the cache entry */
+                if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+
+                /* Reset fields about the chunk we are looking for */
+                udata.chunk_block.offset = HADDR_UNDEF;
+                udata.chunk_block.length = 0;
+                udata.idx_hint           = UINT_MAX;
+
+                /* Get the new file address / chunk size after flushing */
+                if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+            }
+        }
+
+        /* Make sure the address of the chunk is returned. */
+        if (!H5F_addr_defined(udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
+
+        /* Return the chunk size on disk */
+        *storage_size = udata.chunk_block.length;
+    }
+    /* There are no filters registered, return the chunk size from the storage layout */
+    else
+        *storage_size = dset->shared->layout.u.chunk.size;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* H5D__get_chunk_storage_size */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_set_info_real
+ *
+ * Purpose:    Internal routine to set the information about chunks for a dataset
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Tuesday, June 30, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims, const hsize_t *curr_dims,
+                         const hsize_t *max_dims)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(layout);
+    HDassert(ndims > 0);
+    HDassert(curr_dims);
+
+    /* Compute the # of chunks in dataset dimensions */
+    for (u = 0, layout->nchunks = 1, layout->max_nchunks = 1; u < ndims; u++) {
+        /* Round up to the next integer # of chunks, to accommodate partial chunks */
+        layout->chunks[u] = ((curr_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
+        if (H5S_UNLIMITED == max_dims[u])
+            layout->max_chunks[u] = H5S_UNLIMITED;
+        else {
+            /* Sanity check */
+            if (layout->dim[u] == 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dimension size must be > 0, dim = %u ", u)
+
+            layout->max_chunks[u] = ((max_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
+        }
+
+        /* Accumulate the # of chunks */
+        layout->nchunks *= layout->chunks[u];
+        layout->max_nchunks *= layout->max_chunks[u];
+    } /* end for */
+
+    /* Get the "down" sizes for each dimension */
+    if (H5VM_array_down(ndims, layout->chunks, layout->down_chunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
+    if (H5VM_array_down(ndims, layout->max_chunks, layout->max_down_chunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_set_info_real() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_set_info
+ *
+ * Purpose:    Sets the information about chunks for a dataset
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Tuesday, June 30, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_set_info(const H5D_t *dset)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+
+    /* Set the base layout information */
+    if (H5D__chunk_set_info_real(&dset->shared->layout.u.chunk, dset->shared->ndims, dset->shared->curr_dims,
+                                 dset->shared->max_dims) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set layout's chunk info")
+
+    /* Call the index's "resize" callback */
+    if (dset->shared->layout.storage.u.chunk.ops->resize &&
+        (dset->shared->layout.storage.u.chunk.ops->resize)(&dset->shared->layout.u.chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to resize chunk index information")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_set_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_set_sizes
+ *
+ * Purpose:     Sets chunk and type sizes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ * Programmer:    Dana Robinson
+ *              December 2015
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_set_sizes(H5D_t *dset)
+{
+    uint64_t chunk_size;            /* Size of chunk in bytes */
+    unsigned max_enc_bytes_per_dim; /* Max. number of bytes required to encode this dimension */
+    unsigned u;                     /* Iterator */
+    herr_t   ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(dset);
+
+    /* Increment # of chunk dimensions, to account for datatype size as last element */
+    dset->shared->layout.u.chunk.ndims++;
+
+    /* Set the last dimension of the chunk size to the size of the datatype */
+    dset->shared->layout.u.chunk.dim[dset->shared->layout.u.chunk.ndims - 1] =
+        (uint32_t)H5T_GET_SIZE(dset->shared->type);
+
+    /* Compute number of bytes to use for encoding chunk dimensions */
+    max_enc_bytes_per_dim = 0;
+    for (u = 0; u < (unsigned)dset->shared->layout.u.chunk.ndims; u++) {
+        unsigned enc_bytes_per_dim; /* Number of bytes required to encode this dimension */
+
+        /* Get encoded size of dim, in bytes */
+        enc_bytes_per_dim = (H5VM_log2_gen(dset->shared->layout.u.chunk.dim[u]) + 8) / 8;
+
+        /* Check if this is the largest value so far */
+        if (enc_bytes_per_dim > max_enc_bytes_per_dim)
+            max_enc_bytes_per_dim = enc_bytes_per_dim;
+    } /* end for */
+    HDassert(max_enc_bytes_per_dim > 0 && max_enc_bytes_per_dim <= 8);
+    dset->shared->layout.u.chunk.enc_bytes_per_dim = max_enc_bytes_per_dim;
+
+    /* Compute and store the total size of a chunk */
+    /* (Use 64-bit value to ensure that we can detect >4GB chunks) */
+    for (u = 1, chunk_size = (uint64_t)dset->shared->layout.u.chunk.dim[0];
+         u < dset->shared->layout.u.chunk.ndims; u++)
+        chunk_size *= (uint64_t)dset->shared->layout.u.chunk.dim[u];
+
+    /* Check for chunk larger than can be represented in 32-bits */
+    /* (Chunk size is encoded in 32-bit value in v1 B-tree records) */
+    if (chunk_size > (uint64_t)0xffffffff)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be < 4GB")
+
+    H5_CHECKED_ASSIGN(dset->shared->layout.u.chunk.size, uint32_t, chunk_size, uint64_t);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_set_sizes */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_construct
+ *
+ * Purpose:    Constructs new chunked layout information for dataset
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Thursday, May 22, 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_construct(H5F_t H5_ATTR_UNUSED *f, H5D_t *dset)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(dset);
+
+    /* Check for invalid chunk dimension rank */
+    if (0 == dset->shared->layout.u.chunk.ndims)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "no chunk information set?")
+    if (dset->shared->layout.u.chunk.ndims != dset->shared->ndims)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dimensionality of chunks doesn't match the dataspace")
+
+    /* Set chunk sizes */
+    if (H5D__chunk_set_sizes(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unable to set chunk sizes")
+    HDassert((unsigned)(dset->shared->layout.u.chunk.ndims) <= NELMTS(dset->shared->layout.u.chunk.dim));
+
+    /* Chunked storage is not compatible with external storage (currently) */
+    if (dset->shared->dcpl_cache.efl.nused > 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "external storage not supported with chunked layout")
+
+    /* Sanity check dimensions */
+    for (u = 0; u < dset->shared->layout.u.chunk.ndims - 1; u++) {
+        /* Don't allow zero-sized chunk dimensions */
+        if (0 == dset->shared->layout.u.chunk.dim[u])
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be > 0, dim = %u ", u)
+
+        /*
+         * The chunk size of a dimension with a fixed size cannot exceed
+         * the maximum dimension size. If any dimension size is zero, there
+         * will be no such restriction.
+         */
+        if (dset->shared->curr_dims[u] && dset->shared->max_dims[u] != H5S_UNLIMITED &&
+            dset->shared->max_dims[u] < dset->shared->layout.u.chunk.dim[u])
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                        "chunk size must be <= maximum dimension size for fixed-sized dimensions")
+    } /* end for */
+
+    /* Reset address and pointer of the array struct for the chunked storage index */
+    if (H5D_chunk_idx_reset(&dset->shared->layout.storage.u.chunk, TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to reset chunked storage index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_construct() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_init
+ *
+ * Purpose:    Initialize the raw data chunk cache for a dataset.  This is
+ *        called when the dataset is initialized.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Robb Matzke
+ *              Monday, May 18, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
+{
+    H5D_chk_idx_info_t idx_info;                            /* Chunked index info */
+    H5D_rdcc_t *       rdcc = &(dset->shared->cache.chunk); /* Convenience pointer to dataset's chunk cache */
+    H5P_genplist_t *   dapl;                                /* Data access property list object pointer */
+    H5O_storage_chunk_t *    sc         = &(dset->shared->layout.storage.u.chunk);
+    H5D_chunk_cache_policy_t policy     = H5D_CHUNK_CACHE_POLICY_DEFAULT; /* Replacement policy */
+    hbool_t                  use_shared = FALSE;   /* Whether to use the file's shared chunk cache */
+    herr_t                   ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(dset);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+
+    if (NULL == (dapl = (H5P_genplist_t *)H5I_object(dapl_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for fapl ID")
+
+    /* Use the properties in dapl_id if they have been set, otherwise use the properties from the file */
+    if (H5P_get(dapl, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &rdcc->nslots) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache number of slots")
+    if (H5P_get(dapl, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc->nbytes_max) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache byte size")
+    if (H5P_get(dapl, H5D_ACS_DATA_CACHE_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache replacement policy")
+    if (H5P_get(dapl, H5D_ACS_CHUNK_INDEX_CACHE_NAME, &rdcc->idx_cache_on) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get in-memory chunk index option")
+
+    /* Single chunk and implicit indices are looked up without I/O anyway, and
+     * the index of a file opened for SWMR reading changes under the reader */
+    if (sc->idx_type == H5D_CHUNK_IDX_SINGLE || sc->idx_type == H5D_CHUNK_IDX_NONE ||
+        (H5F_INTENT(f) & H5F_ACC_SWMR_READ))
+        rdcc->idx_cache_on = FALSE;
+
+    /* A dataset without chunk cache settings of its own uses the file's
+     * shared chunk cache, if the file has one */
+    if (H5F_RDCC_SHARED_NBYTES(f) > 0 && rdcc->nslots == H5D_CHUNK_CACHE_NSLOTS_DEFAULT &&
+        rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT && policy == H5D_CHUNK_CACHE_POLICY_DEFAULT)
+        use_shared = TRUE;
+
+    if (rdcc->nslots == H5D_CHUNK_CACHE_NSLOTS_DEFAULT)
+        rdcc->nslots = H5F_RDCC_NSLOTS(f);
+    if (rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
+        rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+
+    if (H5P_get(dapl, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &rdcc->w0) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get preempt read chunks")
+    if (rdcc->w0 < 0)
+        rdcc->w0 = H5F_RDCC_W0(f);
+
+    if (use_shared) {
+        /* Keep the dataset's chunks in the shared cache, instead of a hash table of its own */
+        if (H5D__chunk_shared_cache_attach(f, dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't attach to shared chunk cache")
+
+        /* Reset any cached chunk info for this dataset */
+        H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+    } /* end if */
+    else if (policy != H5D_CHUNK_CACHE_POLICY_DEFAULT && rdcc->nbytes_max > 0) {
+        /* Keep the dataset's chunks in an open hash table of its own, the number
+         * of slots doesn't matter */
+        if (NULL == (rdcc->open_cache = H5D__chunk_open_cache_create(policy, rdcc->nbytes_max)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk cache")
+        rdcc->oh_addr = dset->oloc.addr;
+
+        /* Reset any cached chunk info for this dataset */
+        H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+    } /* end if */
+    /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
+    else if (!rdcc->nbytes_max || !rdcc->nslots)
+        rdcc->nbytes_max = rdcc->nslots = 0;
+    else {
+        rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
+        if (NULL == rdcc->slot)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+        /* Reset any cached chunk info for this dataset */
+        H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+    } /* end else */
+
+    /* Compute scaled dimension info, if dataset dims > 1 */
+    if (dset->shared->ndims > 1) {
+        unsigned u; /* Local index value */
+
+        for (u = 0; u < dset->shared->ndims; u++) {
+            hsize_t scaled_power2up; /* Scaled value, rounded to next power of 2 */
+
+            /* Initial scaled dimension sizes */
+            if (dset->shared->layout.u.chunk.dim[u] == 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+
+            /* Round up to the next integer # of chunks, to accommodate partial chunks */
+            rdcc->scaled_dims[u] = (dset->shared->curr_dims[u] + dset->shared->layout.u.chunk.dim[u] - 1) /
+                                   dset->shared->layout.u.chunk.dim[u];
+
+            if (!(scaled_power2up = H5VM_power2up(rdcc->scaled_dims[u])))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
+
+            /* Inital 'power2up' values for scaled dimensions */
+            rdcc->scaled_power2up[u] = scaled_power2up;
+
+            /* Number of bits required to encode scaled dimension size */
+            rdcc->scaled_encode_bits[u] = H5VM_log2_gen(rdcc->scaled_power2up[u]);
+        } /* end for */
+    }     /* end if */
+
+    /* Compose chunked index info struct */
+    idx_info.f       = f;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Allocate any indexing structures */
+    if (sc->ops->init && (sc->ops->init)(&idx_info, dset->shared->space, dset->oloc.addr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize indexing information")
+
+    /* Set the number of chunks in dataset, etc. */
+    if (H5D__chunk_set_info(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set # of chunks for dataset")
+
+done:
+    if (ret_value < 0 && rdcc->open_cache && !rdcc->open_cache->shared) {
+        H5D__chunk_open_cache_free(rdcc->open_cache);
+        rdcc->open_cache = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_is_space_alloc
+ *
+ * Purpose:    Query if space is allocated for layout
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Thursday, January 15, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5D__chunk_is_space_alloc(const H5O_storage_t *storage)
+{
+    const H5O_storage_chunk_t *sc        = &(storage->u.chunk);
+    hbool_t                    ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(storage);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+
+    /* Query index layer */
+    ret_value = (sc->ops->is_space_alloc)(sc);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_is_space_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_is_data_cached
+ *
+ * Purpose:     Query if raw data is cached for dataset
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Neil Fortner
+ *              Wednessday, March 6, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5D__chunk_is_data_cached(const H5D_shared_t *shared_dset)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(shared_dset);
+
+    FUNC_LEAVE_NOAPI(shared_dset->cache.chunk.nused > 0)
+} /* end H5D__chunk_is_data_cached() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_io_init
+ *
+ * Purpose:    Performs initialization before any sort of I/O on the raw data
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Thursday, March 20, 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
+                   const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm)
+{
+    const H5D_t *dataset = io_info->dset;       /* Local pointer to dataset info */
+    hssize_t     old_offset[H5O_LAYOUT_NDIMS];  /* Old selection offset */
+    htri_t       file_space_normalized = FALSE; /* File dataspace was normalized */
+    unsigned     f_ndims;                       /* The number of dimensions of the file's dataspace */
+    int          sm_ndims;            /* The number of dimensions of the memory buffer's dataspace (signed) */
+    unsigned     u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value        */
+
+    FUNC_ENTER_STATIC
+
+    /* Get layout for dataset */
+    fm->layout = &(dataset->shared->layout);
+    fm->nelmts = nelmts;
+
+    /* Check if the memory space is scalar & make equivalent memory space */
+    if ((sm_ndims = H5S_GET_EXTENT_NDIMS(mem_space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get dimension number")
+    /* Set the number of dimensions for the memory dataspace */
+    H5_CHECKED_ASSIGN(fm->m_ndims, unsigned, sm_ndims, int);
+
+    /* Get rank for file dataspace */
+    fm->f_ndims = f_ndims = dataset->shared->layout.u.chunk.ndims - 1;
+
+    /* Normalize hyperslab selections by adjusting them by the offset */
+    /* (It might be worthwhile to normalize both the file and memory dataspaces
+     * before any (contiguous, chunked, etc) file I/O operation, in order to
+     * speed up hyperslab calculations by removing the extra checks and/or
+     * additions involving the offset and the hyperslab selection -QAK)
+     */
+    if ((file_space_normalized = H5S_hyper_normalize_offset((H5S_t *)file_space, old_offset)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to normalize selection")
+
+    /* Decide the number of chunks in each dimension */
+    for (u = 0; u < f_ndims; u++)
+        /* Keep the size of the chunk dimensions as hsize_t for various routines */
+        fm->chunk_dim[u] = fm->layout->u.chunk.dim[u];
+
+#ifdef H5_HAVE_PARALLEL
+    /* Calculate total chunk in file map*/
+    fm->select_chunk = NULL;
+    if (io_info->using_mpi_vfd) {
+        H5_CHECK_OVERFLOW(fm->layout->u.chunk.nchunks, hsize_t, size_t);
+        if (fm->layout->u.chunk.nchunks)
+            if (NULL == (fm->select_chunk = (H5D_chunk_info_t **)H5MM_calloc(
+                             (size_t)fm->layout->u.chunk.nchunks * sizeof(H5D_chunk_info_t *))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+    }  /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Initialize "last chunk" information */
+    fm->last_index      = (hsize_t)-1;
+    fm->last_chunk_info = NULL;
+
+    /* Point at the dataspaces */
+    fm->file_space = file_space;
+    fm->mem_space  = mem_space;
+
+    if (H5D__chunk_io_init_selections(io_info, type_info, fm) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file and memory chunk selections")
+
+done:
+    /* Reset the global dataspace info */
+    fm->file_space = NULL;
+    fm->mem_space  = NULL;
+
+    if (file_space_normalized == TRUE)
+        if (H5S_hyper_denormalize_offset((H5S_t *)file_space, old_offset) <
+            0) /* (Casting away const OK -QAK) */
+            HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't denormalize selection")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_io_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_io_init_selections
+ *
+ * Purpose:        Initialize the chunk mappings
+ *
+ * Return:        Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Thursday, March 20, 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_io_init_selections(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                              H5D_chunk_map_t *fm)
+{
+    const H5D_t *dataset    = io_info->dset;       /* Local pointer to dataset info */
+    const H5T_t *mem_type   = type_info->mem_type; /* Local pointer to memory datatype */
+    H5S_t *      tmp_mspace = NULL;                /* Temporary memory dataspace */
+    H5T_t *      file_type  = NULL;                /* Temporary copy of file datatype for iteration */
+    hbool_t      iter_init  = FALSE;               /* Selection iteration info has been initialized */
+    char         bogus;                            /* "bogus" buffer to pass to selection iterator */
+    herr_t       ret_value = SUCCEED;              /* Return value        */
+
+    FUNC_ENTER_STATIC
+
+    /* Special case for only one element in selection */
+    /* (usually appending a record) */
+    if (fm->nelmts == 1
+#ifdef H5_HAVE_PARALLEL
+        && !(io_info->using_mpi_vfd)
+#endif /* H5_HAVE_PARALLEL */
+        && H5S_SEL_ALL != H5S_GET_SELECT_TYPE(fm->file_space)) {
+        /* Initialize skip list for chunk selections */
+        fm->sel_chunks = NULL;
+        fm->use_single = TRUE;
+
+        /* Initialize single chunk dataspace */
+        if (NULL == dataset->shared->cache.chunk.single_space) {
+            /* Make a copy of the dataspace for the dataset */
+            if ((dataset->shared->cache.chunk.single_space = H5S_copy(fm->file_space, TRUE, FALSE)) == NULL)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
+
+            /* Resize chunk's dataspace dimensions to size of chunk */
+            if (H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
+
+            /* Set the single chunk dataspace to 'all' selection */
+            if (H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
+        } /* end if */
+        fm->single_space = dataset->shared->cache.chunk.single_space;
+        HDassert(fm->single_space);
+
+        /* Allocate the single chunk information */
+        if (NULL == dataset->shared->cache.chunk.single_chunk_info)
+            if (NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+        HDassert(fm->single_chunk_info);
+
+        /* Reset chunk template information */
+        fm->mchunk_tmpl = NULL;
+
+        /* Set up chunk mapping for single element */
+        if (H5D__create_chunk_map_single(fm, io_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                        "unable to create chunk selections for single element")
+    } /* end if */
+    else {
+        hbool_t sel_hyper_flag; /* Whether file selection is a hyperslab */
+
+        /* Initialize skip list for chunk selections */
+        if (NULL == dataset->shared->cache.chunk.sel_chunks)
+            if (NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
+        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+        HDassert(fm->sel_chunks);
+
+        /* We are not using single element mode */
+        fm->use_single = FALSE;
+
+        /* Get type of selection on disk & in memory */
+        if ((fm->fsel_type = H5S_GET_SELECT_TYPE(fm->file_space)) < H5S_SEL_NONE)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
+        if ((fm->msel_type = H5S_GET_SELECT_TYPE(fm->mem_space)) < H5S_SEL_NONE)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
+
+        /* If the selection is NONE or POINTS, set the flag to FALSE */
+        if (fm->fsel_type == H5S_SEL_POINTS || fm->fsel_type == H5S_SEL_NONE)
+            sel_hyper_flag = FALSE;
+        else
+            sel_hyper_flag = TRUE;
+
+        /* Check if file selection is a not a hyperslab selection */
+        if (sel_hyper_flag) {
+            /* Build the file selection for each chunk */
+            if (H5S_SEL_ALL == fm->fsel_type) {
+                if (H5D__create_chunk_file_map_all(fm, io_info) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
+            } /* end if */
+            else {
+                /* Sanity check */
+                HDassert(fm->fsel_type == H5S_SEL_HYPERSLABS);
+
+                if (H5D__create_chunk_file_map_hyper(fm, io_info) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
+            } /* end else */
+        }     /* end if */
+        else {
+            H5S_sel_iter_op_t        iter_op; /* Operator for iteration */
+            H5D_chunk_file_iter_ud_t udata;   /* User data for iteration */
+
+            /* Create temporary datatypes for selection iteration */
+            if (NULL == (file_type = H5T_copy(dataset->shared->type, H5T_COPY_ALL)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy file datatype")
+
+            /* Initialize the user data */
+            udata.fm = fm;
+#ifdef H5_HAVE_PARALLEL
+            udata.io_info = io_info;
+#endif /* H5_HAVE_PARALLEL */
+
+            iter_op.op_type  = H5S_SEL_ITER_OP_LIB;
+            iter_op.u.lib_op = H5D__chunk_file_cb;
+
+            /* Spaces might not be the same shape, iterate over the file selection directly */
+            if (H5S_select_iterate(&bogus, file_type, fm->file_space, &iter_op, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
+
+            /* Reset "last chunk" info */
+            fm->last_index      = (hsize_t)-1;
+            fm->last_chunk_info = NULL;
+        } /* end else */
+
+        /* Build the memory selection for each chunk */
+        if (sel_hyper_flag && H5S_SELECT_SHAPE_SAME(fm->file_space, fm->mem_space) == TRUE) {
+            /* Reset chunk template information */
+            fm->mchunk_tmpl = NULL;
+
+            /* If the selections are the same shape, use the file chunk information
+             * to generate the memory chunk information quickly.
+             */
+            if (H5D__create_chunk_mem_map_hyper(fm) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create memory chunk selections")
+        } /* end if */
+        else if (sel_hyper_flag && fm->f_ndims == 1 && fm->m_ndims == 1 &&
+                 H5S_SELECT_IS_REGULAR(fm->mem_space) && H5S_SELECT_IS_SINGLE(fm->mem_space)) {
+            if (H5D__create_chunk_mem_map_1d(fm) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
+        } /* end else-if */
+        else {
+            H5S_sel_iter_op_t iter_op;   /* Operator for iteration */
+            size_t            elmt_size; /* Memory datatype size */
+
+            /* Make a copy of equivalent memory space */
+            if ((tmp_mspace = H5S_copy(fm->mem_space, TRUE, FALSE)) == NULL)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+
+            /* De-select the mem space copy */
+            if (H5S_select_none(tmp_mspace) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select memory space")
+
+            /* Save chunk template information */
+            fm->mchunk_tmpl = tmp_mspace;
+
+            /* Create temporary datatypes for selection iteration */
+            if (!file_type)
+                if (NULL == (file_type = H5T_copy(dataset->shared->type, H5T_COPY_ALL)))
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy file datatype")
+
+            /* Create selection iterator for memory selection */
+            if (0 == (elmt_size = H5T_get_size(mem_type)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_BADSIZE, FAIL, "datatype size invalid")
+            if (H5S_select_iter_init(&(fm->mem_iter), fm->mem_space, elmt_size, 0) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+            iter_init = TRUE; /* Selection iteration info has been initialized */
+
+            iter_op.op_type  = H5S_SEL_ITER_OP_LIB;
+            iter_op.u.lib_op = H5D__chunk_mem_cb;
+
+            /* Spaces aren't the same shape, iterate over the memory selection directly */
+            if (H5S_select_iterate(&bogus, file_type, fm->file_space, &iter_op, fm) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create memory chunk selections")
+        } /* end else */
+    }     /* end else */
+
+done:
+    /* Release the [potentially partially built] chunk mapping information if an error occurs */
+    if (ret_value < 0) {
+        if (tmp_mspace && !fm->mchunk_tmpl)
+            if (H5S_close(tmp_mspace) < 0)
+                HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL,
+                            "can't release memory chunk dataspace template")
+        if (H5D__chunk_io_term(fm) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release chunk mapping")
+    } /* end if */
+
+    if (iter_init && H5S_SELECT_ITER_RELEASE(&(fm->mem_iter)) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if (file_type && (H5T_close_real(file_type) < 0))
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "Can't free temporary datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_io_init_selections() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_mem_alloc
+ *
+ * Purpose:    Allocate space for a chunk in memory.  This routine allocates
+ *              memory space for non-filtered chunks from a block free list
+ *              and uses malloc()/free() for filtered chunks.
+ *
+ * Return:    Pointer to memory for chunk on success/NULL on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              April 22, 2004
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline)
+{
+    void *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(size);
+
+    if (pline && pline->nused)
+        ret_value = H5MM_malloc(size);
+    else
+        ret_value = H5FL_BLK_MALLOC(chunk, size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_mem_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_mem_xfree
+ *
+ * Purpose:    Free space for a chunk in memory.  This routine releases
+ *              memory space for non-filtered chunks from a block free list
+ *              and uses malloc()/free() for filtered chunks.
+ *
+ * Return:    NULL (never fails)
+ *
+ * Programmer:    Quincey Koziol
+ *              April 22, 2004
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_mem_xfree(void *chk, const void *_pline)
+{
+    const H5O_pline_t *pline = (const H5O_pline_t *)_pline;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (chk) {
+        if (pline && pline->nused)
+            H5MM_xfree(chk);
+        else
+            chk = H5FL_BLK_FREE(chunk, chk);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* H5D__chunk_mem_xfree() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_mem_realloc
+ *
+ * Purpose:     Reallocate space for a chunk in memory.  This routine allocates
+ *              memory space for non-filtered chunks from a block free list
+ *              and uses malloc()/free() for filtered chunks.
+ *
+ * Return:      Pointer to memory for chunk on success/NULL on failure
+ *
+ * Programmer:  Neil Fortner
+ *              May 3, 2010
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline)
+{
+    void *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(size);
+    HDassert(pline);
+
+    if (pline->nused > 0)
+        ret_value = H5MM_realloc(chk, size);
+    else
+        ret_value = H5FL_BLK_REALLOC(chunk, chk, size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_mem_realloc() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__free_chunk_info
+ PURPOSE
+    Internal routine to destroy a chunk info node
+ USAGE
+    void H5D__free_chunk_info(chunk_info)
+        void *chunk_info;    IN: Pointer to chunk info to destroy
+ RETURNS
+    No return value
+ DESCRIPTION
+    Releases all the memory for a chunk info node.  Called by H5SL_free
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5D__free_chunk_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *opdata)
+{
+    H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)item;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(chunk_info);
+
+    /* Close the chunk's file dataspace, if it's not shared */
+    if (!chunk_info->fspace_shared)
+        (void)H5S_close(chunk_info->fspace);
+    else
+        H5S_select_all(chunk_info->fspace, TRUE);
+
+    /* Close the chunk's memory dataspace, if it's not shared */
+    if (!chunk_info->mspace_shared && chunk_info->mspace)
+        (void)H5S_close(chunk_info->mspace);
+
+    /* Free the actual chunk info */
+    chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* H5D__free_chunk_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__create_chunk_map_single
+ *
+ * Purpose:    Create chunk selections when appending a single record
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *        Tuesday, November 20, 2007
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_map_single(H5D_chunk_map_t *fm, const H5D_io_info_t
+#ifndef H5_HAVE_PARALLEL
+                                                      H5_ATTR_UNUSED
+#endif /* H5_HAVE_PARALLEL */
+                                                          *io_info)
+{
+    H5D_chunk_info_t *chunk_info;                  /* Chunk information to insert into skip list */
+    hsize_t           coords[H5O_LAYOUT_NDIMS];    /* Coordinates of chunk */
+    hsize_t           sel_start[H5O_LAYOUT_NDIMS]; /* Offset of low bound of file selection */
+    hsize_t           sel_end[H5O_LAYOUT_NDIMS];   /* Offset of high bound of file selection */
+    unsigned          u;                           /* Local index variable */
+    herr_t            ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    /* Get coordinate for selection */
+    if (H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+    /* Initialize the 'single chunk' file & memory chunk information */
+    chunk_info               = fm->single_chunk_info;
+    chunk_info->chunk_points = 1;
+
+    /* Set chunk location & hyperslab size */
+    for (u = 0; u < fm->f_ndims; u++) {
+        /* Validate this chunk dimension */
+        if (fm->layout->u.chunk.dim[u] == 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+        HDassert(sel_start[u] == sel_end[u]);
+        chunk_info->scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
+        coords[u]             = chunk_info->scaled[u] * fm->layout->u.chunk.dim[u];
+    } /* end for */
+    chunk_info->scaled[fm->f_ndims] = 0;
+
+    /* Calculate the index of this chunk */
+    chunk_info->index =
+        H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, chunk_info->scaled);
+    chunk_info->coalesced = FALSE;
+
+    /* Copy selection for file's dataspace into chunk dataspace */
+    if (H5S_select_copy(fm->single_space, fm->file_space, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file selection")
+
+    /* Move selection back to have correct offset in chunk */
+    if (H5S_SELECT_ADJUST_U(fm->single_space, coords) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection")
+
+#ifdef H5_HAVE_PARALLEL
+    /* store chunk selection information */
+    if (io_info->using_mpi_vfd)
+        fm->select_chunk[chunk_info->index] = chunk_info;
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Set the file dataspace for the chunk to the shared 'single' dataspace */
+    chunk_info->fspace = fm->single_space;
+
+    /* Indicate that the chunk's file dataspace is shared */
+    chunk_info->fspace_shared = TRUE;
+
+    /* Just point at the memory dataspace & selection */
+    /* (Casting away const OK -QAK) */
+    chunk_info->mspace = (H5S_t *)fm->mem_space;
+
+    /* Indicate that the chunk's memory dataspace is shared */
+    chunk_info->mspace_shared = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_map_single() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__create_chunk_file_map_all
+ *
+ * Purpose:    Create all chunk selections in file, for an "all" selection.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *        Monday, January 21, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t
+#ifndef H5_HAVE_PARALLEL
+                                                        H5_ATTR_UNUSED
+#endif /* H5_HAVE_PARALLEL */
+                                                            *io_info)
+{
+    H5S_t * tmp_fchunk = NULL;       /* Temporary file dataspace */
+    hsize_t file_dims[H5S_MAX_RANK]; /* File dataspace dims */
+    hsize_t sel_points;              /* Number of elements in file selection */
+    hsize_t zeros[H5S_MAX_RANK];     /* All zero vector (for start parameter to setting hyperslab on partial
+                                        chunks) */
+    hsize_t  coords[H5S_MAX_RANK];   /* Current coordinates of chunk */
+    hsize_t  end[H5S_MAX_RANK];      /* Final coordinates of chunk */
+    hsize_t  scaled[H5S_MAX_RANK];   /* Scaled coordinates for this chunk */
+    hsize_t  chunk_index;            /* "Index" of chunk */
+    hsize_t  curr_partial_clip[H5S_MAX_RANK]; /* Current partial dimension sizes to clip against */
+    hsize_t  partial_dim_size[H5S_MAX_RANK];  /* Size of a partial dimension */
+    hbool_t  is_partial_dim[H5S_MAX_RANK];    /* Whether a dimension is currently a partial chunk */
+    unsigned num_partial_dims;                /* Current number of partial dimensions */
+    unsigned u;                               /* Local index variable */
+    herr_t   ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    /* Get number of elements selected in file */
+    sel_points = fm->nelmts;
+
+    /* Get dataspace dimensions */
+    if (H5S_get_simple_extent_dims(fm->file_space, file_dims, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+    /* Set initial chunk location, partial dimensions, etc */
+    num_partial_dims = 0;
+    HDmemset(zeros, 0, sizeof(zeros));
+    for (u = 0; u < fm->f_ndims; u++) {
+        /* Validate this chunk dimension */
+        if (fm->layout->u.chunk.dim[u] == 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+
+        /* Set up start / end coordinates for first chunk */
+        scaled[u] = 0;
+        coords[u] = 0;
+        end[u]    = fm->chunk_dim[u] - 1;
+
+        /* Iniitialize partial chunk dimension information */
+        partial_dim_size[u] = file_dims[u] % fm->chunk_dim[u];
+        if (file_dims[u] < fm->chunk_dim[u]) {
+            curr_partial_clip[u] = partial_dim_size[u];
+            is_partial_dim[u]    = TRUE;
+            num_partial_dims++;
+        } /* end if */
+        else {
+            curr_partial_clip[u] = fm->chunk_dim[u];
+            is_partial_dim[u]    = FALSE;
+        } /* end else */
+    }     /* end for */
+
+    /* Set the index of this chunk */
+    chunk_index = 0;
+
+    /* Create "temporary" chunk for selection operations (copy file space) */
+    if (NULL == (tmp_fchunk = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk")
+
+    /* Iterate through each chunk in the dataset */
+    while (sel_points) {
+        H5D_chunk_info_t *new_chunk_info; /* chunk information to insert into skip list */
+        hsize_t           chunk_points;   /* Number of elements in chunk selection */
+
+        /* Add temporary chunk to the list of chunks */
+
+        /* Allocate the file & memory chunk information */
+        if (NULL == (new_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk info")
+
+        /* Initialize the chunk information */
+
+        /* Set the chunk index */
+        new_chunk_info->index     = chunk_index;
+        new_chunk_info->coalesced = FALSE;
+
+#ifdef H5_HAVE_PARALLEL
+        /* Store chunk selection information, for multi-chunk I/O */
+        if (io_info->using_mpi_vfd)
+            fm->select_chunk[chunk_index] = new_chunk_info;
+#endif /* H5_HAVE_PARALLEL */
+
+        /* Set the file chunk dataspace */
+        if (NULL == (new_chunk_info->fspace = H5S_copy(tmp_fchunk, TRUE, FALSE)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy chunk dataspace")
+        new_chunk_info->fspace_shared = FALSE;
+
+        /* If there are partial dimensions for this chunk, set the hyperslab for them */
+        if (num_partial_dims > 0)
+            if (H5S_select_hyperslab(new_chunk_info->fspace, H5S_SELECT_SET, zeros, NULL, curr_partial_clip,
+                                     NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk selection")
+
+        /* Set the memory chunk dataspace */
+        new_chunk_info->mspace        = NULL;
+        new_chunk_info->mspace_shared = FALSE;
+
+        /* Copy the chunk's scaled coordinates */
+        H5MM_memcpy(new_chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
+        new_chunk_info->scaled[fm->f_ndims] = 0;
+
+        /* Insert the new chunk into the skip list */
+        if (H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
+            H5D__free_chunk_info(new_chunk_info, NULL, NULL);
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
+        } /* end if */
+
+        /* Get number of elements selected in chunk */
+        chunk_points = H5S_GET_SELECT_NPOINTS(new_chunk_info->fspace);
+        H5_CHECKED_ASSIGN(new_chunk_info->chunk_points, uint32_t, chunk_points, hsize_t);
+
+        /* Decrement # of points left in file selection */
+        sel_points -= chunk_points;
+
+        /* Advance to next chunk if we are not done */
+        if (sel_points > 0) {
+            int curr_dim; /* Current dimension to increment */
+
+            /* Increment chunk index */
+            chunk_index++;
+
+            /* Set current increment dimension */
+            curr_dim = (int)fm->f_ndims - 1;
+
+            /* Increment chunk location in fastest changing dimension */
+            coords[curr_dim] += fm->chunk_dim[curr_dim];
+            scaled[curr_dim]++;
+            end[curr_dim] += fm->chunk_dim[curr_dim];
+
+            /* Bring chunk location back into bounds, if necessary */
+            if (coords[curr_dim] >= file_dims[curr_dim]) {
+                do {
+                    /* Reset current dimension's location to 0 */
+                    coords[curr_dim] = 0;
+                    scaled[curr_dim] = 0;
+                    end[curr_dim]    = fm->chunk_dim[curr_dim] - 1;
+
+                    /* Check for previous partial chunk in this dimension */
+                    if (is_partial_dim[curr_dim] && end[curr_dim] < file_dims[curr_dim]) {
+                        /* Sanity check */
+                        HDassert(num_partial_dims > 0);
+
+                        /* Reset partial chunk information for this dimension */
+                        curr_partial_clip[curr_dim] = fm->chunk_dim[curr_dim];
+                        is_partial_dim[curr_dim]    = FALSE;
+                        num_partial_dims--;
+                    } /* end if */
+
+                    /* Decrement current dimension */
+                    curr_dim--;
+
+                    /* Check for valid current dim */
+                    if (curr_dim >= 0) {
+                        /* Increment chunk location in current dimension */
+                        coords[curr_dim] += fm->chunk_dim[curr_dim];
+                        scaled[curr_dim]++;
+                        end[curr_dim] = (coords[curr_dim] + fm->chunk_dim[curr_dim]) - 1;
+                    } /* end if */
+                } while (curr_dim >= 0 && (coords[curr_dim] >= file_dims[curr_dim]));
+            } /* end if */
+
+            /* Check for valid current dim */
+            if (curr_dim >= 0) {
+                /* Check for partial chunk in this dimension */
+                if (!is_partial_dim[curr_dim] && file_dims[curr_dim] <= end[curr_dim]) {
+                    /* Set partial chunk information for this dimension */
+                    curr_partial_clip[curr_dim] = partial_dim_size[curr_dim];
+                    is_partial_dim[curr_dim]    = TRUE;
+                    num_partial_dims++;
+
+                    /* Sanity check */
+                    HDassert(num_partial_dims <= fm->f_ndims);
+                } /* end if */
+            }     /* end if */
+        }         /* end if */
+    }             /* end while */
+
+done:
+    /* Clean up */
+    if (tmp_fchunk && H5S_close(tmp_fchunk) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release temporary dataspace")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_file_map_all() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__create_chunk_file_map_hyper
+ *
+ * Purpose:    Create all chunk selections in file, for a hyperslab selection.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *        Thursday, May 29, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
+#ifndef H5_HAVE_PARALLEL
+                                                          H5_ATTR_UNUSED
+#endif /* H5_HAVE_PARALLEL */
+                                                              *io_info)
+{
+    H5S_t *  tmp_fchunk = NULL;              /* Temporary file dataspace */
+    hsize_t  sel_start[H5O_LAYOUT_NDIMS];    /* Offset of low bound of file selection */
+    hsize_t  sel_end[H5O_LAYOUT_NDIMS];      /* Offset of high bound of file selection */
+    hsize_t  sel_points;                     /* Number of elements in file selection */
+    hsize_t  start_coords[H5O_LAYOUT_NDIMS]; /* Starting coordinates of selection */
+    hsize_t  coords[H5O_LAYOUT_NDIMS];       /* Current coordinates of chunk */
+    hsize_t  end[H5O_LAYOUT_NDIMS];          /* Final coordinates of chunk */
+    hsize_t  chunk_index;                    /* Index of chunk */
+    hsize_t  start_scaled[H5S_MAX_RANK];     /* Starting scaled coordinates of selection */
+    hsize_t  scaled[H5S_MAX_RANK];           /* Scaled coordinates for this chunk */
+    int      curr_dim;                       /* Current dimension to increment */
+    unsigned u;                              /* Local index variable */
+    herr_t   ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    /* Get number of elements selected in file */
+    sel_points = fm->nelmts;
+
+    /* Get bounding box for selection (to reduce the number of chunks to iterate over) */
+    if (H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+    /* Set initial chunk location & hyperslab size */
+    for (u = 0; u < fm->f_ndims; u++) {
+        /* Validate this chunk dimension */
+        if (fm->layout->u.chunk.dim[u] == 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+        scaled[u] = start_scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
+        coords[u] = start_coords[u] = scaled[u] * fm->layout->u.chunk.dim[u];
+        end[u]                      = (coords[u] + fm->chunk_dim[u]) - 1;
+    } /* end for */
+
+    /* Calculate the index of this chunk */
+    chunk_index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, scaled);
+
+    /* Iterate through each chunk in the dataset */
+    while (sel_points) {
+        /* Check for intersection of current chunk and file selection */
+        /* (Casting away const OK - QAK) */
+        if (TRUE == H5S_SELECT_INTERSECT_BLOCK(fm->file_space, coords, end)) {
+            H5D_chunk_info_t *new_chunk_info; /* chunk information to insert into skip list */
+            hsize_t           chunk_points;   /* Number of elements in chunk selection */
+
+            /* Create dataspace for chunk, 'AND'ing the overall selection with
+             *  the current chunk.
+             */
+            if (H5S_combine_hyperslab(fm->file_space, H5S_SELECT_AND, coords, NULL, fm->chunk_dim, NULL,
+                                      &tmp_fchunk) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL,
+                            "unable to combine file space selection with chunk block")
+
+            /* Resize chunk's dataspace dimensions to size of chunk */
+            if (H5S_set_extent_real(tmp_fchunk, fm->chunk_dim) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't adjust chunk dimensions")
+
+            /* Move selection back to have correct offset in chunk */
+            if (H5S_SELECT_ADJUST_U(tmp_fchunk, coords) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't adjust chunk selection")
+
+            /* Add temporary chunk to the list of chunks */
+
+            /* Allocate the file & memory chunk information */
+            if (NULL == (new_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk info")
+
+            /* Initialize the chunk information */
+
+            /* Set the chunk index */
+            new_chunk_info->index     = chunk_index;
+            new_chunk_info->coalesced = FALSE;
+
+#ifdef H5_HAVE_PARALLEL
+            /* Store chunk selection information, for multi-chunk I/O */
+            if (io_info->using_mpi_vfd)
+                fm->select_chunk[chunk_index] = new_chunk_info;
+#endif /* H5_HAVE_PARALLEL */
+
+            /* Set the file chunk dataspace */
+            new_chunk_info->fspace        = tmp_fchunk;
+            new_chunk_info->fspace_shared = FALSE;
+            tmp_fchunk                    = NULL;
+
+            /* Set the memory chunk dataspace */
+            new_chunk_info->mspace        = NULL;
+            new_chunk_info->mspace_shared = FALSE;
+
+            /* Copy the chunk's scaled coordinates */
+            H5MM_memcpy(new_chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
+            new_chunk_info->scaled[fm->f_ndims] = 0;
+
+            /* Insert the new chunk into the skip list */
+            if (H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
+                H5D__free_chunk_info(new_chunk_info, NULL, NULL);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
+            } /* end if */
+
+            /* Get number of elements selected in chunk */
+            chunk_points = H5S_GET_SELECT_NPOINTS(new_chunk_info->fspace);
+            H5_CHECKED_ASSIGN(new_chunk_info->chunk_points, uint32_t, chunk_points, hsize_t);
+
+            /* Decrement # of points left in file selection */
+            sel_points -= chunk_points;
+
+            /* Leave if we are done */
+            if (sel_points == 0)
+                HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Increment chunk index */
+        chunk_index++;
+
+        /* Set current increment dimension */
+        curr_dim = (int)fm->f_ndims - 1;
 
-    /* Get layout for dataset */
-    fm->layout = &(dataset->shared->layout);
-    fm->nelmts = nelmts;
+        /* Increment chunk location in fastest changing dimension */
+        coords[curr_dim] += fm->chunk_dim[curr_dim];
+        end[curr_dim] += fm->chunk_dim[curr_dim];
+        scaled[curr_dim]++;
 
-    /* Check if the memory space is scalar & make equivalent memory space */
-    if ((sm_ndims = H5S_GET_EXTENT_NDIMS(mem_space)) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get dimension number")
-    /* Set the number of dimensions for the memory dataspace */
-    H5_CHECKED_ASSIGN(fm->m_ndims, unsigned, sm_ndims, int);
+        /* Bring chunk location back into bounds, if necessary */
+        if (coords[curr_dim] > sel_end[curr_dim]) {
+            do {
+                /* Reset current dimension's location to 0 */
+                scaled[curr_dim] = start_scaled[curr_dim];
+                coords[curr_dim] =
+                    start_coords[curr_dim]; /*lint !e771 The start_coords will always be initialized */
+                end[curr_dim] = (coords[curr_dim] + fm->chunk_dim[curr_dim]) - 1;
 
-    /* Get rank for file dataspace */
-    fm->f_ndims = f_ndims = dataset->shared->layout.u.chunk.ndims - 1;
+                /* Decrement current dimension */
+                curr_dim--;
 
-    /* Normalize hyperslab selections by adjusting them by the offset */
-    /* (It might be worthwhile to normalize both the file and memory dataspaces
-     * before any (contiguous, chunked, etc) file I/O operation, in order to
-     * speed up hyperslab calculations by removing the extra checks and/or
-     * additions involving the offset and the hyperslab selection -QAK)
-     */
-    if ((file_space_normalized = H5S_hyper_normalize_offset((H5S_t *)file_space, old_offset)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to normalize selection")
+                /* Check for valid current dim */
+                if (curr_dim >= 0) {
+                    /* Increment chunk location in current dimension */
+                    scaled[curr_dim]++;
+                    coords[curr_dim] += fm->chunk_dim[curr_dim];
+                    end[curr_dim] = (coords[curr_dim] + fm->chunk_dim[curr_dim]) - 1;
+                } /* end if */
+            } while (curr_dim >= 0 && (coords[curr_dim] > sel_end[curr_dim]));
 
-    /* Decide the number of chunks in each dimension */
-    for (u = 0; u < f_ndims; u++)
-        /* Keep the size of the chunk dimensions as hsize_t for various routines */
-        fm->chunk_dim[u] = fm->layout->u.chunk.dim[u];
+            /* Re-calculate the index of this chunk */
+            chunk_index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, scaled);
+        } /* end if */
+    }     /* end while */
 
-#ifdef H5_HAVE_PARALLEL
-    /* Calculate total chunk in file map*/
-    fm->select_chunk = NULL;
-    if (io_info->using_mpi_vfd) {
-        H5_CHECK_OVERFLOW(fm->layout->u.chunk.nchunks, hsize_t, size_t);
-        if (fm->layout->u.chunk.nchunks)
-            if (NULL == (fm->select_chunk = (H5D_chunk_info_t **)H5MM_calloc(
-                             (size_t)fm->layout->u.chunk.nchunks * sizeof(H5D_chunk_info_t *))))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
-    }  /* end if */
-#endif /* H5_HAVE_PARALLEL */
+done:
+    /* Clean up on failure */
+    if (ret_value < 0)
+        if (tmp_fchunk && H5S_close(tmp_fchunk) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release temporary dataspace")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_file_map_hyper() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__create_chunk_mem_map_hyper
+ *
+ * Purpose:    Create all chunk selections in memory by copying the file
+ *              chunk selections and adjusting their offsets to be correct
+ *              for the memory.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *        Thursday, May 29, 2003
+ *
+ * Assumptions: That the file and memory selections are the same shape.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_mem_map_hyper(const H5D_chunk_map_t *fm)
+{
+    H5D_chunk_info_t *chunk_info;                   /* Pointer to chunk information */
+    H5SL_node_t *     curr_node;                    /* Current node in skip list */
+    hsize_t           file_sel_start[H5S_MAX_RANK]; /* Offset of low bound of file selection */
+    hsize_t           file_sel_end[H5S_MAX_RANK];   /* Offset of high bound of file selection */
+    hsize_t           mem_sel_start[H5S_MAX_RANK];  /* Offset of low bound of file selection */
+    hsize_t           mem_sel_end[H5S_MAX_RANK];    /* Offset of high bound of file selection */
+    hssize_t          adjust[H5S_MAX_RANK];         /* Adjustment to make to all file chunks */
+    unsigned          u;                            /* Local index variable */
+    herr_t            ret_value = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    /* Check for all I/O going to a single chunk */
+    if (H5SL_count(fm->sel_chunks) == 1) {
+        /* Get the node */
+        curr_node = H5SL_first(fm->sel_chunks);
+
+        /* Get pointer to chunk's information */
+        chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
+        HDassert(chunk_info);
+
+        /* Just point at the memory dataspace & selection */
+        /* (Casting away const OK -QAK) */
+        chunk_info->mspace = (H5S_t *)fm->mem_space;
+
+        /* Indicate that the chunk's memory space is shared */
+        chunk_info->mspace_shared = TRUE;
+    } /* end if */
+    else {
+        /* Get bounding box for file selection */
+        if (H5S_SELECT_BOUNDS(fm->file_space, file_sel_start, file_sel_end) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+        /* Get bounding box for memory selection */
+        if (H5S_SELECT_BOUNDS(fm->mem_space, mem_sel_start, mem_sel_end) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+        /* Calculate the adjustment for memory selection from file selection */
+        HDassert(fm->m_ndims == fm->f_ndims);
+        for (u = 0; u < fm->f_ndims; u++) {
+            H5_CHECK_OVERFLOW(file_sel_start[u], hsize_t, hssize_t);
+            H5_CHECK_OVERFLOW(mem_sel_start[u], hsize_t, hssize_t);
+            adjust[u] = (hssize_t)file_sel_start[u] - (hssize_t)mem_sel_start[u];
+        } /* end for */
+
+        /* Iterate over each chunk in the chunk list */
+        curr_node = H5SL_first(fm->sel_chunks);
+        while (curr_node) {
+            hsize_t      coords[H5S_MAX_RANK];       /* Current coordinates of chunk */
+            hssize_t     chunk_adjust[H5S_MAX_RANK]; /* Adjustment to make to a particular chunk */
+            H5S_sel_type chunk_sel_type;             /* Chunk's selection type */
+
+            /* Get pointer to chunk's information */
+            chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
+            HDassert(chunk_info);
+
+            /* Compute the chunk coordinates from the scaled coordinates */
+            for (u = 0; u < fm->f_ndims; u++)
+                coords[u] = chunk_info->scaled[u] * fm->layout->u.chunk.dim[u];
+
+            /* Copy the information */
+
+            /* Copy the memory dataspace */
+            if ((chunk_info->mspace = H5S_copy(fm->mem_space, TRUE, FALSE)) == NULL)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+
+            /* Get the chunk's selection type */
+            if ((chunk_sel_type = H5S_GET_SELECT_TYPE(chunk_info->fspace)) < H5S_SEL_NONE)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
+
+            /* Set memory selection for "all" chunk selections */
+            if (H5S_SEL_ALL == chunk_sel_type) {
+                /* Adjust the chunk coordinates */
+                for (u = 0; u < fm->f_ndims; u++)
+                    coords[u] = (hsize_t)((hssize_t)coords[u] - adjust[u]);
+
+                /* Set to same shape as chunk */
+                if (H5S_select_hyperslab(chunk_info->mspace, H5S_SELECT_SET, coords, NULL, fm->chunk_dim,
+                                         NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk memory selection")
+            } /* end if */
+            else {
+                /* Sanity check */
+                HDassert(H5S_SEL_HYPERSLABS == chunk_sel_type);
+
+                /* Copy the file chunk's selection */
+                if (H5S_SELECT_COPY(chunk_info->mspace, chunk_info->fspace, FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy selection")
+
+                /* Compute the adjustment for this chunk */
+                for (u = 0; u < fm->f_ndims; u++) {
+                    /* Compensate for the chunk offset */
+                    H5_CHECK_OVERFLOW(coords[u], hsize_t, hssize_t);
+                    chunk_adjust[u] = adjust[u] - (hssize_t)coords[u];
+                } /* end for */
+
+                /* Adjust the selection */
+                if (H5S_SELECT_ADJUST_S(chunk_info->mspace, chunk_adjust) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to adjust selection")
+            } /* end else */
+
+            /* Get the next chunk node in the skip list */
+            curr_node = H5SL_next(curr_node);
+        } /* end while */
+    }     /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_mem_map_hyper() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__create_mem_map_1d
+ *
+ * Purpose:    Create all chunk selections for 1-dimensional regular memory space
+ *          that has only one single block in the selection
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Vailin Choi
+ *                Sept 18, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_mem_map_1d(const H5D_chunk_map_t *fm)
+{
+    H5D_chunk_info_t *chunk_info;          /* Pointer to chunk information */
+    H5SL_node_t *     curr_node;           /* Current node in skip list */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    /* Check for all I/O going to a single chunk */
+    if (H5SL_count(fm->sel_chunks) == 1) {
+        /* Get the node */
+        curr_node = H5SL_first(fm->sel_chunks);
+
+        /* Get pointer to chunk's information */
+        chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
+        HDassert(chunk_info);
+
+        /* Just point at the memory dataspace & selection */
+        /* (Casting away const OK -QAK) */
+        chunk_info->mspace = (H5S_t *)fm->mem_space;
+
+        /* Indicate that the chunk's memory space is shared */
+        chunk_info->mspace_shared = TRUE;
+    } /* end if */
+    else {
+        hsize_t mem_sel_start[H5S_MAX_RANK]; /* Offset of low bound of file selection */
+        hsize_t mem_sel_end[H5S_MAX_RANK];   /* Offset of high bound of file selection */
+
+        HDassert(fm->m_ndims == 1);
+
+        if (H5S_SELECT_BOUNDS(fm->mem_space, mem_sel_start, mem_sel_end) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+        /* Iterate over each chunk in the chunk list */
+        curr_node = H5SL_first(fm->sel_chunks);
+        while (curr_node) {
+            hsize_t chunk_points; /* Number of elements in chunk selection */
+            hsize_t tmp_count = 1;
 
-    /* Initialize "last chunk" information */
-    fm->last_index      = (hsize_t)-1;
-    fm->last_chunk_info = NULL;
+            /* Get pointer to chunk's information */
+            chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
+            HDassert(chunk_info);
 
-    /* Point at the dataspaces */
-    fm->file_space = file_space;
-    fm->mem_space  = mem_space;
+            /* Copy the memory dataspace */
+            if ((chunk_info->mspace = H5S_copy(fm->mem_space, TRUE, FALSE)) == NULL)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
 
-    if (H5D__chunk_io_init_selections(io_info, type_info, fm) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file and memory chunk selections")
+            chunk_points = H5S_GET_SELECT_NPOINTS(chunk_info->fspace);
 
-done:
-    /* Reset the global dataspace info */
-    fm->file_space = NULL;
-    fm->mem_space  = NULL;
+            if (H5S_select_hyperslab(chunk_info->mspace, H5S_SELECT_SET, mem_sel_start, NULL, &tmp_count,
+                                     &chunk_points) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk memory selection")
 
-    if (file_space_normalized == TRUE)
-        if (H5S_hyper_denormalize_offset((H5S_t *)file_space, old_offset) <
-            0) /* (Casting away const OK -QAK) */
-            HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't denormalize selection")
+            mem_sel_start[0] += chunk_points;
+
+            /* Get the next chunk node in the skip list */
+            curr_node = H5SL_next(curr_node);
+        } /* end while */
+    }     /* end else */
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_io_init() */
+} /* end H5D__create_chunk_mem_map_1d() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_io_init_selections
+ * Function:    H5D__chunk_file_cb
  *
- * Purpose:        Initialize the chunk mappings
+ * Purpose:    Callback routine for file selection iterator.  Used when
+ *              creating selections in file for each point selected.
  *
- * Return:        Non-negative on success/Negative on failure
+ * Return:    Non-negative on success/Negative on failure
  *
  * Programmer:    Quincey Koziol
- *              Thursday, March 20, 2008
+ *        Wednesday, July 23, 2003
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_io_init_selections(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-                              H5D_chunk_map_t *fm)
+H5D__chunk_file_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type, unsigned ndims,
+                   const hsize_t *coords, void *_udata)
 {
-    const H5D_t *dataset    = io_info->dset;       /* Local pointer to dataset info */
-    const H5T_t *mem_type   = type_info->mem_type; /* Local pointer to memory datatype */
-    H5S_t *      tmp_mspace = NULL;                /* Temporary memory dataspace */
-    H5T_t *      file_type  = NULL;                /* Temporary copy of file datatype for iteration */
-    hbool_t      iter_init  = FALSE;               /* Selection iteration info has been initialized */
-    char         bogus;                            /* "bogus" buffer to pass to selection iterator */
-    herr_t       ret_value = SUCCEED;              /* Return value        */
+    H5D_chunk_file_iter_ud_t *udata = (H5D_chunk_file_iter_ud_t *)_udata; /* User data for operation */
+    H5D_chunk_map_t *         fm    = udata->fm;                 /* File<->memory chunk mapping info */
+    H5D_chunk_info_t *        chunk_info;                        /* Chunk information for current chunk */
+    hsize_t                   coords_in_chunk[H5O_LAYOUT_NDIMS]; /* Coordinates of element in chunk */
+    hsize_t                   chunk_index;                       /* Chunk index */
+    hsize_t                   scaled[H5S_MAX_RANK];              /* Scaled coordinates for this chunk */
+    unsigned                  u;                                 /* Local index variable */
+    herr_t                    ret_value = SUCCEED;               /* Return value        */
 
     FUNC_ENTER_STATIC
 
-    /* Special case for only one element in selection */
-    /* (usually appending a record) */
-    if (fm->nelmts == 1
-#ifdef H5_HAVE_PARALLEL
-        && !(io_info->using_mpi_vfd)
-#endif /* H5_HAVE_PARALLEL */
-        && H5S_SEL_ALL != H5S_GET_SELECT_TYPE(fm->file_space)) {
-        /* Initialize skip list for chunk selections */
-        fm->sel_chunks = NULL;
-        fm->use_single = TRUE;
+    /* Calculate the index of this chunk */
+    chunk_index = H5VM_chunk_index_scaled(ndims, coords, fm->layout->u.chunk.dim,
+                                          fm->layout->u.chunk.down_chunks, scaled);
 
-        /* Initialize single chunk dataspace */
-        if (NULL == dataset->shared->cache.chunk.single_space) {
-            /* Make a copy of the dataspace for the dataset */
-            if ((dataset->shared->cache.chunk.single_space = H5S_copy(fm->file_space, TRUE, FALSE)) == NULL)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
+    /* Find correct chunk in file & memory skip list */
+    if (chunk_index == fm->last_index) {
+        /* If the chunk index is the same as the last chunk index we used,
+         * get the cached info to operate on.
+         */
+        chunk_info = fm->last_chunk_info;
+    } /* end if */
+    else {
+        /* If the chunk index is not the same as the last chunk index we used,
+         * find the chunk in the skip list.
+         */
+        /* Get the chunk node from the skip list */
+        if (NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_index))) {
+            H5S_t *fspace; /* Memory chunk's dataspace */
 
-            /* Resize chunk's dataspace dimensions to size of chunk */
-            if (H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
+            /* Allocate the file & memory chunk information */
+            if (NULL == (chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
 
-            /* Set the single chunk dataspace to 'all' selection */
-            if (H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
-        } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
-        HDassert(fm->single_space);
+            /* Initialize the chunk information */
 
-        /* Allocate the single chunk information */
-        if (NULL == dataset->shared->cache.chunk.single_chunk_info)
-            if (NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
-        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
-        HDassert(fm->single_chunk_info);
+            /* Set the chunk index */
+            chunk_info->index     = chunk_index;
+            chunk_info->coalesced = FALSE;
 
-        /* Reset chunk template information */
-        fm->mchunk_tmpl = NULL;
+            /* Create a dataspace for the chunk */
+            if ((fspace = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)) == NULL) {
+                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk")
+            } /* end if */
 
-        /* Set up chunk mapping for single element */
-        if (H5D__create_chunk_map_single(fm, io_info) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                        "unable to create chunk selections for single element")
-    } /* end if */
-    else {
-        hbool_t sel_hyper_flag; /* Whether file selection is a hyperslab */
+            /* De-select the chunk space */
+            if (H5S_select_none(fspace) < 0) {
+                (void)H5S_close(fspace);
+                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select dataspace")
+            } /* end if */
 
-        /* Initialize skip list for chunk selections */
-        if (NULL == dataset->shared->cache.chunk.sel_chunks)
-            if (NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
-        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
-        HDassert(fm->sel_chunks);
+            /* Set the file chunk dataspace */
+            chunk_info->fspace        = fspace;
+            chunk_info->fspace_shared = FALSE;
 
-        /* We are not using single element mode */
-        fm->use_single = FALSE;
+            /* Set the memory chunk dataspace */
+            chunk_info->mspace        = NULL;
+            chunk_info->mspace_shared = FALSE;
 
-        /* Get type of selection on disk & in memory */
-        if ((fm->fsel_type = H5S_GET_SELECT_TYPE(fm->file_space)) < H5S_SEL_NONE)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
-        if ((fm->msel_type = H5S_GET_SELECT_TYPE(fm->mem_space)) < H5S_SEL_NONE)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
+            /* Set the number of selected elements in chunk to zero */
+            chunk_info->chunk_points = 0;
 
-        /* If the selection is NONE or POINTS, set the flag to FALSE */
-        if (fm->fsel_type == H5S_SEL_POINTS || fm->fsel_type == H5S_SEL_NONE)
-            sel_hyper_flag = FALSE;
-        else
-            sel_hyper_flag = TRUE;
+            /* Set the chunk's scaled coordinates */
+            H5MM_memcpy(chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
+            chunk_info->scaled[fm->f_ndims] = 0;
+            H5MM_memcpy(chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
 
-        /* Check if file selection is a not a hyperslab selection */
-        if (sel_hyper_flag) {
-            /* Build the file selection for each chunk */
-            if (H5S_SEL_ALL == fm->fsel_type) {
-                if (H5D__create_chunk_file_map_all(fm, io_info) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
+            /* Insert the new chunk into the skip list */
+            if (H5SL_insert(fm->sel_chunks, chunk_info, &chunk_info->index) < 0) {
+                H5D__free_chunk_info(chunk_info, NULL, NULL);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
             } /* end if */
-            else {
-                /* Sanity check */
-                HDassert(fm->fsel_type == H5S_SEL_HYPERSLABS);
-
-                if (H5D__create_chunk_file_map_hyper(fm, io_info) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
-            } /* end else */
         }     /* end if */
-        else {
-            H5S_sel_iter_op_t        iter_op; /* Operator for iteration */
-            H5D_chunk_file_iter_ud_t udata;   /* User data for iteration */
-
-            /* Create temporary datatypes for selection iteration */
-            if (NULL == (file_type = H5T_copy(dataset->shared->type, H5T_COPY_ALL)))
-                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy file datatype")
 
-            /* Initialize the user data */
-            udata.fm = fm;
 #ifdef H5_HAVE_PARALLEL
-            udata.io_info = io_info;
+        /* Store chunk selection information, for collective multi-chunk I/O */
+        if (udata->io_info->using_mpi_vfd)
+            fm->select_chunk[chunk_index] = chunk_info;
 #endif /* H5_HAVE_PARALLEL */
 
-            iter_op.op_type  = H5S_SEL_ITER_OP_LIB;
-            iter_op.u.lib_op = H5D__chunk_file_cb;
-
-            /* Spaces might not be the same shape, iterate over the file selection directly */
-            if (H5S_select_iterate(&bogus, file_type, fm->file_space, &iter_op, &udata) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
-
-            /* Reset "last chunk" info */
-            fm->last_index      = (hsize_t)-1;
-            fm->last_chunk_info = NULL;
-        } /* end else */
-
-        /* Build the memory selection for each chunk */
-        if (sel_hyper_flag && H5S_SELECT_SHAPE_SAME(fm->file_space, fm->mem_space) == TRUE) {
-            /* Reset chunk template information */
-            fm->mchunk_tmpl = NULL;
-
-            /* If the selections are the same shape, use the file chunk information
-             * to generate the memory chunk information quickly.
-             */
-            if (H5D__create_chunk_mem_map_hyper(fm) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create memory chunk selections")
-        } /* end if */
-        else if (sel_hyper_flag && fm->f_ndims == 1 && fm->m_ndims == 1 &&
-                 H5S_SELECT_IS_REGULAR(fm->mem_space) && H5S_SELECT_IS_SINGLE(fm->mem_space)) {
-            if (H5D__create_chunk_mem_map_1d(fm) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
-        } /* end else-if */
-        else {
-            H5S_sel_iter_op_t iter_op;   /* Operator for iteration */
-            size_t            elmt_size; /* Memory datatype size */
-
-            /* Make a copy of equivalent memory space */
-            if ((tmp_mspace = H5S_copy(fm->mem_space, TRUE, FALSE)) == NULL)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
-
-            /* De-select the mem space copy */
-            if (H5S_select_none(tmp_mspace) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select memory space")
-
-            /* Save chunk template information */
-            fm->mchunk_tmpl = tmp_mspace;
-
-            /* Create temporary datatypes for selection iteration */
-            if (!file_type)
-                if (NULL == (file_type = H5T_copy(dataset->shared->type, H5T_COPY_ALL)))
-                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy file datatype")
-
-            /* Create selection iterator for memory selection */
-            if (0 == (elmt_size = H5T_get_size(mem_type)))
-                HGOTO_ERROR(H5E_DATATYPE, H5E_BADSIZE, FAIL, "datatype size invalid")
-            if (H5S_select_iter_init(&(fm->mem_iter), fm->mem_space, elmt_size, 0) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
-            iter_init = TRUE; /* Selection iteration info has been initialized */
-
-            iter_op.op_type  = H5S_SEL_ITER_OP_LIB;
-            iter_op.u.lib_op = H5D__chunk_mem_cb;
+        /* Update the "last chunk seen" information */
+        fm->last_index      = chunk_index;
+        fm->last_chunk_info = chunk_info;
+    } /* end else */
 
-            /* Spaces aren't the same shape, iterate over the memory selection directly */
-            if (H5S_select_iterate(&bogus, file_type, fm->file_space, &iter_op, fm) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create memory chunk selections")
-        } /* end else */
-    }     /* end else */
+    /* Get the offset of the element within the chunk */
+    for (u = 0; u < fm->f_ndims; u++)
+        coords_in_chunk[u] = coords[u] - (scaled[u] * fm->layout->u.chunk.dim[u]);
 
-done:
-    /* Release the [potentially partially built] chunk mapping information if an error occurs */
-    if (ret_value < 0) {
-        if (tmp_mspace && !fm->mchunk_tmpl)
-            if (H5S_close(tmp_mspace) < 0)
-                HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL,
-                            "can't release memory chunk dataspace template")
-        if (H5D__chunk_io_term(fm) < 0)
-            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release chunk mapping")
-    } /* end if */
+    /* Add point to file selection for chunk */
+    if (H5S_select_elements(chunk_info->fspace, H5S_SELECT_APPEND, (size_t)1, coords_in_chunk) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "unable to select element")
 
-    if (iter_init && H5S_SELECT_ITER_RELEASE(&(fm->mem_iter)) < 0)
-        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
-    if (file_type && (H5T_close_real(file_type) < 0))
-        HDONE_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "Can't free temporary datatype")
+    /* Increment the number of elemented selected in chunk */
+    chunk_info->chunk_points++;
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_io_init_selections() */
+} /* end H5D__chunk_file_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_mem_alloc
+ * Function:    H5D__chunk_mem_cb
  *
- * Purpose:    Allocate space for a chunk in memory.  This routine allocates
- *              memory space for non-filtered chunks from a block free list
- *              and uses malloc()/free() for filtered chunks.
+ * Purpose:    Callback routine for file selection iterator.  Used when
+ *              creating selections in memory for each chunk.
  *
- * Return:    Pointer to memory for chunk on success/NULL on failure
+ * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *              April 22, 2004
+ * Programmer:    Raymond Lu
+ *        Thursday, April 10, 2003
  *
  *-------------------------------------------------------------------------
  */
-static void *
-H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline)
+static herr_t
+H5D__chunk_mem_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type, unsigned ndims,
+                  const hsize_t *coords, void *_fm)
 {
-    void *ret_value = NULL; /* Return value */
+    H5D_chunk_map_t * fm = (H5D_chunk_map_t *)_fm; /* File<->memory chunk mapping info */
+    H5D_chunk_info_t *chunk_info;                  /* Chunk information for current chunk */
+    hsize_t           coords_in_mem[H5S_MAX_RANK]; /* Coordinates of element in memory */
+    hsize_t           chunk_index;                 /* Chunk index */
+    herr_t            ret_value = SUCCEED;         /* Return value        */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
 
-    HDassert(size);
+    /* Calculate the index of this chunk */
+    chunk_index = H5VM_chunk_index(ndims, coords, fm->layout->u.chunk.dim, fm->layout->u.chunk.down_chunks);
 
-    if (pline && pline->nused)
-        ret_value = H5MM_malloc(size);
-    else
-        ret_value = H5FL_BLK_MALLOC(chunk, size);
+    /* Find correct chunk in file & memory skip list */
+    if (chunk_index == fm->last_index) {
+        /* If the chunk index is the same as the last chunk index we used,
+         * get the cached spaces to operate on.
+         */
+        chunk_info = fm->last_chunk_info;
+    } /* end if */
+    else {
+        /* If the chunk index is not the same as the last chunk index we used,
+         * find the chunk in the skip list.
+         */
+        /* Get the chunk node from the skip list */
+        if (NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_index)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_NOTFOUND, H5_ITER_ERROR, "can't locate chunk in skip list")
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_mem_alloc() */
+        /* Check if the chunk already has a memory space */
+        if (NULL == chunk_info->mspace)
+            /* Copy the template memory chunk dataspace */
+            if (NULL == (chunk_info->mspace = H5S_copy(fm->mchunk_tmpl, FALSE, FALSE)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy file space")
 
-/*-------------------------------------------------------------------------
- * Function:    H5D__chunk_mem_xfree
- *
- * Purpose:    Free space for a chunk in memory.  This routine releases
- *              memory space for non-filtered chunks from a block free list
- *              and uses malloc()/free() for filtered chunks.
- *
- * Return:    NULL (never fails)
- *
- * Programmer:    Quincey Koziol
- *              April 22, 2004
- *
- *-------------------------------------------------------------------------
- */
-static void *
-H5D__chunk_mem_xfree(void *chk, const void *_pline)
-{
-    const H5O_pline_t *pline = (const H5O_pline_t *)_pline;
+        /* Update the "last chunk seen" information */
+        fm->last_index      = chunk_index;
+        fm->last_chunk_info = chunk_info;
+    } /* end else */
 
-    FUNC_ENTER_STATIC_NOERR
+    /* Get coordinates of selection iterator for memory */
+    if (H5S_SELECT_ITER_COORDS(&fm->mem_iter, coords_in_mem) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, H5_ITER_ERROR, "unable to get iterator coordinates")
 
-    if (chk) {
-        if (pline && pline->nused)
-            H5MM_xfree(chk);
-        else
-            chk = H5FL_BLK_FREE(chunk, chk);
+    /* Add point to memory selection for chunk */
+    if (fm->msel_type == H5S_SEL_POINTS) {
+        if (H5S_select_elements(chunk_info->mspace, H5S_SELECT_APPEND, (size_t)1, coords_in_mem) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, H5_ITER_ERROR, "unable to select element")
     } /* end if */
+    else {
+        if (H5S_hyper_add_span_element(chunk_info->mspace, fm->m_ndims, coords_in_mem) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, H5_ITER_ERROR, "unable to select element")
+    } /* end else */
 
-    FUNC_LEAVE_NOAPI(NULL)
-} /* H5D__chunk_mem_xfree() */
+    /* Move memory selection iterator to next element in selection */
+    if (H5S_SELECT_ITER_NEXT(&fm->mem_iter, (size_t)1) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTNEXT, H5_ITER_ERROR, "unable to move to next iterator location")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_mem_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_mem_realloc
+ * Function:    H5D__chunk_cacheable
  *
- * Purpose:     Reallocate space for a chunk in memory.  This routine allocates
- *              memory space for non-filtered chunks from a block free list
- *              and uses malloc()/free() for filtered chunks.
+ * Purpose:    A small internal function to if it's possible to load the
+ *              chunk into cache.
  *
- * Return:      Pointer to memory for chunk on success/NULL on failure
+ * Return:    TRUE or FALSE
  *
- * Programmer:  Neil Fortner
- *              May 3, 2010
+ * Programmer:    Raymond Lu
+ *        17 July 2007
  *
  *-------------------------------------------------------------------------
  */
-static void *
-H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline)
+htri_t
+H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op)
 {
-    void *ret_value = NULL; /* Return value */
-
-    FUNC_ENTER_STATIC_NOERR
-
-    HDassert(size);
-    HDassert(pline);
-
-    if (pline->nused > 0)
-        ret_value = H5MM_realloc(chk, size);
-    else
-        ret_value = H5FL_BLK_REALLOC(chunk, chk, size);
-
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_mem_realloc() */
+    const H5D_t *dataset     = io_info->dset; /* Local pointer to dataset info */
+    hbool_t      has_filters = FALSE;         /* Whether there are filters on the chunk or not */
+    htri_t       ret_value   = FAIL;          /* Return value */
 
-/*--------------------------------------------------------------------------
- NAME
-    H5D__free_chunk_info
- PURPOSE
-    Internal routine to destroy a chunk info node
- USAGE
-    void H5D__free_chunk_info(chunk_info)
-        void *chunk_info;    IN: Pointer to chunk info to destroy
- RETURNS
-    No return value
- DESCRIPTION
-    Releases all the memory for a chunk info node.  Called by H5SL_free
- GLOBAL VARIABLES
- COMMENTS, BUGS, ASSUMPTIONS
- EXAMPLES
- REVISION LOG
---------------------------------------------------------------------------*/
-static herr_t
-H5D__free_chunk_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *opdata)
-{
-    H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)item;
+    FUNC_ENTER_PACKAGE
 
-    FUNC_ENTER_STATIC_NOERR
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(dataset);
 
-    HDassert(chunk_info);
+    /* Must bring the whole chunk in if there are any filters on the chunk.
+     * Make sure to check if filters are on the dataset but disabled for the
+     * chunk because it is a partial edge chunk. */
+    if (dataset->shared->dcpl_cache.pline.nused > 0) {
+        if (dataset->shared->layout.u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) {
+            has_filters = !H5D__chunk_is_partial_edge_chunk(
+                io_info->dset->shared->ndims, io_info->dset->shared->layout.u.chunk.dim,
+                io_info->store->chunk.scaled, io_info->dset->shared->curr_dims);
+        } /* end if */
+        else
+            has_filters = TRUE;
+    } /* end if */
 
-    /* Close the chunk's file dataspace, if it's not shared */
-    if (!chunk_info->fspace_shared)
-        (void)H5S_close(chunk_info->fspace);
-    else
-        H5S_select_all(chunk_info->fspace, TRUE);
+    if (has_filters)
+        ret_value = TRUE;
+    else {
+#ifdef H5_HAVE_PARALLEL
+        /* If MPI based VFD is used and the file is opened for write access, must
+         *         bypass the chunk-cache scheme because other MPI processes could
+         *         be writing to other elements in the same chunk.  Do a direct
+         *         write-through of only the elements requested.
+         */
+        if (io_info->using_mpi_vfd && (H5F_ACC_RDWR & H5F_INTENT(dataset->oloc.file)))
+            ret_value = FALSE;
+        else {
+#endif /* H5_HAVE_PARALLEL */
+            /* If the chunk is too large to keep in the cache and if we don't
+             * need to write the fill value, then don't load the chunk into the
+             * cache, just write the data to it directly.
+             */
+            H5_CHECK_OVERFLOW(dataset->shared->layout.u.chunk.size, uint32_t, size_t);
+            if ((size_t)dataset->shared->layout.u.chunk.size > dataset->shared->cache.chunk.nbytes_max) {
+                if (write_op && !H5F_addr_defined(caddr)) {
+                    const H5O_fill_t *fill = &(dataset->shared->dcpl_cache.fill); /* Fill value info */
+                    H5D_fill_value_t  fill_status;                                /* Fill value status */
 
-    /* Close the chunk's memory dataspace, if it's not shared */
-    if (!chunk_info->mspace_shared && chunk_info->mspace)
-        (void)H5S_close(chunk_info->mspace);
+                    /* Revtrieve the fill value status */
+                    if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
+                        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
 
-    /* Free the actual chunk info */
-    chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+                    /* If the fill value needs to be written then we will need
+                     * to use the cache to write the fill value */
+                    if (fill->fill_time == H5D_FILL_TIME_ALLOC ||
+                        (fill->fill_time == H5D_FILL_TIME_IFSET &&
+                         (fill_status == H5D_FILL_VALUE_USER_DEFINED ||
+                          fill_status == H5D_FILL_VALUE_DEFAULT)))
+                        ret_value = TRUE;
+                    else
+                        ret_value = FALSE;
+                }
+                else
+                    ret_value = FALSE;
+            }
+            else
+                ret_value = TRUE;
+#ifdef H5_HAVE_PARALLEL
+        } /* end else */
+#endif    /* H5_HAVE_PARALLEL */
+    } /* end else */
 
-    FUNC_LEAVE_NOAPI(0)
-} /* H5D__free_chunk_info() */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cacheable() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__create_chunk_map_single
+ * Function:    H5D__chunk_read
  *
- * Purpose:    Create chunk selections when appending a single record
+ * Purpose:    Read from a chunked dataset.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *        Tuesday, November 20, 2007
+ * Programmer:    Raymond Lu
+ *        Thursday, April 10, 2003
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__create_chunk_map_single(H5D_chunk_map_t *fm, const H5D_io_info_t
-#ifndef H5_HAVE_PARALLEL
-                                                      H5_ATTR_UNUSED
-#endif /* H5_HAVE_PARALLEL */
-                                                          *io_info)
+H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t H5_ATTR_UNUSED nelmts,
+                const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
+                H5D_chunk_map_t *fm)
 {
-    H5D_chunk_info_t *chunk_info;                  /* Chunk information to insert into skip list */
-    hsize_t           coords[H5O_LAYOUT_NDIMS];    /* Coordinates of chunk */
-    hsize_t           sel_start[H5O_LAYOUT_NDIMS]; /* Offset of low bound of file selection */
-    hsize_t           sel_end[H5O_LAYOUT_NDIMS];   /* Offset of high bound of file selection */
-    unsigned          u;                           /* Local index variable */
-    herr_t            ret_value = SUCCEED;         /* Return value */
+    H5SL_node_t *   chunk_node;                  /* Current node in chunk skip list */
+    H5D_io_info_t   nonexistent_io_info;         /* "nonexistent" I/O info object */
+    H5D_io_info_t   ctg_io_info;                 /* Contiguous I/O info object */
+    H5D_storage_t   ctg_store;                   /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t   cpt_io_info;                 /* Compact I/O info object */
+    H5D_storage_t   cpt_store;                   /* Chunk storage information as compact dataset */
+    hbool_t         cpt_dirty;                   /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t        src_accessed_bytes  = 0;     /* Total accessed size in a chunk */
+    hbool_t         skip_missing_chunks = FALSE; /* Whether to skip missing chunks */
+    H5D_chunk_ud_t *found_udata         = NULL;  /* Chunks already looked up, in skip list order */
+    size_t          chunk_num           = 0;     /* Position of the current chunk in the skip list */
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    htri_t       decode_ahead = FALSE; /* Whether chunks are decoded in batches on filter threads */
+    unsigned     nthreads     = 0;     /* Number of filter threads */
+    H5SL_node_t *batch_end    = NULL;  /* First chunk past the current batch */
+#endif                                 /* H5D_CHUNK_CONCURRENT_FILTERS */
+    herr_t ret_value = SUCCEED;        /*return value        */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
-    HDassert(fm->f_ndims > 0);
+    HDassert(io_info);
+    HDassert(io_info->u.rbuf);
+    HDassert(type_info);
+    HDassert(fm);
 
-    /* Get coordinate for selection */
-    if (H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+    /* Set up "nonexistent" I/O info object */
+    H5MM_memcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
+    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
 
-    /* Initialize the 'single chunk' file & memory chunk information */
-    chunk_info               = fm->single_chunk_info;
-    chunk_info->chunk_points = 1;
+    /* Set up contiguous I/O info object */
+    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
+    ctg_io_info.store      = &ctg_store;
+    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
 
-    /* Set chunk location & hyperslab size */
-    for (u = 0; u < fm->f_ndims; u++) {
-        /* Validate this chunk dimension */
-        if (fm->layout->u.chunk.dim[u] == 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
-        HDassert(sel_start[u] == sel_end[u]);
-        chunk_info->scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
-        coords[u]             = chunk_info->scaled[u] * fm->layout->u.chunk.dim[u];
-    } /* end for */
-    chunk_info->scaled[fm->f_ndims] = 0;
+    /* Initialize temporary contiguous storage info */
+    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size,
+                      uint32_t);
 
-    /* Calculate the index of this chunk */
-    chunk_info->index =
-        H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, chunk_info->scaled);
+    /* Set up compact I/O info object */
+    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
+    cpt_io_info.store      = &cpt_store;
+    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
 
-    /* Copy selection for file's dataspace into chunk dataspace */
-    if (H5S_select_copy(fm->single_space, fm->file_space, FALSE) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file selection")
+    /* Initialize temporary compact storage info */
+    cpt_store.compact.dirty = &cpt_dirty;
 
-    /* Move selection back to have correct offset in chunk */
-    if (H5S_SELECT_ADJUST_U(fm->single_space, coords) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection")
+    {
+        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill); /* Fill value info */
+        H5D_fill_value_t  fill_status;                                      /* Fill value status */
 
-#ifdef H5_HAVE_PARALLEL
-    /* store chunk selection information */
-    if (io_info->using_mpi_vfd)
-        fm->select_chunk[chunk_info->index] = chunk_info;
-#endif /* H5_HAVE_PARALLEL */
+        /* Check the fill value status */
+        if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
 
-    /* Set the file dataspace for the chunk to the shared 'single' dataspace */
-    chunk_info->fspace = fm->single_space;
+        /* If we are never to return fill values, or if we would return them
+         * but they aren't set, set the flag to skip missing chunks.
+         */
+        if (fill->fill_time == H5D_FILL_TIME_NEVER ||
+            (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED &&
+             fill_status != H5D_FILL_VALUE_DEFAULT))
+            skip_missing_chunks = TRUE;
+    }
 
-    /* Indicate that the chunk's file dataspace is shared */
-    chunk_info->fspace_shared = TRUE;
+    /* Read the chunks that aren't in the chunk cache in file order, merging
+     * neighboring chunks into larger reads
+     */
+    if (H5D__chunk_read_coalesced(io_info, type_info, fm, &cpt_io_info, &found_udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunks")
 
-    /* Just point at the memory dataspace & selection */
-    /* (Casting away const OK -QAK) */
-    chunk_info->mspace = (H5S_t *)fm->mem_space;
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
 
-    /* Indicate that the chunk's memory dataspace is shared */
-    chunk_info->mspace_shared = TRUE;
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    /* Check if several filtered chunks can be decoded at once */
+    if (!fm->use_single && H5SL_count(fm->sel_chunks) > 1) {
+        if ((decode_ahead = H5D__chunk_filter_concurrent(io_info->dset, &nthreads)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered concurrently")
+        batch_end = chunk_node;
+    } /* end if */
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__create_chunk_map_single() */
+    while (chunk_node) {
+        H5D_chunk_info_t *chunk_info; /* Chunk information */
+        H5D_chunk_ud_t    udata;      /* Chunk index pass-through    */
 
-/*-------------------------------------------------------------------------
- * Function:    H5D__create_chunk_file_map_all
- *
- * Purpose:    Create all chunk selections in file, for an "all" selection.
- *
- * Return:    Non-negative on success/Negative on failure
- *
- * Programmer:    Quincey Koziol
- *        Monday, January 21, 2019
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t
-#ifndef H5_HAVE_PARALLEL
-                                                        H5_ATTR_UNUSED
-#endif /* H5_HAVE_PARALLEL */
-                                                            *io_info)
-{
-    H5S_t * tmp_fchunk = NULL;       /* Temporary file dataspace */
-    hsize_t file_dims[H5S_MAX_RANK]; /* File dataspace dims */
-    hsize_t sel_points;              /* Number of elements in file selection */
-    hsize_t zeros[H5S_MAX_RANK];     /* All zero vector (for start parameter to setting hyperslab on partial
-                                        chunks) */
-    hsize_t  coords[H5S_MAX_RANK];   /* Current coordinates of chunk */
-    hsize_t  end[H5S_MAX_RANK];      /* Final coordinates of chunk */
-    hsize_t  scaled[H5S_MAX_RANK];   /* Scaled coordinates for this chunk */
-    hsize_t  chunk_index;            /* "Index" of chunk */
-    hsize_t  curr_partial_clip[H5S_MAX_RANK]; /* Current partial dimension sizes to clip against */
-    hsize_t  partial_dim_size[H5S_MAX_RANK];  /* Size of a partial dimension */
-    hbool_t  is_partial_dim[H5S_MAX_RANK];    /* Whether a dimension is currently a partial chunk */
-    unsigned num_partial_dims;                /* Current number of partial dimensions */
-    unsigned u;                               /* Local index variable */
-    herr_t   ret_value = SUCCEED;             /* Return value */
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+        /* Read and decode the next batch of chunks on the filter threads */
+        if (decode_ahead && chunk_node == batch_end)
+            if (H5D__chunk_decode_ahead(io_info, type_info, fm, chunk_node, nthreads, FALSE, &batch_end) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to decode raw data chunks")
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
 
-    FUNC_ENTER_STATIC
+        /* Get the actual chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
-    /* Sanity check */
-    HDassert(fm->f_ndims > 0);
+        /* Skip chunks that have been read already */
+        if (chunk_info->coalesced) {
+            chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+            chunk_num++;
+            continue;
+        } /* end if */
 
-    /* Get number of elements selected in file */
-    sel_points = fm->nelmts;
+        /* Get the info for the chunk in the file. A chunk that was not in the
+         * cache when it was looked up can't have entered it since, but one
+         * that was may have been evicted by the chunks read before it.
+         */
+        if (found_udata && UINT_MAX == found_udata[chunk_num].idx_hint)
+            udata = found_udata[chunk_num];
+        else if (H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
-    /* Get dataspace dimensions */
-    if (H5S_get_simple_extent_dims(fm->file_space, file_dims, NULL) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+        /* Sanity check */
+        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
+                 (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
 
-    /* Set initial chunk location, partial dimensions, etc */
-    num_partial_dims = 0;
-    HDmemset(zeros, 0, sizeof(zeros));
-    for (u = 0; u < fm->f_ndims; u++) {
-        /* Validate this chunk dimension */
-        if (fm->layout->u.chunk.dim[u] == 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+        /* Check for non-existant chunk & skip it if appropriate */
+        if (H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint ||
+            !skip_missing_chunks) {
+            H5D_io_info_t *chk_io_info;  /* Pointer to I/O info object for this chunk */
+            void *         chunk = NULL; /* Pointer to locked chunk buffer */
+            htri_t         cacheable;    /* Whether the chunk is cacheable */
 
-        /* Set up start / end coordinates for first chunk */
-        scaled[u] = 0;
-        coords[u] = 0;
-        end[u]    = fm->chunk_dim[u] - 1;
+            /* Set chunk's [scaled] coordinates */
+            io_info->store->chunk.scaled = chunk_info->scaled;
 
-        /* Iniitialize partial chunk dimension information */
-        partial_dim_size[u] = file_dims[u] % fm->chunk_dim[u];
-        if (file_dims[u] < fm->chunk_dim[u]) {
-            curr_partial_clip[u] = partial_dim_size[u];
-            is_partial_dim[u]    = TRUE;
-            num_partial_dims++;
-        } /* end if */
-        else {
-            curr_partial_clip[u] = fm->chunk_dim[u];
-            is_partial_dim[u]    = FALSE;
-        } /* end else */
-    }     /* end for */
+            /* Determine if we should use the chunk cache */
+            if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+            if (cacheable) {
+                /* Load the chunk into cache and lock it. */
 
-    /* Set the index of this chunk */
-    chunk_index = 0;
+                /* Compute # of bytes accessed in chunk */
+                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
+                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
 
-    /* Create "temporary" chunk for selection operations (copy file space) */
-    if (NULL == (tmp_fchunk = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)))
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk")
+                /* Lock the chunk into the cache */
+                if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
-    /* Iterate through each chunk in the dataset */
-    while (sel_points) {
-        H5D_chunk_info_t *new_chunk_info; /* chunk information to insert into skip list */
-        hsize_t           chunk_points;   /* Number of elements in chunk selection */
+                /* Set up the storage buffer information for this chunk */
+                cpt_store.compact.buf = chunk;
 
-        /* Add temporary chunk to the list of chunks */
+                /* Point I/O info at contiguous I/O info for this chunk */
+                chk_io_info = &cpt_io_info;
+            } /* end if */
+            else if (H5F_addr_defined(udata.chunk_block.offset)) {
+                /* Set up the storage address information for this chunk */
+                ctg_store.contig.dset_addr = udata.chunk_block.offset;
 
-        /* Allocate the file & memory chunk information */
-        if (NULL == (new_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk info")
+                /* Point I/O info at temporary I/O info for this chunk */
+                chk_io_info = &ctg_io_info;
+            } /* end else if */
+            else {
+                /* Point I/O info at "nonexistent" I/O info for this chunk */
+                chk_io_info = &nonexistent_io_info;
+            } /* end else */
+
+            /* Perform the actual read operation */
+            if ((io_info->io_ops.single_read)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
+                                              chunk_info->fspace, chunk_info->mspace) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+
+            /* Release the cache lock on the chunk. */
+            if (chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+        } /* end if */
+
+        /* Advance to next chunk in list */
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+        chunk_num++;
+    } /* end while */
+
+done:
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    /* Release any decoded chunks that weren't used */
+    if (decode_ahead > 0)
+        H5D__chunk_free_decoded(&io_info->dset->shared->cache.chunk);
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+    H5MM_xfree(found_udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_coalesced
+ *
+ * Purpose:     Reads the selected chunks of an unfiltered dataset that
+ *              are not in the chunk cache, when the cache is disabled, or
+ *              too small to hold one of them, or too small to hold all
+ *              of them. Loading that many chunks into the cache would
+ *              only evict each in turn; otherwise the chunks are read
+ *              through the cache, where a later access can find them.
+ *
+ *              The chunks are sorted by file address and chunks that
+ *              are next to each other, or separated by no more than
+ *              H5D_CHUNK_COALESCE_GAP bytes, are read with a single
+ *              block read of up to H5D_CHUNK_COALESCE_MAX_READ bytes.
+ *              Each chunk's selection is then copied out of the block,
+ *              without loading the chunk into the cache. Chunks read
+ *              this way are marked as such, so that H5D__chunk_read()
+ *              skips them.
+ *
+ *              When the chunks were looked up, *udata_out is set to an
+ *              array of their index info, in skip list order, which the
+ *              caller must free. Otherwise it is left NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read_coalesced(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, H5D_chunk_map_t *fm,
+                          H5D_io_info_t *cpt_io_info, H5D_chunk_ud_t **udata_out)
+{
+    const H5D_t *             dset     = io_info->dset; /* Dataset being read */
+    const H5D_rdcc_t *        rdcc;                      /* Dataset's chunk cache */
+    H5D_chunk_ud_t *          udata    = NULL;           /* Index info for each selected chunk */
+    H5D_chunk_coalesce_ent_t *ents     = NULL;           /* Chunks to read */
+    size_t                    nents    = 0;              /* Number of chunks to read */
+    unsigned char *           buf      = NULL;           /* Buffer for each read */
+    size_t                    buf_size = 0;              /* Size of the buffer */
+    size_t                    chunk_size;                /* Size of each chunk */
+    size_t                    nchunks;                   /* Number of selected chunks */
+    H5SL_node_t *             chunk_node;                /* Current node in chunk skip list */
+    size_t                    u, v, w;                   /* Local index variables */
+    herr_t                    ret_value = SUCCEED;       /* Return value */
 
-        /* Initialize the chunk information */
+    FUNC_ENTER_STATIC
 
-        /* Set the chunk index */
-        new_chunk_info->index = chunk_index;
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(type_info);
+    HDassert(fm);
+    HDassert(cpt_io_info);
+    HDassert(udata_out && NULL == *udata_out);
 
+    /* Only unfiltered chunks are read this way */
+    if (dset->shared->dcpl_cache.pline.nused > 0 || fm->use_single)
+        HGOTO_DONE(SUCCEED)
 #ifdef H5_HAVE_PARALLEL
-        /* Store chunk selection information, for multi-chunk I/O */
-        if (io_info->using_mpi_vfd)
-            fm->select_chunk[chunk_index] = new_chunk_info;
+    if (io_info->using_mpi_vfd)
+        HGOTO_DONE(SUCCEED)
 #endif /* H5_HAVE_PARALLEL */
+    if ((nchunks = H5SL_count(fm->sel_chunks)) < 2)
+        HGOTO_DONE(SUCCEED)
 
-        /* Set the file chunk dataspace */
-        if (NULL == (new_chunk_info->fspace = H5S_copy(tmp_fchunk, TRUE, FALSE)))
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy chunk dataspace")
-        new_chunk_info->fspace_shared = FALSE;
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
 
-        /* If there are partial dimensions for this chunk, set the hyperslab for them */
-        if (num_partial_dims > 0)
-            if (H5S_select_hyperslab(new_chunk_info->fspace, H5S_SELECT_SET, zeros, NULL, curr_partial_clip,
-                                     NULL) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk selection")
+    if (NULL == (udata = (H5D_chunk_ud_t *)H5MM_malloc(nchunks * sizeof(H5D_chunk_ud_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk info list")
+    if (NULL == (ents = (H5D_chunk_coalesce_ent_t *)H5MM_malloc(nchunks * sizeof(H5D_chunk_coalesce_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk list")
 
-        /* Set the memory chunk dataspace */
-        new_chunk_info->mspace        = NULL;
-        new_chunk_info->mspace_shared = FALSE;
+    /* Find the chunks that are in the file but not in the chunk cache. Those
+     * in the cache may hold changes not yet written, so are read through it.
+     */
+    for (chunk_node = H5SL_first(fm->sel_chunks), u = 0; chunk_node;
+         chunk_node = H5SL_next(chunk_node), u++) {
+        H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)H5SL_item(chunk_node); /* Chunk information */
 
-        /* Copy the chunk's scaled coordinates */
-        H5MM_memcpy(new_chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
-        new_chunk_info->scaled[fm->f_ndims] = 0;
+        if (H5D__chunk_lookup(dset, chunk_info->scaled, &udata[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
-        /* Insert the new chunk into the skip list */
-        if (H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
-            H5D__free_chunk_info(new_chunk_info, NULL, NULL);
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
+        if (H5F_addr_defined(udata[u].chunk_block.offset) && UINT_MAX == udata[u].idx_hint) {
+            ents[nents].addr       = udata[u].chunk_block.offset;
+            ents[nents].chunk_info = chunk_info;
+            nents++;
         } /* end if */
+    }     /* end for */
 
-        /* Get number of elements selected in chunk */
-        chunk_points = H5S_GET_SELECT_NPOINTS(new_chunk_info->fspace);
-        H5_CHECKED_ASSIGN(new_chunk_info->chunk_points, uint32_t, chunk_points, hsize_t);
+    /* Hand the lookups to the caller */
+    *udata_out = udata;
+    udata      = NULL;
 
-        /* Decrement # of points left in file selection */
-        sel_points -= chunk_points;
+    if (nents < 2)
+        HGOTO_DONE(SUCCEED)
 
-        /* Advance to next chunk if we are not done */
-        if (sel_points > 0) {
-            int curr_dim; /* Current dimension to increment */
+    /* Leave the chunks to the chunk cache if it can hold all of them */
+    rdcc = &(dset->shared->cache.chunk);
+    if ((rdcc->open_cache || rdcc->nslots > 0) && chunk_size <= rdcc->nbytes_max &&
+        nents <= rdcc->nbytes_max / chunk_size)
+        HGOTO_DONE(SUCCEED)
 
-            /* Increment chunk index */
-            chunk_index++;
+    /* Put the chunks in file address order */
+    HDqsort(ents, nents, sizeof(H5D_chunk_coalesce_ent_t), H5D__chunk_coalesce_cmp);
 
-            /* Set current increment dimension */
-            curr_dim = (int)fm->f_ndims - 1;
+    for (u = 0; u < nents; u = v) {
+        haddr_t run_start = ents[u].addr;              /* Start of the read */
+        haddr_t run_end   = ents[u].addr + chunk_size; /* End of the read */
+        size_t  run_size;                              /* Size of the read */
 
-            /* Increment chunk location in fastest changing dimension */
-            coords[curr_dim] += fm->chunk_dim[curr_dim];
-            scaled[curr_dim]++;
-            end[curr_dim] += fm->chunk_dim[curr_dim];
+        /* Gather the chunks that are close enough to read along */
+        for (v = u + 1; v < nents; v++) {
+            if (H5F_addr_gt(ents[v].addr, run_end + H5D_CHUNK_COALESCE_GAP) ||
+                (ents[v].addr + chunk_size) - run_start > H5D_CHUNK_COALESCE_MAX_READ)
+                break;
+            run_end = ents[v].addr + chunk_size;
+        } /* end for */
 
-            /* Bring chunk location back into bounds, if necessary */
-            if (coords[curr_dim] >= file_dims[curr_dim]) {
-                do {
-                    /* Reset current dimension's location to 0 */
-                    coords[curr_dim] = 0;
-                    scaled[curr_dim] = 0;
-                    end[curr_dim]    = fm->chunk_dim[curr_dim] - 1;
+        /* A chunk on its own is read the usual way */
+        if (v - u < 2)
+            continue;
 
-                    /* Check for previous partial chunk in this dimension */
-                    if (is_partial_dim[curr_dim] && end[curr_dim] < file_dims[curr_dim]) {
-                        /* Sanity check */
-                        HDassert(num_partial_dims > 0);
+        /* Read all the chunks at once */
+        H5_CHECKED_ASSIGN(run_size, size_t, run_end - run_start, hsize_t);
+        if (run_size > buf_size) {
+            buf = (unsigned char *)H5MM_xfree(buf);
+            if (NULL == (buf = (unsigned char *)H5MM_malloc(run_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate read buffer")
+            buf_size = run_size;
+        } /* end if */
+        if (H5F_shared_block_read(io_info->f_sh, H5FD_MEM_DRAW, run_start, run_size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
 
-                        /* Reset partial chunk information for this dimension */
-                        curr_partial_clip[curr_dim] = fm->chunk_dim[curr_dim];
-                        is_partial_dim[curr_dim]    = FALSE;
-                        num_partial_dims--;
-                    } /* end if */
+        /* Copy each chunk's selection out of the buffer */
+        for (w = u; w < v; w++) {
+            H5D_chunk_info_t *chunk_info = ents[w].chunk_info; /* Chunk information */
 
-                    /* Decrement current dimension */
-                    curr_dim--;
+            io_info->store->chunk.scaled    = chunk_info->scaled;
+            cpt_io_info->store->compact.buf = buf + (ents[w].addr - run_start);
+            if ((io_info->io_ops.single_read)(cpt_io_info, type_info, (hsize_t)chunk_info->chunk_points,
+                                              chunk_info->fspace, chunk_info->mspace) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+            chunk_info->coalesced = TRUE;
+        } /* end for */
+    }     /* end for */
 
-                    /* Check for valid current dim */
-                    if (curr_dim >= 0) {
-                        /* Increment chunk location in current dimension */
-                        coords[curr_dim] += fm->chunk_dim[curr_dim];
-                        scaled[curr_dim]++;
-                        end[curr_dim] = (coords[curr_dim] + fm->chunk_dim[curr_dim]) - 1;
-                    } /* end if */
-                } while (curr_dim >= 0 && (coords[curr_dim] >= file_dims[curr_dim]));
-            } /* end if */
+done:
+    H5MM_xfree(udata);
+    H5MM_xfree(ents);
+    H5MM_xfree(buf);
 
-            /* Check for valid current dim */
-            if (curr_dim >= 0) {
-                /* Check for partial chunk in this dimension */
-                if (!is_partial_dim[curr_dim] && file_dims[curr_dim] <= end[curr_dim]) {
-                    /* Set partial chunk information for this dimension */
-                    curr_partial_clip[curr_dim] = partial_dim_size[curr_dim];
-                    is_partial_dim[curr_dim]    = TRUE;
-                    num_partial_dims++;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_read_coalesced() */
 
-                    /* Sanity check */
-                    HDassert(num_partial_dims <= fm->f_ndims);
-                } /* end if */
-            }     /* end if */
-        }         /* end if */
-    }             /* end while */
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_coalesce_cmp
+ *
+ * Purpose:     Compares two chunks by file address, for HDqsort().
+ *
+ * Return:      <0, 0 or >0 as the first chunk comes before, at or after
+ *              the second one
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_coalesce_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_coalesce_ent_t *ent1 = (const H5D_chunk_coalesce_ent_t *)_ent1;
+    const H5D_chunk_coalesce_ent_t *ent2 = (const H5D_chunk_coalesce_ent_t *)_ent2;
 
-done:
-    /* Clean up */
-    if (tmp_fchunk && H5S_close(tmp_fchunk) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release temporary dataspace")
+    FUNC_ENTER_STATIC_NOERR
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__create_chunk_file_map_all() */
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->addr, ent2->addr))
+} /* H5D__chunk_coalesce_cmp() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__create_chunk_file_map_hyper
+ * Function:    H5D__chunk_write
  *
- * Purpose:    Create all chunk selections in file, for a hyperslab selection.
+ * Purpose:    Writes to a chunked dataset.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *        Thursday, May 29, 2003
+ * Programmer:    Raymond Lu
+ *        Thursday, April 10, 2003
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
-#ifndef H5_HAVE_PARALLEL
-                                                          H5_ATTR_UNUSED
-#endif /* H5_HAVE_PARALLEL */
-                                                              *io_info)
+H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t H5_ATTR_UNUSED nelmts,
+                 const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
+                 H5D_chunk_map_t *fm)
 {
-    H5S_t *  tmp_fchunk = NULL;              /* Temporary file dataspace */
-    hsize_t  sel_start[H5O_LAYOUT_NDIMS];    /* Offset of low bound of file selection */
-    hsize_t  sel_end[H5O_LAYOUT_NDIMS];      /* Offset of high bound of file selection */
-    hsize_t  sel_points;                     /* Number of elements in file selection */
-    hsize_t  start_coords[H5O_LAYOUT_NDIMS]; /* Starting coordinates of selection */
-    hsize_t  coords[H5O_LAYOUT_NDIMS];       /* Current coordinates of chunk */
-    hsize_t  end[H5O_LAYOUT_NDIMS];          /* Final coordinates of chunk */
-    hsize_t  chunk_index;                    /* Index of chunk */
-    hsize_t  start_scaled[H5S_MAX_RANK];     /* Starting scaled coordinates of selection */
-    hsize_t  scaled[H5S_MAX_RANK];           /* Scaled coordinates for this chunk */
-    int      curr_dim;                       /* Current dimension to increment */
-    unsigned u;                              /* Local index variable */
-    herr_t   ret_value = SUCCEED;            /* Return value */
+    H5SL_node_t * chunk_node;                   /* Current node in chunk skip list */
+    H5D_io_info_t ctg_io_info;                  /* Contiguous I/O info object */
+    H5D_storage_t ctg_store;                    /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t cpt_io_info;                  /* Compact I/O info object */
+    H5D_storage_t cpt_store;                    /* Chunk storage information as compact dataset */
+    hbool_t       cpt_dirty;                    /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t      dst_accessed_bytes = 0;       /* Total accessed size in a chunk */
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    htri_t       decode_ahead = FALSE; /* Whether chunks are decoded in batches on filter threads */
+    unsigned     nthreads     = 0;     /* Number of filter threads */
+    H5SL_node_t *batch_end    = NULL;  /* First chunk past the current batch */
+#endif                                 /* H5D_CHUNK_CONCURRENT_FILTERS */
+    herr_t ret_value = SUCCEED;        /* Return value        */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
-    HDassert(fm->f_ndims > 0);
+    HDassert(io_info);
+    HDassert(io_info->u.wbuf);
+    HDassert(type_info);
+    HDassert(fm);
 
-    /* Get number of elements selected in file */
-    sel_points = fm->nelmts;
+    /* Set up contiguous I/O info object */
+    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
+    ctg_io_info.store      = &ctg_store;
+    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
 
-    /* Get bounding box for selection (to reduce the number of chunks to iterate over) */
-    if (H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+    /* Initialize temporary contiguous storage info */
+    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size,
+                      uint32_t);
 
-    /* Set initial chunk location & hyperslab size */
-    for (u = 0; u < fm->f_ndims; u++) {
-        /* Validate this chunk dimension */
-        if (fm->layout->u.chunk.dim[u] == 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
-        scaled[u] = start_scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
-        coords[u] = start_coords[u] = scaled[u] * fm->layout->u.chunk.dim[u];
-        end[u]                      = (coords[u] + fm->chunk_dim[u]) - 1;
-    } /* end for */
+    /* Set up compact I/O info object */
+    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
+    cpt_io_info.store      = &cpt_store;
+    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
 
-    /* Calculate the index of this chunk */
-    chunk_index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, scaled);
+    /* Initialize temporary compact storage info */
+    cpt_store.compact.dirty = &cpt_dirty;
 
-    /* Iterate through each chunk in the dataset */
-    while (sel_points) {
-        /* Check for intersection of current chunk and file selection */
-        /* (Casting away const OK - QAK) */
-        if (TRUE == H5S_SELECT_INTERSECT_BLOCK(fm->file_space, coords, end)) {
-            H5D_chunk_info_t *new_chunk_info; /* chunk information to insert into skip list */
-            hsize_t           chunk_points;   /* Number of elements in chunk selection */
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
 
-            /* Create dataspace for chunk, 'AND'ing the overall selection with
-             *  the current chunk.
-             */
-            if (H5S_combine_hyperslab(fm->file_space, H5S_SELECT_AND, coords, NULL, fm->chunk_dim, NULL,
-                                      &tmp_fchunk) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL,
-                            "unable to combine file space selection with chunk block")
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    /* Check if the filtered chunks that are partially written can be decoded at once */
+    if (!fm->use_single && H5SL_count(fm->sel_chunks) > 1) {
+        if ((decode_ahead = H5D__chunk_filter_concurrent(io_info->dset, &nthreads)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered concurrently")
+        batch_end = chunk_node;
+    } /* end if */
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
 
-            /* Resize chunk's dataspace dimensions to size of chunk */
-            if (H5S_set_extent_real(tmp_fchunk, fm->chunk_dim) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't adjust chunk dimensions")
+    while (chunk_node) {
+        H5D_chunk_info_t * chunk_info;          /* Chunk information */
+        H5D_chk_idx_info_t idx_info;            /* Chunked index info */
+        H5D_io_info_t *    chk_io_info;         /* Pointer to I/O info object for this chunk */
+        void *             chunk;               /* Pointer to locked chunk buffer */
+        H5D_chunk_ud_t     udata;               /* Index pass-through    */
+        htri_t             cacheable;           /* Whether the chunk is cacheable */
+        hbool_t            need_insert = FALSE; /* Whether the chunk needs to be inserted into the index */
 
-            /* Move selection back to have correct offset in chunk */
-            if (H5S_SELECT_ADJUST_U(tmp_fchunk, coords) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't adjust chunk selection")
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+        /* Read and decode the next batch of chunks on the filter threads */
+        if (decode_ahead && chunk_node == batch_end)
+            if (H5D__chunk_decode_ahead(io_info, type_info, fm, chunk_node, nthreads, TRUE, &batch_end) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to decode raw data chunks")
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
 
-            /* Add temporary chunk to the list of chunks */
+        /* Get the actual chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
-            /* Allocate the file & memory chunk information */
-            if (NULL == (new_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk info")
+        /* Look up the chunk */
+        if (H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
-            /* Initialize the chunk information */
+        /* Sanity check */
+        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
+                 (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
 
-            /* Set the chunk index */
-            new_chunk_info->index = chunk_index;
+        /* Set chunk's [scaled] coordinates */
+        io_info->store->chunk.scaled = chunk_info->scaled;
 
-#ifdef H5_HAVE_PARALLEL
-            /* Store chunk selection information, for multi-chunk I/O */
-            if (io_info->using_mpi_vfd)
-                fm->select_chunk[chunk_index] = new_chunk_info;
-#endif /* H5_HAVE_PARALLEL */
+        /* Determine if we should use the chunk cache */
+        if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, TRUE)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+        if (cacheable) {
+            /* Load the chunk into cache.  But if the whole chunk is written,
+             * simply allocate space instead of load the chunk. */
+            hbool_t entire_chunk = TRUE; /* Whether whole chunk is selected */
 
-            /* Set the file chunk dataspace */
-            new_chunk_info->fspace        = tmp_fchunk;
-            new_chunk_info->fspace_shared = FALSE;
-            tmp_fchunk                    = NULL;
+            /* Compute # of bytes accessed in chunk */
+            H5_CHECK_OVERFLOW(type_info->dst_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
+            dst_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->dst_type_size;
 
-            /* Set the memory chunk dataspace */
-            new_chunk_info->mspace        = NULL;
-            new_chunk_info->mspace_shared = FALSE;
+            /* Determine if we will access all the data in the chunk */
+            if (dst_accessed_bytes != ctg_store.contig.dset_size ||
+                (chunk_info->chunk_points * type_info->src_type_size) != ctg_store.contig.dset_size ||
+                fm->fsel_type == H5S_SEL_POINTS)
+                entire_chunk = FALSE;
 
-            /* Copy the chunk's scaled coordinates */
-            H5MM_memcpy(new_chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
-            new_chunk_info->scaled[fm->f_ndims] = 0;
+            /* Lock the chunk into the cache */
+            if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE)))
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
-            /* Insert the new chunk into the skip list */
-            if (H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
-                H5D__free_chunk_info(new_chunk_info, NULL, NULL);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
-            } /* end if */
+            /* Set up the storage buffer information for this chunk */
+            cpt_store.compact.buf = chunk;
 
-            /* Get number of elements selected in chunk */
-            chunk_points = H5S_GET_SELECT_NPOINTS(new_chunk_info->fspace);
-            H5_CHECKED_ASSIGN(new_chunk_info->chunk_points, uint32_t, chunk_points, hsize_t);
+            /* Point I/O info at main I/O info for this chunk */
+            chk_io_info = &cpt_io_info;
+        } /* end if */
+        else {
+            /* If the chunk hasn't been allocated on disk, do so now. */
+            if (!H5F_addr_defined(udata.chunk_block.offset)) {
+                /* Compose chunked index info struct */
+                idx_info.f       = io_info->dset->oloc.file;
+                idx_info.pline   = &(io_info->dset->shared->dcpl_cache.pline);
+                idx_info.layout  = &(io_info->dset->shared->layout.u.chunk);
+                idx_info.storage = &(io_info->dset->shared->layout.storage.u.chunk);
 
-            /* Decrement # of points left in file selection */
-            sel_points -= chunk_points;
+                /* Set up the size of chunk for user data */
+                udata.chunk_block.length = io_info->dset->shared->layout.u.chunk.size;
 
-            /* Leave if we are done */
-            if (sel_points == 0)
-                HGOTO_DONE(SUCCEED)
-        } /* end if */
+                /* Allocate the chunk */
+                if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert,
+                                          chunk_info->scaled) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
+                                "unable to insert/resize chunk on chunk level")
 
-        /* Increment chunk index */
-        chunk_index++;
+                /* Make sure the address of the chunk is returned. */
+                if (!H5F_addr_defined(udata.chunk_block.offset))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
 
-        /* Set current increment dimension */
-        curr_dim = (int)fm->f_ndims - 1;
+                /* Cache the new chunk information */
+                H5D__chunk_cinfo_cache_update(&io_info->dset->shared->cache.chunk.last, &udata);
+            } /* end if */
 
-        /* Increment chunk location in fastest changing dimension */
-        coords[curr_dim] += fm->chunk_dim[curr_dim];
-        end[curr_dim] += fm->chunk_dim[curr_dim];
-        scaled[curr_dim]++;
+            /* Set up the storage address information for this chunk */
+            ctg_store.contig.dset_addr = udata.chunk_block.offset;
 
-        /* Bring chunk location back into bounds, if necessary */
-        if (coords[curr_dim] > sel_end[curr_dim]) {
-            do {
-                /* Reset current dimension's location to 0 */
-                scaled[curr_dim] = start_scaled[curr_dim];
-                coords[curr_dim] =
-                    start_coords[curr_dim]; /*lint !e771 The start_coords will always be initialized */
-                end[curr_dim] = (coords[curr_dim] + fm->chunk_dim[curr_dim]) - 1;
+            /* No chunk cached */
+            chunk = NULL;
 
-                /* Decrement current dimension */
-                curr_dim--;
+            /* Point I/O info at temporary I/O info for this chunk */
+            chk_io_info = &ctg_io_info;
+        } /* end else */
 
-                /* Check for valid current dim */
-                if (curr_dim >= 0) {
-                    /* Increment chunk location in current dimension */
-                    scaled[curr_dim]++;
-                    coords[curr_dim] += fm->chunk_dim[curr_dim];
-                    end[curr_dim] = (coords[curr_dim] + fm->chunk_dim[curr_dim]) - 1;
-                } /* end if */
-            } while (curr_dim >= 0 && (coords[curr_dim] > sel_end[curr_dim]));
+        /* Perform the actual write operation */
+        if ((io_info->io_ops.single_write)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
+                                           chunk_info->fspace, chunk_info->mspace) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked write failed")
 
-            /* Re-calculate the index of this chunk */
-            chunk_index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, scaled);
+        /* Release the cache lock on the chunk, or insert chunk into index. */
+        if (chunk) {
+            if (H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
         } /* end if */
-    }     /* end while */
+        else {
+            if (need_insert && io_info->dset->shared->layout.storage.u.chunk.ops->insert) {
+                if ((io_info->dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, &udata, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                if (H5D__chunk_idx_cache_insert(io_info->dset, &udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update in-memory chunk index")
+            } /* end if */
+        }     /* end else */
+
+        /* Advance to next chunk in list */
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
 
 done:
-    /* Clean up on failure */
-    if (ret_value < 0)
-        if (tmp_fchunk && H5S_close(tmp_fchunk) < 0)
-            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release temporary dataspace")
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    /* Release any decoded chunks that weren't used */
+    if (decode_ahead > 0)
+        H5D__chunk_free_decoded(&io_info->dset->shared->cache.chunk);
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__create_chunk_file_map_hyper() */
+} /* H5D__chunk_write() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__create_chunk_mem_map_hyper
+ * Function:    H5D__chunk_flush
  *
- * Purpose:    Create all chunk selections in memory by copying the file
- *              chunk selections and adjusting their offsets to be correct
- *              for the memory.
+ * Purpose:    Writes all dirty chunks to disk and optionally preempts them
+ *        from the cache.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *        Thursday, May 29, 2003
- *
- * Assumptions: That the file and memory selections are the same shape.
+ * Programmer:    Robb Matzke
+ *              Thursday, May 21, 1998
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__create_chunk_mem_map_hyper(const H5D_chunk_map_t *fm)
+H5D__chunk_flush(H5D_t *dset)
 {
-    H5D_chunk_info_t *chunk_info;                   /* Pointer to chunk information */
-    H5SL_node_t *     curr_node;                    /* Current node in skip list */
-    hsize_t           file_sel_start[H5S_MAX_RANK]; /* Offset of low bound of file selection */
-    hsize_t           file_sel_end[H5S_MAX_RANK];   /* Offset of high bound of file selection */
-    hsize_t           mem_sel_start[H5S_MAX_RANK];  /* Offset of low bound of file selection */
-    hsize_t           mem_sel_end[H5S_MAX_RANK];    /* Offset of high bound of file selection */
-    hssize_t          adjust[H5S_MAX_RANK];         /* Adjustment to make to all file chunks */
-    unsigned          u;                            /* Local index variable */
-    herr_t            ret_value = SUCCEED;          /* Return value */
+    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_ent_t *ent, *next;
+    unsigned        nerrors   = 0;       /* Count of any errors encountered when flushing chunks */
+    herr_t          ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
-    HDassert(fm->f_ndims > 0);
-
-    /* Check for all I/O going to a single chunk */
-    if (H5SL_count(fm->sel_chunks) == 1) {
-        /* Get the node */
-        curr_node = H5SL_first(fm->sel_chunks);
-
-        /* Get pointer to chunk's information */
-        chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
-        HDassert(chunk_info);
-
-        /* Just point at the memory dataspace & selection */
-        /* (Casting away const OK -QAK) */
-        chunk_info->mspace = (H5S_t *)fm->mem_space;
-
-        /* Indicate that the chunk's memory space is shared */
-        chunk_info->mspace_shared = TRUE;
-    } /* end if */
-    else {
-        /* Get bounding box for file selection */
-        if (H5S_SELECT_BOUNDS(fm->file_space, file_sel_start, file_sel_end) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
-
-        /* Get bounding box for memory selection */
-        if (H5S_SELECT_BOUNDS(fm->mem_space, mem_sel_start, mem_sel_end) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
-
-        /* Calculate the adjustment for memory selection from file selection */
-        HDassert(fm->m_ndims == fm->f_ndims);
-        for (u = 0; u < fm->f_ndims; u++) {
-            H5_CHECK_OVERFLOW(file_sel_start[u], hsize_t, hssize_t);
-            H5_CHECK_OVERFLOW(mem_sel_start[u], hsize_t, hssize_t);
-            adjust[u] = (hssize_t)file_sel_start[u] - (hssize_t)mem_sel_start[u];
-        } /* end for */
-
-        /* Iterate over each chunk in the chunk list */
-        curr_node = H5SL_first(fm->sel_chunks);
-        while (curr_node) {
-            hsize_t      coords[H5S_MAX_RANK];       /* Current coordinates of chunk */
-            hssize_t     chunk_adjust[H5S_MAX_RANK]; /* Adjustment to make to a particular chunk */
-            H5S_sel_type chunk_sel_type;             /* Chunk's selection type */
-
-            /* Get pointer to chunk's information */
-            chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
-            HDassert(chunk_info);
-
-            /* Compute the chunk coordinates from the scaled coordinates */
-            for (u = 0; u < fm->f_ndims; u++)
-                coords[u] = chunk_info->scaled[u] * fm->layout->u.chunk.dim[u];
-
-            /* Copy the information */
-
-            /* Copy the memory dataspace */
-            if ((chunk_info->mspace = H5S_copy(fm->mem_space, TRUE, FALSE)) == NULL)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
-
-            /* Get the chunk's selection type */
-            if ((chunk_sel_type = H5S_GET_SELECT_TYPE(chunk_info->fspace)) < H5S_SEL_NONE)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
-
-            /* Set memory selection for "all" chunk selections */
-            if (H5S_SEL_ALL == chunk_sel_type) {
-                /* Adjust the chunk coordinates */
-                for (u = 0; u < fm->f_ndims; u++)
-                    coords[u] = (hsize_t)((hssize_t)coords[u] - adjust[u]);
-
-                /* Set to same shape as chunk */
-                if (H5S_select_hyperslab(chunk_info->mspace, H5S_SELECT_SET, coords, NULL, fm->chunk_dim,
-                                         NULL) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk memory selection")
-            } /* end if */
-            else {
-                /* Sanity check */
-                HDassert(H5S_SEL_HYPERSLABS == chunk_sel_type);
-
-                /* Copy the file chunk's selection */
-                if (H5S_SELECT_COPY(chunk_info->mspace, chunk_info->fspace, FALSE) < 0)
-                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy selection")
-
-                /* Compute the adjustment for this chunk */
-                for (u = 0; u < fm->f_ndims; u++) {
-                    /* Compensate for the chunk offset */
-                    H5_CHECK_OVERFLOW(coords[u], hsize_t, hssize_t);
-                    chunk_adjust[u] = adjust[u] - (hssize_t)coords[u];
-                } /* end for */
-
-                /* Adjust the selection */
-                if (H5S_SELECT_ADJUST_S(chunk_info->mspace, chunk_adjust) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to adjust selection")
-            } /* end else */
+    HDassert(dset);
 
-            /* Get the next chunk node in the skip list */
-            curr_node = H5SL_next(curr_node);
-        } /* end while */
-    }     /* end else */
+    /* Loop over all entries in the chunk cache */
+    for (ent = rdcc->head; ent; ent = next) {
+        next = ent->next;
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+        /* Encode this and the following dirty chunks on the filter threads */
+        if (ent->dirty && !ent->image && H5D__chunk_encode_ahead(dset, ent) < 0)
+            nerrors++;
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+            nerrors++;
+    } /* end for */
+    if (nerrors)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__create_chunk_mem_map_hyper() */
+} /* end H5D__chunk_flush() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__create_mem_map_1d
+ * Function:    H5D__chunk_io_term
  *
- * Purpose:    Create all chunk selections for 1-dimensional regular memory space
- *          that has only one single block in the selection
+ * Purpose:    Destroy I/O operation information.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Vailin Choi
- *                Sept 18, 2019
+ * Programmer:    Quincey Koziol
+ *        Saturday, May 17, 2003
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__create_chunk_mem_map_1d(const H5D_chunk_map_t *fm)
+H5D__chunk_io_term(const H5D_chunk_map_t *fm)
 {
-    H5D_chunk_info_t *chunk_info;          /* Pointer to chunk information */
-    H5SL_node_t *     curr_node;           /* Current node in skip list */
-    herr_t            ret_value = SUCCEED; /* Return value */
+    herr_t ret_value = SUCCEED; /*return value        */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(fm->f_ndims > 0);
-
-    /* Check for all I/O going to a single chunk */
-    if (H5SL_count(fm->sel_chunks) == 1) {
-        /* Get the node */
-        curr_node = H5SL_first(fm->sel_chunks);
-
-        /* Get pointer to chunk's information */
-        chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
-        HDassert(chunk_info);
-
-        /* Just point at the memory dataspace & selection */
-        /* (Casting away const OK -QAK) */
-        chunk_info->mspace = (H5S_t *)fm->mem_space;
+    /* Single element I/O vs. multiple element I/O cleanup */
+    if (fm->use_single) {
+        /* Sanity checks */
+        HDassert(fm->sel_chunks == NULL);
+        HDassert(fm->single_chunk_info);
+        HDassert(fm->single_chunk_info->fspace_shared);
+        HDassert(fm->single_chunk_info->mspace_shared);
 
-        /* Indicate that the chunk's memory space is shared */
-        chunk_info->mspace_shared = TRUE;
+        /* Reset the selection for the single element I/O */
+        H5S_select_all(fm->single_space, TRUE);
     } /* end if */
     else {
-        hsize_t mem_sel_start[H5S_MAX_RANK]; /* Offset of low bound of file selection */
-        hsize_t mem_sel_end[H5S_MAX_RANK];   /* Offset of high bound of file selection */
-
-        HDassert(fm->m_ndims == 1);
-
-        if (H5S_SELECT_BOUNDS(fm->mem_space, mem_sel_start, mem_sel_end) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
-
-        /* Iterate over each chunk in the chunk list */
-        curr_node = H5SL_first(fm->sel_chunks);
-        while (curr_node) {
-            hsize_t chunk_points; /* Number of elements in chunk selection */
-            hsize_t tmp_count = 1;
-
-            /* Get pointer to chunk's information */
-            chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
-            HDassert(chunk_info);
-
-            /* Copy the memory dataspace */
-            if ((chunk_info->mspace = H5S_copy(fm->mem_space, TRUE, FALSE)) == NULL)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
-
-            chunk_points = H5S_GET_SELECT_NPOINTS(chunk_info->fspace);
-
-            if (H5S_select_hyperslab(chunk_info->mspace, H5S_SELECT_SET, mem_sel_start, NULL, &tmp_count,
-                                     &chunk_points) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk memory selection")
-
-            mem_sel_start[0] += chunk_points;
+        /* Release the nodes on the list of selected chunks */
+        if (fm->sel_chunks)
+            if (H5SL_free(fm->sel_chunks, H5D__free_chunk_info, NULL) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
+    } /* end else */
 
-            /* Get the next chunk node in the skip list */
-            curr_node = H5SL_next(curr_node);
-        } /* end while */
-    }     /* end else */
+    /* Free the memory chunk dataspace template */
+    if (fm->mchunk_tmpl)
+        if (H5S_close(fm->mchunk_tmpl) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release memory chunk dataspace template")
+#ifdef H5_HAVE_PARALLEL
+    if (fm->select_chunk)
+        H5MM_xfree(fm->select_chunk);
+#endif /* H5_HAVE_PARALLEL */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__create_chunk_mem_map_1d() */
+} /* end H5D__chunk_io_term() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_file_cb
+ * Function:    H5D__chunk_dest
  *
- * Purpose:    Callback routine for file selection iterator.  Used when
- *              creating selections in file for each point selected.
+ * Purpose:    Destroy the entire chunk cache by flushing dirty entries,
+ *        preempting all entries, and freeing the cache itself.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *        Wednesday, July 23, 2003
+ * Programmer:    Robb Matzke
+ *              Thursday, May 21, 1998
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_file_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type, unsigned ndims,
-                   const hsize_t *coords, void *_udata)
+H5D__chunk_dest(H5D_t *dset)
 {
-    H5D_chunk_file_iter_ud_t *udata = (H5D_chunk_file_iter_ud_t *)_udata; /* User data for operation */
-    H5D_chunk_map_t *         fm    = udata->fm;                 /* File<->memory chunk mapping info */
-    H5D_chunk_info_t *        chunk_info;                        /* Chunk information for current chunk */
-    hsize_t                   coords_in_chunk[H5O_LAYOUT_NDIMS]; /* Coordinates of element in chunk */
-    hsize_t                   chunk_index;                       /* Chunk index */
-    hsize_t                   scaled[H5S_MAX_RANK];              /* Scaled coordinates for this chunk */
-    unsigned                  u;                                 /* Local index variable */
-    herr_t                    ret_value = SUCCEED;               /* Return value        */
-
-    FUNC_ENTER_STATIC
-
-    /* Calculate the index of this chunk */
-    chunk_index = H5VM_chunk_index_scaled(ndims, coords, fm->layout->u.chunk.dim,
-                                          fm->layout->u.chunk.down_chunks, scaled);
-
-    /* Find correct chunk in file & memory skip list */
-    if (chunk_index == fm->last_index) {
-        /* If the chunk index is the same as the last chunk index we used,
-         * get the cached info to operate on.
-         */
-        chunk_info = fm->last_chunk_info;
-    } /* end if */
-    else {
-        /* If the chunk index is not the same as the last chunk index we used,
-         * find the chunk in the skip list.
-         */
-        /* Get the chunk node from the skip list */
-        if (NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_index))) {
-            H5S_t *fspace; /* Memory chunk's dataspace */
+    H5D_chk_idx_info_t   idx_info;                            /* Chunked index info */
+    H5D_rdcc_t *         rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_t *     ent = NULL, *next = NULL;            /* Pointer to current & next cache entries */
+    int                  nerrors   = 0;                       /* Accumulated count of errors */
+    H5O_storage_chunk_t *sc        = &(dset->shared->layout.storage.u.chunk);
+    herr_t               ret_value = SUCCEED; /* Return value */
 
-            /* Allocate the file & memory chunk information */
-            if (NULL == (chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+    FUNC_ENTER_STATIC_TAG(dset->oloc.addr)
 
-            /* Initialize the chunk information */
+    /* Sanity checks */
+    HDassert(dset);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
 
-            /* Set the chunk index */
-            chunk_info->index = chunk_index;
+    /* Flush all the cached chunks */
+    for (ent = rdcc->head; ent; ent = next) {
+        next = ent->next;
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+        /* Encode this and the following dirty chunks on the filter threads */
+        if (ent->dirty && !ent->image && H5D__chunk_encode_ahead(dset, ent) < 0)
+            nerrors++;
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+        if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+            nerrors++;
+    } /* end for */
 
-            /* Create a dataspace for the chunk */
-            if ((fspace = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)) == NULL) {
-                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk")
-            } /* end if */
+    /* Continue even if there are failures. */
+    if (nerrors)
+        HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
-            /* De-select the chunk space */
-            if (H5S_select_none(fspace) < 0) {
-                (void)H5S_close(fspace);
-                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select dataspace")
-            } /* end if */
+    /* Release cache structures */
+    if (rdcc->slot)
+        rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    if (rdcc->open_cache && !rdcc->open_cache->shared)
+        H5D__chunk_open_cache_free(rdcc->open_cache);
+    if (rdcc->idx_cache)
+        H5D__chunk_idx_cache_free(rdcc->idx_cache);
+    HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
 
-            /* Set the file chunk dataspace */
-            chunk_info->fspace        = fspace;
-            chunk_info->fspace_shared = FALSE;
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
 
-            /* Set the memory chunk dataspace */
-            chunk_info->mspace        = NULL;
-            chunk_info->mspace_shared = FALSE;
+    /* Free any index structures */
+    if (sc->ops->dest && (sc->ops->dest)(&idx_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk index info")
 
-            /* Set the number of selected elements in chunk to zero */
-            chunk_info->chunk_points = 0;
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_dest() */
 
-            /* Set the chunk's scaled coordinates */
-            H5MM_memcpy(chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
-            chunk_info->scaled[fm->f_ndims] = 0;
-            H5MM_memcpy(chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_idx_reset
+ *
+ * Purpose:    Reset index information
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              Thursday, January 15, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
 
-            /* Insert the new chunk into the skip list */
-            if (H5SL_insert(fm->sel_chunks, chunk_info, &chunk_info->index) < 0) {
-                H5D__free_chunk_info(chunk_info, NULL, NULL);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
-            } /* end if */
-        }     /* end if */
+    FUNC_ENTER_NOAPI(FAIL)
 
-#ifdef H5_HAVE_PARALLEL
-        /* Store chunk selection information, for collective multi-chunk I/O */
-        if (udata->io_info->using_mpi_vfd)
-            fm->select_chunk[chunk_index] = chunk_info;
-#endif /* H5_HAVE_PARALLEL */
+    /* Sanity checks */
+    HDassert(storage);
+    HDassert(storage->ops);
+    H5D_CHUNK_STORAGE_INDEX_CHK(storage);
 
-        /* Update the "last chunk seen" information */
-        fm->last_index      = chunk_index;
-        fm->last_chunk_info = chunk_info;
-    } /* end else */
+    /* Reset index structures */
+    if ((storage->ops->reset)(storage, reset_addr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to reset chunk index info")
 
-    /* Get the offset of the element within the chunk */
-    for (u = 0; u < fm->f_ndims; u++)
-        coords_in_chunk[u] = coords[u] - (scaled[u] * fm->layout->u.chunk.dim[u]);
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_chunk_idx_reset() */
 
-    /* Add point to file selection for chunk */
-    if (H5S_select_elements(chunk_info->fspace, H5S_SELECT_APPEND, (size_t)1, coords_in_chunk) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "unable to select element")
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cinfo_cache_reset
+ *
+ * Purpose:    Reset the cached chunk info
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Quincey Koziol
+ *              November 27, 2007
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last)
+{
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Increment the number of elemented selected in chunk */
-    chunk_info->chunk_points++;
+    /* Sanity check */
+    HDassert(last);
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_file_cb() */
+    /* Indicate that the cached info is not valid */
+    last->valid = FALSE;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D__chunk_cinfo_cache_reset() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_mem_cb
+ * Function:    H5D__chunk_cinfo_cache_update
  *
- * Purpose:    Callback routine for file selection iterator.  Used when
- *              creating selections in memory for each chunk.
+ * Purpose:    Update the cached chunk info
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Raymond Lu
- *        Thursday, April 10, 2003
+ * Programmer:    Quincey Koziol
+ *              November 27, 2007
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_mem_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type, unsigned ndims,
-                  const hsize_t *coords, void *_fm)
+H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *udata)
 {
-    H5D_chunk_map_t * fm = (H5D_chunk_map_t *)_fm; /* File<->memory chunk mapping info */
-    H5D_chunk_info_t *chunk_info;                  /* Chunk information for current chunk */
-    hsize_t           coords_in_mem[H5S_MAX_RANK]; /* Coordinates of element in memory */
-    hsize_t           chunk_index;                 /* Chunk index */
-    herr_t            ret_value = SUCCEED;         /* Return value        */
-
-    FUNC_ENTER_STATIC
-
-    /* Calculate the index of this chunk */
-    chunk_index = H5VM_chunk_index(ndims, coords, fm->layout->u.chunk.dim, fm->layout->u.chunk.down_chunks);
-
-    /* Find correct chunk in file & memory skip list */
-    if (chunk_index == fm->last_index) {
-        /* If the chunk index is the same as the last chunk index we used,
-         * get the cached spaces to operate on.
-         */
-        chunk_info = fm->last_chunk_info;
-    } /* end if */
-    else {
-        /* If the chunk index is not the same as the last chunk index we used,
-         * find the chunk in the skip list.
-         */
-        /* Get the chunk node from the skip list */
-        if (NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_index)))
-            HGOTO_ERROR(H5E_DATASPACE, H5E_NOTFOUND, H5_ITER_ERROR, "can't locate chunk in skip list")
-
-        /* Check if the chunk already has a memory space */
-        if (NULL == chunk_info->mspace)
-            /* Copy the template memory chunk dataspace */
-            if (NULL == (chunk_info->mspace = H5S_copy(fm->mchunk_tmpl, FALSE, FALSE)))
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy file space")
-
-        /* Update the "last chunk seen" information */
-        fm->last_index      = chunk_index;
-        fm->last_chunk_info = chunk_info;
-    } /* end else */
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Get coordinates of selection iterator for memory */
-    if (H5S_SELECT_ITER_COORDS(&fm->mem_iter, coords_in_mem) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, H5_ITER_ERROR, "unable to get iterator coordinates")
+    /* Sanity check */
+    HDassert(last);
+    HDassert(udata);
+    HDassert(udata->common.layout);
+    HDassert(udata->common.scaled);
 
-    /* Add point to memory selection for chunk */
-    if (fm->msel_type == H5S_SEL_POINTS) {
-        if (H5S_select_elements(chunk_info->mspace, H5S_SELECT_APPEND, (size_t)1, coords_in_mem) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, H5_ITER_ERROR, "unable to select element")
-    } /* end if */
-    else {
-        if (H5S_hyper_add_span_element(chunk_info->mspace, fm->m_ndims, coords_in_mem) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, H5_ITER_ERROR, "unable to select element")
-    } /* end else */
+    /* Stored the information to cache */
+    H5MM_memcpy(last->scaled, udata->common.scaled, sizeof(hsize_t) * udata->common.layout->ndims);
+    last->addr = udata->chunk_block.offset;
+    H5_CHECKED_ASSIGN(last->nbytes, uint32_t, udata->chunk_block.length, hsize_t);
+    last->chunk_idx   = udata->chunk_idx;
+    last->filter_mask = udata->filter_mask;
 
-    /* Move memory selection iterator to next element in selection */
-    if (H5S_SELECT_ITER_NEXT(&fm->mem_iter, (size_t)1) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTNEXT, H5_ITER_ERROR, "unable to move to next iterator location")
+    /* Indicate that the cached info is valid */
+    last->valid = TRUE;
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_mem_cb() */
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D__chunk_cinfo_cache_update() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cacheable
+ * Function:    H5D__chunk_cinfo_cache_found
  *
- * Purpose:    A small internal function to if it's possible to load the
- *              chunk into cache.
+ * Purpose:    Look for chunk info in cache
  *
- * Return:    TRUE or FALSE
+ * Return:    TRUE/FALSE/FAIL
  *
- * Programmer:    Raymond Lu
- *        17 July 2007
+ * Programmer:    Quincey Koziol
+ *              November 27, 2007
  *
  *-------------------------------------------------------------------------
  */
-htri_t
-H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op)
+static hbool_t
+H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *udata)
 {
-    const H5D_t *dataset     = io_info->dset; /* Local pointer to dataset info */
-    hbool_t      has_filters = FALSE;         /* Whether there are filters on the chunk or not */
-    htri_t       ret_value   = FAIL;          /* Return value */
+    hbool_t ret_value = FALSE; /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC_NOERR
 
     /* Sanity check */
-    HDassert(io_info);
-    HDassert(dataset);
+    HDassert(last);
+    HDassert(udata);
+    HDassert(udata->common.layout);
+    HDassert(udata->common.scaled);
 
-    /* Must bring the whole chunk in if there are any filters on the chunk.
-     * Make sure to check if filters are on the dataset but disabled for the
-     * chunk because it is a partial edge chunk. */
-    if (dataset->shared->dcpl_cache.pline.nused > 0) {
-        if (dataset->shared->layout.u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) {
-            has_filters = !H5D__chunk_is_partial_edge_chunk(
-                io_info->dset->shared->ndims, io_info->dset->shared->layout.u.chunk.dim,
-                io_info->store->chunk.scaled, io_info->dset->shared->curr_dims);
-        } /* end if */
-        else
-            has_filters = TRUE;
-    } /* end if */
+    /* Check if the cached information is what is desired */
+    if (last->valid) {
+        unsigned u; /* Local index variable */
 
-    if (has_filters)
-        ret_value = TRUE;
-    else {
-#ifdef H5_HAVE_PARALLEL
-        /* If MPI based VFD is used and the file is opened for write access, must
-         *         bypass the chunk-cache scheme because other MPI processes could
-         *         be writing to other elements in the same chunk.  Do a direct
-         *         write-through of only the elements requested.
-         */
-        if (io_info->using_mpi_vfd && (H5F_ACC_RDWR & H5F_INTENT(dataset->oloc.file)))
-            ret_value = FALSE;
-        else {
-#endif /* H5_HAVE_PARALLEL */
-            /* If the chunk is too large to keep in the cache and if we don't
-             * need to write the fill value, then don't load the chunk into the
-             * cache, just write the data to it directly.
-             */
-            H5_CHECK_OVERFLOW(dataset->shared->layout.u.chunk.size, uint32_t, size_t);
-            if ((size_t)dataset->shared->layout.u.chunk.size > dataset->shared->cache.chunk.nbytes_max) {
-                if (write_op && !H5F_addr_defined(caddr)) {
-                    const H5O_fill_t *fill = &(dataset->shared->dcpl_cache.fill); /* Fill value info */
-                    H5D_fill_value_t  fill_status;                                /* Fill value status */
+        /* Check that the scaled offset is the same */
+        for (u = 0; u < udata->common.layout->ndims; u++)
+            if (last->scaled[u] != udata->common.scaled[u])
+                HGOTO_DONE(FALSE)
 
-                    /* Revtrieve the fill value status */
-                    if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
-                        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+        /* Retrieve the information from the cache */
+        udata->chunk_block.offset = last->addr;
+        udata->chunk_block.length = last->nbytes;
+        udata->chunk_idx          = last->chunk_idx;
+        udata->filter_mask        = last->filter_mask;
 
-                    /* If the fill value needs to be written then we will need
-                     * to use the cache to write the fill value */
-                    if (fill->fill_time == H5D_FILL_TIME_ALLOC ||
-                        (fill->fill_time == H5D_FILL_TIME_IFSET &&
-                         (fill_status == H5D_FILL_VALUE_USER_DEFINED ||
-                          fill_status == H5D_FILL_VALUE_DEFAULT)))
-                        ret_value = TRUE;
-                    else
-                        ret_value = FALSE;
-                }
-                else
-                    ret_value = FALSE;
-            }
-            else
-                ret_value = TRUE;
-#ifdef H5_HAVE_PARALLEL
-        } /* end else */
-#endif    /* H5_HAVE_PARALLEL */
-    } /* end else */
+        /* Indicate that the data was found */
+        HGOTO_DONE(TRUE)
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cacheable() */
+} /* H5D__chunk_cinfo_cache_found() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_read
+ * Function:    H5D__chunk_idx_cache_load
  *
- * Purpose:    Read from a chunked dataset.
- *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Reads the whole chunk index of DSET into an in-memory copy,
+ *              which answers the dataset's chunk lookups from then on.
  *
- * Programmer:    Raymond Lu
- *        Thursday, April 10, 2003
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t H5_ATTR_UNUSED nelmts,
-                const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
-                H5D_chunk_map_t *fm)
+H5D__chunk_idx_cache_load(const H5D_t *dset)
 {
-    H5SL_node_t * chunk_node;                    /* Current node in chunk skip list */
-    H5D_io_info_t nonexistent_io_info;           /* "nonexistent" I/O info object */
-    H5D_io_info_t ctg_io_info;                   /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;                     /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;                   /* Compact I/O info object */
-    H5D_storage_t cpt_store;                     /* Chunk storage information as compact dataset */
-    hbool_t       cpt_dirty;                     /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t      src_accessed_bytes  = 0;       /* Total accessed size in a chunk */
-    hbool_t       skip_missing_chunks = FALSE;   /* Whether to skip missing chunks */
-    herr_t        ret_value           = SUCCEED; /*return value        */
+    H5D_rdcc_t *           rdcc  = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5O_storage_chunk_t *  sc    = &(dset->shared->layout.storage.u.chunk);
+    H5D_chunk_idx_cache_t *cache = NULL;    /* In-memory chunk index */
+    herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(io_info);
-    HDassert(io_info->u.rbuf);
-    HDassert(type_info);
-    HDassert(fm);
-
-    /* Set up "nonexistent" I/O info object */
-    H5MM_memcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
-    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
-
-    /* Set up contiguous I/O info object */
-    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
-    ctg_io_info.store      = &ctg_store;
-    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
-
-    /* Initialize temporary contiguous storage info */
-    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size,
-                      uint32_t);
-
-    /* Set up compact I/O info object */
-    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
-    cpt_io_info.store      = &cpt_store;
-    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+    HDassert(rdcc->idx_cache_on);
+    HDassert(NULL == rdcc->idx_cache);
 
-    /* Initialize temporary compact storage info */
-    cpt_store.compact.dirty = &cpt_dirty;
+    if (NULL == (cache = H5FL_CALLOC(H5D_chunk_idx_cache_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate in-memory chunk index")
+    cache->ndims = dset->shared->layout.u.chunk.ndims - 1;
 
-    {
-        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill); /* Fill value info */
-        H5D_fill_value_t  fill_status;                                      /* Fill value status */
+    /* An index that doesn't exist yet has no chunks */
+    if (H5F_addr_defined(sc->idx_addr)) {
+        H5D_chk_idx_info_t idx_info; /* Chunked index info */
 
-        /* Check the fill value status */
-        if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
-            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+        /* Compose chunked index info struct */
+        idx_info.f       = dset->oloc.file;
+        idx_info.pline   = &dset->shared->dcpl_cache.pline;
+        idx_info.layout  = &dset->shared->layout.u.chunk;
+        idx_info.storage = sc;
 
-        /* If we are never to return fill values, or if we would return them
-         * but they aren't set, set the flag to skip missing chunks.
-         */
-        if (fill->fill_time == H5D_FILL_TIME_NEVER ||
-            (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED &&
-             fill_status != H5D_FILL_VALUE_DEFAULT))
-            skip_missing_chunks = TRUE;
-    }
+        /* Copy a record for each allocated chunk */
+        if ((sc->ops->iterate)(&idx_info, H5D__chunk_idx_cache_load_cb, cache) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "unable to read chunk index into memory")
+    } /* end if */
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while (chunk_node) {
-        H5D_chunk_info_t *chunk_info; /* Chunk information */
-        H5D_chunk_ud_t    udata;      /* Chunk index pass-through    */
+    rdcc->idx_cache = cache;
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+done:
+    if (ret_value < 0 && cache)
+        H5D__chunk_idx_cache_free(cache);
 
-        /* Get the info for the chunk in the file */
-        if (H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_idx_cache_load() */
 
-        /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-                 (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_load_cb
+ *
+ * Purpose:     Chunk index iteration callback copying a chunk's record
+ *              into the in-memory chunk index.
+ *
+ * Return:      H5_ITER_CONT/H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_idx_cache_load_cb(const H5D_chunk_rec_t *chunk_rec, void *_cache)
+{
+    H5D_chunk_idx_cache_t *cache     = (H5D_chunk_idx_cache_t *)_cache; /* In-memory chunk index */
+    int                    ret_value = H5_ITER_CONT;                   /* Return value */
 
-        /* Check for non-existant chunk & skip it if appropriate */
-        if (H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint ||
-            !skip_missing_chunks) {
-            H5D_io_info_t *chk_io_info;  /* Pointer to I/O info object for this chunk */
-            void *         chunk = NULL; /* Pointer to locked chunk buffer */
-            htri_t         cacheable;    /* Whether the chunk is cacheable */
+    FUNC_ENTER_STATIC
 
-            /* Set chunk's [scaled] coordinates */
-            io_info->store->chunk.scaled = chunk_info->scaled;
+    if (H5D__chunk_idx_cache_add(cache, chunk_rec->scaled, chunk_rec->chunk_addr, chunk_rec->nbytes,
+                                 chunk_rec->filter_mask) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, H5_ITER_ERROR, "can't add chunk to in-memory chunk index")
 
-            /* Determine if we should use the chunk cache */
-            if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
-            if (cacheable) {
-                /* Load the chunk into cache and lock it. */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_idx_cache_load_cb() */
 
-                /* Compute # of bytes accessed in chunk */
-                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
-                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_hash
+ *
+ * Purpose:     Computes the hash chain of a chunk in the in-memory chunk
+ *              index from its scaled offset.
+ *
+ * Return:      Index of the hash chain
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__chunk_idx_cache_hash(const H5D_chunk_idx_cache_t *cache, const hsize_t *scaled)
+{
+    uint64_t val = 0;       /* Intermediate value */
+    unsigned u;             /* Local index variable */
+    size_t   ret_value = 0; /* Return value */
 
-                /* Lock the chunk into the cache */
-                if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    FUNC_ENTER_STATIC_NOERR
 
-                /* Set up the storage buffer information for this chunk */
-                cpt_store.compact.buf = chunk;
+    HDassert(cache);
+    HDassert(scaled);
 
-                /* Point I/O info at contiguous I/O info for this chunk */
-                chk_io_info = &cpt_io_info;
-            } /* end if */
-            else if (H5F_addr_defined(udata.chunk_block.offset)) {
-                /* Set up the storage address information for this chunk */
-                ctg_store.contig.dset_addr = udata.chunk_block.offset;
+    /* FNV-1a style mix of the coordinates */
+    for (u = 0; u < cache->ndims; u++)
+        val = (val ^ (uint64_t)scaled[u]) * (uint64_t)0x100000001b3ULL;
+    val ^= val >> 32;
 
-                /* Point I/O info at temporary I/O info for this chunk */
-                chk_io_info = &ctg_io_info;
-            } /* end else if */
-            else {
-                /* Point I/O info at "nonexistent" I/O info for this chunk */
-                chk_io_info = &nonexistent_io_info;
-            } /* end else */
+    ret_value = (size_t)(val & (uint64_t)(cache->nbuckets - 1));
 
-            /* Perform the actual read operation */
-            if ((io_info->io_ops.single_read)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
-                                              chunk_info->fspace, chunk_info->mspace) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_idx_cache_hash() */
 
-            /* Release the cache lock on the chunk. */
-            if (chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
-                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
-        } /* end if */
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_find
+ *
+ * Purpose:     Looks up the record of a chunk in the in-memory chunk
+ *              index.
+ *
+ * Return:      Pointer to the record, or NULL if there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_chunk_idx_cache_ent_t *
+H5D__chunk_idx_cache_find(const H5D_chunk_idx_cache_t *cache, const hsize_t *scaled)
+{
+    size_t                     n;                /* Current record plus one */
+    H5D_chunk_idx_cache_ent_t *ret_value = NULL; /* Return value */
 
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
-    } /* end while */
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(cache);
+    HDassert(scaled);
+
+    if (cache->nbuckets > 0)
+        for (n = cache->bucket[H5D__chunk_idx_cache_hash(cache, scaled)]; n; n = cache->ent[n - 1].next)
+            if (!HDmemcmp(&cache->scaled[(n - 1) * cache->ndims], scaled, cache->ndims * sizeof(hsize_t))) {
+                ret_value = &cache->ent[n - 1];
+                break;
+            } /* end if */
 
-done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_read() */
+} /* end H5D__chunk_idx_cache_find() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_write
+ * Function:    H5D__chunk_idx_cache_add
  *
- * Purpose:    Writes to a chunked dataset.
+ * Purpose:     Adds or updates the record of a chunk in the in-memory
+ *              chunk index.  An undefined ADDR records that the chunk
+ *              was removed.
  *
- * Return:    Non-negative on success/Negative on failure
+ *              The hash table is doubled whenever it holds as many
+ *              records as chains.
  *
- * Programmer:    Raymond Lu
- *        Thursday, April 10, 2003
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t H5_ATTR_UNUSED nelmts,
-                 const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
-                 H5D_chunk_map_t *fm)
+H5D__chunk_idx_cache_add(H5D_chunk_idx_cache_t *cache, const hsize_t *scaled, haddr_t addr, uint32_t nbytes,
+                         uint32_t filter_mask)
 {
-    H5SL_node_t * chunk_node;                   /* Current node in chunk skip list */
-    H5D_io_info_t ctg_io_info;                  /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;                    /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;                  /* Compact I/O info object */
-    H5D_storage_t cpt_store;                    /* Chunk storage information as compact dataset */
-    hbool_t       cpt_dirty;                    /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t      dst_accessed_bytes = 0;       /* Total accessed size in a chunk */
-    herr_t        ret_value          = SUCCEED; /* Return value        */
+    H5D_chunk_idx_cache_ent_t *ent;                 /* Chunk's record */
+    herr_t                     ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(io_info);
-    HDassert(io_info->u.wbuf);
-    HDassert(type_info);
-    HDassert(fm);
+    HDassert(cache);
+    HDassert(scaled);
 
-    /* Set up contiguous I/O info object */
-    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
-    ctg_io_info.store      = &ctg_store;
-    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+    if (NULL == (ent = H5D__chunk_idx_cache_find(cache, scaled))) {
+        size_t h; /* Chunk's hash chain */
 
-    /* Initialize temporary contiguous storage info */
-    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size,
-                      uint32_t);
+        /* Removing a chunk that isn't recorded changes nothing */
+        if (!H5F_addr_defined(addr))
+            HGOTO_DONE(SUCCEED)
 
-    /* Set up compact I/O info object */
-    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
-    cpt_io_info.store      = &cpt_store;
-    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+        /* Make room for another record */
+        if (cache->nents == cache->nalloc) {
+            size_t                     nalloc = MAX(2 * cache->nalloc, H5D_CHUNK_IDX_CACHE_NENTS_INIT);
+            H5D_chunk_idx_cache_ent_t *new_ent;
+            hsize_t *                  new_scaled;
+
+            if (NULL == (new_ent = (H5D_chunk_idx_cache_ent_t *)H5MM_realloc(
+                             cache->ent, nalloc * sizeof(H5D_chunk_idx_cache_ent_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't grow in-memory chunk index")
+            cache->ent = new_ent;
+            if (NULL == (new_scaled = (hsize_t *)H5MM_realloc(cache->scaled,
+                                                              nalloc * cache->ndims * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't grow in-memory chunk index")
+            cache->scaled = new_scaled;
+            cache->nalloc = nalloc;
+        } /* end if */
 
-    /* Initialize temporary compact storage info */
-    cpt_store.compact.dirty = &cpt_dirty;
+        /* Keep no more records than hash chains */
+        if (cache->nents >= cache->nbuckets) {
+            size_t  nbuckets = MAX(2 * cache->nbuckets, H5D_CHUNK_IDX_CACHE_NENTS_INIT);
+            size_t *new_bucket;
+            size_t  n;
+
+            if (NULL == (new_bucket = (size_t *)H5MM_calloc(nbuckets * sizeof(size_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't grow in-memory chunk index hash table")
+            H5MM_xfree(cache->bucket);
+            cache->bucket   = new_bucket;
+            cache->nbuckets = nbuckets;
+
+            /* Re-link the records into the new chains */
+            for (n = 0; n < cache->nents; n++) {
+                h                  = H5D__chunk_idx_cache_hash(cache, &cache->scaled[n * cache->ndims]);
+                cache->ent[n].next = cache->bucket[h];
+                cache->bucket[h]   = n + 1;
+            } /* end for */
+        }     /* end if */
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while (chunk_node) {
-        H5D_chunk_info_t * chunk_info;          /* Chunk information */
-        H5D_chk_idx_info_t idx_info;            /* Chunked index info */
-        H5D_io_info_t *    chk_io_info;         /* Pointer to I/O info object for this chunk */
-        void *             chunk;               /* Pointer to locked chunk buffer */
-        H5D_chunk_ud_t     udata;               /* Index pass-through    */
-        htri_t             cacheable;           /* Whether the chunk is cacheable */
-        hbool_t            need_insert = FALSE; /* Whether the chunk needs to be inserted into the index */
+        /* Append the record and link it into its chain */
+        H5MM_memcpy(&cache->scaled[cache->nents * cache->ndims], scaled, cache->ndims * sizeof(hsize_t));
+        ent              = &cache->ent[cache->nents];
+        h                = H5D__chunk_idx_cache_hash(cache, scaled);
+        ent->next        = cache->bucket[h];
+        cache->bucket[h] = ++cache->nents;
+    } /* end if */
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+    ent->addr        = addr;
+    ent->nbytes      = nbytes;
+    ent->filter_mask = filter_mask;
 
-        /* Look up the chunk */
-        if (H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_idx_cache_add() */
 
-        /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-                 (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_chunk_idx
+ *
+ * Purpose:     Computes the index of a chunk in an extensible or fixed
+ *              array chunk index, as their 'get_addr' callbacks do.
+ *
+ * Return:      Index of the chunk, or 0 for other chunk indices
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__chunk_idx_cache_chunk_idx(const H5O_layout_chunk_t *layout, H5D_chunk_index_t idx_type,
+                               const hsize_t *scaled)
+{
+    hsize_t ret_value = 0; /* Return value */
 
-        /* Set chunk's [scaled] coordinates */
-        io_info->store->chunk.scaled = chunk_info->scaled;
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Determine if we should use the chunk cache */
-        if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, TRUE)) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
-        if (cacheable) {
-            /* Load the chunk into cache.  But if the whole chunk is written,
-             * simply allocate space instead of load the chunk. */
-            hbool_t entire_chunk = TRUE; /* Whether whole chunk is selected */
+    if (H5D_CHUNK_IDX_EARRAY == idx_type && layout->u.earray.unlim_dim > 0) {
+        hsize_t  swizzled_coords[H5O_LAYOUT_NDIMS]; /* swizzled chunk coordinates */
+        unsigned ndims = (layout->ndims - 1);       /* Number of dimensions */
+        unsigned u;
 
-            /* Compute # of bytes accessed in chunk */
-            H5_CHECK_OVERFLOW(type_info->dst_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
-            dst_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->dst_type_size;
+        /* Compute coordinate offset from scaled offset */
+        for (u = 0; u < ndims; u++)
+            swizzled_coords[u] = scaled[u] * layout->dim[u];
 
-            /* Determine if we will access all the data in the chunk */
-            if (dst_accessed_bytes != ctg_store.contig.dset_size ||
-                (chunk_info->chunk_points * type_info->src_type_size) != ctg_store.contig.dset_size ||
-                fm->fsel_type == H5S_SEL_POINTS)
-                entire_chunk = FALSE;
+        H5VM_swizzle_coords(hsize_t, swizzled_coords, layout->u.earray.unlim_dim);
 
-            /* Lock the chunk into the cache */
-            if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE)))
-                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+        ret_value = H5VM_chunk_index(ndims, swizzled_coords, layout->u.earray.swizzled_dim,
+                                     layout->u.earray.swizzled_max_down_chunks);
+    } /* end if */
+    else if (H5D_CHUNK_IDX_EARRAY == idx_type || H5D_CHUNK_IDX_FARRAY == idx_type)
+        ret_value = H5VM_array_offset_pre((layout->ndims - 1), layout->max_down_chunks, scaled);
 
-            /* Set up the storage buffer information for this chunk */
-            cpt_store.compact.buf = chunk;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_idx_cache_chunk_idx() */
 
-            /* Point I/O info at main I/O info for this chunk */
-            chk_io_info = &cpt_io_info;
-        } /* end if */
-        else {
-            /* If the chunk hasn't been allocated on disk, do so now. */
-            if (!H5F_addr_defined(udata.chunk_block.offset)) {
-                /* Compose chunked index info struct */
-                idx_info.f       = io_info->dset->oloc.file;
-                idx_info.pline   = &(io_info->dset->shared->dcpl_cache.pline);
-                idx_info.layout  = &(io_info->dset->shared->layout.u.chunk);
-                idx_info.storage = &(io_info->dset->shared->layout.storage.u.chunk);
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_free
+ *
+ * Purpose:     Releases an in-memory chunk index.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_idx_cache_free(H5D_chunk_idx_cache_t *cache)
+{
+    FUNC_ENTER_STATIC_NOERR
 
-                /* Set up the size of chunk for user data */
-                udata.chunk_block.length = io_info->dset->shared->layout.u.chunk.size;
+    HDassert(cache);
 
-                /* Allocate the chunk */
-                if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert,
-                                          chunk_info->scaled) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
-                                "unable to insert/resize chunk on chunk level")
+    H5MM_xfree(cache->ent);
+    H5MM_xfree(cache->scaled);
+    H5MM_xfree(cache->bucket);
+    cache = H5FL_FREE(H5D_chunk_idx_cache_t, cache);
 
-                /* Make sure the address of the chunk is returned. */
-                if (!H5F_addr_defined(udata.chunk_block.offset))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_idx_cache_free() */
 
-                /* Cache the new chunk information */
-                H5D__chunk_cinfo_cache_update(&io_info->dset->shared->cache.chunk.last, &udata);
-            } /* end if */
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_insert
+ *
+ * Purpose:     Records a chunk just inserted into the chunk index of DSET
+ *              in the in-memory copy of the index, if it is loaded.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_idx_cache_insert(const H5D_t *dset, const H5D_chunk_ud_t *udata)
+{
+    H5D_rdcc_t *rdcc      = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    herr_t      ret_value = SUCCEED;                      /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(udata);
+    HDassert(udata->common.scaled);
+
+    if (rdcc->idx_cache) {
+        uint32_t nbytes; /* Size of stored data */
+
+        H5_CHECKED_ASSIGN(nbytes, uint32_t, udata->chunk_block.length, hsize_t);
+        if (H5D__chunk_idx_cache_add(rdcc->idx_cache, udata->common.scaled, udata->chunk_block.offset, nbytes,
+                                     udata->filter_mask) < 0) {
+            /* Drop the copy rather than leave it stale, it is read again on the next lookup */
+            H5D__chunk_idx_cache_free(rdcc->idx_cache);
+            rdcc->idx_cache = NULL;
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk to in-memory chunk index")
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_idx_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_create
+ *
+ * Purpose:    Creates a new chunked storage index and initializes the
+ *        layout information with information about the storage.  The
+ *        layout info should be immediately written to the object header.
+ *
+ * Return:    Non-negative on success (with the layout information initialized
+ *        and ready to write to an object header). Negative on failure.
+ *
+ * Programmer:    Quincey Koziol
+ *        Thursday, May 22, 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_create(const H5D_t *dset /*in,out*/)
+{
+    H5D_chk_idx_info_t   idx_info; /* Chunked index info */
+    H5O_storage_chunk_t *sc        = &(dset->shared->layout.storage.u.chunk);
+    herr_t               ret_value = SUCCEED; /* Return value */
 
-            /* Set up the storage address information for this chunk */
-            ctg_store.contig.dset_addr = udata.chunk_block.offset;
+    FUNC_ENTER_PACKAGE
 
-            /* No chunk cached */
-            chunk = NULL;
+    /* Check args */
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(dset->shared->layout.u.chunk.ndims > 0 &&
+             dset->shared->layout.u.chunk.ndims <= H5O_LAYOUT_NDIMS);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
 
-            /* Point I/O info at temporary I/O info for this chunk */
-            chk_io_info = &ctg_io_info;
-        } /* end else */
+#ifndef NDEBUG
+    {
+        unsigned u; /* Local index variable */
 
-        /* Perform the actual write operation */
-        if ((io_info->io_ops.single_write)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
-                                           chunk_info->fspace, chunk_info->mspace) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked write failed")
+        for (u = 0; u < dset->shared->layout.u.chunk.ndims; u++)
+            HDassert(dset->shared->layout.u.chunk.dim[u] > 0);
+    }
+#endif
 
-        /* Release the cache lock on the chunk, or insert chunk into index. */
-        if (chunk) {
-            if (H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
-                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
-        } /* end if */
-        else {
-            if (need_insert && io_info->dset->shared->layout.storage.u.chunk.ops->insert)
-                if ((io_info->dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, &udata, NULL) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
-        } /* end else */
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
 
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
-    } /* end while */
+    /* Create the index for the chunks */
+    if ((sc->ops->create)(&idx_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_write() */
+} /* end H5D__chunk_create() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_flush
+ * Function:    H5D__chunk_hash_val
  *
- * Purpose:    Writes all dirty chunks to disk and optionally preempts them
- *        from the cache.
+ * Purpose:     To calculate an index based on the dataset's scaled
+ *              coordinates and sizes of the faster dimensions.
  *
- * Return:    Non-negative on success/Negative on failure
+ * Return:    Hash value index
  *
- * Programmer:    Robb Matzke
- *              Thursday, May 21, 1998
+ * Programmer:    Vailin Choi; Nov 2014
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_flush(H5D_t *dset)
+static unsigned
+H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
 {
-    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk);
-    H5D_rdcc_ent_t *ent, *next;
-    unsigned        nerrors   = 0;       /* Count of any errors encountered when flushing chunks */
-    herr_t          ret_value = SUCCEED; /* Return value */
+    hsize_t  val;                   /* Intermediate value */
+    unsigned ndims = shared->ndims; /* Rank of dataset */
+    unsigned ret   = 0;             /* Value to return */
+    unsigned u;                     /* Local index variable */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
     /* Sanity check */
-    HDassert(dset);
+    HDassert(shared);
+    HDassert(scaled);
 
-    /* Loop over all entries in the chunk cache */
-    for (ent = rdcc->head; ent; ent = next) {
-        next = ent->next;
-        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
-            nerrors++;
+    /* If the fastest changing dimension doesn't have enough entropy, use
+     *  other dimensions too
+     */
+    val = scaled[0];
+    for (u = 1; u < ndims; u++) {
+        val <<= shared->cache.chunk.scaled_encode_bits[u];
+        val ^= scaled[u];
     } /* end for */
-    if (nerrors)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_flush() */
+    /* Modulo value against the number of array slots */
+    ret = (unsigned)(val % shared->cache.chunk.nslots);
+
+    FUNC_LEAVE_NOAPI(ret)
+} /* H5D__chunk_hash_val() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_io_term
+ * Function:    H5D__chunk_lookup
  *
- * Purpose:    Destroy I/O operation information.
+ * Purpose:    Loops up a chunk in cache and on disk, and retrieves
+ *              information about that chunk.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *        Saturday, May 17, 2003
+ * Programmer:    Albert Cheng
+ *              June 27, 1998
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_io_term(const H5D_chunk_map_t *fm)
+herr_t
+H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udata)
 {
-    herr_t ret_value = SUCCEED; /*return value        */
+    H5D_rdcc_ent_t *     ent = NULL; /* Cache entry */
+    H5O_storage_chunk_t *sc  = &(dset->shared->layout.storage.u.chunk);
+    unsigned             idx;                 /* Index of chunk in cache, if present */
+    hbool_t              found     = FALSE;   /* In cache? */
+    herr_t               ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE
 
-    /* Single element I/O vs. multiple element I/O cleanup */
-    if (fm->use_single) {
-        /* Sanity checks */
-        HDassert(fm->sel_chunks == NULL);
-        HDassert(fm->single_chunk_info);
-        HDassert(fm->single_chunk_info->fspace_shared);
-        HDassert(fm->single_chunk_info->mspace_shared);
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(dset->shared->layout.u.chunk.ndims > 0);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    HDassert(scaled);
+    HDassert(udata);
 
-        /* Reset the selection for the single element I/O */
-        H5S_select_all(fm->single_space, TRUE);
+    /* Initialize the query information about the chunk we are looking for */
+    udata->common.layout  = &(dset->shared->layout.u.chunk);
+    udata->common.storage = sc;
+    udata->common.scaled  = scaled;
+
+    /* Reset information about the chunk we are looking for */
+    udata->chunk_block.offset = HADDR_UNDEF;
+    udata->chunk_block.length = 0;
+    udata->filter_mask        = 0;
+    udata->new_unfilt_chunk   = FALSE;
+
+    /* Check for chunk in cache */
+    if (dset->shared->cache.chunk.open_cache) {
+        /* Determine the chunk's hash chain in the shared cache and search it */
+        idx   = H5D__chunk_open_hash_val(dset->shared->cache.chunk.open_cache, dset->shared, scaled);
+        ent   = H5D__chunk_cache_find(dset->shared, idx, scaled);
+        found = (ent != NULL);
+    } /* end if */
+    else if (dset->shared->cache.chunk.nslots > 0) {
+        /* Determine the chunk's location in the hash table */
+        idx = H5D__chunk_hash_val(dset->shared, scaled);
+
+        /* Get the chunk cache entry for that location */
+        ent = dset->shared->cache.chunk.slot[idx];
+        if (ent) {
+            unsigned u; /* Counter */
+
+            /* Speculatively set the 'found' flag */
+            found = TRUE;
+
+            /* Verify that the cache entry is the correct chunk */
+            for (u = 0; u < dset->shared->ndims; u++)
+                if (scaled[u] != ent->scaled[u]) {
+                    found = FALSE;
+                    break;
+                } /* end if */
+        }         /* end if */
+    }             /* end if */
+
+    /* Retrieve chunk addr */
+    if (found) {
+        udata->idx_hint           = idx;
+        udata->chunk_block.offset = ent->chunk_block.offset;
+        udata->chunk_block.length = ent->chunk_block.length;
+        ;
+        udata->chunk_idx = ent->chunk_idx;
     } /* end if */
     else {
-        /* Release the nodes on the list of selected chunks */
-        if (fm->sel_chunks)
-            if (H5SL_free(fm->sel_chunks, H5D__free_chunk_info, NULL) < 0)
-                HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
-    } /* end else */
+        /* Invalidate idx_hint, to signal that the chunk is not in cache */
+        udata->idx_hint = UINT_MAX;
+
+        /* Check for cached information */
+        if (!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
+            H5D_chk_idx_info_t idx_info; /* Chunked index info */
+
+            /* Answer from the in-memory copy of the chunk index, reading it on first use */
+            if (dset->shared->cache.chunk.idx_cache_on) {
+                const H5D_chunk_idx_cache_ent_t *idx_ent; /* Chunk's record */
+
+                if (NULL == dset->shared->cache.chunk.idx_cache && H5D__chunk_idx_cache_load(dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "can't read chunk index into memory")
+
+                idx_ent = H5D__chunk_idx_cache_find(dset->shared->cache.chunk.idx_cache, scaled);
+                if (idx_ent && H5F_addr_defined(idx_ent->addr)) {
+                    udata->chunk_block.offset = idx_ent->addr;
+                    udata->chunk_block.length = idx_ent->nbytes;
+                    udata->filter_mask        = idx_ent->filter_mask;
+                } /* end if */
+                udata->chunk_idx =
+                    H5D__chunk_idx_cache_chunk_idx(&dset->shared->layout.u.chunk, sc->idx_type, scaled);
+
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+
+            /* Compose chunked index info struct */
+            idx_info.f       = dset->oloc.file;
+            idx_info.pline   = &dset->shared->dcpl_cache.pline;
+            idx_info.layout  = &dset->shared->layout.u.chunk;
+            idx_info.storage = sc;
 
-    /* Free the memory chunk dataspace template */
-    if (fm->mchunk_tmpl)
-        if (H5S_close(fm->mchunk_tmpl) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release memory chunk dataspace template")
 #ifdef H5_HAVE_PARALLEL
-    if (fm->select_chunk)
-        H5MM_xfree(fm->select_chunk);
+            /* Disable collective metadata read for chunk indexes as it is
+             * highly unlikely that users would read the same chunks from all
+             * processes.
+             */
+            if (H5F_HAS_FEATURE(idx_info.f, H5FD_FEAT_HAS_MPI))
+                H5CX_set_coll_metadata_read(FALSE);
 #endif /* H5_HAVE_PARALLEL */
 
+            /* Go get the chunk information */
+            if ((sc->ops->get_addr)(&idx_info, udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
+
+                /*
+                 * Cache the information retrieved.
+                 *
+                 * Note that if we are writing to the dataset in parallel and filters
+                 * are involved, we skip caching this information as it is highly likely
+                 * that the chunk information will be invalidated as a result of the
+                 * filter operation (e.g. the chunk gets re-allocated to a different
+                 * address in the file and/or gets re-allocated with a different size).
+                 * If we were to cache this information, subsequent reads/writes would
+                 * retrieve the invalid information and cause a variety of issues.
+                 *
+                 * It has been verified that in the serial library, when writing to chunks
+                 * with the real chunk cache disabled and with filters involved, the
+                 * functions within this file are correctly called in such a manner that
+                 * this single chunk cache is always updated correctly. Therefore, this
+                 * check is not needed for the serial library.
+                 *
+                 * This is an ugly and potentially frail check, but the
+                 * H5D__chunk_cinfo_cache_reset() function is not currently available
+                 * to functions outside of this file, so outside functions can not
+                 * invalidate this single chunk cache. Even if the function were available,
+                 * this check prevents us from doing the work of going through and caching
+                 * each chunk in the write operation, when we're only going to invalidate
+                 * the cache at the end of a parallel write anyway.
+                 *
+                 *  - JTH (7/13/2018)
+                 */
+#ifdef H5_HAVE_PARALLEL
+            if (!((H5F_HAS_FEATURE(idx_info.f, H5FD_FEAT_HAS_MPI)) &&
+                  (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR) && dset->shared->dcpl_cache.pline.nused))
+#endif
+                H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+        } /* end if */
+    }     /* end else */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_io_term() */
+} /* H5D__chunk_lookup() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_dest
+ * Function:    H5D__chunk_flush_entry
  *
- * Purpose:    Destroy the entire chunk cache by flushing dirty entries,
- *        preempting all entries, and freeing the cache itself.
+ * Purpose:    Writes a chunk to disk.  If RESET is non-zero then the
+ *        entry is cleared -- it's slightly faster to flush a chunk if
+ *        the RESET flag is turned on because it results in one fewer
+ *        memory copy.
  *
  * Return:    Non-negative on success/Negative on failure
  *
@@ -2853,805 +4692,1054 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_dest(H5D_t *dset)
+H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
 {
-    H5D_chk_idx_info_t   idx_info;                            /* Chunked index info */
-    H5D_rdcc_t *         rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
-    H5D_rdcc_ent_t *     ent = NULL, *next = NULL;            /* Pointer to current & next cache entries */
-    int                  nerrors   = 0;                       /* Accumulated count of errors */
-    H5O_storage_chunk_t *sc        = &(dset->shared->layout.storage.u.chunk);
-    herr_t               ret_value = SUCCEED; /* Return value */
+    void *               buf                = NULL; /* Temporary buffer        */
+    hbool_t              point_of_no_return = FALSE;
+    H5O_storage_chunk_t *sc                 = &(dset->shared->layout.storage.u.chunk);
+    herr_t               ret_value          = SUCCEED; /* Return value            */
 
-    FUNC_ENTER_STATIC_TAG(dset->oloc.addr)
+    FUNC_ENTER_STATIC
 
-    /* Sanity checks */
     HDassert(dset);
+    HDassert(dset->shared);
     H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    HDassert(ent);
+    HDassert(!ent->locked);
 
-    /* Flush all the cached chunks */
-    for (ent = rdcc->head; ent; ent = next) {
-        next = ent->next;
-        if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
-            nerrors++;
-    } /* end for */
+    buf = ent->chunk;
+    if (ent->dirty) {
+        H5D_chk_idx_info_t idx_info;            /* Chunked index info */
+        H5D_chunk_ud_t     udata;               /* pass through B-tree        */
+        hbool_t            must_alloc  = FALSE; /* Whether the chunk must be allocated */
+        hbool_t            need_insert = FALSE; /* Whether the chunk needs to be inserted into the index */
 
-    /* Continue even if there are failures. */
-    if (nerrors)
-        HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+        /* Set up user data for index callbacks */
+        udata.common.layout      = &dset->shared->layout.u.chunk;
+        udata.common.storage     = sc;
+        udata.common.scaled      = ent->scaled;
+        udata.chunk_block.offset = ent->chunk_block.offset;
+        udata.chunk_block.length = dset->shared->layout.u.chunk.size;
+        udata.filter_mask        = 0;
+        udata.chunk_idx          = ent->chunk_idx;
 
-    /* Release cache structures */
-    if (rdcc->slot)
-        rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
-    HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
+        /* Should the chunk be filtered before writing it to disk? */
+        if (dset->shared->dcpl_cache.pline.nused && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
+            H5Z_EDC_t err_detect;                       /* Error detection info */
+            H5Z_cb_t  filter_cb;                        /* I/O filter callback function */
+            size_t    alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
+            size_t    nbytes;                           /* Chunk size (in bytes) */
 
-    /* Compose chunked index info struct */
-    idx_info.f       = dset->oloc.file;
-    idx_info.pline   = &dset->shared->dcpl_cache.pline;
-    idx_info.layout  = &dset->shared->layout.u.chunk;
-    idx_info.storage = sc;
+            if (ent->image) {
+                /* The chunk has already been run through the pipeline by a
+                 * filter thread; write that image out.
+                 */
+                buf               = ent->image;
+                nbytes            = ent->image_size;
+                udata.filter_mask = ent->image_mask;
+                ent->image        = NULL;
+            } /* end if */
+            else {
+                /* Retrieve filter settings from API context */
+                if (H5CX_get_err_detect(&err_detect) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+                if (H5CX_get_filter_cb(&filter_cb) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
 
-    /* Free any index structures */
-    if (sc->ops->dest && (sc->ops->dest)(&idx_info) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk index info")
+                if (!reset) {
+                    /*
+                     * Copy the chunk to a new buffer before running it through
+                     * the pipeline because we'll want to save the original buffer
+                     * for later.
+                     */
+                    if (NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    H5MM_memcpy(buf, ent->chunk, alloc);
+                } /* end if */
+                else {
+                    /*
+                     * If we are resetting and something goes wrong after this
+                     * point then it's too late to recover because we may have
+                     * destroyed the original data by calling H5Z_pipeline().
+                     * The only safe option is to continue with the reset
+                     * even if we can't write the data to disk.
+                     */
+                    point_of_no_return = TRUE;
+                    ent->chunk         = NULL;
+                } /* end else */
+                H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+                if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
+                                 filter_cb, &nbytes, &alloc, &buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+            } /* end else */
+#if H5_SIZEOF_SIZE_T > 4
+            /* Check for the chunk expanding too much to encode in a 32-bit value */
+            if (nbytes > ((size_t)0xffffffff))
+                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif /* H5_SIZEOF_SIZE_T > 4 */
+            H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, nbytes, size_t);
+
+            /* Indicate that the chunk must be allocated */
+            must_alloc = TRUE;
+        } /* end if */
+        else if (!H5F_addr_defined(udata.chunk_block.offset)) {
+            /* Indicate that the chunk must be allocated */
+            must_alloc = TRUE;
+
+            /* This flag could be set for this chunk, just remove and ignore it
+             */
+            ent->edge_chunk_state &= ~H5D_RDCC_NEWLY_DISABLED_FILTERS;
+        } /* end else */
+        else if (ent->edge_chunk_state & H5D_RDCC_NEWLY_DISABLED_FILTERS) {
+            /* Chunk on disk is still filtered, must insert to allocate correct
+             * size */
+            must_alloc = TRUE;
+
+            /* Set the disable filters field back to the standard disable
+             * filters setting, as it no longer needs to be inserted with every
+             * flush */
+            ent->edge_chunk_state &= ~H5D_RDCC_NEWLY_DISABLED_FILTERS;
+        } /* end else */
+
+        HDassert(!(ent->edge_chunk_state & H5D_RDCC_NEWLY_DISABLED_FILTERS));
+
+        /* Check if the chunk needs to be allocated (it also could exist already
+         *      and the chunk alloc operation could resize it)
+         */
+        if (must_alloc) {
+            /* Compose chunked index info struct */
+            idx_info.f       = dset->oloc.file;
+            idx_info.pline   = &dset->shared->dcpl_cache.pline;
+            idx_info.layout  = &dset->shared->layout.u.chunk;
+            idx_info.storage = sc;
+
+            /* Create the chunk it if it doesn't exist, or reallocate the chunk
+             *  if its size changed.
+             */
+            if (H5D__chunk_file_alloc(&idx_info, &(ent->chunk_block), &udata.chunk_block, &need_insert,
+                                      ent->scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
+
+            /* Update the chunk entry's info, in case it was allocated or relocated */
+            ent->chunk_block.offset = udata.chunk_block.offset;
+            ent->chunk_block.length = udata.chunk_block.length;
+        } /* end if */
+
+        /* Write the data to the file */
+        HDassert(H5F_addr_defined(udata.chunk_block.offset));
+        H5_CHECK_OVERFLOW(udata.chunk_block.length, hsize_t, size_t);
+        if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset,
+                                   (size_t)udata.chunk_block.length, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+
+        /* Insert the chunk record into the index */
+        if (need_insert && sc->ops->insert) {
+            if ((sc->ops->insert)(&idx_info, &udata, dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+            if (H5D__chunk_idx_cache_insert(dset, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update in-memory chunk index")
+        } /* end if */
+
+        /* Cache the chunk's info, in case it's accessed again shortly */
+        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+
+        /* Mark cache entry as clean */
+        ent->dirty = FALSE;
+
+        /* Increment # of flushed entries */
+        dset->shared->cache.chunk.stats.nflushes++;
+    } /* end if */
+
+    /* Reset, but do not free or removed from list */
+    if (reset) {
+        point_of_no_return = FALSE;
+        if (buf == ent->chunk)
+            buf = NULL;
+        if (ent->chunk != NULL)
+            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
+                                                         ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
+                                                              ? NULL
+                                                              : &(dset->shared->dcpl_cache.pline)));
+    } /* end if */
 
 done:
-    FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* end H5D__chunk_dest() */
+    /* Free the temp buffer only if it's different than the entry chunk */
+    if (buf != ent->chunk)
+        H5MM_xfree(buf);
+
+    /*
+     * If we reached the point of no return then we have no choice but to
+     * reset the entry.  This can only happen if RESET is true but the
+     * output pipeline failed.  Do not free the entry or remove it from the
+     * list.
+     */
+    if (ret_value < 0 && point_of_no_return)
+        if (ent->chunk)
+            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
+                                                         ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
+                                                              ? NULL
+                                                              : &(dset->shared->dcpl_cache.pline)));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_flush_entry() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D_chunk_idx_reset
+ * Function:    H5D__chunk_cache_evict
  *
- * Purpose:    Reset index information
+ * Purpose:     Preempts the specified entry from the cache, flushing it to
+ *              disk if necessary.
  *
- * Return:    Non-negative on success/Negative on failure
+ * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *              Thursday, January 15, 2009
+ * Programmer:  Robb Matzke
+ *              Thursday, May 21, 1998
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr)
+static herr_t
+H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5D_rdcc_t *rdcc      = &(dset->shared->cache.chunk);
+    herr_t      ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_STATIC
 
     /* Sanity checks */
-    HDassert(storage);
-    HDassert(storage->ops);
-    H5D_CHUNK_STORAGE_INDEX_CHK(storage);
+    HDassert(dset);
+    HDassert(ent);
+    HDassert(!ent->locked);
+    HDassert(rdcc->open_cache || ent->idx < rdcc->nslots);
 
-    /* Reset index structures */
-    if ((storage->ops->reset)(storage, reset_addr) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to reset chunk index info")
+    if (flush) {
+        /* Flush */
+        if (H5D__chunk_flush_entry(dset, ent, TRUE) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+    } /* end if */
+    else {
+        /* Don't flush, just free chunk (and any filtered image of it) */
+        ent->image = H5MM_xfree(ent->image);
+        if (ent->chunk != NULL)
+            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
+                                                         ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
+                                                              ? NULL
+                                                              : &(dset->shared->dcpl_cache.pline)));
+    } /* end else */
+
+    /* Unlink from list */
+    if (ent->prev)
+        ent->prev->next = ent->next;
+    else
+        rdcc->head = ent->next;
+    if (ent->next)
+        ent->next->prev = ent->prev;
+    else
+        rdcc->tail = ent->prev;
+    ent->prev = ent->next = NULL;
+
+    /* Unlink from the shared cache's hash chain and LRU list */
+    if (rdcc->open_cache)
+        H5D__chunk_open_cache_remove(rdcc->open_cache, ent);
+    else {
+        /* Unlink from temporary list */
+        if (ent->tmp_prev) {
+            HDassert(rdcc->tmp_head->tmp_next);
+            ent->tmp_prev->tmp_next = ent->tmp_next;
+            if (ent->tmp_next) {
+                ent->tmp_next->tmp_prev = ent->tmp_prev;
+                ent->tmp_next           = NULL;
+            } /* end if */
+            ent->tmp_prev = NULL;
+        } /* end if */
+        else
+            /* Only clear hash table slot if the chunk was not on the temporary list
+             */
+            rdcc->slot[ent->idx] = NULL;
+
+        HDassert(rdcc->slot[ent->idx] != ent);
+    } /* end else */
+
+    /* Remove from cache */
+    ent->idx = UINT_MAX;
+    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
+    --rdcc->nused;
+
+    /* Free */
+    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
 
-done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D_chunk_idx_reset() */
+} /* end H5D__chunk_cache_evict() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cinfo_cache_reset
+ * Function:    H5D__chunk_cache_prune
  *
- * Purpose:    Reset the cached chunk info
+ * Purpose:    Prune the cache by preempting some things until the cache has
+ *        room for something which is SIZE bytes.  Only unlocked
+ *        entries are considered for preemption.
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Quincey Koziol
- *              November 27, 2007
+ * Programmer:    Robb Matzke
+ *              Thursday, May 21, 1998
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last)
+H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
 {
-    FUNC_ENTER_STATIC_NOERR
+    const H5D_rdcc_t *rdcc  = &(dset->shared->cache.chunk);
+    size_t            total = rdcc->nbytes_max;
+    const int         nmeth = 2;           /* Number of methods */
+    int               w[1];                /* Weighting as an interval */
+    H5D_rdcc_ent_t *  p[2], *cur;          /* List pointers */
+    H5D_rdcc_ent_t *  n[2];                /* List next pointers */
+    int               nerrors   = 0;       /* Accumulated error count during preemptions */
+    herr_t            ret_value = SUCCEED; /* Return value */
 
-    /* Sanity check */
-    HDassert(last);
+    FUNC_ENTER_STATIC
 
-    /* Indicate that the cached info is not valid */
-    last->valid = FALSE;
+    /*
+     * Preemption is accomplished by having multiple pointers (currently two)
+     * slide down the list beginning at the head. Pointer p(N+1) will start
+     * traversing the list when pointer pN reaches wN percent of the original
+     * list.  In other words, preemption method N gets to consider entries in
+     * approximate least recently used order w0 percent before method N+1
+     * where 100% means tha method N will run to completion before method N+1
+     * begins.  The pointers participating in the list traversal are each
+     * given a chance at preemption before any of the pointers are advanced.
+     */
+    w[0] = (int)(rdcc->nused * rdcc->w0);
+    p[0] = rdcc->head;
+    p[1] = NULL;
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
-} /* H5D__chunk_cinfo_cache_reset() */
+    while ((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
+        int i; /* Local index variable */
+
+        /* Introduce new pointers */
+        for (i = 0; i < nmeth - 1; i++)
+            if (0 == w[i])
+                p[i + 1] = rdcc->head;
+
+        /* Compute next value for each pointer */
+        for (i = 0; i < nmeth; i++)
+            n[i] = p[i] ? p[i]->next : NULL;
+
+        /* Give each method a chance */
+        for (i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
+            if (0 == i && p[0] && !p[0]->locked &&
+                ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
+                 (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
+                 (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
+                /*
+                 * Method 0: Preempt entries that have been completely written
+                 * and/or completely read but not entries that are partially
+                 * written or partially read.
+                 */
+                cur = p[0];
+            }
+            else if (1 == i && p[1] && !p[1]->locked) {
+                /*
+                 * Method 1: Preempt the entry without regard to
+                 * considerations other than being locked.  This is the last
+                 * resort preemption.
+                 */
+                cur = p[1];
+            }
+            else {
+                /* Nothing to preempt at this point */
+                cur = NULL;
+            }
+
+            if (cur) {
+                int j; /* Local index variable */
+
+                for (j = 0; j < nmeth; j++) {
+                    if (p[j] == cur)
+                        p[j] = NULL;
+                    if (n[j] == cur)
+                        n[j] = cur->next;
+                } /* end for */
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+                /* Encode this and the following dirty chunks, which are
+                 * likely to be preempted next, on the filter threads
+                 */
+                if (cur->dirty && !cur->image && H5D__chunk_encode_ahead(dset, cur) < 0)
+                    nerrors++;
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+                if (H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
+                    nerrors++;
+                dset->shared->cache.chunk.stats.nevictions++;
+            } /* end if */
+        }     /* end for */
+
+        /* Advance pointers */
+        for (i = 0; i < nmeth; i++)
+            p[i] = n[i];
+        for (i = 0; i < nmeth - 1; i++)
+            w[i] -= 1;
+    } /* end while */
+
+    if (nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cinfo_cache_update
- *
- * Purpose:    Update the cached chunk info
+ * Function:    H5D__chunk_cache_find
  *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Returns the cache entry of a chunk that H5D__chunk_lookup
+ *              found in the dataset's chunk cache.  IDX is the slot of the
+ *              chunk in the dataset's hash table; for a dataset that uses
+ *              the file's shared cache the chunk is looked up by SCALED
+ *              instead, since the shared hash table may have grown since.
  *
- * Programmer:    Quincey Koziol
- *              November 27, 2007
+ * Return:      Cache entry, or NULL if the chunk isn't in a shared cache
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *udata)
+static H5D_rdcc_ent_t *
+H5D__chunk_cache_find(const H5D_shared_t *shared, unsigned idx, const hsize_t *scaled)
 {
+    const H5D_rdcc_t *rdcc      = &(shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_t *  ret_value = NULL;                   /* Return value */
+
     FUNC_ENTER_STATIC_NOERR
 
-    /* Sanity check */
-    HDassert(last);
-    HDassert(udata);
-    HDassert(udata->common.layout);
-    HDassert(udata->common.scaled);
+    HDassert(scaled);
 
-    /* Stored the information to cache */
-    H5MM_memcpy(last->scaled, udata->common.scaled, sizeof(hsize_t) * udata->common.layout->ndims);
-    last->addr = udata->chunk_block.offset;
-    H5_CHECKED_ASSIGN(last->nbytes, uint32_t, udata->chunk_block.length, hsize_t);
-    last->chunk_idx   = udata->chunk_idx;
-    last->filter_mask = udata->filter_mask;
+    if (rdcc->open_cache) {
+        H5D_rdcc_open_t *cache = rdcc->open_cache;
+        H5D_rdcc_ent_t *   ent;
 
-    /* Indicate that the cached info is valid */
-    last->valid = TRUE;
+        for (ent = cache->bucket[H5D__chunk_open_hash_val(cache, shared, scaled)]; ent; ent = ent->hnext)
+            if (ent->owner == shared) {
+                unsigned u;
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
-} /* H5D__chunk_cinfo_cache_update() */
+                for (u = 0; u < shared->ndims; u++)
+                    if (scaled[u] != ent->scaled[u])
+                        break;
+                if (u == shared->ndims) {
+                    ret_value = ent;
+                    break;
+                } /* end if */
+            }     /* end if */
+    }             /* end if */
+    else {
+        HDassert(idx < rdcc->nslots);
+        ret_value = rdcc->slot[idx];
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_find() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cinfo_cache_found
- *
- * Purpose:    Look for chunk info in cache
+ * Function:    H5D__chunk_open_cache_create
  *
- * Return:    TRUE/FALSE/FAIL
+ * Purpose:     Creates an empty open-hashing chunk cache holding up to
+ *              NBYTES_MAX bytes of chunks and preempting them according
+ *              to POLICY.
  *
- * Programmer:    Quincey Koziol
- *              November 27, 2007
+ * Return:      Success:    Pointer to the new cache
+ *              Failure:    NULL
  *
  *-------------------------------------------------------------------------
  */
-static hbool_t
-H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *udata)
+static H5D_rdcc_open_t *
+H5D__chunk_open_cache_create(H5D_chunk_cache_policy_t policy, size_t nbytes_max)
 {
-    hbool_t ret_value = FALSE; /* Return value */
-
-    FUNC_ENTER_STATIC_NOERR
-
-    /* Sanity check */
-    HDassert(last);
-    HDassert(udata);
-    HDassert(udata->common.layout);
-    HDassert(udata->common.scaled);
+    H5D_rdcc_open_t *cache     = NULL; /* New chunk cache */
+    H5D_rdcc_open_t *ret_value = NULL; /* Return value */
 
-    /* Check if the cached information is what is desired */
-    if (last->valid) {
-        unsigned u; /* Local index variable */
+    FUNC_ENTER_STATIC
 
-        /* Check that the scaled offset is the same */
-        for (u = 0; u < udata->common.layout->ndims; u++)
-            if (last->scaled[u] != udata->common.scaled[u])
-                HGOTO_DONE(FALSE)
+    HDassert(policy > H5D_CHUNK_CACHE_POLICY_DEFAULT && policy < H5D_CHUNK_CACHE_NPOLICIES);
+    HDassert(nbytes_max > 0);
 
-        /* Retrieve the information from the cache */
-        udata->chunk_block.offset = last->addr;
-        udata->chunk_block.length = last->nbytes;
-        udata->chunk_idx          = last->chunk_idx;
-        udata->filter_mask        = last->filter_mask;
+    if (NULL == (cache = H5FL_CALLOC(H5D_rdcc_open_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate chunk cache")
+    cache->policy     = policy;
+    cache->nbytes_max = nbytes_max;
+    cache->nbuckets   = H5D_CHUNK_OPEN_NBUCKETS_INIT;
+    if (NULL == (cache->bucket = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, cache->nbuckets)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate chunk cache hash table")
 
-        /* Indicate that the data was found */
-        HGOTO_DONE(TRUE)
-    } /* end if */
+    ret_value = cache;
 
 done:
+    if (!ret_value && cache)
+        cache = H5FL_FREE(H5D_rdcc_open_t, cache);
+
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_cinfo_cache_found() */
+} /* end H5D__chunk_open_cache_create() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_create
- *
- * Purpose:    Creates a new chunked storage index and initializes the
- *        layout information with information about the storage.  The
- *        layout info should be immediately written to the object header.
+ * Function:    H5D__chunk_shared_cache_attach
  *
- * Return:    Non-negative on success (with the layout information initialized
- *        and ready to write to an object header). Negative on failure.
+ * Purpose:     Makes DSET keep its chunks in the shared chunk cache of
+ *              file F, creating the cache on first use.  The file holds
+ *              the only reference to the cache, which is freed when the
+ *              file is; the datasets using it are all closed by then.
  *
- * Programmer:    Quincey Koziol
- *        Thursday, May 22, 2008
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_create(const H5D_t *dset /*in,out*/)
+static herr_t
+H5D__chunk_shared_cache_attach(H5F_t *f, const H5D_t *dset)
 {
-    H5D_chk_idx_info_t   idx_info; /* Chunked index info */
-    H5O_storage_chunk_t *sc        = &(dset->shared->layout.storage.u.chunk);
-    herr_t               ret_value = SUCCEED; /* Return value */
-
-    FUNC_ENTER_PACKAGE
-
-    /* Check args */
-    HDassert(dset);
-    HDassert(H5D_CHUNKED == dset->shared->layout.type);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0 &&
-             dset->shared->layout.u.chunk.ndims <= H5O_LAYOUT_NDIMS);
-    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
-
-#ifndef NDEBUG
-    {
-        unsigned u; /* Local index variable */
+    H5D_rdcc_t *     rdcc      = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_open_t *cache     = NULL;                         /* File's shared chunk cache */
+    H5UC_t *         rc        = NULL;                         /* Ref-counted wrapper for the cache */
+    herr_t           ret_value = SUCCEED;                      /* Return value */
 
-        for (u = 0; u < dset->shared->layout.u.chunk.ndims; u++)
-            HDassert(dset->shared->layout.u.chunk.dim[u] > 0);
-    }
-#endif
+    FUNC_ENTER_STATIC
 
-    /* Compose chunked index info struct */
-    idx_info.f       = dset->oloc.file;
-    idx_info.pline   = &dset->shared->dcpl_cache.pline;
-    idx_info.layout  = &dset->shared->layout.u.chunk;
-    idx_info.storage = sc;
+    HDassert(f);
+    HDassert(H5F_RDCC_SHARED_NBYTES(f) > 0);
+
+    if (NULL == (rc = H5F_RDCC_SHARED(f))) {
+        if (NULL == (cache = H5D__chunk_open_cache_create(H5D_CHUNK_CACHE_POLICY_LRU,
+                                                          H5F_RDCC_SHARED_NBYTES(f))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create shared chunk cache")
+        cache->shared = TRUE;
+
+        if (NULL == (rc = H5UC_create(cache, H5D__chunk_open_cache_free)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTCREATE, FAIL, "can't create ref-count wrapper for shared cache")
+        cache = NULL;
+        if (H5F_SET_RDCC_SHARED(f, rc) < 0) {
+            H5UC_DEC(rc);
+            HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't set shared chunk cache for file")
+        } /* end if */
+    }     /* end if */
 
-    /* Create the index for the chunks */
-    if ((sc->ops->create)(&idx_info) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
+    rdcc->open_cache = (H5D_rdcc_open_t *)H5UC_GET_OBJ(rc);
+    rdcc->nbytes_max = rdcc->open_cache->nbytes_max;
+    rdcc->oh_addr    = dset->oloc.addr;
 
 done:
+    if (ret_value < 0 && cache)
+        H5D__chunk_open_cache_free(cache);
+
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_create() */
+} /* end H5D__chunk_shared_cache_attach() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_hash_val
- *
- * Purpose:     To calculate an index based on the dataset's scaled
- *              coordinates and sizes of the faster dimensions.
+ * Function:    H5D__chunk_open_cache_free
  *
- * Return:    Hash value index
+ * Purpose:     Frees an open-hashing chunk cache: a dataset's own when
+ *              the dataset is closed, or a shared one when the file's
+ *              reference to it is released.
  *
- * Programmer:    Vailin Choi; Nov 2014
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static unsigned
-H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
+static herr_t
+H5D__chunk_open_cache_free(void *_cache)
 {
-    hsize_t  val;                   /* Intermediate value */
-    unsigned ndims = shared->ndims; /* Rank of dataset */
-    unsigned ret   = 0;             /* Value to return */
-    unsigned u;                     /* Local index variable */
+    H5D_rdcc_open_t *cache = (H5D_rdcc_open_t *)_cache; /* Chunk cache */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Sanity check */
-    HDassert(shared);
-    HDassert(scaled);
-
-    /* If the fastest changing dimension doesn't have enough entropy, use
-     *  other dimensions too
-     */
-    val = scaled[0];
-    for (u = 1; u < ndims; u++) {
-        val <<= shared->cache.chunk.scaled_encode_bits[u];
-        val ^= scaled[u];
-    } /* end for */
+    HDassert(cache);
+    HDassert(0 == cache->nused);
+    HDassert(NULL == cache->head);
 
-    /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    cache->bucket = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, cache->bucket);
+    cache         = H5FL_FREE(H5D_rdcc_open_t, cache);
 
-    FUNC_LEAVE_NOAPI(ret)
-} /* H5D__chunk_hash_val() */
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_open_cache_free() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_lookup
+ * Function:    H5D__chunk_open_hash_val
  *
- * Purpose:    Loops up a chunk in cache and on disk, and retrieves
- *              information about that chunk.
- *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Computes the hash chain of a chunk in an open-hashing chunk
+ *              cache, from the chunk's dataset and scaled coordinates.
+ *              Unlike H5D__chunk_hash_val the result doesn't depend on the
+ *              dataset's dimensions, so entries stay put when a dataset
+ *              is extended.
  *
- * Programmer:    Albert Cheng
- *              June 27, 1998
+ * Return:      Hash chain index
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udata)
+static unsigned
+H5D__chunk_open_hash_val(const H5D_rdcc_open_t *cache, const H5D_shared_t *owner, const hsize_t *scaled)
 {
-    H5D_rdcc_ent_t *     ent = NULL; /* Cache entry */
-    H5O_storage_chunk_t *sc  = &(dset->shared->layout.storage.u.chunk);
-    unsigned             idx;                 /* Index of chunk in cache, if present */
-    hbool_t              found     = FALSE;   /* In cache? */
-    herr_t               ret_value = SUCCEED; /* Return value */
+    uint64_t val = (uint64_t)(uintptr_t)owner; /* Intermediate value */
+    unsigned u;                                /* Local index variable */
+    unsigned ret_value = 0;                    /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Sanity checks */
-    HDassert(dset);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0);
-    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    HDassert(cache);
+    HDassert(owner);
     HDassert(scaled);
-    HDassert(udata);
 
-    /* Initialize the query information about the chunk we are looking for */
-    udata->common.layout  = &(dset->shared->layout.u.chunk);
-    udata->common.storage = sc;
-    udata->common.scaled  = scaled;
+    /* FNV-1a style mix of the coordinates into the dataset's address */
+    for (u = 0; u < owner->ndims; u++)
+        val = (val ^ (uint64_t)scaled[u]) * (uint64_t)0x100000001b3ULL;
+    val ^= val >> 32;
 
-    /* Reset information about the chunk we are looking for */
-    udata->chunk_block.offset = HADDR_UNDEF;
-    udata->chunk_block.length = 0;
-    udata->filter_mask        = 0;
-    udata->new_unfilt_chunk   = FALSE;
+    ret_value = (unsigned)(val & (uint64_t)(cache->nbuckets - 1));
 
-    /* Check for chunk in cache */
-    if (dset->shared->cache.chunk.nslots > 0) {
-        /* Determine the chunk's location in the hash table */
-        idx = H5D__chunk_hash_val(dset->shared, scaled);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_open_hash_val() */
 
-        /* Get the chunk cache entry for that location */
-        ent = dset->shared->cache.chunk.slot[idx];
-        if (ent) {
-            unsigned u; /* Counter */
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_open_cache_insert
+ *
+ * Purpose:     Adds ENT to the hash table of an open-hashing chunk cache
+ *              and to the end of its list, which is in order of last use
+ *              for LRU and of insertion otherwise.  The hash table is
+ *              doubled when it holds as many chunks as it has chains, to
+ *              keep the chains short.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_open_cache_insert(H5D_rdcc_open_t *cache, H5D_rdcc_ent_t *ent)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
 
-            /* Speculatively set the 'found' flag */
-            found = TRUE;
+    FUNC_ENTER_STATIC
 
-            /* Verify that the cache entry is the correct chunk */
-            for (u = 0; u < dset->shared->ndims; u++)
-                if (scaled[u] != ent->scaled[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
-        }         /* end if */
-    }             /* end if */
+    HDassert(cache);
+    HDassert(ent);
+    HDassert(ent->owner);
 
-    /* Retrieve chunk addr */
-    if (found) {
-        udata->idx_hint           = idx;
-        udata->chunk_block.offset = ent->chunk_block.offset;
-        udata->chunk_block.length = ent->chunk_block.length;
-        ;
-        udata->chunk_idx = ent->chunk_idx;
-    } /* end if */
-    else {
-        /* Invalidate idx_hint, to signal that the chunk is not in cache */
-        udata->idx_hint = UINT_MAX;
+    if (cache->nused >= cache->nbuckets) {
+        H5D_rdcc_ent_ptr_t *old_bucket   = cache->bucket;   /* Hash chains to move */
+        size_t              old_nbuckets = cache->nbuckets; /* Number of chains to move */
+        size_t              u;                              /* Local index variable */
 
-        /* Check for cached information */
-        if (!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
-            H5D_chk_idx_info_t idx_info; /* Chunked index info */
+        if (NULL == (cache->bucket = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, 2 * old_nbuckets))) {
+            cache->bucket = old_bucket;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't grow chunk cache hash table")
+        } /* end if */
+        cache->nbuckets = 2 * old_nbuckets;
+
+        for (u = 0; u < old_nbuckets; u++)
+            while (old_bucket[u]) {
+                H5D_rdcc_ent_t *cur = old_bucket[u];
+
+                old_bucket[u]           = cur->hnext;
+                cur->idx                = H5D__chunk_open_hash_val(cache, cur->owner, cur->scaled);
+                cur->hnext              = cache->bucket[cur->idx];
+                cache->bucket[cur->idx] = cur;
+            } /* end while */
+        old_bucket = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, old_bucket);
+    } /* end if */
 
-            /* Compose chunked index info struct */
-            idx_info.f       = dset->oloc.file;
-            idx_info.pline   = &dset->shared->dcpl_cache.pline;
-            idx_info.layout  = &dset->shared->layout.u.chunk;
-            idx_info.storage = sc;
+    /* Add to the hash chain */
+    ent->idx                = H5D__chunk_open_hash_val(cache, ent->owner, ent->scaled);
+    ent->hnext              = cache->bucket[ent->idx];
+    cache->bucket[ent->idx] = ent;
 
-#ifdef H5_HAVE_PARALLEL
-            /* Disable collective metadata read for chunk indexes as it is
-             * highly unlikely that users would read the same chunks from all
-             * processes.
-             */
-            if (H5F_HAS_FEATURE(idx_info.f, H5FD_FEAT_HAS_MPI))
-                H5CX_set_coll_metadata_read(FALSE);
-#endif /* H5_HAVE_PARALLEL */
+    /* Add to the end of the list */
+    ent->lru_next = NULL;
+    ent->lru_prev = cache->tail;
+    if (cache->tail)
+        cache->tail->lru_next = ent;
+    else
+        cache->head = ent;
+    cache->tail = ent;
 
-            /* Go get the chunk information */
-            if ((sc->ops->get_addr)(&idx_info, udata) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
+    /* A new chunk hasn't been used again yet */
+    ent->referenced = FALSE;
+    ent->nrefs      = 1;
 
-                /*
-                 * Cache the information retrieved.
-                 *
-                 * Note that if we are writing to the dataset in parallel and filters
-                 * are involved, we skip caching this information as it is highly likely
-                 * that the chunk information will be invalidated as a result of the
-                 * filter operation (e.g. the chunk gets re-allocated to a different
-                 * address in the file and/or gets re-allocated with a different size).
-                 * If we were to cache this information, subsequent reads/writes would
-                 * retrieve the invalid information and cause a variety of issues.
-                 *
-                 * It has been verified that in the serial library, when writing to chunks
-                 * with the real chunk cache disabled and with filters involved, the
-                 * functions within this file are correctly called in such a manner that
-                 * this single chunk cache is always updated correctly. Therefore, this
-                 * check is not needed for the serial library.
-                 *
-                 * This is an ugly and potentially frail check, but the
-                 * H5D__chunk_cinfo_cache_reset() function is not currently available
-                 * to functions outside of this file, so outside functions can not
-                 * invalidate this single chunk cache. Even if the function were available,
-                 * this check prevents us from doing the work of going through and caching
-                 * each chunk in the write operation, when we're only going to invalidate
-                 * the cache at the end of a parallel write anyway.
-                 *
-                 *  - JTH (7/13/2018)
-                 */
-#ifdef H5_HAVE_PARALLEL
-            if (!((H5F_HAS_FEATURE(idx_info.f, H5FD_FEAT_HAS_MPI)) &&
-                  (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR) && dset->shared->dcpl_cache.pline.nused))
-#endif
-                H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
-        } /* end if */
-    }     /* end else */
+    cache->nbytes_used += ent->owner->layout.u.chunk.size;
+    cache->nused++;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_lookup() */
+} /* end H5D__chunk_open_cache_insert() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_flush_entry
- *
- * Purpose:    Writes a chunk to disk.  If RESET is non-zero then the
- *        entry is cleared -- it's slightly faster to flush a chunk if
- *        the RESET flag is turned on because it results in one fewer
- *        memory copy.
+ * Function:    H5D__chunk_open_cache_remove
  *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Unlinks ENT from the hash table and list of an open-hashing
+ *              chunk cache, moving the clock hand past it if needed.
  *
- * Programmer:    Robb Matzke
- *              Thursday, May 21, 1998
+ * Return:      void
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
+static void
+H5D__chunk_open_cache_remove(H5D_rdcc_open_t *cache, H5D_rdcc_ent_t *ent)
 {
-    void *               buf                = NULL; /* Temporary buffer        */
-    hbool_t              point_of_no_return = FALSE;
-    H5O_storage_chunk_t *sc                 = &(dset->shared->layout.storage.u.chunk);
-    herr_t               ret_value          = SUCCEED; /* Return value            */
+    H5D_rdcc_ent_t **pp; /* Link to ENT in its hash chain */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
-    HDassert(dset);
-    HDassert(dset->shared);
-    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    HDassert(cache);
     HDassert(ent);
-    HDassert(!ent->locked);
+    HDassert(ent->idx < cache->nbuckets);
 
-    buf = ent->chunk;
-    if (ent->dirty) {
-        H5D_chk_idx_info_t idx_info;            /* Chunked index info */
-        H5D_chunk_ud_t     udata;               /* pass through B-tree        */
-        hbool_t            must_alloc  = FALSE; /* Whether the chunk must be allocated */
-        hbool_t            need_insert = FALSE; /* Whether the chunk needs to be inserted into the index */
+    for (pp = &cache->bucket[ent->idx]; *pp != ent; pp = &(*pp)->hnext)
+        HDassert(*pp);
+    *pp = ent->hnext;
 
-        /* Set up user data for index callbacks */
-        udata.common.layout      = &dset->shared->layout.u.chunk;
-        udata.common.storage     = sc;
-        udata.common.scaled      = ent->scaled;
-        udata.chunk_block.offset = ent->chunk_block.offset;
-        udata.chunk_block.length = dset->shared->layout.u.chunk.size;
-        udata.filter_mask        = 0;
-        udata.chunk_idx          = ent->chunk_idx;
+    if (cache->hand == ent)
+        cache->hand = ent->lru_next;
 
-        /* Should the chunk be filtered before writing it to disk? */
-        if (dset->shared->dcpl_cache.pline.nused && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
-            H5Z_EDC_t err_detect;                       /* Error detection info */
-            H5Z_cb_t  filter_cb;                        /* I/O filter callback function */
-            size_t    alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
-            size_t    nbytes;                           /* Chunk size (in bytes) */
+    if (ent->lru_prev)
+        ent->lru_prev->lru_next = ent->lru_next;
+    else
+        cache->head = ent->lru_next;
+    if (ent->lru_next)
+        ent->lru_next->lru_prev = ent->lru_prev;
+    else
+        cache->tail = ent->lru_prev;
 
-            /* Retrieve filter settings from API context */
-            if (H5CX_get_err_detect(&err_detect) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
-            if (H5CX_get_filter_cb(&filter_cb) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+    cache->nbytes_used -= ent->owner->layout.u.chunk.size;
+    cache->nused--;
 
-            if (!reset) {
-                /*
-                 * Copy the chunk to a new buffer before running it through
-                 * the pipeline because we'll want to save the original buffer
-                 * for later.
-                 */
-                if (NULL == (buf = H5MM_malloc(alloc)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
-                H5MM_memcpy(buf, ent->chunk, alloc);
-            } /* end if */
-            else {
-                /*
-                 * If we are resetting and something goes wrong after this
-                 * point then it's too late to recover because we may have
-                 * destroyed the original data by calling H5Z_pipeline().
-                 * The only safe option is to continue with the reset
-                 * even if we can't write the data to disk.
-                 */
-                point_of_no_return = TRUE;
-                ent->chunk         = NULL;
-            } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
-                             filter_cb, &nbytes, &alloc, &buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
-#if H5_SIZEOF_SIZE_T > 4
-            /* Check for the chunk expanding too much to encode in a 32-bit value */
-            if (nbytes > ((size_t)0xffffffff))
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
-#endif /* H5_SIZEOF_SIZE_T > 4 */
-            H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, nbytes, size_t);
+    ent->hnext = ent->lru_next = ent->lru_prev = NULL;
+    ent->owner                                 = NULL;
 
-            /* Indicate that the chunk must be allocated */
-            must_alloc = TRUE;
-        } /* end if */
-        else if (!H5F_addr_defined(udata.chunk_block.offset)) {
-            /* Indicate that the chunk must be allocated */
-            must_alloc = TRUE;
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_open_cache_remove() */
 
-            /* This flag could be set for this chunk, just remove and ignore it
-             */
-            ent->edge_chunk_state &= ~H5D_RDCC_NEWLY_DISABLED_FILTERS;
-        } /* end else */
-        else if (ent->edge_chunk_state & H5D_RDCC_NEWLY_DISABLED_FILTERS) {
-            /* Chunk on disk is still filtered, must insert to allocate correct
-             * size */
-            must_alloc = TRUE;
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_open_cache_touch
+ *
+ * Purpose:     Records a use of ENT, a chunk found in an open-hashing
+ *              chunk cache: LRU moves it to the end of the list, CLOCK
+ *              marks it referenced and LFU counts the use.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_open_cache_touch(H5D_rdcc_open_t *cache, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
 
-            /* Set the disable filters field back to the standard disable
-             * filters setting, as it no longer needs to be inserted with every
-             * flush */
-            ent->edge_chunk_state &= ~H5D_RDCC_NEWLY_DISABLED_FILTERS;
-        } /* end else */
+    HDassert(cache);
+    HDassert(ent);
 
-        HDassert(!(ent->edge_chunk_state & H5D_RDCC_NEWLY_DISABLED_FILTERS));
+    switch (cache->policy) {
+        case H5D_CHUNK_CACHE_POLICY_LRU:
+            if (ent != cache->tail) {
+                /* Unlink */
+                if (ent->lru_prev)
+                    ent->lru_prev->lru_next = ent->lru_next;
+                else
+                    cache->head = ent->lru_next;
+                ent->lru_next->lru_prev = ent->lru_prev;
+
+                /* Append */
+                ent->lru_prev         = cache->tail;
+                ent->lru_next         = NULL;
+                cache->tail->lru_next = ent;
+                cache->tail           = ent;
+            } /* end if */
+            break;
 
-        /* Check if the chunk needs to be allocated (it also could exist already
-         *      and the chunk alloc operation could resize it)
-         */
-        if (must_alloc) {
-            /* Compose chunked index info struct */
-            idx_info.f       = dset->oloc.file;
-            idx_info.pline   = &dset->shared->dcpl_cache.pline;
-            idx_info.layout  = &dset->shared->layout.u.chunk;
-            idx_info.storage = sc;
+        case H5D_CHUNK_CACHE_POLICY_CLOCK:
+            ent->referenced = TRUE;
+            break;
 
-            /* Create the chunk it if it doesn't exist, or reallocate the chunk
-             *  if its size changed.
-             */
-            if (H5D__chunk_file_alloc(&idx_info, &(ent->chunk_block), &udata.chunk_block, &need_insert,
-                                      ent->scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
+        case H5D_CHUNK_CACHE_POLICY_LFU:
+            if (ent->nrefs < UINT_MAX)
+                ent->nrefs++;
+            break;
 
-            /* Update the chunk entry's info, in case it was allocated or relocated */
-            ent->chunk_block.offset = udata.chunk_block.offset;
-            ent->chunk_block.length = udata.chunk_block.length;
-        } /* end if */
+        case H5D_CHUNK_CACHE_POLICY_ERROR:
+        case H5D_CHUNK_CACHE_POLICY_DEFAULT:
+        case H5D_CHUNK_CACHE_NPOLICIES:
+        default:
+            HDassert(0 && "invalid chunk cache policy");
+            break;
+    } /* end switch */
 
-        /* Write the data to the file */
-        HDassert(H5F_addr_defined(udata.chunk_block.offset));
-        H5_CHECK_OVERFLOW(udata.chunk_block.length, hsize_t, size_t);
-        if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset,
-                                   (size_t)udata.chunk_block.length, buf) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_open_cache_touch() */
 
-        /* Insert the chunk record into the index */
-        if (need_insert && sc->ops->insert)
-            if ((sc->ops->insert)(&idx_info, &udata, dset) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_open_cache_victim
+ *
+ * Purpose:     Chooses the next chunk to preempt from an open-hashing
+ *              chunk cache, among the unlocked ones: the head of the list
+ *              for LRU, the first chunk the clock hand finds unreferenced
+ *              for CLOCK (clearing the references it passes), and the
+ *              least used chunk for LFU, the oldest one on ties.
+ *
+ * Return:      Chunk to preempt, or NULL if all the chunks are locked
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcc_ent_t *
+H5D__chunk_open_cache_victim(H5D_rdcc_open_t *cache)
+{
+    H5D_rdcc_ent_t *cur;              /* Current chunk considered */
+    H5D_rdcc_ent_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Cache the chunk's info, in case it's accessed again shortly */
-        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+    HDassert(cache);
 
-        /* Mark cache entry as clean */
-        ent->dirty = FALSE;
+    switch (cache->policy) {
+        case H5D_CHUNK_CACHE_POLICY_LRU:
+            for (cur = cache->head; cur; cur = cur->lru_next)
+                if (!cur->locked) {
+                    ret_value = cur;
+                    break;
+                } /* end if */
+            break;
 
-        /* Increment # of flushed entries */
-        dset->shared->cache.chunk.stats.nflushes++;
-    } /* end if */
+        case H5D_CHUNK_CACHE_POLICY_CLOCK: {
+            size_t nsteps; /* Chunks the hand may pass, enough to go round twice */
 
-    /* Reset, but do not free or removed from list */
-    if (reset) {
-        point_of_no_return = FALSE;
-        if (buf == ent->chunk)
-            buf = NULL;
-        if (ent->chunk != NULL)
-            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
-                                                         ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
-                                                              ? NULL
-                                                              : &(dset->shared->dcpl_cache.pline)));
-    } /* end if */
+            /* Each chunk passed once loses its reference, so two turns of the
+             * hand find a victim unless all the chunks are locked */
+            for (nsteps = 2 * cache->nused + 1; nsteps > 0 && cache->head; nsteps--) {
+                if (NULL == (cur = cache->hand))
+                    cur = cache->head;
+                cache->hand = cur->lru_next;
 
-done:
-    /* Free the temp buffer only if it's different than the entry chunk */
-    if (buf != ent->chunk)
-        H5MM_xfree(buf);
+                if (!cur->locked) {
+                    if (!cur->referenced) {
+                        ret_value = cur;
+                        break;
+                    } /* end if */
+                    cur->referenced = FALSE;
+                } /* end if */
+            }     /* end for */
+            break;
+        }
 
-    /*
-     * If we reached the point of no return then we have no choice but to
-     * reset the entry.  This can only happen if RESET is true but the
-     * output pipeline failed.  Do not free the entry or remove it from the
-     * list.
-     */
-    if (ret_value < 0 && point_of_no_return)
-        if (ent->chunk)
-            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
-                                                         ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
-                                                              ? NULL
-                                                              : &(dset->shared->dcpl_cache.pline)));
+        case H5D_CHUNK_CACHE_POLICY_LFU:
+            for (cur = cache->head; cur; cur = cur->lru_next)
+                if (!cur->locked && (NULL == ret_value || cur->nrefs < ret_value->nrefs))
+                    ret_value = cur;
+            break;
+
+        case H5D_CHUNK_CACHE_POLICY_ERROR:
+        case H5D_CHUNK_CACHE_POLICY_DEFAULT:
+        case H5D_CHUNK_CACHE_NPOLICIES:
+        default:
+            HDassert(0 && "invalid chunk cache policy");
+            break;
+    } /* end switch */
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_flush_entry() */
+} /* end H5D__chunk_open_cache_victim() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cache_evict
+ * Function:    H5D__chunk_open_cache_prune
  *
- * Purpose:     Preempts the specified entry from the cache, flushing it to
- *              disk if necessary.
+ * Purpose:     Preempts chunks chosen by the replacement policy from the
+ *              open-hashing chunk cache DSET uses until SIZE more bytes
+ *              fit in it.  With a shared cache the chunks may belong to
+ *              any dataset.
  *
- * Return:      Non-negative on success/Negative on failure
+ *              A chunk of another dataset is flushed through a stand-in
+ *              for that dataset, built from its shared information and
+ *              object header address, and tagged with that address so
+ *              any metadata its flush touches is attributed correctly.
  *
- * Programmer:  Robb Matzke
- *              Thursday, May 21, 1998
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
+H5D__chunk_open_cache_prune(const H5D_t *dset, size_t size)
 {
-    H5D_rdcc_t *rdcc      = &(dset->shared->cache.chunk);
-    herr_t      ret_value = SUCCEED; /* Return value */
+    H5D_rdcc_open_t *cache = dset->shared->cache.chunk.open_cache; /* Chunk cache */
+    H5D_rdcc_ent_t * cur;                                          /* Chunk to preempt */
+    int              nerrors   = 0;       /* Accumulated error count during preemptions */
+    herr_t           ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity checks */
-    HDassert(dset);
-    HDassert(ent);
-    HDassert(!ent->locked);
-    HDassert(ent->idx < rdcc->nslots);
+    HDassert(cache);
 
-    if (flush) {
-        /* Flush */
-        if (H5D__chunk_flush_entry(dset, ent, TRUE) < 0)
-            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
-    } /* end if */
-    else {
-        /* Don't flush, just free chunk */
-        if (ent->chunk != NULL)
-            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
-                                                         ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
-                                                              ? NULL
-                                                              : &(dset->shared->dcpl_cache.pline)));
-    } /* end else */
+    while ((cache->nbytes_used + size) > cache->nbytes_max) {
+        H5D_shared_t *owner; /* Dataset of the chunk */
 
-    /* Unlink from list */
-    if (ent->prev)
-        ent->prev->next = ent->next;
-    else
-        rdcc->head = ent->next;
-    if (ent->next)
-        ent->next->prev = ent->prev;
-    else
-        rdcc->tail = ent->prev;
-    ent->prev = ent->next = NULL;
+        if (NULL == (cur = H5D__chunk_open_cache_victim(cache)))
+            break;
+        owner = cur->owner;
 
-    /* Unlink from temporary list */
-    if (ent->tmp_prev) {
-        HDassert(rdcc->tmp_head->tmp_next);
-        ent->tmp_prev->tmp_next = ent->tmp_next;
-        if (ent->tmp_next) {
-            ent->tmp_next->tmp_prev = ent->tmp_prev;
-            ent->tmp_next           = NULL;
+        if (owner == dset->shared) {
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+            /* Encode this and the following dirty chunks, which are likely
+             * to be preempted next, on the filter threads
+             */
+            if (cur->dirty && !cur->image && H5D__chunk_encode_ahead(dset, cur) < 0)
+                nerrors++;
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+            if (H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
+                nerrors++;
         } /* end if */
-        ent->tmp_prev = NULL;
-    } /* end if */
-    else
-        /* Only clear hash table slot if the chunk was not on the temporary list
-         */
-        rdcc->slot[ent->idx] = NULL;
+        else {
+            H5D_t   owner_dset; /* Stand-in for the dataset of the chunk */
+            haddr_t owner_addr = owner->cache.chunk.oh_addr;
+
+            HDmemset(&owner_dset, 0, sizeof(owner_dset));
+            owner_dset.oloc.file = dset->oloc.file;
+            owner_dset.oloc.addr = owner_addr;
+            owner_dset.shared    = owner;
+
+            H5_BEGIN_TAG(owner_addr)
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+            if (cur->dirty && !cur->image && H5D__chunk_encode_ahead(&owner_dset, cur) < 0)
+                nerrors++;
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+            if (H5D__chunk_cache_evict(&owner_dset, cur, TRUE) < 0)
+                nerrors++;
+            H5_END_TAG
+        } /* end else */
 
-    /* Remove from cache */
-    HDassert(rdcc->slot[ent->idx] != ent);
-    ent->idx = UINT_MAX;
-    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
-    --rdcc->nused;
+        cache->stats.nevictions++;
+        owner->cache.chunk.stats.nevictions++;
+    } /* end while */
 
-    /* Free */
-    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+    if (nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_evict() */
+} /* end H5D__chunk_open_cache_prune() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cache_prune
+ * Function:    H5D_chunk_shared_cache_stats
  *
- * Purpose:    Prune the cache by preempting some things until the cache has
- *        room for something which is SIZE bytes.  Only unlocked
- *        entries are considered for preemption.
+ * Purpose:     Retrieves the statistics of the shared chunk cache of file
+ *              F.  All the counts are zero if no dataset has used the
+ *              cache yet.  Any of the output arguments may be NULL.
  *
- * Return:    Non-negative on success/Negative on failure
+ * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:    Robb Matzke
- *              Thursday, May 21, 1998
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_shared_cache_stats(const H5F_t *f, unsigned *hits, unsigned *misses, unsigned *evictions,
+                             size_t *nbytes_used, size_t *nchunks)
+{
+    const H5D_rdcc_open_t *cache = NULL; /* Shared chunk cache */
+    H5UC_t *                 rc;           /* Ref-counted wrapper for the cache */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    if (NULL != (rc = H5F_RDCC_SHARED(f)))
+        cache = (const H5D_rdcc_open_t *)H5UC_GET_OBJ(rc);
+
+    if (hits)
+        *hits = cache ? cache->stats.nhits : 0;
+    if (misses)
+        *misses = cache ? cache->stats.nmisses : 0;
+    if (evictions)
+        *evictions = cache ? cache->stats.nevictions : 0;
+    if (nbytes_used)
+        *nbytes_used = cache ? cache->nbytes_used : 0;
+    if (nchunks)
+        *nchunks = cache ? cache->nused : 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D_chunk_shared_cache_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_shared_cache_reset_stats
+ *
+ * Purpose:     Resets the hit, miss and eviction counts of the shared
+ *              chunk cache of file F.
+ *
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
+herr_t
+H5D_chunk_shared_cache_reset_stats(const H5F_t *f)
 {
-    const H5D_rdcc_t *rdcc  = &(dset->shared->cache.chunk);
-    size_t            total = rdcc->nbytes_max;
-    const int         nmeth = 2;           /* Number of methods */
-    int               w[1];                /* Weighting as an interval */
-    H5D_rdcc_ent_t *  p[2], *cur;          /* List pointers */
-    H5D_rdcc_ent_t *  n[2];                /* List next pointers */
-    int               nerrors   = 0;       /* Accumulated error count during preemptions */
-    herr_t            ret_value = SUCCEED; /* Return value */
+    H5UC_t *rc; /* Ref-counted wrapper for the cache */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-    /*
-     * Preemption is accomplished by having multiple pointers (currently two)
-     * slide down the list beginning at the head. Pointer p(N+1) will start
-     * traversing the list when pointer pN reaches wN percent of the original
-     * list.  In other words, preemption method N gets to consider entries in
-     * approximate least recently used order w0 percent before method N+1
-     * where 100% means tha method N will run to completion before method N+1
-     * begins.  The pointers participating in the list traversal are each
-     * given a chance at preemption before any of the pointers are advanced.
-     */
-    w[0] = (int)(rdcc->nused * rdcc->w0);
-    p[0] = rdcc->head;
-    p[1] = NULL;
+    HDassert(f);
 
-    while ((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
-        int i; /* Local index variable */
+    if (NULL != (rc = H5F_RDCC_SHARED(f))) {
+        H5D_rdcc_open_t *cache = (H5D_rdcc_open_t *)H5UC_GET_OBJ(rc);
 
-        /* Introduce new pointers */
-        for (i = 0; i < nmeth - 1; i++)
-            if (0 == w[i])
-                p[i + 1] = rdcc->head;
+        HDmemset(&cache->stats, 0, sizeof(cache->stats));
+    } /* end if */
 
-        /* Compute next value for each pointer */
-        for (i = 0; i < nmeth; i++)
-            n[i] = p[i] ? p[i]->next : NULL;
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D_chunk_shared_cache_reset_stats() */
 
-        /* Give each method a chance */
-        for (i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
-            if (0 == i && p[0] && !p[0]->locked &&
-                ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
-                 (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
-                 (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
-                /*
-                 * Method 0: Preempt entries that have been completely written
-                 * and/or completely read but not entries that are partially
-                 * written or partially read.
-                 */
-                cur = p[0];
-            }
-            else if (1 == i && p[1] && !p[1]->locked) {
-                /*
-                 * Method 1: Preempt the entry without regard to
-                 * considerations other than being locked.  This is the last
-                 * resort preemption.
-                 */
-                cur = p[1];
-            }
-            else {
-                /* Nothing to preempt at this point */
-                cur = NULL;
-            }
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_stats
+ *
+ * Purpose:     Retrieves the hit, miss and eviction counts of the chunk
+ *              cache of DSET, since it was opened or the counts were last
+ *              reset.  A chunk created in the cache without being read
+ *              counts as a miss, unless it's about to be overwritten
+ *              completely.  Any of the pointers may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_cache_stats(const H5D_t *dset, unsigned *hits, unsigned *misses, unsigned *evictions)
+{
+    const H5D_rdcc_t *rdcc      = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    herr_t            ret_value = SUCCEED;                      /* Return value */
 
-            if (cur) {
-                int j; /* Local index variable */
+    FUNC_ENTER_PACKAGE
 
-                for (j = 0; j < nmeth; j++) {
-                    if (p[j] == cur)
-                        p[j] = NULL;
-                    if (n[j] == cur)
-                        n[j] = cur->next;
-                } /* end for */
-                if (H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
-                    nerrors++;
-            } /* end if */
-        }     /* end for */
+    HDassert(dset);
 
-        /* Advance pointers */
-        for (i = 0; i < nmeth; i++)
-            p[i] = n[i];
-        for (i = 0; i < nmeth - 1; i++)
-            w[i] -= 1;
-    } /* end while */
+    if (H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "not a chunked dataset")
 
-    if (nerrors)
-        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+    if (hits)
+        *hits = rdcc->stats.nhits;
+    if (misses)
+        *misses = rdcc->stats.nmisses + rdcc->stats.ninits;
+    if (evictions)
+        *evictions = rdcc->stats.nevictions;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_prune() */
+} /* end H5D__chunk_cache_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_reset_stats
+ *
+ * Purpose:     Resets the statistics of the chunk cache of DSET.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_cache_reset_stats(H5D_t *dset)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+
+    if (H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+    HDmemset(&dset->shared->cache.chunk.stats, 0, sizeof(dset->shared->cache.chunk.stats));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_reset_stats() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lock
@@ -3715,12 +5803,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
 
     /* Check if the chunk is in the cache */
     if (UINT_MAX != udata->idx_hint) {
-        /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
-        HDassert(rdcc->slot[udata->idx_hint]);
-
         /* Get the entry */
-        ent = rdcc->slot[udata->idx_hint];
+        ent = H5D__chunk_cache_find(dset->shared, udata->idx_hint, udata->common.scaled);
+        HDassert(ent);
 
 #ifndef NDEBUG
         {
@@ -3764,6 +5849,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 ent->chunk = (uint8_t *)chunk;
                 chunk      = NULL;
 
+                /* Any filtered image of the chunk is no longer wanted */
+                ent->image = H5MM_xfree(ent->image);
+
                 /* Mark the chunk as having filters disabled as well as "newly
                  * disabled" so it is inserted on flush */
                 ent->edge_chunk_state |= H5D_RDCC_DISABLE_FILTERS;
@@ -3791,6 +5879,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 ent->chunk = (uint8_t *)chunk;
                 chunk      = NULL;
 
+                /* Any image of the chunk was made before filters were enabled */
+                HDassert(!ent->image);
+
                 /* Mark the chunk as having filters enabled */
                 ent->edge_chunk_state &= ~(H5D_RDCC_DISABLE_FILTERS | H5D_RDCC_NEWLY_DISABLED_FILTERS);
             } /* end else */
@@ -3815,6 +5906,13 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
             ent->next       = ent->next->next;
             ent->prev->next = ent;
         } /* end if */
+
+        /* Count the hit in the shared cache too, and make the chunk its most
+         * recently used one */
+        if (rdcc->open_cache) {
+            rdcc->open_cache->stats.nhits++;
+            H5D__chunk_open_cache_touch(rdcc->open_cache, ent);
+        } /* end if */
     }     /* end if */
     else {
         haddr_t chunk_addr;  /* Address of chunk on disk */
@@ -3824,6 +5922,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
         chunk_addr  = udata->chunk_block.offset;
         chunk_alloc = udata->chunk_block.length;
 
+        if (rdcc->open_cache)
+            rdcc->open_cache->stats.nmisses++;
+
         /* Check if we should disable filters on this chunk */
         if (pline->nused) {
             if (udata->new_unfilt_chunk) {
@@ -3876,8 +5977,19 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
              *      or an init if it isn't.
              */
 
-            /* Check if the chunk exists on disk */
-            if (H5F_addr_defined(chunk_addr)) {
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+            /* Check if the chunk has already been read and decoded by a filter
+             * thread
+             */
+            if (H5F_addr_defined(chunk_addr) && old_pline && old_pline->nused && !udata->new_unfilt_chunk &&
+                NULL != (chunk = H5D__chunk_take_decoded(rdcc, dset->shared->ndims, udata->common.scaled,
+                                                         chunk_addr, &udata->filter_mask)))
+                /* Increment # of cache misses */
+                rdcc->stats.nmisses++;
+            else
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+                /* Check if the chunk exists on disk */
+                if (H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc; /* Allocated buffer size */
                 size_t buf_alloc      = chunk_alloc; /* [Re-]allocated buffer size */
 
@@ -3968,19 +6080,29 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
         }     /* end else */
 
         /* See if the chunk can be cached */
-        if (rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
-            /* Calculate the index */
-            udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
+        if ((rdcc->open_cache || rdcc->nslots > 0) && chunk_size <= rdcc->nbytes_max) {
+            if (rdcc->open_cache)
+                /* Chains in an open hash table hold any number of chunks */
+                ent = NULL;
+            else {
+                /* Calculate the index */
+                udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
 
-            /* Add the chunk to the cache only if the slot is not already locked */
-            ent = rdcc->slot[udata->idx_hint];
+                /* Add the chunk to the cache only if the slot is not already locked */
+                ent = rdcc->slot[udata->idx_hint];
+            } /* end else */
             if (!ent || !ent->locked) {
                 /* Preempt enough things from the cache to make room */
                 if (ent) {
                     if (H5D__chunk_cache_evict(io_info->dset, ent, TRUE) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
+                    rdcc->stats.nevictions++;
+                } /* end if */
+                if (rdcc->open_cache) {
+                    if (H5D__chunk_open_cache_prune(io_info->dset, chunk_size) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
                 } /* end if */
-                if (H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
+                else if (H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
 
                 /* Create a new entry */
@@ -4001,9 +6123,19 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 ent->chunk = (uint8_t *)chunk;
 
                 /* Add it to the cache */
-                HDassert(NULL == rdcc->slot[udata->idx_hint]);
-                rdcc->slot[udata->idx_hint] = ent;
-                ent->idx                    = udata->idx_hint;
+                if (rdcc->open_cache) {
+                    ent->owner = dset->shared;
+                    if (H5D__chunk_open_cache_insert(rdcc->open_cache, ent) < 0) {
+                        ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, NULL, "can't insert chunk into chunk cache")
+                    } /* end if */
+                    udata->idx_hint = ent->idx;
+                } /* end if */
+                else {
+                    HDassert(NULL == rdcc->slot[udata->idx_hint]);
+                    rdcc->slot[udata->idx_hint] = ent;
+                    ent->idx                    = udata->idx_hint;
+                } /* end else */
                 rdcc->nbytes_used += chunk_size;
                 rdcc->nused++;
 
@@ -4084,8 +6216,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
                   uint32_t naccessed)
 {
     const H5O_layout_t *layout    = &(io_info->dset->shared->layout); /* Dataset layout */
-    const H5D_rdcc_t *  rdcc      = &(io_info->dset->shared->cache.chunk);
-    herr_t              ret_value = SUCCEED; /* Return value */
+    herr_t              ret_value = SUCCEED;                          /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -4141,19 +6272,19 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
     else {
         H5D_rdcc_ent_t *ent; /* Chunk's entry in the cache */
 
-        /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
-        HDassert(rdcc->slot[udata->idx_hint]);
-        HDassert(rdcc->slot[udata->idx_hint]->chunk == chunk);
-
         /*
          * It's in the cache so unlock it.
          */
-        ent = rdcc->slot[udata->idx_hint];
+        ent = H5D__chunk_cache_find(io_info->dset->shared, udata->idx_hint, udata->common.scaled);
+        HDassert(ent);
+        HDassert(ent->chunk == chunk);
         HDassert(ent->locked);
         if (dirty) {
             ent->dirty = TRUE;
             ent->wr_count -= MIN(ent->wr_count, naccessed);
+
+            /* Any filtered image of the chunk is out of date now */
+            ent->image = H5MM_xfree(ent->image);
         } /* end if */
         else
             ent->rd_count -= MIN(ent->rd_count, naccessed);
@@ -4164,6 +6295,561 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_unlock() */
 
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_concurrent
+ *
+ * Purpose:     Decide whether the dataset's filter pipeline may be run
+ *              over several chunks at once on filter threads, and how
+ *              many threads to use.
+ *
+ *              Only the deflate, shuffle, Fletcher32, N-bit and
+ *              scale-offset filters are run this way: they keep no state
+ *              between calls and the rest of the library is not touched
+ *              while they run, apart from allocating memory.  (Szip is
+ *              left out, as libaec's thread safety isn't promised.)  A
+ *              filter callback on the data transfer property list must
+ *              be made from the application's thread, so the pipeline is
+ *              run serially when one is set.
+ *
+ *              The code stack, the memory allocation sanity checks and
+ *              the filter statistics kept with H5Z_DEBUG are all global
+ *              and unlocked, so the pipeline is always run serially
+ *              when any of them is built in.
+ *
+ * Return:      TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_filter_concurrent(const H5D_t *dset, unsigned *nthreads)
+{
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* Filter pipeline */
+    H5Z_cb_t           filter_cb;                                  /* I/O filter callback function */
+    size_t             u;                                          /* Local index variable */
+    htri_t             ret_value = TRUE;                           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(nthreads);
+
+    *nthreads = H5F_FILTER_THREADS(dset->oloc.file);
+
+#if defined(H5_HAVE_CODESTACK) || defined(H5_MEMORY_ALLOC_SANITY_CHECK) || defined(H5Z_DEBUG)
+    /* H5MM_malloc() and H5MM_xfree() would race on the sanity check list,
+     * and the filters on the code stack and statistics */
+    HGOTO_DONE(FALSE)
+#endif
+
+    if (*nthreads < 2 || 0 == pline->nused)
+        HGOTO_DONE(FALSE)
+
+    /* Retrieve filter settings from API context */
+    if (H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+    if (filter_cb.func)
+        HGOTO_DONE(FALSE)
+
+    /* Check that all the filters are ones that can run concurrently, and
+     * are available.  (A missing filter is left for the serial pipeline to
+     * report.)
+     */
+    for (u = 0; u < pline->nused; u++) {
+        htri_t avail; /* Whether the filter is available */
+
+        switch (pline->filter[u].id) {
+            case H5Z_FILTER_DEFLATE:
+            case H5Z_FILTER_SHUFFLE:
+            case H5Z_FILTER_FLETCHER32:
+            case H5Z_FILTER_NBIT:
+            case H5Z_FILTER_SCALEOFFSET:
+                break;
+
+            default:
+                HGOTO_DONE(FALSE)
+        } /* end switch */
+        if ((avail = H5Z_filter_avail(pline->filter[u].id)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "unable to check filter availability")
+        if (!avail)
+            HGOTO_DONE(FALSE)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_concurrent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_run
+ *
+ * Purpose:     Run the filter pipeline over all the jobs in POOL, on up
+ *              to NTHREADS threads including the calling one.  Jobs are
+ *              handed out one at a time, so the calling thread finishes
+ *              the work of any thread that couldn't be started.
+ *
+ *              The error stack isn't safe to use from several threads,
+ *              so every thread running jobs, the calling one included,
+ *              drops the errors raised by the filters.  Jobs that fail,
+ *              or that no thread could take, are only marked as failed:
+ *              the caller leaves those chunks to the serial pipeline,
+ *              which reports the failure properly.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filter_run(H5D_chunk_filter_pool_t *pool, unsigned nthreads)
+{
+    pthread_t *threads   = NULL;    /* Thread handles */
+    hbool_t *  started   = NULL;    /* Whether each thread was started */
+    size_t     nworkers;            /* Number of threads to use */
+    size_t     u;                   /* Local index variable */
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(pool);
+    HDassert(pool->njobs > 0);
+
+    nworkers   = MIN((size_t)nthreads, pool->njobs);
+    pool->next = 0;
+    if (nworkers > 1) {
+        if (NULL == (threads = (pthread_t *)H5MM_malloc(nworkers * sizeof(pthread_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread handles")
+        if (NULL == (started = (hbool_t *)H5MM_calloc(nworkers * sizeof(hbool_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread flags")
+    } /* end if */
+    if (0 != pthread_mutex_init(&pool->mutex, NULL))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize filter job lock")
+
+    /* Start the extra threads, then take jobs on this thread too */
+    for (u = 1; u < nworkers; u++)
+        if (0 == pthread_create(&threads[u], NULL, H5D__chunk_filter_worker, pool))
+            started[u] = TRUE;
+    H5D__chunk_filter_worker(pool);
+
+    /* Wait for the other threads */
+    for (u = 1; u < nworkers; u++)
+        if (started[u])
+            pthread_join(threads[u], NULL);
+    pthread_mutex_destroy(&pool->mutex);
+
+    /* Leave the jobs no thread could take to the serial pipeline */
+    for (u = pool->next; u < pool->njobs; u++)
+        pool->jobs[u].failed = TRUE;
+
+done:
+    H5MM_xfree(threads);
+    H5MM_xfree(started);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_worker
+ *
+ * Purpose:     Thread body for H5D__chunk_filter_run(): take jobs from
+ *              the pool until there are none left.  Errors raised while
+ *              the jobs run are dropped; a thread that can't arrange
+ *              that takes no jobs.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_filter_worker(void *_pool)
+{
+    H5D_chunk_filter_pool_t *pool      = (H5D_chunk_filter_pool_t *)_pool;
+    H5Z_cb_t                 filter_cb = {NULL, NULL}; /* No filter callback */
+    hbool_t                  prev_suppress;                /* Previous error push setting */
+
+    if (H5E_suppress_thread_push(TRUE, &prev_suppress) < 0)
+        return NULL;
+
+    for (;;) {
+        H5D_chunk_filter_job_t *job = NULL;
+
+        pthread_mutex_lock(&pool->mutex);
+        if (pool->next < pool->njobs)
+            job = &pool->jobs[pool->next++];
+        pthread_mutex_unlock(&pool->mutex);
+        if (NULL == job)
+            break;
+
+        /* Copy a chunk to be encoded, so the cached chunk is left alone */
+        if (job->src) {
+            if (NULL == (job->buf = H5MM_malloc(job->buf_size))) {
+                job->failed = TRUE;
+                continue;
+            } /* end if */
+            H5MM_memcpy(job->buf, job->src, job->nbytes);
+        } /* end if */
+
+        if (H5Z_pipeline(pool->pline, pool->flags, &job->filter_mask, pool->err_detect, filter_cb,
+                         &job->nbytes, &job->buf_size, &job->buf) < 0)
+            job->failed = TRUE;
+#if H5_SIZEOF_SIZE_T > 4
+        /* Leave chunks too large for a 32-bit length to the serial pipeline */
+        else if (!(pool->flags & H5Z_FLAG_REVERSE) && job->nbytes > ((size_t)0xffffffff))
+            job->failed = TRUE;
+#endif /* H5_SIZEOF_SIZE_T > 4 */
+    }      /* end for */
+
+    H5E_suppress_thread_push(prev_suppress, NULL);
+
+    return NULL;
+} /* end H5D__chunk_filter_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_decode_ahead
+ *
+ * Purpose:     Read the filtered chunks among the next few chunks of an
+ *              I/O operation, starting at CHUNK_NODE, and decode them on
+ *              NTHREADS filter threads.  Only chunks that
+ *              H5D__chunk_lock() would read from the file are picked:
+ *              chunks in the file but not in the cache, with filters
+ *              enabled, and (for a write, WRITE_OP) not about to be
+ *              overwritten entirely.
+ *
+ *              The decoded chunks are kept on the chunk cache, where
+ *              H5D__chunk_lock() takes them instead of reading and
+ *              decoding the chunks itself.  Chunks that fail to decode
+ *              are left out, so that H5D__chunk_lock() gets the same
+ *              error.  Chunks left over from the previous batch are
+ *              released first.
+ *
+ *              END_NODE is set to the first chunk after the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_decode_ahead(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                        const H5D_chunk_map_t *fm, H5SL_node_t *chunk_node, unsigned nthreads,
+                        hbool_t write_op, H5SL_node_t **end_node)
+{
+    const H5D_t *             dset   = io_info->dset;                          /* Dataset */
+    const H5O_layout_chunk_t *layout = &(dset->shared->layout.u.chunk);        /* Chunk layout */
+    H5D_chunk_filter_pool_t   pool;                                            /* Batch of jobs */
+    size_t                    max_jobs = (size_t)nthreads * H5D_CHUNK_FILTER_JOBS_PER_THREAD;
+    size_t                    nchunks  = 0;       /* Number of chunks looked at */
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(nthreads > 1);
+    HDassert(end_node);
+
+    /* Release chunks left over from the previous batch and start a new one */
+    if (H5D__chunk_decode_init(dset, &pool, max_jobs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start batch of chunks to decode")
+
+    /* Pick the chunks to decode and read them */
+    while (chunk_node && nchunks < max_jobs) {
+        H5D_chunk_info_t *chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node); /* Chunk information */
+        H5D_chunk_ud_t    udata;       /* Chunk index pass-through */
+        hbool_t           pick = TRUE; /* Whether to decode the chunk */
+
+        if (H5D__chunk_lookup(dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        if (!H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint)
+            pick = FALSE;
+        else if ((layout->flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+                 H5D__chunk_is_partial_edge_chunk(dset->shared->ndims, layout->dim, chunk_info->scaled,
+                                                  dset->shared->curr_dims))
+            pick = FALSE;
+        else if (write_op && (chunk_info->chunk_points * type_info->dst_type_size) == layout->size &&
+                 (chunk_info->chunk_points * type_info->src_type_size) == layout->size &&
+                 fm->fsel_type != H5S_SEL_POINTS)
+            /* The whole chunk is about to be overwritten */
+            pick = FALSE;
+
+        if (pick && H5D__chunk_decode_add(dset, &pool, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunk")
+
+        nchunks++;
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+    *end_node = chunk_node;
+
+    /* Decode the chunks */
+    if (H5D__chunk_decode_run(dset, &pool, nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to decode raw data chunks")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_decode_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_decode_init
+ *
+ * Purpose:     Release the chunks left over from the previous batch of
+ *              decoded chunks and set up POOL for a new batch of up to
+ *              MAX_JOBS chunks, kept on the chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_decode_init(const H5D_t *dset, H5D_chunk_filter_pool_t *pool, size_t max_jobs)
+{
+    H5D_rdcc_t *rdcc      = &(dset->shared->cache.chunk); /* Chunk cache */
+    herr_t      ret_value = SUCCEED;                      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    H5D__chunk_free_decoded(rdcc);
+
+    HDmemset(pool, 0, sizeof(*pool));
+    if (NULL ==
+        (pool->jobs = (H5D_chunk_filter_job_t *)H5MM_calloc(max_jobs * sizeof(H5D_chunk_filter_job_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter jobs")
+    rdcc->decoded = pool->jobs;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_decode_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_decode_add
+ *
+ * Purpose:     Read the chunk at SCALED, which is described by UDATA,
+ *              from the file into a new job of POOL, the batch of chunks
+ *              decoded for the chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_decode_add(const H5D_t *dset, H5D_chunk_filter_pool_t *pool, const hsize_t *scaled,
+                      const H5D_chunk_ud_t *udata)
+{
+    H5D_chunk_filter_job_t *job       = &pool->jobs[pool->njobs]; /* New job */
+    herr_t                  ret_value = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset->shared->cache.chunk.decoded == pool->jobs);
+    HDassert(H5F_addr_defined(udata->chunk_block.offset));
+
+    H5MM_memcpy(job->scaled, scaled, sizeof(hsize_t) * dset->shared->ndims);
+    job->addr = udata->chunk_block.offset;
+    H5_CHECKED_ASSIGN(job->nbytes, size_t, udata->chunk_block.length, hsize_t);
+    job->buf_size    = job->nbytes;
+    job->filter_mask = udata->filter_mask;
+    if (NULL == (job->buf = H5D__chunk_mem_alloc(job->nbytes, &(dset->shared->dcpl_cache.pline))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+    dset->shared->cache.chunk.ndecoded = ++pool->njobs;
+
+    if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, job->addr, job->nbytes, job->buf) <
+        0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_decode_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_decode_run
+ *
+ * Purpose:     Decode the chunks read by H5D__chunk_decode_add() into
+ *              POOL, on NTHREADS filter threads.  Chunks that fail to
+ *              decode are dropped from the pool, for H5D__chunk_lock()
+ *              to read and report.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_decode_run(const H5D_t *dset, H5D_chunk_filter_pool_t *pool, unsigned nthreads)
+{
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* Filter pipeline */
+    size_t             u;                                          /* Local index variable */
+    herr_t             ret_value = SUCCEED;                        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (0 == pool->njobs)
+        HGOTO_DONE(SUCCEED)
+
+    pool->pline = pline;
+    pool->flags = H5Z_FLAG_REVERSE;
+    if (H5CX_get_err_detect(&pool->err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if (H5D__chunk_filter_run(pool, nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to run filter threads")
+
+    /* Leave the chunks that failed to H5D__chunk_lock() */
+    for (u = 0; u < pool->njobs; u++)
+        if (pool->jobs[u].failed)
+            pool->jobs[u].buf = H5D__chunk_mem_xfree(pool->jobs[u].buf, pline);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_decode_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_take_decoded
+ *
+ * Purpose:     Take the chunk at SCALED, at address ADDR in the file,
+ *              from the chunks decoded by H5D__chunk_decode_ahead().
+ *              FILTER_MASK is set to the filters skipped by the pipeline.
+ *
+ * Return:      The decoded chunk, which now belongs to the caller, or
+ *              NULL if the chunk hasn't been decoded
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_take_decoded(H5D_rdcc_t *rdcc, unsigned ndims, const hsize_t *scaled, haddr_t addr,
+                        unsigned *filter_mask)
+{
+    size_t u;                /* Local index variable */
+    void * ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < rdcc->ndecoded; u++) {
+        H5D_chunk_filter_job_t *job = &rdcc->decoded[u];
+
+        if (job->buf && H5F_addr_eq(job->addr, addr) &&
+            0 == HDmemcmp(job->scaled, scaled, sizeof(hsize_t) * ndims)) {
+            *filter_mask = job->filter_mask;
+            ret_value    = job->buf;
+            job->buf     = NULL;
+            break;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_take_decoded() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_free_decoded
+ *
+ * Purpose:     Release the chunks decoded by H5D__chunk_decode_ahead()
+ *              that haven't been taken.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_free_decoded(H5D_rdcc_t *rdcc)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < rdcc->ndecoded; u++)
+        H5MM_xfree(rdcc->decoded[u].buf);
+    rdcc->decoded  = (H5D_chunk_filter_job_t *)H5MM_xfree(rdcc->decoded);
+    rdcc->ndecoded = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_free_decoded() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_encode_ahead
+ *
+ * Purpose:     Run the filter pipeline over ENT and the dirty cache
+ *              entries that follow it, on the filter threads, ahead of
+ *              their being flushed.  Each entry keeps its filtered image,
+ *              which H5D__chunk_flush_entry() writes out, until it is
+ *              flushed or modified.
+ *
+ *              Nothing is done when the pipeline can't be run
+ *              concurrently or there aren't at least two chunks to
+ *              encode; H5D__chunk_flush_entry() then runs the pipeline
+ *              itself, as it does for entries that fail to encode here.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_encode_ahead(const H5D_t *dset, H5D_rdcc_ent_t *ent)
+{
+    const H5O_pline_t *     pline = &(dset->shared->dcpl_cache.pline); /* Filter pipeline */
+    H5D_chunk_filter_pool_t pool;                                      /* Batch of jobs */
+    H5D_rdcc_ent_t *        cur;                                       /* Current cache entry */
+    unsigned                nthreads = 0;                              /* Number of filter threads */
+    htri_t                  concurrent;          /* Whether the pipeline can be run concurrently */
+    size_t                  max_jobs;            /* Maximum number of jobs in the batch */
+    size_t                  u;                   /* Local index variable */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(ent);
+
+    HDmemset(&pool, 0, sizeof(pool));
+
+    /* Check whether there is anything to do (quickly, in the common case) */
+    if (H5F_FILTER_THREADS(dset->oloc.file) < 2 || 0 == pline->nused)
+        HGOTO_DONE(SUCCEED)
+    if ((concurrent = H5D__chunk_filter_concurrent(dset, &nthreads)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered concurrently")
+    if (!concurrent)
+        HGOTO_DONE(SUCCEED)
+
+    max_jobs = (size_t)nthreads * H5D_CHUNK_FILTER_JOBS_PER_THREAD;
+    if (NULL ==
+        (pool.jobs = (H5D_chunk_filter_job_t *)H5MM_calloc(max_jobs * sizeof(H5D_chunk_filter_job_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter jobs")
+
+    /* Pick the entries to encode */
+    for (cur = ent; cur && pool.njobs < max_jobs; cur = cur->next)
+        if (cur->dirty && !cur->locked && !cur->image &&
+            !(cur->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
+            H5D_chunk_filter_job_t *job = &pool.jobs[pool.njobs++];
+
+            job->ent = cur;
+            job->src = cur->chunk;
+            H5_CHECKED_ASSIGN(job->nbytes, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+            job->buf_size = job->nbytes;
+        } /* end if */
+    if (pool.njobs < 2)
+        HGOTO_DONE(SUCCEED)
+
+    /* Encode the chunks */
+    pool.pline      = pline;
+    pool.flags      = 0;
+    pool.err_detect = H5Z_ENABLE_EDC;
+    if (H5D__chunk_filter_run(&pool, nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to run filter threads")
+
+    /* Give the images to the entries */
+    for (u = 0; u < pool.njobs; u++)
+        if (!pool.jobs[u].failed) {
+            pool.jobs[u].ent->image      = pool.jobs[u].buf;
+            pool.jobs[u].ent->image_size = pool.jobs[u].nbytes;
+            pool.jobs[u].ent->image_mask = pool.jobs[u].filter_mask;
+            pool.jobs[u].buf             = NULL;
+        } /* end if */
+
+done:
+    if (pool.jobs) {
+        for (u = 0; u < pool.njobs; u++)
+            H5MM_xfree(pool.jobs[u].buf);
+        H5MM_xfree(pool.jobs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_encode_ahead() */
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_allocated_cb
  *
@@ -4231,17 +6917,130 @@ H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes)
     idx_info.layout  = &dset->shared->layout.u.chunk;
     idx_info.storage = sc;
 
-    /* Iterate over the chunks */
-    if ((sc->ops->iterate)(&idx_info, H5D__chunk_allocated_cb, &chunk_bytes) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL,
-                    "unable to retrieve allocated chunk information from index")
+    /* Iterate over the chunks */
+    if ((sc->ops->iterate)(&idx_info, H5D__chunk_allocated_cb, &chunk_bytes) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL,
+                    "unable to retrieve allocated chunk information from index")
+
+    /* Set number of bytes for caller */
+    *nbytes = chunk_bytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_allocated() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_allocate_batch
+ *
+ * Purpose:     Allocates file space for a batch of NENTS new chunks,
+ *              writes their fill values and inserts them into the index,
+ *              for H5D__chunk_allocate().
+ *
+ *              The chunks that need space get one block of file space,
+ *              laid out in the order of ENTS, and the fill values of all
+ *              the chunks are written with one vector request, which the
+ *              file driver can turn into a few large writes.  Chunks
+ *              large enough to be aligned in the file (H5Pset_alignment)
+ *              still get their own, aligned, space.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_allocate_batch(const H5D_t *dset, const H5D_chk_idx_info_t *idx_info, size_t nents,
+                          H5D_chunk_alloc_ent_t *ents)
+{
+    const H5D_chunk_ops_t *ops        = dset->shared->layout.storage.u.chunk.ops; /* Chunk operations */
+    hsize_t                alignment  = H5F_ALIGNMENT(idx_info->f); /* File's alignment */
+    hsize_t                threshold  = H5F_THRESHOLD(idx_info->f); /* File's alignment threshold */
+    hsize_t                alloc_size = 0;    /* Bytes of file space for the batch */
+    H5FD_mem_t *           types      = NULL; /* Memory types of the I/O vector */
+    haddr_t *              addrs      = NULL; /* Addresses of the I/O vector */
+    size_t *               sizes      = NULL; /* Sizes of the I/O vector */
+    const void **          bufs       = NULL; /* Buffers of the I/O vector */
+    uint32_t               nvec       = 0;    /* Number of chunks to write */
+    size_t                 u;                 /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(idx_info);
+    HDassert(ents);
+    HDassert(nents <= UINT32_MAX);
+
+    /* Allocate file space for the chunks that need it */
+    for (u = 0; u < nents; u++)
+        if (ents[u].alloc) {
+            if (alignment > 1 && ents[u].udata.chunk_block.length >= threshold) {
+                ents[u].udata.chunk_block.offset =
+                    H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, ents[u].udata.chunk_block.length);
+                if (!H5F_addr_defined(ents[u].udata.chunk_block.offset))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+                ents[u].need_insert = TRUE;
+            } /* end if */
+            else
+                alloc_size += ents[u].udata.chunk_block.length;
+        } /* end if */
+    if (alloc_size > 0) {
+        haddr_t alloc_addr; /* Address of the next new chunk */
+
+        if (HADDR_UNDEF == (alloc_addr = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, alloc_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
 
-    /* Set number of bytes for caller */
-    *nbytes = chunk_bytes;
+        for (u = 0; u < nents; u++)
+            if (ents[u].alloc && !H5F_addr_defined(ents[u].udata.chunk_block.offset)) {
+                ents[u].udata.chunk_block.offset = alloc_addr;
+                ents[u].need_insert              = TRUE;
+                alloc_addr += ents[u].udata.chunk_block.length;
+            } /* end if */
+    }         /* end if */
+
+    /* Write the fill values of the chunks */
+    if (ents[0].fill_buf) {
+        if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(nents * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        if (NULL == (addrs = (haddr_t *)H5MM_malloc(nents * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        if (NULL == (sizes = (size_t *)H5MM_malloc(nents * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        if (NULL == (bufs = (const void **)H5MM_malloc(nents * sizeof(const void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+
+        for (u = 0; u < nents; u++) {
+            HDassert(H5F_addr_defined(ents[u].udata.chunk_block.offset));
+            HDassert(ents[u].fill_buf);
+
+            types[nvec] = H5FD_MEM_DRAW;
+            addrs[nvec] = ents[u].udata.chunk_block.offset;
+            H5_CHECKED_ASSIGN(sizes[nvec], size_t, ents[u].udata.chunk_block.length, hsize_t);
+            bufs[nvec] = ents[u].fill_buf;
+            nvec++;
+        } /* end for */
+
+        if (H5F_shared_vector_write(H5F_SHARED(idx_info->f), nvec, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    } /* end if */
+
+    /* Insert the chunk records into the index */
+    if (ops->insert)
+        for (u = 0; u < nents; u++)
+            if (ents[u].need_insert) {
+                if ((ops->insert)(idx_info, &ents[u].udata, dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                if (H5D__chunk_idx_cache_insert(dset, &ents[u].udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update in-memory chunk index")
+            } /* end if */
 
 done:
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_allocated() */
+} /* end H5D__chunk_allocate_batch() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_allocate
@@ -4250,6 +7049,11 @@ done:
  *        Return SUCCEED if all needed allocation succeed, otherwise
  *        FAIL.
  *
+ *        Unless the chunks are written collectively or each chunk
+ *        needs its own (VL datatype) fill values, the chunks are
+ *        allocated, filled and inserted into the index in batches,
+ *        with H5D__chunk_allocate_batch().
+ *
  * Return:    Non-negative on success/Negative on failure
  *
  * Programmer:    Albert Cheng
@@ -4297,9 +7101,14 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
                                                         of each dimension */
     hsize_t edge_chunk_scaled[H5O_LAYOUT_NDIMS]; /* Offset of the unfiltered edge chunks at the edge of each
                                                     dimension */
-    unsigned             nunfilt_edge_chunk_dims = 0; /* Number of dimensions on an edge */
-    H5O_storage_chunk_t *sc                      = &(layout->storage.u.chunk); /* Convenience variable */
-    herr_t               ret_value               = SUCCEED;                    /* Return value */
+    unsigned               nunfilt_edge_chunk_dims = 0; /* Number of dimensions on an edge */
+    H5O_storage_chunk_t *  sc          = &(layout->storage.u.chunk); /* Convenience variable */
+    hbool_t                use_batch   = FALSE; /* Whether chunks are allocated and filled in batches */
+    H5D_chunk_alloc_ent_t *batch       = NULL;  /* Chunks allocated and filled together */
+    size_t                 batch_alloc = 0;     /* Number of chunks the batch can hold */
+    size_t                 batch_nused = 0;     /* Number of chunks in the batch */
+    size_t                 batch_size  = 0;     /* Bytes of chunks in the batch */
+    herr_t                 ret_value   = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -4437,6 +7246,24 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     idx_info.layout  = &dset->shared->layout.u.chunk;
     idx_info.storage = sc;
 
+    /* Set up the batch of chunks, unless each chunk needs its own fill values */
+    use_batch = !(fb_info_init && fb_info.has_vlen_fill_type);
+#ifdef H5_HAVE_PARALLEL
+    /* The chunks are written collectively at the end instead */
+    if (using_mpi)
+        use_batch = FALSE;
+#endif /* H5_HAVE_PARALLEL */
+    if (use_batch) {
+        hsize_t nchunks = 1; /* Number of chunks in the dataset, up to the batch size */
+
+        for (op_dim = 0; op_dim < space_ndims && nchunks < H5D_CHUNK_ALLOC_BATCH_NCHUNKS; op_dim++)
+            nchunks *= max_unalloc[op_dim] + 1;
+        batch_alloc = (size_t)MIN(nchunks, H5D_CHUNK_ALLOC_BATCH_NCHUNKS);
+        if (NULL ==
+            (batch = (H5D_chunk_alloc_ent_t *)H5MM_malloc(batch_alloc * sizeof(H5D_chunk_alloc_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk batch")
+    } /* end if */
+
     /* Loop over all chunks */
     /* The algorithm is:
      *  For each dimension:
@@ -4588,53 +7415,96 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             H5_CHECKED_ASSIGN(udata.chunk_block.length, uint32_t, chunk_size, size_t);
             udata.filter_mask = filter_mask;
 
-            /* Allocate the chunk (with all processes) */
-            if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
-            HDassert(H5F_addr_defined(udata.chunk_block.offset));
+            /* Add the chunk to the batch */
+            if (batch) {
+                H5D_chunk_alloc_ent_t *ent = &batch[batch_nused];
 
-            /* Check if fill values should be written to chunks */
-            if (should_fill) {
-                /* Sanity check */
-                HDassert(fb_info_init);
-                HDassert(udata.chunk_block.length == chunk_size);
+                H5MM_memcpy(ent->scaled, scaled, (space_ndims + 1) * sizeof(scaled[0]));
+                ent->udata               = udata;
+                ent->udata.common.scaled = ent->scaled;
+                ent->alloc               = FALSE;
+                ent->need_insert         = FALSE;
+                ent->fill_buf            = should_fill ? *fill_buf : NULL;
 
-#ifdef H5_HAVE_PARALLEL
-                /* Check if this file is accessed with an MPI-capable file driver */
-                if (using_mpi) {
-                    /* collect all chunk addresses to be written to
-                       write collectively at the end */
-                    /* allocate/resize address array if no more space left */
-                    /* Note that if we add support for parallel filters we must
-                     * also store an array of chunk sizes and pass it to the
-                     * apporpriate collective write function */
-                    if (0 == chunk_info.num_io % 1024)
-                        if (NULL == (chunk_info.addr = (haddr_t *)H5MM_realloc(
-                                         chunk_info.addr, (chunk_info.num_io + 1024) * sizeof(haddr_t))))
-                            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                        "memory allocation failed for chunk addresses")
-
-                    /* Store the chunk's address for later */
-                    chunk_info.addr[chunk_info.num_io] = udata.chunk_block.offset;
-                    chunk_info.num_io++;
-
-                    /* Indicate that blocks will be written */
-                    blocks_written = TRUE;
+                /* The index knows the address of the chunk already, or the
+                 * chunk gets space from the batch
+                 */
+                if (H5D_CHUNK_IDX_NONE == sc->idx_type) {
+                    if (H5D__chunk_file_alloc(&idx_info, NULL, &ent->udata.chunk_block, &ent->need_insert,
+                                              ent->scaled) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
                 } /* end if */
-                else {
+                else if (H5D__chunk_file_alloc_check(&idx_info, NULL, &ent->udata.chunk_block, &ent->alloc) <
+                         0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+
+                batch_nused++;
+                batch_size += chunk_size;
+
+                /* Allocate and fill the chunks, once the batch is full */
+                if (batch_nused == batch_alloc || batch_size >= H5D_CHUNK_ALLOC_BATCH_SIZE) {
+                    if (H5D__chunk_allocate_batch(dset, &idx_info, batch_nused, batch) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
+                    batch_nused = 0;
+                    batch_size  = 0;
+                } /* end if */
+            }     /* end if */
+            else {
+                /* Allocate the chunk (with all processes) */
+                if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
+                                "unable to insert/resize chunk on chunk level")
+                HDassert(H5F_addr_defined(udata.chunk_block.offset));
+
+                /* Check if fill values should be written to chunks */
+                if (should_fill) {
+                    /* Sanity check */
+                    HDassert(fb_info_init);
+                    HDassert(udata.chunk_block.length == chunk_size);
+
+#ifdef H5_HAVE_PARALLEL
+                    /* Check if this file is accessed with an MPI-capable file driver */
+                    if (using_mpi) {
+                        /* collect all chunk addresses to be written to
+                           write collectively at the end */
+                        /* allocate/resize address array if no more space left */
+                        /* Note that if we add support for parallel filters we must
+                         * also store an array of chunk sizes and pass it to the
+                         * apporpriate collective write function */
+                        if (0 == chunk_info.num_io % 1024)
+                            if (NULL == (chunk_info.addr = (haddr_t *)H5MM_realloc(
+                                             chunk_info.addr,
+                                             (chunk_info.num_io + 1024) * sizeof(haddr_t))))
+                                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                            "memory allocation failed for chunk addresses")
+
+                        /* Store the chunk's address for later */
+                        chunk_info.addr[chunk_info.num_io] = udata.chunk_block.offset;
+                        chunk_info.num_io++;
+
+                        /* Indicate that blocks will be written */
+                        blocks_written = TRUE;
+                    } /* end if */
+                    else {
 #endif /* H5_HAVE_PARALLEL */
-                    if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
-                                               udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
-                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+                        if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
+                                                   udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
+                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
 #ifdef H5_HAVE_PARALLEL
-                } /* end else */
+                    } /* end else */
 #endif            /* H5_HAVE_PARALLEL */
-            } /* end if */
+                } /* end if */
 
-            /* Insert the chunk record into the index */
-            if (need_insert && ops->insert)
-                if ((ops->insert)(&idx_info, &udata, dset) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                /* Insert the chunk record into the index */
+                if (need_insert && ops->insert) {
+                    if ((ops->insert)(&idx_info, &udata, dset) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
+                                    "unable to insert chunk addr into index")
+                    if (H5D__chunk_idx_cache_insert(dset, &udata) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
+                                    "unable to update in-memory chunk index")
+                } /* end if */
+            } /* end else */
 
             /* Increment indices and adjust the edge chunk state */
             carry = TRUE;
@@ -4686,6 +7556,11 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             max_unalloc[op_dim] = min_unalloc[op_dim] - 1;
     } /* end for(op_dim=0...) */
 
+    /* Allocate and fill the rest of the chunks in the batch */
+    if (batch_nused > 0)
+        if (H5D__chunk_allocate_batch(dset, &idx_info, batch_nused, batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
+
 #ifdef H5_HAVE_PARALLEL
     /* do final collective I/O */
     if (using_mpi && blocks_written)
@@ -4704,6 +7579,8 @@ done:
     /* Free the unfiltered fill value buffer */
     unfilt_fill_buf = H5D__chunk_mem_xfree(unfilt_fill_buf, &def_pline);
 
+    H5MM_xfree(batch);
+
 #ifdef H5_HAVE_PARALLEL
     if (using_mpi && chunk_info.addr)
         H5MM_free(chunk_info.addr);
@@ -5317,7 +8194,6 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
     H5D_io_info_t       chk_io_info;          /* Chunked I/O info object */
     H5D_storage_t       chk_store;            /* Chunk storage information */
     const H5O_layout_t *layout = &(dset->shared->layout);      /* Dataset's layout */
-    const H5D_rdcc_t *  rdcc   = &(dset->shared->cache.chunk); /*raw data chunk cache */
     unsigned            space_ndims;                           /* Dataset's space rank */
     const hsize_t *     space_dim;                             /* Current dataspace dimensions */
     unsigned            op_dim;                                /* Current operating dimension */
@@ -5555,7 +8431,8 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
                 /* Evict the entry from the cache if present, but do not flush
                  * it to disk */
                 if (UINT_MAX != chk_udata.idx_hint)
-                    if (H5D__chunk_cache_evict(dset, rdcc->slot[chk_udata.idx_hint], FALSE) < 0)
+                    if (H5D__chunk_cache_evict(
+                            dset, H5D__chunk_cache_find(dset->shared, chk_udata.idx_hint, scaled), FALSE) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
                 /* Remove the chunk from disk, if present */
@@ -5567,6 +8444,13 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
                     if ((sc->ops->remove)(&idx_info, &idx_udata) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL,
                                     "unable to remove chunk entry from index")
+
+                    /* Forget the chunk in the in-memory chunk index too */
+                    if (dset->shared->cache.chunk.idx_cache &&
+                        H5D__chunk_idx_cache_add(dset->shared->cache.chunk.idx_cache, scaled, HADDR_UNDEF,
+                                                 0, 0) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL,
+                                    "unable to remove chunk from in-memory chunk index")
                 } /* end if */
             }     /* end else */
 
@@ -5821,6 +8705,10 @@ H5D__chunk_update_cache(H5D_t *dset)
     /* Check the rank */
     HDassert((dset->shared->layout.u.chunk.ndims - 1) > 1);
 
+    /* Chunks in the shared cache are hashed without the dataset's dimensions */
+    if (rdcc->open_cache)
+        HGOTO_DONE(SUCCEED)
+
     /* Add temporary entry list to rdcc */
     (void)HDmemset(&tmp_head, 0, sizeof(tmp_head));
     rdcc->tmp_head = &tmp_head;
@@ -6001,7 +8889,11 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         H5D_shared_t *  shared_fo = (H5D_shared_t *)udata->cpy_info->shared_fo;
 
         /* See if the written chunk is in the chunk cache */
-        if (shared_fo && shared_fo->cache.chunk.nslots > 0) {
+        if (shared_fo && shared_fo->cache.chunk.open_cache) {
+            ent                   = H5D__chunk_cache_find(shared_fo, 0, chunk_rec->scaled);
+            udata->chunk_in_cache = (ent != NULL);
+        } /* end if */
+        else if (shared_fo && shared_fo->cache.chunk.nslots > 0) {
             /* Determine the chunk's location in the hash table */
             idx = H5D__chunk_hash_val(shared_fo, chunk_rec->scaled);
 
@@ -6814,25 +9706,23 @@ done:
 } /* H5D__chunk_is_partial_edge_chunk() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_file_alloc()
+ * Function:    H5D__chunk_file_alloc_check()
  *
- * Purpose:     Chunk allocation:
- *          Create the chunk if it doesn't exist, or reallocate the
- *                chunk if its size changed.
- *          The coding is moved and modified from each index structure.
+ * Purpose:     Decides whether a chunk being written needs new file
+ *              space, checking that its size can be encoded in the
+ *              index and releasing the space of an old chunk whose size
+ *              has changed.  When no new space is needed, the address
+ *              of the old chunk is sent back in NEW_CHUNK.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Vailin Choi; June 2014
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
-                      H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t *scaled)
+static herr_t
+H5D__chunk_file_alloc_check(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+                            H5F_block_t *new_chunk, hbool_t *alloc_chunk)
 {
-    hbool_t alloc_chunk = FALSE;   /* Whether to allocate chunk */
-    herr_t  ret_value   = SUCCEED; /* Return value         */
+    herr_t ret_value = SUCCEED; /* Return value         */
 
     FUNC_ENTER_STATIC
 
@@ -6843,9 +9733,9 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
     HDassert(idx_info->layout);
     HDassert(idx_info->storage);
     HDassert(new_chunk);
-    HDassert(need_insert);
+    HDassert(alloc_chunk);
 
-    *need_insert = FALSE;
+    *alloc_chunk = FALSE;
 
     /* Check for filters on chunks */
     if (idx_info->pline->nused > 0) {
@@ -6887,7 +9777,7 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
                 if (!(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
                     if (H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, old_chunk->offset, old_chunk->length) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
-                alloc_chunk = TRUE;
+                *alloc_chunk = TRUE;
             } /* end if */
             else {
                 /* Don't need to reallocate chunk, but send its address back up */
@@ -6897,15 +9787,53 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
         }     /* end if */
         else {
             HDassert(!H5F_addr_defined(new_chunk->offset));
-            alloc_chunk = TRUE;
+            *alloc_chunk = TRUE;
         } /* end else */
     }     /* end if */
     else {
         HDassert(!H5F_addr_defined(new_chunk->offset));
         HDassert(new_chunk->length == idx_info->layout->size);
-        alloc_chunk = TRUE;
+        *alloc_chunk = TRUE;
     } /* end else */
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_alloc_check() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_alloc()
+ *
+ * Purpose:     Chunk allocation:
+ *          Create the chunk if it doesn't exist, or reallocate the
+ *                chunk if its size changed.
+ *          The coding is moved and modified from each index structure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Vailin Choi; June 2014
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+                      H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t *scaled)
+{
+    hbool_t alloc_chunk = FALSE;   /* Whether to allocate chunk */
+    herr_t  ret_value   = SUCCEED; /* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(idx_info);
+    HDassert(new_chunk);
+    HDassert(need_insert);
+
+    *need_insert = FALSE;
+
+    /* Check whether the chunk needs new file space */
+    if (H5D__chunk_file_alloc_check(idx_info, old_chunk, new_chunk, &alloc_chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to check chunk allocation")
+
     /* Actually allocate space for the chunk in the file */
     if (alloc_chunk) {
         switch (idx_info->storage->idx_type) {
@@ -7453,3 +10381,374 @@ H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *offset, unsigned
 done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__get_chunk_info_by_coord() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter_cb
+ *
+ * Purpose:     Records the info of each chunk in the index, for
+ *              H5D__chunk_iter().
+ *
+ * Return:      Success:    H5_ITER_CONT
+ *              Failure:    Negative (H5_ITER_ERROR)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_iter_ud_t * udata = (H5D_chunk_iter_ud_t *)_udata; /* User data for callback */
+    H5D_chunk_iter_ent_t *ent;                                   /* Entry for this chunk */
+    int                   ret_value = H5_ITER_CONT;              /* Callback return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(chunk_rec);
+    HDassert(udata);
+
+    /* Grow the arrays, if necessary */
+    if (udata->nused == udata->nalloc) {
+        size_t new_alloc = MAX(2 * udata->nalloc, H5D_CHUNK_ITER_NENTS_INIT);
+
+        if (NULL == (udata->ent = (H5D_chunk_iter_ent_t *)H5MM_realloc(
+                         udata->ent, new_alloc * sizeof(H5D_chunk_iter_ent_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, H5_ITER_ERROR, "can't allocate chunk info array")
+        if (NULL == (udata->scaled = (hsize_t *)H5MM_realloc(udata->scaled,
+                                                             new_alloc * udata->ndims * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, H5_ITER_ERROR, "can't allocate chunk offset array")
+        udata->nalloc = new_alloc;
+    } /* end if */
+
+    /* Record the chunk */
+    ent              = &udata->ent[udata->nused];
+    ent->addr        = chunk_rec->chunk_addr;
+    ent->nbytes      = chunk_rec->nbytes;
+    ent->filter_mask = chunk_rec->filter_mask;
+    ent->scaled_idx  = udata->nused;
+    H5MM_memcpy(&udata->scaled[udata->nused * udata->ndims], chunk_rec->scaled,
+                udata->ndims * sizeof(hsize_t));
+    udata->nused++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_iter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter_cmp
+ *
+ * Purpose:     Compares the file addresses of two chunks, for sorting the
+ *              chunks visited by H5D__chunk_iter().
+ *
+ * Return:      -1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_iter_ent_t *ent1 = (const H5D_chunk_iter_ent_t *)_ent1;
+    const H5D_chunk_iter_ent_t *ent2 = (const H5D_chunk_iter_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->addr, ent2->addr))
+} /* H5D__chunk_iter_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter
+ *
+ * Purpose:     Calls OP for each allocated chunk of the dataset, in
+ *              increasing file address order.  The chunk index is walked
+ *              once, recording every chunk, and the records are then
+ *              sorted, so the whole chunk map is built in one pass.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_iter(const H5D_t *dset, H5D_chunk_iter_op_t op, void *op_data)
+{
+    const H5O_layout_t *layout = NULL;            /* Dataset layout */
+    const H5D_rdcc_t *  rdcc   = NULL;            /* Raw data chunk cache */
+    H5D_rdcc_ent_t *    ent;                      /* Cache entry index */
+    H5D_chk_idx_info_t  idx_info;                 /* Chunked index info */
+    H5D_chunk_iter_ud_t udata;                    /* User data for callback */
+    hsize_t             offset[H5O_LAYOUT_NDIMS]; /* Logical offset of a chunk */
+    size_t              u;                        /* Local index variable */
+    unsigned            ii;                       /* Dimension index */
+    herr_t              ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset);
+    HDassert(dset->shared);
+    HDassert(op);
+
+    /* Get dataset layout and raw data chunk cache */
+    layout = &(dset->shared->layout);
+    rdcc   = &(dset->shared->cache.chunk);
+    HDassert(layout);
+    HDassert(rdcc);
+    HDassert(H5D_CHUNKED == layout->type);
+
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.ndims = dset->shared->ndims;
+
+    /* Search for cached chunks that haven't been written out */
+    for (ent = rdcc->head; ent; ent = ent->next)
+        /* Flush the chunk out to disk, to make certain the size is correct later */
+        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* If the dataset is not written, there are no chunks to visit */
+    if (H5F_addr_defined(idx_info.storage->idx_addr)) {
+        /* Record all the allocated chunks */
+        if ((layout->storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_iter_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index")
+
+        /* Visit them in file address order */
+        if (udata.nused > 1)
+            HDqsort(udata.ent, udata.nused, sizeof(H5D_chunk_iter_ent_t), H5D__chunk_iter_cmp);
+
+        for (u = 0; u < udata.nused; u++) {
+            const hsize_t *scaled = &udata.scaled[udata.ent[u].scaled_idx * udata.ndims];
+            int            op_ret; /* Return value from the operator */
+
+            for (ii = 0; ii < udata.ndims; ii++)
+                offset[ii] = scaled[ii] * layout->u.chunk.dim[ii];
+
+            if ((op_ret = (*op)(offset, udata.ent[u].filter_mask, udata.ent[u].addr,
+                                (hsize_t)udata.ent[u].nbytes, op_data)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CALLBACK, FAIL, "chunk iteration callback failed")
+            if (op_ret > 0)
+                break;
+        } /* end for */
+    }     /* end if */
+
+done:
+    H5MM_xfree(udata.ent);
+    H5MM_xfree(udata.scaled);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_iter() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch
+ *
+ * Purpose:     Loads the chunks of a chunked dataset that hold elements
+ *              selected in FILE_SPACE into the dataset's chunk cache,
+ *              so that a later read of the selection finds them there.
+ *
+ *              Chunks that are already cached or aren't in the file are
+ *              skipped.  The others are read in file address order, no
+ *              more of them than fit in the cache, and filtered chunks
+ *              are decoded on the filter threads when the pipeline can
+ *              be run concurrently.  Nothing is loaded when the chunks
+ *              are too large for the cache.
+ *
+ *              This runs to completion before H5Dprefetch() returns;
+ *              see there for why it isn't done in the background.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_prefetch(const H5D_t *dset, const H5S_t *file_space)
+{
+    const H5O_layout_chunk_t *layout = &(dset->shared->layout.u.chunk); /* Chunk layout */
+    H5D_rdcc_t *              rdcc   = &(dset->shared->cache.chunk);    /* Chunk cache */
+    unsigned                  ndims  = dset->shared->ndims;             /* Rank of the dataset */
+    H5D_chunk_prefetch_ent_t *ents   = NULL;                            /* Chunks to load */
+    size_t                    nents  = 0;                               /* Number of chunks to load */
+    size_t                    nalloc = 0;                  /* Number of chunk entries allocated */
+    size_t                    chunk_size;                  /* Size of a chunk in the cache */
+    size_t                    nbytes = 0;                  /* Bytes of the chunks to load */
+    H5D_io_info_t             io_info;                     /* I/O info for locking the chunks */
+    H5D_storage_t             store;                       /* Chunk storage info */
+    hsize_t                   sel_start[H5S_MAX_RANK];     /* Start of the selection's bounding box */
+    hsize_t                   sel_end[H5S_MAX_RANK];       /* End of the selection's bounding box */
+    hsize_t                   scaled[H5O_LAYOUT_NDIMS];    /* Scaled coordinates of the current chunk */
+    hsize_t                   start[H5O_LAYOUT_NDIMS];     /* First element of the current chunk */
+    hsize_t                   end[H5O_LAYOUT_NDIMS];       /* Last element of the current chunk */
+    hbool_t                   cache_full = FALSE;          /* Whether the cache can't take more chunks */
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    unsigned                  nthreads   = 0;              /* Number of filter threads */
+    htri_t                    concurrent = FALSE;          /* Whether to decode chunks on filter threads */
+#endif                                                     /* H5D_CHUNK_CONCURRENT_FILTERS */
+    size_t                    u, v, w;                     /* Local index variables */
+    unsigned                  d;                           /* Dimension after the current one */
+    herr_t                    ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(file_space);
+
+    /* Check the selection against the dataset's extent */
+    if (H5S_GET_EXTENT_NDIMS(file_space) != (int)ndims)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace rank doesn't match dataset's rank")
+    if (0 == H5S_GET_SELECT_NPOINTS(file_space))
+        HGOTO_DONE(SUCCEED)
+    if (H5S_SELECT_BOUNDS(file_space, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+    for (u = 0; u < ndims; u++)
+        if (sel_end[u] >= dset->shared->curr_dims[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "selection isn't within the dataset's extent")
+
+    /* Nothing can be loaded when chunks don't fit in the cache */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, layout->size, uint32_t);
+    if ((!rdcc->open_cache && 0 == rdcc->nslots) || chunk_size > rdcc->nbytes_max)
+        HGOTO_DONE(SUCCEED)
+
+    /* Find the selected chunks that are in the file but not in the cache,
+     * visiting the chunks in the selection's bounding box
+     */
+    for (u = 0; u < ndims; u++) {
+        scaled[u] = sel_start[u] / layout->dim[u];
+        start[u]  = scaled[u] * layout->dim[u];
+        end[u]    = (start[u] + layout->dim[u]) - 1;
+    } /* end for */
+    scaled[ndims] = start[ndims] = end[ndims] = 0;
+    while (!cache_full) {
+        htri_t intersect; /* Whether the chunk holds selected elements */
+
+        if ((intersect = H5S_SELECT_INTERSECT_BLOCK(file_space, start, end)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL, "can't intersect chunk with selection")
+        if (intersect) {
+            H5D_chunk_ud_t udata; /* Chunk index info */
+
+            if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+            if (H5F_addr_defined(udata.chunk_block.offset) && UINT_MAX == udata.idx_hint) {
+                if (nbytes + chunk_size > rdcc->nbytes_max)
+                    cache_full = TRUE;
+                else {
+                    if (nents == nalloc) {
+                        H5D_chunk_prefetch_ent_t *x; /* Reallocated entries */
+                        size_t                    n = MAX(2 * nalloc, 64);
+
+                        if (NULL == (x = (H5D_chunk_prefetch_ent_t *)H5MM_realloc(
+                                         ents, n * sizeof(H5D_chunk_prefetch_ent_t))))
+                            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk list")
+                        ents   = x;
+                        nalloc = n;
+                    } /* end if */
+                    H5MM_memcpy(ents[nents].scaled, scaled, sizeof(scaled));
+                    ents[nents].udata = udata;
+                    nents++;
+                    nbytes += chunk_size;
+                } /* end else */
+            }     /* end if */
+        }         /* end if */
+
+        /* Move to the next chunk in the bounding box */
+        for (d = ndims; d > 0; d--) {
+            if (end[d - 1] < sel_end[d - 1]) {
+                scaled[d - 1]++;
+                start[d - 1] += layout->dim[d - 1];
+                end[d - 1] += layout->dim[d - 1];
+                break;
+            } /* end if */
+            scaled[d - 1] = sel_start[d - 1] / layout->dim[d - 1];
+            start[d - 1]  = scaled[d - 1] * layout->dim[d - 1];
+            end[d - 1]    = (start[d - 1] + layout->dim[d - 1]) - 1;
+        } /* end for */
+        if (0 == d)
+            break;
+    } /* end while */
+
+    if (0 == nents)
+        HGOTO_DONE(SUCCEED)
+
+    /* Put the chunks in file address order */
+    HDqsort(ents, nents, sizeof(H5D_chunk_prefetch_ent_t), H5D__chunk_prefetch_cmp);
+
+    H5D_BUILD_IO_INFO_RD(&io_info, dset, &store, NULL);
+
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    /* Check if several filtered chunks can be decoded at once */
+    if (nents > 1 && (concurrent = H5D__chunk_filter_concurrent(dset, &nthreads)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered concurrently")
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+
+    for (u = 0; u < nents; u = v) {
+        v = nents;
+
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+        /* Read and decode the next batch of chunks on the filter threads */
+        if (concurrent) {
+            H5D_chunk_filter_pool_t pool;     /* Batch of jobs */
+            size_t                  max_jobs = (size_t)nthreads * H5D_CHUNK_FILTER_JOBS_PER_THREAD;
+
+            v = MIN(nents, u + max_jobs);
+            if (H5D__chunk_decode_init(dset, &pool, max_jobs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start batch of chunks to decode")
+            for (w = u; w < v; w++)
+                if (!((layout->flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+                      H5D__chunk_is_partial_edge_chunk(ndims, layout->dim, ents[w].scaled,
+                                                       dset->shared->curr_dims)))
+                    if (H5D__chunk_decode_add(dset, &pool, ents[w].scaled, &ents[w].udata) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunk")
+            if (H5D__chunk_decode_run(dset, &pool, nthreads) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to decode raw data chunks")
+        } /* end if */
+#endif    /* H5D_CHUNK_CONCURRENT_FILTERS */
+
+        /* Bring the chunks into the cache */
+        for (w = u; w < v; w++) {
+            void *chunk; /* The cached chunk */
+
+            store.chunk.scaled          = ents[w].scaled;
+            ents[w].udata.common.scaled = ents[w].scaled;
+            if (NULL == (chunk = H5D__chunk_lock(&io_info, &ents[w].udata, FALSE, FALSE)))
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+            if (H5D__chunk_unlock(&io_info, &ents[w].udata, FALSE, chunk, (uint32_t)0) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+        } /* end for */
+    }     /* end for */
+
+done:
+#ifdef H5D_CHUNK_CONCURRENT_FILTERS
+    /* Release any decoded chunks that weren't used */
+    if (concurrent > 0)
+        H5D__chunk_free_decoded(rdcc);
+#endif /* H5D_CHUNK_CONCURRENT_FILTERS */
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch_cmp
+ *
+ * Purpose:     Compares two chunks loaded by H5D__chunk_prefetch() by
+ *              file address, for HDqsort().
+ *
+ * Return:      <0, 0 or >0 as the first chunk comes before, at or after
+ *              the second one
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_prefetch_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_prefetch_ent_t *ent1 = (const H5D_chunk_prefetch_ent_t *)_ent1;
+    const H5D_chunk_prefetch_ent_t *ent2 = (const H5D_chunk_prefetch_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->udata.chunk_block.offset, ent2->udata.chunk_block.offset))
+} /* end H5D__chunk_prefetch_cmp() */
@@ -49,6 +49,12 @@
 /* Local Macros */
 /****************/
 
+/* Adaptive sizing of the sieve buffer */
+#define H5D_SIEVE_ADAPT_WINDOW    64 /* Number of sieve buffer accesses between adaptations */
+#define H5D_SIEVE_ADAPT_POOR_HITS 2  /* Average accesses per fill below which the sieve buffer adapts */
+#define H5D_SIEVE_ADAPT_MIN_HITS  4  /* Number of accesses a sieve buffer fill should serve */
+#define H5D_SIEVE_ADAPT_MAX_GROW  16 /* Largest multiple of the nominal size the sieve buffer grows to */
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -83,6 +89,13 @@ typedef struct H5D_contig_writevv_ud_t {
     const unsigned char *wbuf;      /* Pointer to buffer to write */
 } H5D_contig_writevv_ud_t;
 
+/* Callback info for building the I/O vector of a vector readvv/writevv operation */
+typedef struct H5D_contig_vector_ud_t {
+    haddr_t         dset_addr; /* Address of dataset */
+    unsigned char * buf;       /* Pointer to memory buffer */
+    H5D_io_batch_t *batch;     /* I/O vector being built */
+} H5D_contig_vector_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -96,6 +109,11 @@ static herr_t  H5D__contig_io_init(const H5D_io_info_t *io_info, const H5D_type_
 static ssize_t H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *dset_curr_seq,
                                   size_t dset_len_arr[], hsize_t dset_offset_arr[], size_t mem_max_nseq,
                                   size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_offset_arr[]);
+static hbool_t H5D__contig_use_vector_io(const H5D_io_info_t *io_info);
+static ssize_t H5D__contig_vector_io(const H5D_io_info_t *io_info, size_t dset_max_nseq,
+                                     size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_offset_arr[],
+                                     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[],
+                                     hsize_t mem_offset_arr[]);
 static ssize_t H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *dset_curr_seq,
                                    size_t dset_len_arr[], hsize_t dset_offset_arr[], size_t mem_max_nseq,
                                    size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_offset_arr[]);
@@ -103,6 +121,8 @@ static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static void   H5D__contig_sieve_stride(H5D_rdcdc_t *dset_contig, size_t nseq, const hsize_t off_arr[]);
+static herr_t H5D__contig_sieve_adapt(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, hsize_t dset_size);
 
 /*********************/
 /* Package Variables */
@@ -409,6 +429,7 @@ H5D__contig_construct(H5F_t *f, H5D_t *dset)
         dset->shared->cache.contig.sieve_buf_size = tmp_size;
     else
         dset->shared->cache.contig.sieve_buf_size = tmp_sieve_buf_size;
+    dset->shared->cache.contig.sieve_buf_nominal = dset->shared->cache.contig.sieve_buf_size;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -480,6 +501,7 @@ H5D__contig_init(H5F_t H5_ATTR_UNUSED *f, const H5D_t *dset, hid_t H5_ATTR_UNUSE
         dset->shared->cache.contig.sieve_buf_size = tmp_size;
     else
         dset->shared->cache.contig.sieve_buf_size = tmp_sieve_buf_size;
+    dset->shared->cache.contig.sieve_buf_nominal = dset->shared->cache.contig.sieve_buf_size;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -536,6 +558,72 @@ H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
     FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
 } /* end H5D__contig_is_data_cached() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_sieve_stats
+ *
+ * Purpose:     Retrieves the hit, miss and bypass counts of the sieve
+ *              buffer of DSET, since it was opened or the counts were
+ *              last reset, and the sieve buffer's current size (0 while
+ *              it's bypassed).  Any of the pointers may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_sieve_stats(const H5D_t *dset, unsigned *hits, unsigned *misses, unsigned *bypasses,
+                        size_t *buf_size)
+{
+    const H5D_rdcdc_t *dset_contig = &(dset->shared->cache.contig); /* Cached contiguous info */
+    herr_t             ret_value   = SUCCEED;                       /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+
+    if (H5D_CONTIGUOUS != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "not a contiguous dataset")
+
+    if (hits)
+        *hits = dset_contig->stats.nhits;
+    if (misses)
+        *misses = dset_contig->stats.nmisses;
+    if (bypasses)
+        *bypasses = dset_contig->stats.nbypasses;
+    if (buf_size)
+        *buf_size = dset_contig->sieve_bypass ? 0 : dset_contig->sieve_buf_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_sieve_reset_stats
+ *
+ * Purpose:     Resets the statistics of the sieve buffer of DSET.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_sieve_reset_stats(H5D_t *dset)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+
+    if (H5D_CONTIGUOUS != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "not a contiguous dataset")
+
+    HDmemset(&dset->shared->cache.contig.stats, 0, sizeof(dset->shared->cache.contig.stats));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_reset_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_io_init
  *
@@ -668,6 +756,129 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_stride
+ *
+ * Purpose:	Records the average distance between the starts of the
+ *              sequences of a readvv/writevv operation, for adapting the
+ *              size of the sieve buffer.  If the sieve buffer is being
+ *              bypassed and the accesses are now close enough together
+ *              for it to pay off again, it's used again at its nominal
+ *              size.
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__contig_sieve_stride(H5D_rdcdc_t *dset_contig, size_t nseq, const hsize_t off_arr[])
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(dset_contig);
+
+    /* A single sequence says nothing about the stride */
+    if (nseq > 1) {
+        if (off_arr[nseq - 1] > off_arr[0])
+            dset_contig->sieve_stride = (off_arr[nseq - 1] - off_arr[0]) / (nseq - 1);
+        else
+            dset_contig->sieve_stride = 0;
+
+        if (dset_contig->sieve_bypass && dset_contig->sieve_stride > 0 &&
+            dset_contig->sieve_stride * H5D_SIEVE_ADAPT_MIN_HITS <= dset_contig->sieve_buf_nominal) {
+            dset_contig->sieve_bypass   = FALSE;
+            dset_contig->sieve_buf_size = dset_contig->sieve_buf_nominal;
+            dset_contig->sieve_naccess  = 0;
+            dset_contig->sieve_nfills   = 0;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_sieve_stride() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_adapt
+ *
+ * Purpose:	Adapts the size of the sieve buffer to the accesses made
+ *              through it since the last adaptation.
+ *
+ *              When the fills of the buffer served fewer than
+ *              H5D_SIEVE_ADAPT_POOR_HITS accesses on average, the buffer
+ *              is grown to hold H5D_SIEVE_ADAPT_MIN_HITS strides of the
+ *              accesses, up to H5D_SIEVE_ADAPT_MAX_GROW times its nominal
+ *              size.  When that isn't enough, or the accesses have no
+ *              regular stride, the buffer is bypassed and the accesses go
+ *              directly to the file.  A grown buffer that serves its
+ *              accesses well is shrunk back when the stride no longer
+ *              needs it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_adapt(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, hsize_t dset_size)
+{
+    size_t  new_size  = dset_contig->sieve_buf_size; /* New size of the sieve buffer */
+    hbool_t bypass    = FALSE;                       /* Whether to bypass the sieve buffer */
+    hsize_t want_size = 0;                           /* Size to serve enough accesses per fill */
+    herr_t  ret_value = SUCCEED;                     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dset_contig);
+
+    /* Compute the size that serves enough accesses of the current stride per fill, if it's allowed */
+    if (dset_contig->sieve_stride > 0 &&
+        dset_contig->sieve_stride <= ((hsize_t)dset_contig->sieve_buf_nominal * H5D_SIEVE_ADAPT_MAX_GROW) /
+                                         H5D_SIEVE_ADAPT_MIN_HITS)
+        want_size = MIN(dset_contig->sieve_stride * H5D_SIEVE_ADAPT_MIN_HITS, dset_size);
+
+    /* Check if the fills are serving too few accesses */
+    if (dset_contig->sieve_nfills * H5D_SIEVE_ADAPT_POOR_HITS > dset_contig->sieve_naccess) {
+        if (want_size > dset_contig->sieve_buf_size)
+            new_size = (size_t)want_size;
+        else
+            bypass = TRUE;
+    } /* end if */
+    /* Check if a grown buffer is larger than needed */
+    else if (dset_contig->sieve_buf_size > dset_contig->sieve_buf_nominal) {
+        if (want_size < dset_contig->sieve_buf_nominal)
+            want_size = dset_contig->sieve_buf_nominal;
+        if (want_size < dset_contig->sieve_buf_size)
+            new_size = (size_t)want_size;
+    } /* end if */
+
+    /* Start a new window of accesses */
+    dset_contig->sieve_naccess = 0;
+    dset_contig->sieve_nfills  = 0;
+
+    /* Drop the current buffer, if it's being resized or bypassed */
+    if (bypass || new_size != dset_contig->sieve_buf_size) {
+        if (dset_contig->sieve_buf) {
+            /* Flush the sieve buffer, if it's dirty */
+            if (dset_contig->sieve_dirty) {
+                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
+                                           dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+                dset_contig->sieve_dirty = FALSE;
+            } /* end if */
+
+            dset_contig->sieve_buf  = (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset_contig->sieve_buf);
+            dset_contig->sieve_loc  = HADDR_UNDEF;
+            dset_contig->sieve_size = 0;
+        } /* end if */
+
+        dset_contig->sieve_buf_size = new_size;
+        dset_contig->sieve_bypass   = bypass;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_adapt() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -714,12 +925,21 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     /* Compute offset in memory */
     buf = udata->rbuf + src_off;
 
+    /* Read directly from the file while the sieve buffer is bypassed */
+    if (dset_contig->sieve_bypass) {
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+        dset_contig->stats.nbypasses++;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Check if the sieve buffer is allocated yet */
     if (NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
             if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+            dset_contig->stats.nbypasses++;
         } /* end if */
         else {
             /* Allocate room for the data sieve buffer */
@@ -750,6 +970,10 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
 
             /* Reset sieve buffer dirty flag */
             dset_contig->sieve_dirty = FALSE;
+
+            dset_contig->stats.nmisses++;
+            dset_contig->sieve_nfills++;
+            dset_contig->sieve_naccess++;
         } /* end else */
     }     /* end if */
     else {
@@ -762,6 +986,9 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
 
             /* Grab the data out of the buffer */
             H5MM_memcpy(buf, base_sieve_buf, len);
+
+            dset_contig->stats.nhits++;
+            dset_contig->sieve_naccess++;
         } /* end if */
         /* Entire request is not within this data sieve buffer */
         else {
@@ -785,6 +1012,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
                 /* Read directly into the user's buffer */
                 if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+                dset_contig->stats.nbypasses++;
             } /* end if */
             /* Element size fits within the buffer size */
             else {
@@ -827,10 +1055,19 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
 
                 /* Reset sieve buffer dirty flag */
                 dset_contig->sieve_dirty = FALSE;
+
+                dset_contig->stats.nmisses++;
+                dset_contig->sieve_nfills++;
+                dset_contig->sieve_naccess++;
             } /* end else */
         }     /* end else */
     }         /* end else */
 
+    /* Adapt the sieve buffer to the access pattern seen since the last adaptation */
+    if (dset_contig->sieve_naccess >= H5D_SIEVE_ADAPT_WINDOW)
+        if (H5D__contig_sieve_adapt(f_sh, dset_contig, store_contig->dset_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't adapt sieve buffer")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_readvv_sieve_cb() */
@@ -864,6 +1101,183 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_readvv_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_use_vector_io
+ *
+ * Purpose:	Determines whether the sequences of a readvv/writevv
+ *              operation should be gathered into one vector and passed to
+ *              the file driver in a single call.  This is done whenever
+ *              each sequence would otherwise become its own block I/O
+ *              call: when data sieving isn't available, when there's
+ *              no sieve buffer (as for the chunks of a chunked dataset),
+ *              or when the sieve buffer is being bypassed.
+ *
+ *              It's also always done for the pieces of a multi-dataset
+ *              operation, which are gathered across all of its datasets.
+ *
+ *              MPI drivers keep their existing per-sequence path, since
+ *              their I/O may need to be matched across processes.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__contig_use_vector_io(const H5D_io_info_t *io_info)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (!H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_HAS_MPI))
+        ret_value = io_info->batch || !H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE) ||
+                    0 == io_info->dset->shared->cache.contig.sieve_buf_size ||
+                    io_info->dset->shared->cache.contig.sieve_bypass;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_use_vector_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_vector_io(), which adds
+ *              one piece of the I/O operation to the I/O vector.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_vector_ud_t *udata = (H5D_contig_vector_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+    H5D_io_batch_t *        batch     = udata->batch;                 /* I/O vector being built */
+    herr_t                  ret_value = SUCCEED;                      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Grow the vector, if necessary */
+    if (batch->nused == batch->nalloc) {
+        uint32_t new_alloc = MAX(2 * batch->nalloc, 64);
+
+        if (NULL ==
+            (batch->types = (H5FD_mem_t *)H5MM_realloc(batch->types, new_alloc * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        if (NULL == (batch->addrs = (haddr_t *)H5MM_realloc(batch->addrs, new_alloc * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        if (NULL == (batch->sizes = (size_t *)H5MM_realloc(batch->sizes, new_alloc * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        if (NULL == (batch->bufs = (void **)H5MM_realloc(batch->bufs, new_alloc * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+        batch->nalloc = new_alloc;
+    } /* end if */
+
+    /* Append this piece */
+    batch->types[batch->nused] = H5FD_MEM_DRAW;
+    batch->addrs[batch->nused] = udata->dset_addr + dst_off;
+    batch->sizes[batch->nused] = len;
+    batch->bufs[batch->nused]  = udata->buf + src_off;
+    batch->nused++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_io
+ *
+ * Purpose:	Reads or writes some data vectors between a dataset and a
+ *              buffer, passing all of them to the file layer as a single
+ *              vector I/O request.  Drivers with vector I/O support can
+ *              then coalesce the pieces into far fewer system calls.
+ *
+ *              When the operation is part of a multi-dataset operation,
+ *              the pieces are only added to its batch, which is issued
+ *              once all the datasets have been processed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5D__contig_vector_io(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *dset_curr_seq,
+                      size_t dset_len_arr[], hsize_t dset_off_arr[], size_t mem_max_nseq,
+                      size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
+{
+    H5D_contig_vector_ud_t udata;          /* User data for H5VM_opvv() operator */
+    H5D_io_batch_t         local_batch;    /* I/O vector, when not part of a multi-dataset operation */
+    ssize_t                ret_value = -1; /* Return value (Size of sequence in bytes) */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up user data for H5VM_opvv() */
+    HDmemset(&local_batch, 0, sizeof(local_batch));
+    udata.dset_addr = io_info->store->contig.dset_addr;
+    if (io_info->batch) {
+        H5D_rdcdc_t *dset_contig = &(io_info->dset->shared->cache.contig); /* Cached contiguous info */
+
+        udata.batch = io_info->batch;
+
+        /* The batch only holds pieces of a single file */
+        if (udata.batch->nused > 0 && udata.batch->f_sh != io_info->f_sh)
+            if (H5D__io_batch_flush(udata.batch) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't issue batched I/O")
+        udata.batch->f_sh = io_info->f_sh;
+
+        /* The deferred I/O bypasses the dataset's sieve buffer, so make
+         * certain the file is current and, for writes, drop the sieve
+         * buffer's now possibly stale contents.
+         */
+        if (dset_contig->sieve_buf) {
+            if (dset_contig->sieve_dirty) {
+                if (H5F_shared_block_write(io_info->f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
+                                           dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+                dset_contig->sieve_dirty = FALSE;
+            } /* end if */
+            if (H5D_IO_OP_WRITE == io_info->op_type) {
+                dset_contig->sieve_loc  = HADDR_UNDEF;
+                dset_contig->sieve_size = 0;
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+    else {
+        local_batch.f_sh    = io_info->f_sh;
+        local_batch.op_type = io_info->op_type;
+        udata.batch         = &local_batch;
+    } /* end else */
+    if (H5D_IO_OP_READ == io_info->op_type)
+        udata.buf = (unsigned char *)io_info->u.rbuf;
+    else {
+        H5_GCC_DIAG_OFF("cast-qual")
+        udata.buf = (unsigned char *)io_info->u.wbuf;
+        H5_GCC_DIAG_ON("cast-qual")
+    } /* end else */
+
+    /* Gather the pieces of the I/O operation */
+    if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
+                               mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_vector_cb, &udata)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build I/O vector")
+
+    /* Perform the I/O, unless it's being deferred */
+    if (!io_info->batch) {
+        if (H5D__io_batch_flush(&local_batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector I/O")
+
+        /* Account for the accesses that bypassed the sieve buffer */
+        if (io_info->dset->shared->cache.contig.sieve_bypass)
+            io_info->dset->shared->cache.contig.stats.nbypasses += local_batch.nused;
+    } /* end if */
+
+done:
+    H5MM_xfree(local_batch.types);
+    H5MM_xfree(local_batch.addrs);
+    H5MM_xfree(local_batch.sizes);
+    H5MM_xfree(local_batch.bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_io() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv
  *
@@ -900,8 +1314,20 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Track the stride of the accesses, for adapting the sieve buffer */
+    if (io_info->dset->shared->cache.contig.sieve_buf_nominal > 0)
+        H5D__contig_sieve_stride(&(io_info->dset->shared->cache.contig), dset_max_nseq - *dset_curr_seq,
+                                 dset_off_arr + *dset_curr_seq);
+
+    /* Check if the sequences can be passed to the file driver as one vector */
+    if (H5D__contig_use_vector_io(io_info)) {
+        if ((ret_value = H5D__contig_vector_io(io_info, dset_max_nseq, dset_curr_seq, dset_len_arr,
+                                               dset_off_arr, mem_max_nseq, mem_curr_seq, mem_len_arr,
+                                               mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector read")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -981,12 +1407,21 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     /* Compute offset in memory */
     buf = udata->wbuf + src_off;
 
+    /* Write directly to the file while the sieve buffer is bypassed */
+    if (dset_contig->sieve_bypass) {
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+        dset_contig->stats.nbypasses++;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* No data sieve buffer yet, go allocate one */
     if (NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
             if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+            dset_contig->stats.nbypasses++;
         } /* end if */
         else {
             /* Allocate room for the data sieve buffer */
@@ -1029,6 +1464,10 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
             sieve_start = dset_contig->sieve_loc;
             sieve_size  = dset_contig->sieve_size;
             sieve_end   = sieve_start + sieve_size;
+
+            dset_contig->stats.nmisses++;
+            dset_contig->sieve_nfills++;
+            dset_contig->sieve_naccess++;
         } /* end else */
     }     /* end if */
     else {
@@ -1044,6 +1483,9 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
 
             /* Set sieve buffer dirty flag */
             dset_contig->sieve_dirty = TRUE;
+
+            dset_contig->stats.nhits++;
+            dset_contig->sieve_naccess++;
         } /* end if */
         /* Entire request is not within this data sieve buffer */
         else {
@@ -1071,6 +1513,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
                 /* Write directly from the user's buffer */
                 if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+                dset_contig->stats.nbypasses++;
             } /* end if */
             /* Element size fits within the buffer size */
             else {
@@ -1098,6 +1541,9 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
 
                     /* Adjust sieve size */
                     dset_contig->sieve_size += len;
+
+                    dset_contig->stats.nhits++;
+                    dset_contig->sieve_naccess++;
                 } /* end if */
                 /* Can't add the new data onto the existing sieve buffer */
                 else {
@@ -1143,11 +1589,20 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
 
                     /* Set sieve buffer dirty flag */
                     dset_contig->sieve_dirty = TRUE;
+
+                    dset_contig->stats.nmisses++;
+                    dset_contig->sieve_nfills++;
+                    dset_contig->sieve_naccess++;
                 } /* end else */
             }     /* end else */
         }         /* end else */
     }             /* end else */
 
+    /* Adapt the sieve buffer to the access pattern seen since the last adaptation */
+    if (dset_contig->sieve_naccess >= H5D_SIEVE_ADAPT_WINDOW)
+        if (H5D__contig_sieve_adapt(f_sh, dset_contig, store_contig->dset_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't adapt sieve buffer")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_writevv_sieve_cb() */
@@ -1218,8 +1673,20 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Track the stride of the accesses, for adapting the sieve buffer */
+    if (io_info->dset->shared->cache.contig.sieve_buf_nominal > 0)
+        H5D__contig_sieve_stride(&(io_info->dset->shared->cache.contig), dset_max_nseq - *dset_curr_seq,
+                                 dset_off_arr + *dset_curr_seq);
+
+    /* Check if the sequences can be passed to the file driver as one vector */
+    if (H5D__contig_use_vector_io(io_info)) {
+        if ((ret_value = H5D__contig_vector_io(io_info, dset_max_nseq, dset_curr_seq, dset_len_arr,
+                                               dset_off_arr, mem_max_nseq, mem_curr_seq, mem_len_arr,
+                                               mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector write")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_writevv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
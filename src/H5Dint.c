@@ -2606,6 +2606,89 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__get_offset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__get_mapped_ptr
+ *
+ * Purpose:     Private function for H5Dget_mapped_ptr().  Returns a pointer
+ *              to the raw data of a contiguous dataset, or of the chunk of
+ *              a chunked dataset at logical OFFSET, in a file mapped into
+ *              memory, along with its size in bytes.
+ *
+ *              The data must be readable with MEM_TYPE_ID without any
+ *              datatype conversion.  When the data isn't available in
+ *              memory (the file driver doesn't map the file, the storage
+ *              isn't allocated, the chunk is filtered, etc.) *PTR is set
+ *              to NULL and *SIZE to zero.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__get_mapped_ptr(const H5D_t *dset, hid_t mem_type_id, const hsize_t *offset, const void **ptr /*out*/,
+                    size_t *size /*out*/)
+{
+    const H5T_t *mem_type;            /* Memory datatype */
+    H5T_path_t * tpath;               /* Datatype conversion path */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(ptr);
+    HDassert(size);
+
+    *ptr  = NULL;
+    *size = 0;
+
+    /* The application sees the data exactly as it is stored, so no
+     * conversion may be needed.
+     */
+    if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+    if (NULL == (tpath = H5T_path_find(dset->shared->type, mem_type)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype")
+    if (!H5T_path_noop(tpath))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "datatype conversion needed to access data")
+
+    switch (dset->shared->layout.type) {
+        case H5D_VIRTUAL:
+        case H5D_COMPACT:
+            break;
+
+        case H5D_CHUNKED:
+            if (NULL == offset)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk offset must be supplied")
+            if (H5D__chunk_get_mapped_ptr(dset, offset, ptr, size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get pointer to chunk")
+            break;
+
+        case H5D_CONTIGUOUS:
+            /* Data stored in external files isn't in the mapping */
+            if (dset->shared->dcpl_cache.efl.nused == 0 &&
+                H5F_addr_defined(dset->shared->layout.storage.u.contig.addr) &&
+                dset->shared->layout.storage.u.contig.size > 0) {
+                size_t data_size;
+
+                H5_CHECKED_ASSIGN(data_size, size_t, dset->shared->layout.storage.u.contig.size, hsize_t);
+                if (H5F_shared_get_mapped_ptr(H5F_SHARED(dset->oloc.file),
+                                              dset->shared->layout.storage.u.contig.addr, data_size, ptr) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get pointer to raw data")
+                if (*ptr)
+                    *size = data_size;
+            } /* end if */
+            break;
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "unknown dataset layout type")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__get_mapped_ptr() */
+
 /*-------------------------------------------------------------------------
  * Function: H5D__vlen_get_buf_size_alloc
  *
@@ -2673,7 +2756,7 @@ H5D__vlen_get_buf_size_cb(void H5_ATTR_UNUSED *elem, hid_t type_id, unsigned H5_
 
     /* Read in the point (with the custom VL memory allocator) */
     if (H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace,
-                  vlen_bufsize->common.fl_tbuf) < 0)
+                  vlen_bufsize->common.fl_tbuf, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, H5_ITER_ERROR, "can't read point")
 
 done:
@@ -123,6 +123,10 @@ done:
  * Purpose:	Reads (part of) a DATASET into application memory BUF. See
  *		H5Dread() for complete details.
  *
+ *              When BATCH is non-NULL, raw data that's read straight into
+ *              BUF may be deferred into it, to be read once the caller
+ *              flushes the batch.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -132,7 +136,7 @@ done:
  */
 herr_t
 H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-          void *buf /*out*/)
+          void *buf /*out*/, H5D_io_batch_t *batch)
 {
     H5D_chunk_map_t *fm = NULL;                   /* Chunk file<->memory mapping */
     H5D_io_info_t    io_info;                     /* Dataset I/O info     */
@@ -287,6 +291,10 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     if (H5D__ioinfo_init(dataset, &type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to set up I/O operation")
 
+    /* Only I/O directly into the application's buffer can be deferred */
+    if (type_info.is_xform_noop && type_info.is_conv_noop)
+        io_info.batch = batch;
+
     /* Sanity check that space is allocated, if there are elements */
     if (nelmts > 0)
         HDassert((*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage) ||
@@ -339,6 +347,10 @@ done:
  * Purpose:	Writes (part of) a DATASET to a file from application memory
  *		BUF. See H5Dwrite() for complete details.
  *
+ *              When BATCH is non-NULL, raw data that's written straight
+ *              from BUF may be deferred into it, to be written once the
+ *              caller flushes the batch.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -348,7 +360,7 @@ done:
  */
 herr_t
 H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-           const void *buf)
+           const void *buf, H5D_io_batch_t *batch)
 {
     H5D_chunk_map_t *fm = NULL;                   /* Chunk file<->memory mapping */
     H5D_io_info_t    io_info;                     /* Dataset I/O info     */
@@ -511,6 +523,10 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
     } /* end if */
 
+    /* Only I/O directly from the application's buffer can be deferred */
+    if (type_info.is_xform_noop && type_info.is_conv_noop)
+        io_info.batch = batch;
+
     /* Allocate the chunk map */
     if (NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
@@ -568,6 +584,170 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) COUNT datasets into application memory. See
+ *		H5Dread_multi() for complete details.
+ *
+ *              The raw data pieces that need no type conversion are
+ *              gathered across all the datasets and read with a single
+ *              vector request per file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_multi(size_t count, H5D_t *dset[], const hid_t mem_type_id[], const H5S_t *mem_space[],
+                const H5S_t *file_space[], void *buf[] /*out*/)
+{
+    H5D_io_batch_t batch;               /* Raw data reads gathered across the datasets */
+    size_t         first = 0;           /* First dataset with reads in the batch */
+    size_t         u, v;                /* Local index variables */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(count > 0);
+    HDassert(dset && mem_type_id && mem_space && file_space && buf);
+
+    HDmemset(&batch, 0, sizeof(batch));
+    batch.op_type = H5D_IO_OP_READ;
+
+    for (u = 0; u < count; u++) {
+        /* Issue the batch before operating on a dataset a second time, so
+         * the dataset's caches never get ahead of the file
+         */
+        for (v = first; v < u; v++)
+            if (dset[v]->shared == dset[u]->shared) {
+                if (H5D__io_batch_flush(&batch) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't issue batched reads")
+                first = u;
+                break;
+            } /* end if */
+
+        if (H5D__read(dset[u], mem_type_id[u], mem_space[u], file_space[u], buf[u], &batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end for */
+
+    /* Read everything that was gathered */
+    if (H5D__io_batch_flush(&batch) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't issue batched reads")
+
+done:
+    H5MM_xfree(batch.types);
+    H5MM_xfree(batch.addrs);
+    H5MM_xfree(batch.sizes);
+    H5MM_xfree(batch.bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) COUNT datasets from application memory. See
+ *		H5Dwrite_multi() for complete details.
+ *
+ *              The raw data pieces that need no type conversion are
+ *              gathered across all the datasets and written with a single
+ *              vector request per file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dset[], const hid_t mem_type_id[], const H5S_t *mem_space[],
+                 const H5S_t *file_space[], const void *buf[])
+{
+    H5D_io_batch_t batch;               /* Raw data writes gathered across the datasets */
+    size_t         first = 0;           /* First dataset with writes in the batch */
+    size_t         u, v;                /* Local index variables */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(count > 0);
+    HDassert(dset && mem_type_id && mem_space && file_space && buf);
+
+    HDmemset(&batch, 0, sizeof(batch));
+    batch.op_type = H5D_IO_OP_WRITE;
+
+    for (u = 0; u < count; u++) {
+        /* Issue the batch before operating on a dataset a second time, so
+         * later writes to the dataset land after the earlier ones
+         */
+        for (v = first; v < u; v++)
+            if (dset[v]->shared == dset[u]->shared) {
+                if (H5D__io_batch_flush(&batch) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't issue batched writes")
+                first = u;
+                break;
+            } /* end if */
+
+        if (H5D__write(dset[u], mem_type_id[u], mem_space[u], file_space[u], buf[u], &batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end for */
+
+    /* Write everything that was gathered */
+    if (H5D__io_batch_flush(&batch) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't issue batched writes")
+
+done:
+    H5MM_xfree(batch.types);
+    H5MM_xfree(batch.addrs);
+    H5MM_xfree(batch.sizes);
+    H5MM_xfree(batch.bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_batch_flush
+ *
+ * Purpose:	Issues the raw data I/O gathered in a batch as one vector
+ *              request to the file, then empties the batch.  The batch's
+ *              vectors are kept for reuse.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_batch_flush(H5D_io_batch_t *batch)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(batch);
+
+    if (batch->nused > 0) {
+        if (H5D_IO_OP_READ == batch->op_type) {
+            if (H5F_shared_vector_read(batch->f_sh, batch->nused, batch->types, batch->addrs, batch->sizes,
+                                       batch->bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+        } /* end if */
+        else {
+            H5_GCC_DIAG_OFF("cast-qual")
+            if (H5F_shared_vector_write(batch->f_sh, batch->nused, batch->types, batch->addrs, batch->sizes,
+                                        (const void **)batch->bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+            H5_GCC_DIAG_ON("cast-qual")
+        } /* end else */
+
+        batch->nused = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_batch_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
  *
@@ -597,6 +777,7 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
     io_info->dset  = dset;
     io_info->f_sh  = H5F_SHARED(dset->oloc.file);
     io_info->store = store;
+    io_info->batch = NULL;
 
     /* Set I/O operations to initial values */
     io_info->layout_ops = *dset->shared->layout.ops;
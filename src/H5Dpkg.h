@@ -50,13 +50,15 @@
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_WRITE;                                                                    \
-    (io_info)->u.wbuf  = buf
+    (io_info)->u.wbuf  = buf;                                                                                \
+    (io_info)->batch   = NULL
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, str, buf)                                                          \
     (io_info)->dset    = ds;                                                                                 \
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_READ;                                                                     \
-    (io_info)->u.rbuf  = buf
+    (io_info)->u.rbuf  = buf;                                                                                \
+    (io_info)->batch   = NULL
 
 /* Flags for marking aspects of a dataset dirty */
 #define H5D_MARK_SPACE  0x01
@@ -211,6 +213,20 @@ typedef enum H5D_io_op_type_t {
     H5D_IO_OP_WRITE /* Write operation */
 } H5D_io_op_type_t;
 
+/* Raw data I/O gathered across the datasets of a multi-dataset operation,
+ * so that it can be handed to the file driver as one vector request.
+ */
+typedef struct H5D_io_batch_t {
+    H5F_shared_t *   f_sh;    /* Shared file the gathered pieces are within */
+    H5D_io_op_type_t op_type; /* Whether the pieces are read or written */
+    uint32_t         nused;   /* Number of vector entries in use */
+    uint32_t         nalloc;  /* Number of vector entries allocated */
+    H5FD_mem_t *     types;   /* Memory types of the vector entries */
+    haddr_t *        addrs;   /* File addresses of the vector entries */
+    size_t *         sizes;   /* Sizes of the vector entries */
+    void **          bufs;    /* Memory buffers of the vector entries */
+} H5D_io_batch_t;
+
 typedef struct H5D_io_info_t {
     const H5D_t *dset;  /* Pointer to dataset being operated on */
                         /* QAK: Delete the f_sh field when oloc has a shared file pointer? */
@@ -227,6 +243,7 @@ typedef struct H5D_io_info_t {
         void *      rbuf; /* Pointer to buffer for read */
         const void *wbuf; /* Pointer to buffer to write */
     } u;
+    H5D_io_batch_t *batch; /* Batch to defer raw data I/O into, when part of a multi-dataset operation */
 } H5D_io_info_t;
 
 /******************/
@@ -339,6 +356,7 @@ typedef struct H5D_chunk_info_t {
     hbool_t  fspace_shared; /* Indicate that the file space for a chunk is shared and shouldn't be freed */
     H5S_t *  mspace;        /* Dataspace describing selection in memory corresponding to this chunk */
     hbool_t  mspace_shared; /* Indicate that the memory space for a chunk is shared and shouldn't be freed */
+    hbool_t  coalesced;     /* Whether the chunk was already read as part of a larger, coalesced read */
 } H5D_chunk_info_t;
 
 /* Main structure holding the mapping between file chunks and memory */
@@ -396,10 +414,11 @@ typedef struct H5D_virtual_held_file_t {
 struct H5D_rdcc_ent_t; /* Forward declaration of struct used below */
 typedef struct H5D_rdcc_t {
     struct {
-        unsigned ninits;   /* Number of chunk creations        */
-        unsigned nhits;    /* Number of cache hits            */
-        unsigned nmisses;  /* Number of cache misses        */
-        unsigned nflushes; /* Number of cache flushes        */
+        unsigned ninits;     /* Number of chunk creations        */
+        unsigned nhits;      /* Number of cache hits            */
+        unsigned nmisses;    /* Number of cache misses        */
+        unsigned nflushes;   /* Number of cache flushes        */
+        unsigned nevictions; /* Number of chunks preempted to make room */
     } stats;
     size_t                 nbytes_max; /* Maximum cached raw data in bytes    */
     size_t                 nslots;     /* Number of chunk slots allocated    */
@@ -417,6 +436,19 @@ typedef struct H5D_rdcc_t {
     H5S_t *                 single_space;      /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t *      single_chunk_info; /* Pointer to single chunk's info */
 
+    /* Chunks read and decoded ahead of H5D__chunk_lock() by the filter workers */
+    struct H5D_chunk_filter_job_t *decoded;  /* Decoded chunks, not yet in the cache */
+    size_t                         ndecoded; /* Number of entries in 'decoded' */
+
+    /* Open-hashing chunk cache, used instead of 'slot' when a replacement policy is set or the
+     * file's shared chunk cache is in use */
+    struct H5D_rdcc_open_t *open_cache; /* Private or shared cache, or NULL when 'slot' is used */
+    haddr_t                 oh_addr;    /* Dataset's object header, for preemption by other datasets */
+
+    /* In-memory copy of the chunk index (H5Pset_chunk_index_cache) */
+    hbool_t                       idx_cache_on; /* Whether lookups use an in-memory copy of the index */
+    struct H5D_chunk_idx_cache_t *idx_cache;    /* Copy of the index, or NULL until the first lookup */
+
     /* Cached information about scaled dataspace dimensions */
     hsize_t  scaled_dims[H5S_MAX_RANK];        /* The scaled dim sizes */
     hsize_t  scaled_power2up[H5S_MAX_RANK];    /* The scaled dim sizes, rounded up to next power of 2 */
@@ -425,11 +457,23 @@ typedef struct H5D_rdcc_t {
 
 /* The raw data contiguous data cache */
 typedef struct H5D_rdcdc_t {
+    struct {
+        unsigned nhits;     /* Number of accesses served from the sieve buffer */
+        unsigned nmisses;   /* Number of accesses that (re)filled the sieve buffer */
+        unsigned nbypasses; /* Number of accesses made directly to the file */
+    } stats;
     unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
     haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
     size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
     size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hbool_t        sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+
+    /* Adaptive sizing of the sieve buffer */
+    size_t   sieve_buf_nominal; /* Size of the data sieve buffer from the file access property list */
+    hbool_t  sieve_bypass;      /* Whether accesses currently bypass the data sieve buffer */
+    hsize_t  sieve_stride;      /* Average distance between the starts of recent accesses (0 if unknown) */
+    unsigned sieve_naccess;     /* Number of sieve buffer accesses since the last adaptation */
+    unsigned sieve_nfills;      /* Number of sieve buffer fills since the last adaptation */
 } H5D_rdcdc_t;
 
 /*
@@ -563,9 +607,12 @@ H5_DLL herr_t  H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, h
 H5_DLL herr_t  H5D__get_num_chunks(const H5D_t *dset, const H5S_t *space, hsize_t *nchunks);
 H5_DLL herr_t  H5D__get_chunk_info(const H5D_t *dset, const H5S_t *space, hsize_t chk_idx, hsize_t *coord,
                                    unsigned *filter_mask, haddr_t *offset, hsize_t *size);
+H5_DLL herr_t  H5D__chunk_iter(const H5D_t *dset, H5D_chunk_iter_op_t op, void *op_data);
 H5_DLL herr_t  H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *coord, unsigned *filter_mask,
                                             haddr_t *addr, hsize_t *size);
 H5_DLL haddr_t H5D__get_offset(const H5D_t *dset);
+H5_DLL herr_t  H5D__get_mapped_ptr(const H5D_t *dset, hid_t mem_type_id, const hsize_t *offset,
+                                   const void **ptr /*out*/, size_t *size /*out*/);
 H5_DLL herr_t  H5D__vlen_get_buf_size(H5D_t *dset, hid_t type_id, hid_t space_id, hsize_t *size);
 H5_DLL herr_t  H5D__vlen_get_buf_size_gen(H5VL_object_t *vol_obj, hid_t type_id, hid_t space_id,
                                           hsize_t *size);
@@ -581,9 +628,14 @@ H5_DLL herr_t H5D__format_convert(H5D_t *dataset);
 
 /* Internal I/O routines */
 H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-                        void *buf /*out*/);
+                        void *buf /*out*/, H5D_io_batch_t *batch);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-                         const void *buf);
+                         const void *buf, H5D_io_batch_t *batch);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dset[], const hid_t mem_type_id[],
+                              const H5S_t *mem_space[], const H5S_t *file_space[], void *buf[] /*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dset[], const hid_t mem_type_id[],
+                               const H5S_t *mem_space[], const H5S_t *file_space[], const void *buf[]);
+H5_DLL herr_t H5D__io_batch_flush(H5D_io_batch_t *batch);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
@@ -614,6 +666,9 @@ H5_DLL herr_t H5D__layout_oh_write(const H5D_t *dataset, H5O_t *oh, unsigned upd
 H5_DLL herr_t  H5D__contig_alloc(H5F_t *f, H5O_storage_contig_t *storage);
 H5_DLL hbool_t H5D__contig_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL hbool_t H5D__contig_is_data_cached(const H5D_shared_t *shared_dset);
+H5_DLL herr_t  H5D__contig_sieve_stats(const H5D_t *dset, unsigned *hits, unsigned *misses,
+                                       unsigned *bypasses, size_t *buf_size);
+H5_DLL herr_t  H5D__contig_sieve_reset_stats(H5D_t *dset);
 H5_DLL herr_t  H5D__contig_fill(const H5D_io_info_t *io_info);
 H5_DLL herr_t  H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
                                 const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
@@ -652,6 +707,18 @@ H5_DLL herr_t H5D__get_offset_copy(const H5D_t *dset, const hsize_t *offset, hsi
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
                                       uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_direct_write_multi(const H5D_t *dset, size_t count, const uint32_t filters[],
+                                            const hsize_t *offsets[], const size_t data_sizes[],
+                                            const void *bufs[]);
+H5_DLL herr_t H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count, const hsize_t *offsets[],
+                                           uint32_t filters[], void *bufs[]);
+H5_DLL herr_t H5D__chunk_prefetch(const H5D_t *dset, const H5S_t *file_space);
+H5_DLL herr_t H5D__chunk_get_mapped_ptr(const H5D_t *dset, const hsize_t *offset, const void **ptr /*out*/,
+                                        size_t *size /*out*/);
+H5_DLL herr_t H5D__chunk_cache_stats(const H5D_t *dset, unsigned *hits, unsigned *misses,
+                                     unsigned *evictions);
+H5_DLL herr_t H5D__chunk_cache_reset_stats(H5D_t *dset);
+H5_DLL herr_t H5D__chunk_idx_cache_insert(const H5D_t *dset, const H5D_chunk_ud_t *udata);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -50,6 +50,8 @@
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME "rdcc_nslots"          /* Size of raw data chunk cache(slots) */
 #define H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME "rdcc_nbytes"          /* Size of raw data chunk cache(bytes) */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME  "rdcc_w0"              /* Preemption read chunks first */
+#define H5D_ACS_DATA_CACHE_POLICY_NAME    "rdcc_policy"          /* Raw data chunk cache replacement policy */
+#define H5D_ACS_CHUNK_INDEX_CACHE_NAME    "chunk_idx_cache"      /* Keep the chunk index in memory */
 #define H5D_ACS_VDS_VIEW_NAME             "vds_view"             /* VDS view option */
 #define H5D_ACS_VDS_PRINTF_GAP_NAME       "vds_printf_gap"       /* VDS printf gap size */
 #define H5D_ACS_VDS_PREFIX_NAME           "vds_prefix"           /* VDS file prefix */
@@ -170,6 +172,9 @@ H5_DLL hid_t       H5D_get_access_plist(const H5D_t *dset);
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+H5_DLL herr_t H5D_chunk_shared_cache_stats(const H5F_t *f, unsigned *hits, unsigned *misses,
+                                           unsigned *evictions, size_t *nbytes_used, size_t *nchunks);
+H5_DLL herr_t H5D_chunk_shared_cache_reset_stats(const H5F_t *f);
 
 /* Functions that operate on virtual storage */
 H5_DLL herr_t H5D_virtual_check_mapping_pre(const H5S_t *vspace, const H5S_t *src_space,
@@ -102,6 +102,16 @@ typedef enum H5D_vds_view_t {
     H5D_VDS_LAST_AVAILABLE = 1
 } H5D_vds_view_t;
 
+/* Values for the chunk cache replacement policy (H5Pset_chunk_cache_policy) */
+typedef enum H5D_chunk_cache_policy_t {
+    H5D_CHUNK_CACHE_POLICY_ERROR   = -1,
+    H5D_CHUNK_CACHE_POLICY_DEFAULT = 0, /* Hash slots, preemption weighted by w0 */
+    H5D_CHUNK_CACHE_POLICY_LRU     = 1, /* Least recently used */
+    H5D_CHUNK_CACHE_POLICY_CLOCK   = 2, /* Clock (second chance) */
+    H5D_CHUNK_CACHE_POLICY_LFU     = 3, /* Least frequently used */
+    H5D_CHUNK_CACHE_NPOLICIES           /* Number of policies (must be last) */
+} H5D_chunk_cache_policy_t;
+
 /* Callback for H5Pset_append_flush() in a dataset access property list */
 typedef herr_t (*H5D_append_cb_t)(hid_t dataset_id, hsize_t *cur_dims, void *op_data);
 
@@ -116,6 +126,10 @@ typedef herr_t (*H5D_scatter_func_t)(const void **src_buf /*out*/, size_t *src_b
 /* Define the operator function pointer for H5Dgather() */
 typedef herr_t (*H5D_gather_func_t)(const void *dst_buf, size_t dst_buf_bytes_used, void *op_data);
 
+/* Define the operator function pointer for H5Dchunk_iter() */
+typedef int (*H5D_chunk_iter_op_t)(const hsize_t *offset, unsigned filter_mask, haddr_t addr, hsize_t size,
+                                   void *op_data);
+
 /********************/
 /* Public Variables */
 /********************/
@@ -143,15 +157,35 @@ H5_DLL herr_t  H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *coord, u
                                           haddr_t *addr, hsize_t *size);
 H5_DLL herr_t  H5Dget_chunk_info(hid_t dset_id, hid_t fspace_id, hsize_t chk_idx, hsize_t *coord,
                                  unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+H5_DLL herr_t  H5Dchunk_iter(hid_t dset_id, hid_t dxpl_id, H5D_chunk_iter_op_t cb, void *op_data);
 H5_DLL haddr_t H5Dget_offset(hid_t dset_id);
+H5_DLL herr_t  H5Dget_mapped_ptr(hid_t dset_id, hid_t mem_type_id, const hsize_t *offset,
+                                 const void **ptr /*out*/, size_t *size /*out*/);
+H5_DLL herr_t  H5Dget_chunk_cache_stats(hid_t dset_id, unsigned *hits /*out*/, unsigned *misses /*out*/,
+                                        unsigned *evictions /*out*/);
+H5_DLL herr_t  H5Dreset_chunk_cache_stats(hid_t dset_id);
+H5_DLL herr_t  H5Dget_sieve_stats(hid_t dset_id, unsigned *hits /*out*/, unsigned *misses /*out*/,
+                                  unsigned *bypasses /*out*/, size_t *buf_size /*out*/);
+H5_DLL herr_t  H5Dreset_sieve_stats(hid_t dset_id);
 H5_DLL herr_t  H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
                        hid_t plist_id, void *buf /*out*/);
 H5_DLL herr_t  H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
                         hid_t plist_id, const void *buf);
+H5_DLL herr_t  H5Dread_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                             const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+                             void *buf[] /*out*/);
+H5_DLL herr_t  H5Dwrite_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                              const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+                              const void *buf[]);
 H5_DLL herr_t  H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, const hsize_t *offset,
                               size_t data_size, const void *buf);
 H5_DLL herr_t  H5Dread_chunk(hid_t dset_id, hid_t dxpl_id, const hsize_t *offset, uint32_t *filters,
                              void *buf);
+H5_DLL herr_t  H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const uint32_t filters[],
+                               const hsize_t *offsets[], const size_t data_sizes[], const void *bufs[]);
+H5_DLL herr_t  H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const hsize_t *offsets[],
+                              uint32_t filters[] /*out*/, void *bufs[] /*out*/);
+H5_DLL herr_t  H5Dprefetch(hid_t dset_id, hid_t file_space_id, hid_t dxpl_id);
 H5_DLL herr_t  H5Diterate(void *buf, hid_t type_id, hid_t space_id, H5D_operator_t op, void *operator_data);
 H5_DLL herr_t  H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id, hsize_t *size);
 H5_DLL herr_t  H5Dfill(const void *fill, hid_t fill_type, void *buf, hid_t buf_type, hid_t space);
@@ -2687,7 +2687,7 @@ H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
         /* Perform read on source dataset */
         if (H5D__read(source_dset->dset, type_info->dst_type_id, source_dset->projected_mem_space,
-                      projected_src_space, io_info->u.rbuf) < 0)
+                      projected_src_space, io_info->u.rbuf, NULL) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read source dataset")
 
         /* Close projected_src_space */
@@ -2879,7 +2879,7 @@ H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
         /* Perform write on source dataset */
         if (H5D__write(source_dset->dset, type_info->dst_type_id, source_dset->projected_mem_space,
-                       projected_src_space, io_info->u.wbuf) < 0)
+                       projected_src_space, io_info->u.wbuf, NULL) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write to source dataset")
 
         /* Close projected_src_space */
@@ -41,6 +41,15 @@
 /* Local Macros */
 /****************/
 
+/* Threads the library starts to work alongside the application's own
+ * threads can mark themselves, so that the errors raised on them are
+ * dropped instead of being pushed on the (unprotected) error stack.
+ */
+#if defined(H5_HAVE_PTHREAD_H) && defined(H5_HAVE_LIBPTHREAD)
+#define H5E_THREAD_PUSH_CONTROL
+#include <pthread.h>
+#endif
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -63,6 +72,9 @@ static herr_t H5E__walk1_cb(int n, H5E_error1_t *err_desc, void *client_data);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 static herr_t H5E__walk2_cb(unsigned n, const H5E_error2_t *err_desc, void *client_data);
 static herr_t H5E__clear_entries(H5E_t *estack, size_t nentries);
+#ifdef H5E_THREAD_PUSH_CONTROL
+static void H5E__quiet_key_create(void);
+#endif /* H5E_THREAD_PUSH_CONTROL */
 
 /*********************/
 /* Package Variables */
@@ -101,6 +113,13 @@ char H5E_mpi_error_str[MPI_MAX_ERROR_STRING];
 int  H5E_mpi_error_str_len;
 #endif /* H5_HAVE_PARALLEL */
 
+#ifdef H5E_THREAD_PUSH_CONTROL
+/* Key for the flag of threads whose errors are dropped, created once */
+static pthread_key_t  H5E_quiet_key_g;
+static pthread_once_t H5E_quiet_once_g    = PTHREAD_ONCE_INIT;
+static int            H5E_quiet_key_err_g = 0;
+#endif /* H5E_THREAD_PUSH_CONTROL */
+
 /*-------------------------------------------------------------------------
  * Function:    H5E__get_msg
  *
@@ -670,6 +689,15 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+#ifdef H5E_THREAD_PUSH_CONTROL
+    /* Drop errors raised on threads that mustn't touch the error stack or
+     * the IDs it references (see H5E_suppress_thread_push)
+     */
+    if (0 == pthread_once(&H5E_quiet_once_g, H5E__quiet_key_create) && 0 == H5E_quiet_key_err_g &&
+        NULL != pthread_getspecific(H5E_quiet_key_g))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5E_THREAD_PUSH_CONTROL */
+
     /* Note that the variable-argument parsing for the format is identical in
      *      the H5Epush2() routine - correct errors and make changes in both
      *      places. -QAK
@@ -699,6 +727,72 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_printf_stack() */
 
+#ifdef H5E_THREAD_PUSH_CONTROL
+/*-------------------------------------------------------------------------
+ * Function:    H5E__quiet_key_create
+ *
+ * Purpose:     Create the key for H5E_suppress_thread_push(), once.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5E__quiet_key_create(void)
+{
+    H5E_quiet_key_err_g = pthread_key_create(&H5E_quiet_key_g, NULL);
+} /* end H5E__quiet_key_create() */
+#endif /* H5E_THREAD_PUSH_CONTROL */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5E_suppress_thread_push
+ *
+ * Purpose:     Set whether errors raised on the calling thread are
+ *              dropped by H5E_printf_stack() instead of being pushed on
+ *              the error stack.  PREV_SUPPRESS, if non-NULL, is set to
+ *              the previous setting, for the caller to restore.
+ *
+ *              Threads the library runs internally (filter and I/O
+ *              workers) set this before calling code that may fail:
+ *              the error stack, and the reference counts of the IDs
+ *              pushed with it, are not protected against concurrent
+ *              use.  Their failures are passed back to the thread that
+ *              started them, which reports them.
+ *
+ *              This must not use the FUNC_ENTER macros or push errors,
+ *              since it is called from those threads.  On failure errno
+ *              is set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_suppress_thread_push(hbool_t suppress, hbool_t *prev_suppress)
+{
+#ifdef H5E_THREAD_PUSH_CONTROL
+    int err; /* Error code from the Pthreads calls */
+
+    if (0 != (err = pthread_once(&H5E_quiet_once_g, H5E__quiet_key_create)) ||
+        0 != (err = H5E_quiet_key_err_g)) {
+        errno = err;
+        return FAIL;
+    } /* end if */
+    if (prev_suppress)
+        *prev_suppress = (NULL != pthread_getspecific(H5E_quiet_key_g));
+    if (0 != (err = pthread_setspecific(H5E_quiet_key_g, suppress ? &H5E_quiet_key_g : NULL))) {
+        errno = err;
+        return FAIL;
+    } /* end if */
+#else  /* H5E_THREAD_PUSH_CONTROL */
+    (void)suppress;
+    if (prev_suppress)
+        *prev_suppress = FALSE;
+#endif /* H5E_THREAD_PUSH_CONTROL */
+
+    return SUCCEED;
+} /* end H5E_suppress_thread_push() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5E__push_stack
  *
@@ -208,5 +208,6 @@ H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func
                                hid_t maj_id, hid_t min_id, const char *fmt, ...) H5_ATTR_FORMAT(printf, 8, 9);
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
 H5_DLL herr_t H5E_dump_api_stack(hbool_t is_api);
+H5_DLL herr_t H5E_suppress_thread_push(hbool_t suppress, hbool_t *prev_suppress);
 
 #endif /* _H5Eprivate_H */
@@ -1824,6 +1824,139 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_page_buffering_stats() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_page_buffering_type_stats
+ *
+ * Purpose:     Retrieves the page buffer hits, misses and evictions for
+ *              each type of file memory.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_page_buffering_type_stats(hid_t file_id, unsigned hits[H5FD_MEM_NTYPES] /*out*/,
+                                 unsigned misses[H5FD_MEM_NTYPES] /*out*/,
+                                 unsigned evictions[H5FD_MEM_NTYPES] /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* File object */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", file_id, hits, misses, evictions);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Get the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_PAGE_BUF_TYPE_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL, hits, misses, evictions) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for page buffering")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_page_buffering_type_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_readahead_stats
+ *
+ * Purpose:     Retrieves statistics for read-ahead of raw data by the file
+ *              driver (see H5Pset_fapl_sec2_readahead).
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_readahead_stats(hid_t file_id, hsize_t *reads /*out*/, hsize_t *hits /*out*/, hsize_t *fills /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* File object */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", file_id, reads, hits, fills);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Get the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_READAHEAD_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL, reads, hits, fills) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for read-ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_readahead_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_shared_chunk_cache_stats
+ *
+ * Purpose:     Retrieves the hits, misses and preemptions of the chunk
+ *              cache shared by the file's datasets, and how much of it is
+ *              in use.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_shared_chunk_cache_stats(hid_t file_id, unsigned *hits /*out*/, unsigned *misses /*out*/,
+                                unsigned *evictions /*out*/, size_t *nbytes_used /*out*/,
+                                size_t *nchunks /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* File object */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "ixxxxx", file_id, hits, misses, evictions, nbytes_used, nchunks);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Get the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL, hits, misses, evictions, nbytes_used, nchunks) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for shared chunk cache")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_shared_chunk_cache_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_shared_chunk_cache_stats
+ *
+ * Purpose:     Resets the hit, miss and preemption counts of the chunk
+ *              cache shared by the file's datasets.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_shared_chunk_cache_stats(hid_t file_id)
+{
+    H5VL_object_t *vol_obj;             /* File to reset stats on */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier")
+
+    /* Reset the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset stats for shared chunk cache")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Freset_shared_chunk_cache_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_image_info
  *
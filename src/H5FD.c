@@ -1435,6 +1435,132 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FDread_vector
+ *
+ * Purpose:     Reads COUNT extents from FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  Extent I begins at address ADDRS[I], is
+ *              SIZES[I] bytes long, has memory type TYPES[I] and is read
+ *              into the buffer BUFS[I].  Drivers which do not provide a
+ *              'read_vector' callback get one 'read' call per extent.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                size_t sizes[], void *bufs[] /*out*/)
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*#iIu*Mt*a*zx", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!types || !addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "vector parameters can't be NULL when count is positive")
+    for (u = 0; u < count; u++)
+        if (!bufs[u] && sizes[u] > 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result buffer parameter can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    for (u = 0; u < count; u++)
+        addrs[u] -= file->base_addr;
+
+    /* Call private function */
+    if (H5FD_read_vector(file, count, types, addrs, sizes, bufs) < 0)
+        ret_value = FAIL;
+
+    /* Restore the caller's addresses */
+    for (u = 0; u < count; u++)
+        addrs[u] += file->base_addr;
+
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDwrite_vector
+ *
+ * Purpose:     Writes COUNT extents to FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  Extent I begins at address ADDRS[I], is
+ *              SIZES[I] bytes long, has memory type TYPES[I] and comes
+ *              from the buffer BUFS[I].  Drivers which do not provide a
+ *              'write_vector' callback get one 'write' call per extent.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                 size_t sizes[], const void *bufs[])
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*#iIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!types || !addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "vector parameters can't be NULL when count is positive")
+    for (u = 0; u < count; u++)
+        if (!bufs[u] && sizes[u] > 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write buffer parameter can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    for (u = 0; u < count; u++)
+        addrs[u] -= file->base_addr;
+
+    /* Call private function */
+    if (H5FD_write_vector(file, count, types, addrs, sizes, bufs) < 0)
+        ret_value = FAIL;
+
+    /* Restore the caller's addresses */
+    for (u = 0; u < count; u++)
+        addrs[u] += file->base_addr;
+
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FDflush
  *
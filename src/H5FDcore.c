@@ -18,6 +18,12 @@
  * Purpose:     A driver which stores the HDF5 data in main memory  using
  *              only the HDF5 public API. This driver is useful for fast
  *              access to small, temporary hdf5 files.
+ *
+ *              The data is normally one buffer which is reallocated as
+ *              the file grows.  With a paged store (see
+ *              H5Pset_core_paged_store) it is kept in separate pages of
+ *              the allocation increment instead, so growing the file never
+ *              copies the data already written.
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -45,9 +51,18 @@ typedef struct H5FD_core_region_t {
     haddr_t end;   /* End address of the region            */
 } H5FD_core_region_t;
 
+/* How the pages of a paged store are allocated */
+typedef enum H5FD_core_page_alloc_t {
+    H5FD_CORE_PAGE_MALLOC, /* From the library's memory allocator */
+    H5FD_CORE_PAGE_MMAP    /* Anonymous mappings (huge pages if possible) */
+} H5FD_core_page_alloc_t;
+
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
  * of the file (the current size of the underlying memory).
+ *
+ * With a paged store, 'mem' is NULL and the data is in 'pages', each of
+ * 'increment' bytes.  Page N holds the file's bytes from N * increment.
  */
 typedef struct H5FD_core_t {
     H5FD_t         pub;              /* public stuff, must be first          */
@@ -92,6 +107,11 @@ typedef struct H5FD_core_t {
     hbool_t                     dirty;        /* changes not saved?       */
     H5FD_file_image_callbacks_t fi_callbacks; /* file image callbacks     */
     H5SL_t *                    dirty_list;   /* dirty parts of the file  */
+    hbool_t                     paged;        /* memory kept in pages?    */
+    unsigned char **            pages;        /* page table               */
+    size_t                      npages;       /* # of pages in use        */
+    size_t                      pages_alloc;  /* # of page table entries  */
+    H5FD_core_page_alloc_t      page_alloc;   /* how pages are allocated  */
 } H5FD_core_t;
 
 /* Driver-specific file access properties */
@@ -100,6 +120,7 @@ typedef struct H5FD_core_fapl_t {
     hbool_t backing_store;  /* write to file name on flush */
     hbool_t write_tracking; /* Whether to track writes */
     size_t  page_size;      /* Page size for tracked writes */
+    hbool_t paged;          /* Whether to keep memory in pages */
 } H5FD_core_fapl_t;
 
 /* Allocate memory in multiples of this size by default */
@@ -107,6 +128,17 @@ typedef struct H5FD_core_fapl_t {
 #define H5FD_CORE_WRITE_TRACKING_FLAG      FALSE
 #define H5FD_CORE_WRITE_TRACKING_PAGE_SIZE 524288
 
+/* Pages of a paged store which are a multiple of this size are taken from
+ * anonymous memory mappings, using huge pages when the system has them
+ */
+#define H5FD_CORE_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#if defined(H5_HAVE_MMAP) && (defined(MAP_ANONYMOUS) || defined(MAP_ANON))
+#define H5FD_CORE_MMAP_PAGES
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
  *
@@ -149,6 +181,13 @@ static herr_t  H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing
 static herr_t  H5FD__core_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__core_unlock(H5FD_t *_file);
 
+/* Paged store routines */
+static unsigned char *H5FD__core_addr_ptr(const H5FD_core_t *file, haddr_t addr, size_t *len);
+static unsigned char *H5FD__core_page_alloc(H5FD_core_t *file);
+static void           H5FD__core_page_free(H5FD_core_t *file, unsigned char *page);
+static herr_t         H5FD__core_pages_resize(H5FD_core_t *file, size_t new_eof);
+static void           H5FD__core_pages_release(H5FD_core_t *file);
+
 static const H5FD_class_t H5FD_core_g = {
     "core",                   /* name                 */
     MAXADDR,                  /* maxaddr              */
@@ -181,7 +220,9 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD__core_truncate,      /* truncate             */
     H5FD__core_lock,          /* lock                 */
     H5FD__core_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,     /* fl_map               */
+    NULL,                     /* read_vector          */
+    NULL                      /* write_vector         */
 };
 
 /* Define a free list to manage the region type */
@@ -339,11 +380,9 @@ done:
 static herr_t
 H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
 {
-    unsigned char *ptr = file->mem + addr; /* mutable pointer into the
-                                            * buffer (can't change mem)
-                                            */
-    HDoff_t offset    = (HDoff_t)addr;     /* Offset to write at */
-    herr_t  ret_value = SUCCEED;           /* Return value */
+    unsigned char *ptr       = NULL;          /* pointer into the memory */
+    HDoff_t        offset    = (HDoff_t)addr; /* Offset to write at */
+    herr_t         ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -357,16 +396,20 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
 
     while (size > 0) {
 
-        h5_posix_io_t     bytes_in    = 0;  /* # of bytes to write  */
-        h5_posix_io_ret_t bytes_wrote = -1; /* # of bytes written   */
+        h5_posix_io_t     bytes_in    = 0;    /* # of bytes to write  */
+        h5_posix_io_ret_t bytes_wrote = -1;   /* # of bytes written   */
+        size_t            len         = size; /* # of contiguous bytes */
+
+        /* A paged store is written a page at a time */
+        ptr = H5FD__core_addr_ptr(file, addr, &len);
 
         /* Trying to write more bytes than the return type can handle is
          * undefined behavior in POSIX.
          */
-        if (size > H5_POSIX_MAX_IO_BYTES)
+        if (len > H5_POSIX_MAX_IO_BYTES)
             bytes_in = H5_POSIX_MAX_IO_BYTES;
         else
-            bytes_in = (h5_posix_io_t)size;
+            bytes_in = (h5_posix_io_t)len;
 
         do {
 #ifdef H5_HAVE_PREADWRITE
@@ -397,7 +440,7 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
         HDassert((size_t)bytes_wrote <= size);
 
         size -= (size_t)bytes_wrote;
-        ptr = (unsigned char *)ptr + bytes_wrote;
+        addr += (haddr_t)bytes_wrote;
 
     } /* end while */
 
@@ -405,6 +448,208 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write_to_bstore() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_addr_ptr
+ *
+ * Purpose:     Finds the memory holding the file's data at ADDR, which
+ *              must be below the eof.  *LEN is cut down to the number of
+ *              bytes from there that are contiguous in memory: up to the
+ *              end of the page for a paged store.
+ *
+ * Return:      Pointer to the data at ADDR (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned char *
+H5FD__core_addr_ptr(const H5FD_core_t *file, haddr_t addr, size_t *len)
+{
+    unsigned char *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(addr < file->eof);
+    HDassert(len);
+
+    if (file->paged) {
+        size_t page   = (size_t)(addr / file->increment);
+        size_t offset = (size_t)(addr % file->increment);
+
+        HDassert(page < file->npages);
+
+        *len      = MIN(*len, file->increment - offset);
+        ret_value = file->pages[page] + offset;
+    } /* end if */
+    else
+        ret_value = file->mem + addr;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_addr_ptr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_page_alloc
+ *
+ * Purpose:     Allocates one zero-filled page for a paged store.
+ *
+ *              Pages of a multiple of the huge page size come from
+ *              anonymous mappings, which are only backed by memory once
+ *              they are written.  Huge pages are used when the system has
+ *              any left, and normal ones otherwise.
+ *
+ * Return:      Success:    Pointer to the page
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned char *
+H5FD__core_page_alloc(H5FD_core_t *file)
+{
+    unsigned char *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(file->paged);
+
+#ifdef H5FD_CORE_MMAP_PAGES
+    if (H5FD_CORE_PAGE_MMAP == file->page_alloc) {
+        void *page = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+        page = HDmmap(NULL, file->increment, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, (HDoff_t)0);
+#endif /* MAP_HUGETLB */
+        if (MAP_FAILED == page)
+            page = HDmmap(NULL, file->increment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                          (HDoff_t)0);
+        if (MAP_FAILED != page)
+            ret_value = (unsigned char *)page;
+    } /* end if */
+    else
+#endif /* H5FD_CORE_MMAP_PAGES */
+        ret_value = (unsigned char *)H5MM_calloc(file->increment);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_page_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_page_free
+ *
+ * Purpose:     Releases a page from H5FD__core_page_alloc.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__core_page_free(H5FD_core_t *file, unsigned char *page)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(file->paged);
+
+#ifdef H5FD_CORE_MMAP_PAGES
+    if (H5FD_CORE_PAGE_MMAP == file->page_alloc)
+        (void)HDmunmap(page, file->increment);
+    else
+#endif /* H5FD_CORE_MMAP_PAGES */
+        H5MM_xfree(page);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__core_page_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_resize
+ *
+ * Purpose:     Adds or removes pages of a paged store so that it holds
+ *              NEW_EOF bytes.  New memory reads as zeros.  Only the page
+ *              table is ever reallocated; the data is never copied.
+ *
+ *              The caller sets the eof.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_pages_resize(H5FD_core_t *file, size_t new_eof)
+{
+    size_t new_npages;          /* # of pages needed */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->paged);
+
+    new_npages = new_eof / file->increment;
+    if (new_eof % file->increment)
+        new_npages++;
+
+    /* Grow the page table */
+    if (new_npages > file->pages_alloc) {
+        unsigned char **x;         /* New page table */
+        size_t          new_alloc; /* # of entries in the new table */
+
+        new_alloc = MAX(2 * file->pages_alloc, new_npages);
+        if (NULL == (x = (unsigned char **)H5MM_realloc(file->pages, new_alloc * sizeof(unsigned char *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate page table of %llu entries",
+                        (unsigned long long)new_alloc)
+        file->pages       = x;
+        file->pages_alloc = new_alloc;
+    } /* end if */
+
+    /* The rest of the last page may hold data from before the file shrank */
+    if (new_eof > file->eof && file->eof % file->increment) {
+        size_t offset = (size_t)(file->eof % file->increment);
+
+        HDmemset(file->pages[file->eof / file->increment] + offset, 0,
+                 MIN(file->increment - offset, (size_t)(new_eof - file->eof)));
+    } /* end if */
+
+    /* Add or remove pages */
+    while (file->npages < new_npages) {
+        if (NULL == (file->pages[file->npages] = H5FD__core_page_alloc(file)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate page of %llu bytes",
+                        (unsigned long long)file->increment)
+        file->npages++;
+    } /* end while */
+    while (file->npages > new_npages) {
+        file->npages--;
+        H5FD__core_page_free(file, file->pages[file->npages]);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_pages_resize() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_release
+ *
+ * Purpose:     Releases all the pages and the page table of a paged store.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__core_pages_release(H5FD_core_t *file)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    while (file->npages > 0) {
+        file->npages--;
+        H5FD__core_page_free(file, file->pages[file->npages]);
+    } /* end while */
+    file->pages       = (unsigned char **)H5MM_xfree(file->pages);
+    file->pages_alloc = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__core_pages_release() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
  *
@@ -534,6 +779,7 @@ H5Pset_core_write_tracking(hid_t plist_id, hbool_t is_enabled, size_t page_size)
     fa.backing_store  = old_fa->backing_store;
     fa.write_tracking = is_enabled;
     fa.page_size      = page_size;
+    fa.paged          = old_fa->paged;
 
     /* Set the property values & the driver for the FAPL */
     if (H5P_set_driver(plist, H5FD_CORE, &fa) < 0)
@@ -584,6 +830,96 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_core_write_tracking() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_core_paged_store
+ *
+ * Purpose:     Enables/disables the core VFD paged store.  With it the
+ *              file's memory is kept in separate pages of the allocation
+ *              increment set with H5Pset_fapl_core(), rather than in one
+ *              buffer that is reallocated each time the file grows.
+ *              Growing the file then never copies the data, and never
+ *              needs room for two copies of it.
+ *
+ *              Pages of a multiple of 2 MiB are taken from anonymous
+ *              memory mappings, using huge pages where available.
+ *
+ *              When the backing store is written on flush, only the
+ *              modified pages are written, as with write tracking (see
+ *              H5Pset_core_write_tracking).
+ *
+ *              A paged store can't use file image callbacks, and has no
+ *              single buffer for H5Fget_vfd_handle() to return.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_paged_store(hid_t plist_id, hbool_t is_enabled)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    H5FD_core_fapl_t        fa;                  /* Core VFD info */
+    const H5FD_core_fapl_t *old_fa;              /* Old core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, is_enabled);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID")
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (old_fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Set VFD info values */
+    fa       = *old_fa;
+    fa.paged = is_enabled;
+
+    /* Set the property values & the driver for the FAPL */
+    if (H5P_set_driver(plist, H5FD_CORE, &fa) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD as driver")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_paged_store() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_core_paged_store
+ *
+ * Purpose:     Gets whether the core VFD keeps the file's memory in pages.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_paged_store(hid_t plist_id, hbool_t *is_enabled /*out*/)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    const H5FD_core_fapl_t *fa;                  /* Core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, is_enabled);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID")
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Get values */
+    if (is_enabled)
+        *is_enabled = fa->paged;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_paged_store() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fapl_core
  *
@@ -694,6 +1030,7 @@ H5FD__core_fapl_get(H5FD_t *_file)
     fa->backing_store  = (hbool_t)(file->fd >= 0);
     fa->write_tracking = file->write_tracking;
     fa->page_size      = file->bstore_page_size;
+    fa->paged          = file->paged;
 
     /* Set return value */
     ret_value = fa;
@@ -808,6 +1145,20 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     /* Save file image callbacks */
     file->fi_callbacks = file_image_info.callbacks;
 
+    /* Set up the paged store, whose pages are one increment each */
+    file->paged = fa->paged;
+    if (file->paged) {
+        if (file->fi_callbacks.image_malloc || file->fi_callbacks.image_memcpy ||
+            file->fi_callbacks.image_realloc || file->fi_callbacks.image_free)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "paged store can't use file image callbacks")
+#ifdef H5FD_CORE_MMAP_PAGES
+        if (0 == file->increment % H5FD_CORE_HUGE_PAGE_SIZE)
+            file->page_alloc = H5FD_CORE_PAGE_MMAP;
+        else
+#endif /* H5FD_CORE_MMAP_PAGES */
+            file->page_alloc = H5FD_CORE_PAGE_MALLOC;
+    } /* end if */
+
     /* Check the file locking flags in the fapl */
     if (ignore_disabled_file_locks_s != FAIL)
         /* The environment variable was set, so use that preferentially */
@@ -850,7 +1201,11 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
         /* Check if we should allocate the memory buffer and read in existing data */
         if (size) {
             /* Allocate memory for the file's data, using the file image callback if available. */
-            if (file->fi_callbacks.image_malloc) {
+            if (file->paged) {
+                if (H5FD__core_pages_resize(file, size) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate pages")
+            } /* end if */
+            else if (file->fi_callbacks.image_malloc) {
                 if (NULL == (file->mem = (unsigned char *)file->fi_callbacks.image_malloc(
                                  size, H5FD_FILE_IMAGE_OP_FILE_OPEN, file->fi_callbacks.udata)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "image malloc callback failed")
@@ -871,6 +1226,18 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                                                                      file->fi_callbacks.udata))
                         HGOTO_ERROR(H5E_FILE, H5E_CANTCOPY, NULL, "image_memcpy callback failed")
                 } /* end if */
+                else if (file->paged) {
+                    haddr_t addr = 0; /* Offset of the next piece */
+
+                    while (size > 0) {
+                        size_t len = size; /* Length of this piece */
+                        uint8_t *mem = H5FD__core_addr_ptr(file, addr, &len);
+
+                        H5MM_memcpy(mem, (const uint8_t *)file_image_info.buffer + addr, len);
+                        addr += len;
+                        size -= len;
+                    } /* end while */
+                }     /* end else-if */
                 else
                     H5MM_memcpy(file->mem, file_image_info.buffer, size);
             } /* end if */
@@ -880,20 +1247,25 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                  * partial results, and the end of the file.
                  */
 
-                uint8_t *mem    = file->mem;  /* memory pointer for writes */
-                HDoff_t  offset = (HDoff_t)0; /* offset for reading */
+                haddr_t addr   = 0;           /* memory offset for writes */
+                HDoff_t offset = (HDoff_t)0; /* offset for reading */
 
                 while (size > 0) {
-                    h5_posix_io_t     bytes_in   = 0;  /* # of bytes to read       */
-                    h5_posix_io_ret_t bytes_read = -1; /* # of bytes actually read */
+                    h5_posix_io_t     bytes_in   = 0;    /* # of bytes to read       */
+                    h5_posix_io_ret_t bytes_read = -1;   /* # of bytes actually read */
+                    size_t            len        = size; /* # of bytes left in page  */
+                    uint8_t *         mem;               /* memory pointer for writes */
+
+                    /* Reads of a paged store stop at the end of each page */
+                    mem = H5FD__core_addr_ptr(file, addr, &len);
 
                     /* Trying to read more bytes than the return type can handle is
                      * undefined behavior in POSIX.
                      */
-                    if (size > H5_POSIX_MAX_IO_BYTES)
+                    if (len > H5_POSIX_MAX_IO_BYTES)
                         bytes_in = H5_POSIX_MAX_IO_BYTES;
                     else
-                        bytes_in = (h5_posix_io_t)size;
+                        bytes_in = (h5_posix_io_t)len;
 
                     do {
 #ifdef H5_HAVE_PREADWRITE
@@ -924,7 +1296,7 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                     HDassert(bytes_read >= 0);
                     HDassert((size_t)bytes_read <= size);
 
-                    mem += bytes_read;
+                    addr += (haddr_t)bytes_read;
                     size -= (size_t)bytes_read;
                 } /* end while */
             }     /* end else */
@@ -935,6 +1307,13 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     file->write_tracking   = fa->write_tracking;
     file->bstore_page_size = fa->page_size;
 
+    /* A paged store always tracks its writes, by default in whole pages */
+    if (file->paged) {
+        if (!file->write_tracking || 0 == file->bstore_page_size)
+            file->bstore_page_size = file->increment;
+        file->write_tracking = TRUE;
+    } /* end if */
+
     /* Set up write tracking if the backing store is on */
     file->dirty_list = NULL;
     if (fa->backing_store) {
@@ -945,8 +1324,8 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
          * on open (when not read-only).
          */
         /* Only use write tracking if the file is open for writing */
-        use_write_tracking = (TRUE == fa->write_tracking) /* user asked for write tracking */
-                             && !(o_flags & O_RDONLY)     /* file is open for writing (i.e. not read-only) */
+        use_write_tracking = (TRUE == file->write_tracking) /* user or paged store asked for it */
+                             && !(o_flags & O_RDONLY)       /* file is open for writing */
                              && (file->bstore_page_size != 0); /* page size is not zero */
 
         /* initialize the dirty list */
@@ -964,6 +1343,8 @@ done:
             HDclose(file->fd);
         H5MM_xfree(file->name);
         H5MM_xfree(file->mem);
+        if (file->paged)
+            H5FD__core_pages_release(file);
         H5MM_xfree(file);
     } /* end if */
 
@@ -1014,6 +1395,8 @@ H5FD__core_close(H5FD_t *_file)
         else
             H5MM_xfree(file->mem);
     } /* end if */
+    if (file->paged)
+        H5FD__core_pages_release(file);
     HDmemset(file, 0, sizeof(H5FD_core_t));
     H5MM_xfree(file);
 
@@ -1288,6 +1671,10 @@ H5FD__core_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle)
     else
         *file_handle = &(file->mem);
 
+    /* A paged store has no single memory buffer to hand out */
+    if (file->paged && *file_handle == &(file->mem))
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "paged store has no memory buffer handle")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_get_handle() */
@@ -1339,10 +1726,16 @@ H5FD__core_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         nbytes = MIN(size, (size_t)(file->eof - addr));
 #endif /* NDEBUG */
 
-        H5MM_memcpy(buf, file->mem + addr, nbytes);
         size -= nbytes;
-        addr += nbytes;
-        buf = (char *)buf + nbytes;
+        while (nbytes > 0) {
+            size_t len = nbytes; /* Length of this piece */
+            const unsigned char *ptr = H5FD__core_addr_ptr(file, addr, &len);
+
+            H5MM_memcpy(buf, ptr, len);
+            nbytes -= len;
+            addr += len;
+            buf = (char *)buf + len;
+        } /* end while */
     }
 
     /* Read zeros for the part which is after the EOF markers */
@@ -1390,30 +1783,40 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
      * the first argument is null.
      */
     if (addr + size > file->eof) {
-        unsigned char *x;
-        size_t         new_eof;
+        size_t new_eof;
 
         /* Determine new size of memory buffer */
         H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
         if ((addr + size) % file->increment)
             new_eof += file->increment;
 
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
-            if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
-                             file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes with callback",
+        /* Add pages to a paged store; it never moves the data */
+        if (file->paged) {
+            if (H5FD__core_pages_resize(file, new_eof) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to grow paged store to %llu bytes",
                             (unsigned long long)new_eof)
         } /* end if */
         else {
-            if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
-        } /* end else */
+            unsigned char *x;
+
+            /* (Re)allocate memory for the file buffer, using callbacks if available */
+            if (file->fi_callbacks.image_realloc) {
+                if (NULL ==
+                    (x = (unsigned char *)file->fi_callbacks.image_realloc(
+                         file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                                "unable to allocate memory block of %llu bytes with callback",
+                                (unsigned long long)new_eof)
+            } /* end if */
+            else {
+                if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                                "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
+            } /* end else */
 
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
+            HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+            file->mem = x;
+        } /* end else */
 
         file->eof = new_eof;
     } /* end if */
@@ -1431,7 +1834,15 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     }
 
     /* Write from BUF to memory */
-    H5MM_memcpy(file->mem + addr, buf, size);
+    while (size > 0) {
+        size_t         len = size; /* Length of this piece */
+        unsigned char *ptr = H5FD__core_addr_ptr(file, addr, &len);
+
+        H5MM_memcpy(ptr, buf, len);
+        size -= len;
+        addr += len;
+        buf = (const char *)buf + len;
+    } /* end while */
 
     /* Mark memory buffer as modified */
     file->dirty = TRUE;
@@ -1560,10 +1971,15 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
 
         /* Extend the file to make sure it's large enough */
         if (!H5F_addr_eq(file->eof, (haddr_t)new_eof)) {
-            unsigned char *x; /* Pointer to new buffer for file data */
+            unsigned char *x = NULL; /* Pointer to new buffer for file data */
 
+            /* Add or remove pages of a paged store */
+            if (file->paged) {
+                if (H5FD__core_pages_resize(file, new_eof) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to resize paged store")
+            } /* end if */
             /* (Re)allocate memory for the file buffer, using callback if available */
-            if (file->fi_callbacks.image_realloc) {
+            else if (file->fi_callbacks.image_realloc) {
                 if (NULL ==
                     (x = (unsigned char *)file->fi_callbacks.image_realloc(
                          file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
@@ -1575,9 +1991,11 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
             } /* end else */
 
-            if (file->eof < new_eof)
-                HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-            file->mem = x;
+            if (!file->paged) {
+                if (file->eof < new_eof)
+                    HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+                file->mem = x;
+            } /* end if */
 
             /* Update backing store, if using it and if closing */
             if (closing && (file->fd >= 0) && file->backing_store) {
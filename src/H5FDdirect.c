@@ -74,6 +74,12 @@ typedef struct H5FD_direct_t {
     int                op;  /*last operation    */
     H5FD_direct_fapl_t fa;  /*file access properties  */
     hbool_t            ignore_disabled_file_locks;
+
+    /* Aligned buffers, kept for the lifetime of the file */
+    void *  bounce;    /*copy buffer for unaligned whole blocks    */
+    void *  blk;       /*cached partial block                      */
+    haddr_t blk_addr;  /*address of cached block, or HADDR_UNDEF   */
+    hbool_t blk_dirty; /*whether cached block needs writing out    */
 #ifndef H5_HAVE_WIN32_API
     /*
      * On most systems the combination of device and i-node number uniquely
@@ -134,9 +140,15 @@ static herr_t  H5FD__direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id,
                                  void *buf);
 static herr_t  H5FD__direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                   const void *buf);
+static herr_t  H5FD__direct_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__direct_unlock(H5FD_t *_file);
+static herr_t  H5FD__direct_read_raw(H5FD_direct_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t  H5FD__direct_write_raw(H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf);
+static herr_t  H5FD__direct_flush_block(H5FD_direct_t *file);
+static herr_t  H5FD__direct_load_block(H5FD_direct_t *file, haddr_t blk_addr);
+static void *  H5FD__direct_get_bounce(H5FD_direct_t *file);
 
 static const H5FD_class_t H5FD_direct_g = {
     "direct",                   /* name                 */
@@ -166,11 +178,13 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD__direct_get_handle,    /* get_handle           */
     H5FD__direct_read,          /* read                 */
     H5FD__direct_write,         /* write                */
-    NULL,                       /* flush                */
+    H5FD__direct_flush,         /* flush                */
     H5FD__direct_truncate,      /* truncate             */
     H5FD__direct_lock,          /* lock                 */
     H5FD__direct_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    NULL,                       /* read_vector          */
+    NULL                        /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_direct_t struct */
@@ -500,8 +514,9 @@ H5FD__direct_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
 
     file->fd = fd;
     H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
-    file->pos = HADDR_UNDEF;
-    file->op  = OP_UNKNOWN;
+    file->pos      = HADDR_UNDEF;
+    file->op       = OP_UNKNOWN;
+    file->blk_addr = HADDR_UNDEF;
 #ifdef H5_HAVE_WIN32_API
     filehandle = _get_osfhandle(fd);
     (void)GetFileInformationByHandle((HANDLE)filehandle, &fileinfo);
@@ -609,9 +624,19 @@ H5FD__direct_close(H5FD_t *_file)
 
     FUNC_ENTER_STATIC
 
+    /* Write out the cached block */
+    if (H5FD__direct_flush_block(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write cached block")
+
     if (HDclose(file->fd) < 0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
 
+    /* Free with HDfree since they came from posix_memalign */
+    if (file->bounce)
+        HDfree(file->bounce);
+    if (file->blk)
+        HDfree(file->blk);
+
     H5FL_FREE(H5FD_direct_t, file);
 
 done:
@@ -826,6 +851,213 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_read_raw
+ *
+ * Purpose:  Reads SIZE bytes from the file at ADDR into BUF with plain
+ *    read() calls, being careful of interrupted system calls and
+ *    partial results.  Bytes past the end of the file read as zeros.
+ *    When alignment is required the caller must pass an aligned
+ *    address, size and buffer.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_read_raw(H5FD_direct_t *file, haddr_t addr, size_t size, void *buf /*out*/)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Seek to the correct location */
+    if ((addr != file->pos || OP_READ != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    file->pos = addr;
+    file->op  = OP_READ;
+
+    while (size > 0) {
+        do {
+            nbytes = HDread(file->fd, buf, size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        HDassert((size_t)nbytes <= size);
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
+        size -= (size_t)nbytes;
+        addr += (haddr_t)nbytes;
+        file->pos = addr;
+        buf       = (char *)buf + nbytes;
+
+        /* A read that stops short of a block boundary hit the end of the file,
+         * and an aligned read can't be continued from there
+         */
+        if (0 == nbytes || (file->fa.must_align && (size_t)nbytes % file->fa.fbsize != 0)) {
+            /* end of file but not end of format address space */
+            HDmemset(buf, 0, size);
+            break;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_read_raw() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_write_raw
+ *
+ * Purpose:  Writes SIZE bytes from BUF to the file at ADDR with plain
+ *    write() calls.  When alignment is required the caller must pass
+ *    an aligned address, size and buffer.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_write_raw(H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Seek to the correct location */
+    if ((addr != file->pos || OP_WRITE != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    file->pos = addr;
+    file->op  = OP_WRITE;
+
+    while (size > 0) {
+        do {
+            nbytes = HDwrite(file->fd, buf, size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        HDassert(nbytes > 0);
+        HDassert((size_t)nbytes <= size);
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
+        size -= (size_t)nbytes;
+        addr += (haddr_t)nbytes;
+        file->pos = addr;
+        buf       = (const char *)buf + nbytes;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_write_raw() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_flush_block
+ *
+ * Purpose:  Writes the cached partial block to the file, if it was
+ *    modified.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_flush_block(H5FD_direct_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (file->blk_dirty) {
+        HDassert(H5F_addr_defined(file->blk_addr));
+
+        if (H5FD__direct_write_raw(file, file->blk_addr, file->fa.fbsize, file->blk) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write cached block")
+        file->blk_dirty = FALSE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_flush_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_load_block
+ *
+ * Purpose:  Makes the block cache hold the file block at BLK_ADDR, which
+ *    must be aligned.  The block that was cached before is written
+ *    out first if it was modified.  Blocks past the end of the
+ *    file aren't read; they are all zeros.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_load_block(H5FD_direct_t *file, haddr_t blk_addr)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(!(blk_addr % file->fa.fbsize));
+
+    if (file->blk_addr != blk_addr) {
+        /* Write out the block being replaced */
+        if (H5FD__direct_flush_block(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write cached block")
+
+        /* NOTE: Use HDfree to release the buffer, as it comes from
+         *       HDposix_memalign.
+         */
+        if (NULL == file->blk && HDposix_memalign(&file->blk, file->fa.mboundary, file->fa.fbsize) != 0) {
+            file->blk = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+        } /* end if */
+
+        file->blk_addr = HADDR_UNDEF;
+        if (blk_addr >= file->eof)
+            HDmemset(file->blk, 0, file->fa.fbsize);
+        else if (H5FD__direct_read_raw(file, blk_addr, file->fa.fbsize, file->blk) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read block")
+        file->blk_addr = blk_addr;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_load_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_get_bounce
+ *
+ * Purpose:  Returns the file's aligned bounce buffer, of the fapl's copy
+ *    buffer size, allocating it on first use.  It is kept until the
+ *    file is closed.
+ *
+ * Return:  Success:  Pointer to the buffer
+ *
+ *    Failure:  NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__direct_get_bounce(H5FD_direct_t *file)
+{
+    void *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* NOTE: Use HDfree to release the buffer, as it comes from
+     *       HDposix_memalign.
+     */
+    if (NULL == file->bounce && HDposix_memalign(&file->bounce, file->fa.mboundary, file->fa.cbsize) != 0) {
+        file->bounce = NULL;
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "HDposix_memalign failed")
+    } /* end if */
+
+    ret_value = file->bounce;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_get_bounce() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_read
  *
@@ -833,6 +1065,12 @@ done:
  *    into buffer BUF according to data transfer properties in
  *    DXPL_ID.
  *
+ *    When alignment is required, the whole blocks of the request
+ *    are read straight into BUF if it is aligned, or through the
+ *    file's bounce buffer otherwise.  Partial blocks at either end
+ *    go through the block cache, so small sequential reads only
+ *    read each block once.
+ *
  * Return:  Success:  Zero. Result is stored in caller-supplied
  *        buffer BUF.
  *
@@ -848,17 +1086,9 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
                   size_t size, void *buf /*out*/)
 {
     H5FD_direct_t *file = (H5FD_direct_t *)_file;
-    ssize_t        nbytes;
-    hbool_t        _must_align = TRUE;
-    herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void *         copy_buf = NULL, *p2;
-    size_t         _boundary;
-    size_t         _fbsize;
-    size_t         _cbsize;
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to read when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the requested data */
+    size_t         fbsize;                /* File system block size */
+    size_t         nbytes;                /* Bytes handled in one step */
+    herr_t         ret_value = SUCCEED;   /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -874,131 +1104,73 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     /* If the system doesn't require data to be aligned, read the data in
      * the same way as sec2 driver.
      */
-    _must_align = file->fa.must_align;
+    if (!file->fa.must_align) {
+        if (H5FD__direct_read_raw(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
 
-    /* Get the memory boundary for alignment, file system block size, and maximal
-     * copy buffer size.
-     */
-    _boundary = file->fa.mboundary;
-    _fbsize   = file->fa.fbsize;
-    _cbsize   = file->fa.cbsize;
+    fbsize = file->fa.fbsize;
 
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * read it directly from the file.  If not, read a bigger
-     * and aligned data first, then copy the data into memory buffer.
-     */
-    if (!_must_align || ((addr % _fbsize == 0) && (size % _fbsize == 0) && ((size_t)buf % _boundary == 0))) {
-        /* Seek to the correct location */
-        if ((addr != file->pos || OP_READ != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-        /* Read the aligned data in file first, being careful of interrupted
-         * system calls and partial results. */
-        while (size > 0) {
-            do {
-                nbytes = HDread(file->fd, buf, size);
-            } while (-1 == nbytes && EINTR == errno);
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            if (0 == nbytes) {
-                /* end of file but not end of format address space */
-                HDmemset(buf, 0, size);
-                break;
-            }
-            HDassert(nbytes >= 0);
-            HDassert((size_t)nbytes <= size);
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
-            size -= (size_t)nbytes;
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
-            addr += (haddr_t)nbytes;
-            buf = (char *)buf + nbytes;
-        }
-    }
-    else {
-        /* Calculate where we will begin copying from the copy buffer */
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer. */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        HDassert(!(alloc_size % _fbsize));
-        if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+    /* Partial block at the start */
+    if (addr % fbsize != 0) {
+        size_t blk_offset = (size_t)(addr % fbsize);
 
-        /* look for the aligned position for reading the data */
-        HDassert(!(((addr / _fbsize) * _fbsize) % _fbsize));
-        if (HDlseek(file->fd, (HDoff_t)((addr / _fbsize) * _fbsize), SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+        if (H5FD__direct_load_block(file, addr - blk_offset) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read block")
+        nbytes = MIN(size, fbsize - blk_offset);
+        H5MM_memcpy(buf, (unsigned char *)file->blk + blk_offset, nbytes);
+        addr += nbytes;
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    } /* end if */
 
-        /*
-         * Read the aligned data in file into aligned buffer first, then copy the data
-         * into the final buffer.  If the data size is bigger than maximal copy buffer
-         * size, do the reading by segment (the outer while loop).  If not, do one step
-         * reading.
-         */
-        do {
-            /* Read the aligned data in file first.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE. */
-            HDmemset(copy_buf, 0, alloc_size);
-
-            /* Calculate how much data we have to read in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                read_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                read_size = alloc_size;
-
-            HDassert(!(read_size % _fbsize));
-            do {
-                nbytes = HDread(file->fd, copy_buf, read_size);
-            } while (-1 == nbytes && EINTR == errno);
-
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-
-            /* Copy the needed data from the copy buffer to the output
-             * buffer, and update copy_size.  If the copy buffer does not
-             * contain the rest of the data, just copy what's in the copy
-             * buffer and also update read_addr and copy_offset to read the
-             * next section of data. */
-            p2 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(buf, p2, copy_size);
-                buf       = (unsigned char *)buf + copy_size;
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(buf, p2, alloc_size - copy_offset);
-                buf = (unsigned char *)buf + alloc_size - copy_offset;
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-        } while (copy_size > 0);
-
-        /*Final step: update address*/
-        addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
-
-        if (copy_buf) {
-            /* Free with HDfree since it came from posix_memalign */
-            HDfree(copy_buf);
-            copy_buf = NULL;
+    /* Whole blocks */
+    if (size >= fbsize) {
+        nbytes = (size / fbsize) * fbsize;
+
+        /* The cached block may be newer than the file */
+        if (file->blk_dirty && file->blk_addr >= addr && file->blk_addr < addr + nbytes)
+            if (H5FD__direct_flush_block(file) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write cached block")
+
+        if ((size_t)buf % file->fa.mboundary == 0) {
+            /* Zero-copy: read straight into the application's buffer */
+            if (H5FD__direct_read_raw(file, addr, nbytes, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            addr += nbytes;
+            size -= nbytes;
+            buf = (unsigned char *)buf + nbytes;
         } /* end if */
-    }
-
-    /* Update current position */
-    file->pos = addr;
-    file->op  = OP_READ;
+        else {
+            void * bounce;
+            size_t remaining = nbytes;
+
+            if (NULL == (bounce = H5FD__direct_get_bounce(file)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get bounce buffer")
+            while (remaining > 0) {
+                size_t chunk = MIN(remaining, file->fa.cbsize);
+
+                if (H5FD__direct_read_raw(file, addr, chunk, bounce) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+                H5MM_memcpy(buf, bounce, chunk);
+                addr += chunk;
+                size -= chunk;
+                remaining -= chunk;
+                buf = (unsigned char *)buf + chunk;
+            } /* end while */
+        }     /* end else */
+    }         /* end if */
+
+    /* Partial block at the end */
+    if (size > 0) {
+        if (H5FD__direct_load_block(file, addr) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read block")
+        H5MM_memcpy(buf, file->blk, size);
+    } /* end if */
 
 done:
     if (ret_value < 0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if (copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
@@ -1014,6 +1186,14 @@ done:
  *    from buffer BUF according to data transfer properties in
  *    DXPL_ID.
  *
+ *    When alignment is required, the whole blocks of the request
+ *    are written straight from BUF if it is aligned, or through
+ *    the file's bounce buffer otherwise.  Partial blocks at either
+ *    end are updated in the block cache and only written out when
+ *    another block is needed, or on flush, truncate or close.  A
+ *    run of small adjacent writes therefore reads and writes each
+ *    partial block once instead of once per write.
+ *
  * Return:  Success:  Zero
  *
  *    Failure:  -1
@@ -1028,20 +1208,10 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
                    size_t size, const void *buf)
 {
     H5FD_direct_t *file = (H5FD_direct_t *)_file;
-    ssize_t        nbytes;
-    hbool_t        _must_align = TRUE;
-    herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void *         copy_buf = NULL, *p1;
-    const void *   p3;
-    size_t         _boundary;
-    size_t         _fbsize;
-    size_t         _cbsize;
-    haddr_t        write_addr;       /* Address to write copy buffer */
-    haddr_t        write_size;       /* Size to write from copy buffer */
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to write when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the data to write */
+    size_t         fbsize;                /* File system block size */
+    size_t         nbytes;                /* Bytes handled in one step */
+    haddr_t        end_addr;              /* End of the region written */
+    herr_t         ret_value = SUCCEED;   /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -1054,180 +1224,88 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow")
 
-    /* If the system doesn't require data to be aligned, read the data in
+    /* If the system doesn't require data to be aligned, write the data in
      * the same way as sec2 driver.
      */
-    _must_align = file->fa.must_align;
+    if (!file->fa.must_align) {
+        if (H5FD__direct_write_raw(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        if (addr + size > file->eof)
+            file->eof = addr + size;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
 
-    /* Get the memory boundary for alignment, file system block size, and maximal
-     * copy buffer size.
-     */
-    _boundary = file->fa.mboundary;
-    _fbsize   = file->fa.fbsize;
-    _cbsize   = file->fa.cbsize;
+    fbsize = file->fa.fbsize;
 
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * write it directly to the file.  If not, read a bigger and aligned data
-     * first, update buffer with user data, then write the data out.
-     */
-    if (!_must_align || ((addr % _fbsize == 0) && (size % _fbsize == 0) && ((size_t)buf % _boundary == 0))) {
-        /* Seek to the correct location */
-        if ((addr != file->pos || OP_WRITE != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-        while (size > 0) {
-            do {
-                nbytes = HDwrite(file->fd, buf, size);
-            } while (-1 == nbytes && EINTR == errno);
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-            HDassert(nbytes > 0);
-            HDassert((size_t)nbytes <= size);
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
-            size -= (size_t)nbytes;
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
-            addr += (haddr_t)nbytes;
-            buf = (const char *)buf + nbytes;
-        }
-    }
-    else {
-        /* Calculate where we will begin reading from (on disk) and where we
-         * will begin copying from the copy buffer */
-        write_addr  = (addr / _fbsize) * _fbsize;
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer.
-         */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        HDassert(!(alloc_size % _fbsize));
+    /* Blocks are always written whole, so the file grows to a block boundary */
+    end_addr = ((addr + size + fbsize - 1) / fbsize) * fbsize;
 
-        if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+    /* Partial block at the start */
+    if (addr % fbsize != 0) {
+        size_t blk_offset = (size_t)(addr % fbsize);
 
-        /* look for the right position for reading or writing the data */
-        if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+        if (H5FD__direct_load_block(file, addr - blk_offset) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read block")
+        nbytes = MIN(size, fbsize - blk_offset);
+        H5MM_memcpy((unsigned char *)file->blk + blk_offset, buf, nbytes);
+        file->blk_dirty = TRUE;
+        addr += nbytes;
+        size -= nbytes;
+        buf = (const unsigned char *)buf + nbytes;
+    } /* end if */
 
-        p3 = buf;
-        do {
-            /* Calculate how much data we have to write in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                write_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                write_size = alloc_size;
-
-            /*
-             * Read the aligned data first if the aligned region doesn't fall
-             * entirely in the range to be written.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE.  Only read the entire section if
-             * both ends are misaligned, otherwise only read the block on the
-             * misaligned end.
-             */
-            HDmemset(copy_buf, 0, _fbsize);
-
-            if (copy_offset > 0) {
-                if ((write_addr + write_size) > (addr + size)) {
-                    HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                    read_size = write_size;
-                    p1        = copy_buf;
-                } /* end if */
-                else {
-                    read_size = _fbsize;
-                    p1        = copy_buf;
-                } /* end else */
-            }     /* end if */
-            else if ((write_addr + write_size) > (addr + size)) {
-                HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                read_size = _fbsize;
-                p1        = (unsigned char *)copy_buf + write_size - _fbsize;
-
-                /* Seek to the last block, for reading */
-                HDassert(!((write_addr + write_size - _fbsize) % _fbsize));
-                if (HDlseek(file->fd, (HDoff_t)(write_addr + write_size - _fbsize), SEEK_SET) < 0)
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-            } /* end if */
-            else
-                p1 = NULL;
-
-            if (p1) {
-                HDassert(!(read_size % _fbsize));
-                do {
-                    nbytes = HDread(file->fd, p1, read_size);
-                } while (-1 == nbytes && EINTR == errno);
-
-                if (-1 == nbytes) /* error */
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            } /* end if */
-
-            /* look for the right position and append or copy the data to be written to
-             * the aligned buffer.
-             * Consider all possible situations here: file address is not aligned on
-             * file block size; the end of data address is not aligned; the end of data
-             * address is aligned; data size is smaller or bigger than maximal copy size.
-             */
-            p1 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(p1, p3, copy_size);
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(p1, p3, alloc_size - copy_offset);
-                p3 = (const unsigned char *)p3 + (alloc_size - copy_offset);
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-
-            /*look for the aligned position for writing the data*/
-            HDassert(!(write_addr % _fbsize));
-            if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-            /*
-             * Write the data. It doesn't truncate the extra data introduced by
-             * alignment because that step is done in H5FD_direct_flush.
-             */
-            HDassert(!(write_size % _fbsize));
-            do {
-                nbytes = HDwrite(file->fd, copy_buf, write_size);
-            } while (-1 == nbytes && EINTR == errno);
-
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-
-            /* update the write address */
-            write_addr += write_size;
-        } while (copy_size > 0);
-
-        /*Update the address and size*/
-        addr = write_addr;
-        buf  = (const char *)buf + size;
-
-        if (copy_buf) {
-            /* Free with HDfree since it came from posix_memalign */
-            HDfree(copy_buf);
-            copy_buf = NULL;
+    /* Whole blocks */
+    if (size >= fbsize) {
+        nbytes = (size / fbsize) * fbsize;
+
+        /* The cached block is about to be overwritten */
+        if (H5F_addr_defined(file->blk_addr) && file->blk_addr >= addr && file->blk_addr < addr + nbytes) {
+            file->blk_addr  = HADDR_UNDEF;
+            file->blk_dirty = FALSE;
         } /* end if */
-    }
 
-    /* Update current position and eof */
-    file->pos = addr;
-    file->op  = OP_WRITE;
-    if (file->pos > file->eof)
-        file->eof = file->pos;
+        if ((size_t)buf % file->fa.mboundary == 0) {
+            /* Zero-copy: write straight from the application's buffer */
+            if (H5FD__direct_write_raw(file, addr, nbytes, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            addr += nbytes;
+            size -= nbytes;
+            buf = (const unsigned char *)buf + nbytes;
+        } /* end if */
+        else {
+            void * bounce;
+            size_t remaining = nbytes;
+
+            if (NULL == (bounce = H5FD__direct_get_bounce(file)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get bounce buffer")
+            while (remaining > 0) {
+                size_t chunk = MIN(remaining, file->fa.cbsize);
+
+                H5MM_memcpy(bounce, buf, chunk);
+                if (H5FD__direct_write_raw(file, addr, chunk, bounce) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                addr += chunk;
+                size -= chunk;
+                remaining -= chunk;
+                buf = (const unsigned char *)buf + chunk;
+            } /* end while */
+        }     /* end else */
+    }         /* end if */
+
+    /* Partial block at the end */
+    if (size > 0) {
+        if (H5FD__direct_load_block(file, addr) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read block")
+        H5MM_memcpy(file->blk, buf, size);
+        file->blk_dirty = TRUE;
+    } /* end if */
+
+    /* Update eof */
+    if (end_addr > file->eof)
+        file->eof = end_addr;
 
 done:
     if (ret_value < 0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if (copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
@@ -1236,6 +1314,35 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_flush
+ *
+ * Purpose:  Writes the cached partial block to the file, if it was
+ *    modified.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_direct_t *file      = (H5FD_direct_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (H5FD__direct_flush_block(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write cached block")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_truncate
  *
@@ -1261,6 +1368,13 @@ H5FD__direct_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_AT
 
     HDassert(file);
 
+    /* Write out the cached block before the file size is changed, and
+     * drop it, since it may now lie partly past the end of the file
+     */
+    if (H5FD__direct_flush_block(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write cached block")
+    file->blk_addr = HADDR_UNDEF;
+
     /* Extend the file to make sure it's large enough */
     if (file->eoa != file->eof) {
 #ifdef H5_HAVE_WIN32_API
@@ -30,6 +30,11 @@
  *        can be quite time consuming on file systems that don't
  *        implement holes, like nfs).
  *
+ *        Requests which span several members, and vectors of requests
+ *        spread over several members, can be issued to the members
+ *        from several threads at once (see
+ *        H5Pset_fapl_family_concurrency).
+ *
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -40,6 +45,7 @@
 #include "H5Fprivate.h"  /* File access                */
 #include "H5FDprivate.h" /* File drivers                */
 #include "H5FDfamily.h"  /* Family file driver             */
+#include "H5FDsec2.h"    /* Sec2 file driver                */
 #include "H5Iprivate.h"  /* IDs                      */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists            */
@@ -47,6 +53,14 @@
 /* The size of the member name buffers */
 #define H5FD_FAM_MEMB_NAME_BUF_SIZE 4096
 
+/* Member I/O is only issued from several threads when Pthreads are
+ * available, and the code stack (which is global) isn't in use.
+ */
+#if defined(H5_HAVE_PTHREAD_H) && defined(H5_HAVE_LIBPTHREAD) && !defined(H5_HAVE_CODESTACK)
+#define H5FD_FAMILY_CONCURRENT_IO
+#include <pthread.h>
+#endif
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_FAMILY_g = 0;
 
@@ -62,6 +76,7 @@ typedef struct H5FD_family_t {
     haddr_t  eoa;          /*end of allocated addresses        */
     char *   name;         /*name generator printf format        */
     unsigned flags;        /*flags for opening additional members    */
+    unsigned nthreads;     /*max. # of threads doing member I/O    */
 
     /* Information from properties set by 'h5repart' tool */
     hsize_t mem_newsize;    /*new member size passed in as private
@@ -73,10 +88,38 @@ typedef struct H5FD_family_t {
 
 /* Driver-specific file access properties */
 typedef struct H5FD_family_fapl_t {
-    hsize_t memb_size;    /*size of each member            */
-    hid_t   memb_fapl_id; /*file access property list of each memb*/
+    hsize_t  memb_size;    /*size of each member            */
+    hid_t    memb_fapl_id; /*file access property list of each memb*/
+    unsigned nthreads;     /*max. # of threads doing member I/O    */
 } H5FD_family_fapl_t;
 
+/* One part of a request, which falls entirely within member 'memb' */
+typedef struct H5FD_family_piece_t {
+    unsigned   memb; /*index of the member            */
+    H5FD_mem_t type; /*type of the data            */
+    haddr_t    addr; /*address within the member        */
+    size_t     size; /*size of the piece            */
+    void *     buf;  /*buffer for the piece            */
+} H5FD_family_piece_t;
+
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+/* The share of a concurrent request done by one thread: the pieces whose
+ * member index is 'first' modulo 'stride', so that no two threads ever
+ * use the same member.  'failed' is set to errno when a member I/O call
+ * fails, for the calling thread to report.
+ */
+typedef struct H5FD_family_worker_t {
+    H5FD_family_t *            file;     /*the family                */
+    const H5FD_family_piece_t *pieces;   /*all the pieces            */
+    size_t                     npieces;  /*# of pieces                */
+    unsigned                   first;    /*first member index            */
+    unsigned                   stride;   /*# of threads                */
+    hid_t                      dxpl_id;  /*data transfer property list    */
+    hbool_t                    do_write; /*whether to write the pieces    */
+    int                        failed;   /*errno of a failed call, or 0    */
+} H5FD_family_worker_t;
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
 /* Callback prototypes */
 static herr_t  H5FD__family_term(void);
 static void *  H5FD__family_fapl_get(H5FD_t *_file);
@@ -97,11 +140,24 @@ static herr_t  H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
                                  void *_buf /*out*/);
 static herr_t  H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
                                   const void *_buf);
+static herr_t  H5FD__family_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/);
+static herr_t  H5FD__family_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t  H5FD__family_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__family_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__family_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__family_unlock(H5FD_t *_file);
 
+/* Member I/O routines */
+static herr_t H5FD__family_io(H5FD_family_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                              haddr_t addrs[], size_t sizes[], void *bufs[], hbool_t do_write);
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+static hbool_t H5FD__family_can_run_concurrent(const H5FD_family_t *file, const H5FD_family_piece_t *pieces,
+                                               size_t npieces);
+static void *  H5FD__family_worker(void *_worker);
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
 /* The class struct */
 static const H5FD_class_t H5FD_family_g = {
     "family",                   /* name            */
@@ -135,7 +191,9 @@ static const H5FD_class_t H5FD_family_g = {
     H5FD__family_truncate,      /* truncate        */
     H5FD__family_lock,          /* lock                 */
     H5FD__family_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD__family_read_vector,   /* read_vector  */
+    H5FD__family_write_vector   /* write_vector */
 };
 
 /*--------------------------------------------------------------------------
@@ -240,7 +298,7 @@ herr_t
 H5Pset_fapl_family(hid_t fapl_id, hsize_t msize, hid_t memb_fapl_id)
 {
     herr_t             ret_value;
-    H5FD_family_fapl_t fa = {0, -1};
+    H5FD_family_fapl_t fa = {0, -1, 1};
     H5P_genplist_t *   plist; /* Property list pointer */
 
     FUNC_ENTER_API(FAIL)
@@ -309,6 +367,90 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_family_concurrency
+ *
+ * Purpose:     Sets the number of threads which may do I/O on family
+ *              members at once, for a file access property list which
+ *              already uses the family driver.  A request which spans
+ *              several members, or a vector of requests spread over
+ *              several members, is then issued to up to NTHREADS members
+ *              concurrently, which keeps members on separate devices
+ *              busy at the same time.  One thread (the default) does all
+ *              member I/O serially.
+ *
+ *              Concurrent I/O is only used for sec2 members; requests
+ *              to members using other drivers are always issued
+ *              serially.  H5Pset_fapl_family() resets the number of
+ *              threads to one, so call this function after it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_family_concurrency(hid_t fapl_id, unsigned nthreads)
+{
+    H5P_genplist_t *          plist; /* Property list pointer */
+    H5FD_family_fapl_t        fa;
+    const H5FD_family_fapl_t *old_fa;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", fapl_id, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (old_fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (0 == nthreads || nthreads > H5FD_FAMILY_THREADS_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads out of range")
+
+    /* The driver info is deep copied by H5P_set_driver */
+    fa          = *old_fa;
+    fa.nthreads = nthreads;
+    if (H5P_set_driver(plist, H5FD_FAMILY, &fa) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set family VFD as driver")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_family_concurrency() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_family_concurrency
+ *
+ * Purpose:     Returns the number of threads which may do I/O on family
+ *              members at once.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_family_concurrency(hid_t fapl_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *          plist; /* Property list pointer */
+    const H5FD_family_fapl_t *fa;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (nthreads)
+        *nthreads = fa->nthreads;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_family_concurrency() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__family_fapl_get
  *
@@ -338,6 +480,7 @@ H5FD__family_fapl_get(H5FD_t *_file)
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
     fa->memb_size = file->memb_size;
+    fa->nthreads  = file->nthreads;
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(file->memb_fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
     fa->memb_fapl_id = H5P_copy_plist(plist, FALSE);
@@ -608,7 +751,8 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
         file->memb_size   = 1024 * 1024 * 1024; /*1GB. Actual member size to be updated later */
         file->pmem_size   = 1024 * 1024 * 1024; /*1GB. Member size passed in through property */
         file->mem_newsize = 0;                  /*New member size used by h5repart only       */
-    }                                           /* end if */
+        file->nthreads    = 1;
+    } /* end if */
     else {
         H5P_genplist_t *          plist; /* Property list pointer */
         const H5FD_family_fapl_t *fa;
@@ -640,7 +784,8 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
         }                                /* end else */
         file->memb_size = fa->memb_size; /* Actual member size to be updated later */
         file->pmem_size = fa->memb_size; /* Member size passed in through property */
-    }                                    /* end else */
+        file->nthreads  = MAX(fa->nthreads, 1);
+    } /* end else */
     file->name  = H5MM_strdup(name);
     file->flags = flags;
 
@@ -1107,6 +1252,15 @@ H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+    /* A request which spans several members may be issued to them at once */
+    if (file->nthreads > 1 && (addr % file->memb_size) + size > file->memb_size) {
+        if (H5FD__family_io(file, dxpl_id, 1, &type, &addr, &size, &_buf, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
     /* Read from each member */
     while (size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1172,6 +1326,20 @@ H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+    /* A request which spans several members may be issued to them at once */
+    if (file->nthreads > 1 && (addr % file->memb_size) + size > file->memb_size) {
+        void *mbuf;
+
+        H5_GCC_DIAG_OFF("cast-qual")
+        mbuf = (void *)_buf;
+        H5_GCC_DIAG_ON("cast-qual")
+        if (H5FD__family_io(file, dxpl_id, 1, &type, &addr, &size, &mbuf, TRUE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
     /* Write to each member */
     while (size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1200,6 +1368,348 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_read_vector
+ *
+ * Purpose:     Reads COUNT extents, described by the TYPES, ADDRS and
+ *              SIZES arrays, into the buffers in BUFS.  Extents on
+ *              different members may be read at once (see
+ *              H5FD__family_io).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                         size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_family_t *file      = (H5FD_family_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5FD__family_io(file, dxpl_id, count, types, addrs, sizes, bufs, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_write_vector
+ *
+ * Purpose:     Writes COUNT extents, described by the TYPES, ADDRS and
+ *              SIZES arrays, from the buffers in BUFS.  Extents on
+ *              different members may be written at once (see
+ *              H5FD__family_io).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                          size_t sizes[], const void *bufs[])
+{
+    H5FD_family_t *file      = (H5FD_family_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    H5_GCC_DIAG_OFF("cast-qual")
+    if (H5FD__family_io(file, dxpl_id, count, types, addrs, sizes, (void **)bufs, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file vector write failed")
+    H5_GCC_DIAG_ON("cast-qual")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_io
+ *
+ * Purpose:     Reads or writes COUNT extents of the family, described by
+ *              the TYPES, ADDRS and SIZES arrays, into or from the
+ *              buffers in BUFS.  Each extent is split into pieces which
+ *              fall within one member each.
+ *
+ *              When the file allows more than one thread and the pieces
+ *              are on several members that all use the sec2 driver, the
+ *              pieces are shared out among threads so that each member
+ *              is used by one thread only, and the members' I/O
+ *              callbacks are called from those threads.  Otherwise the
+ *              pieces are transferred one after the other.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_io(H5FD_family_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                size_t sizes[], void *bufs[], hbool_t do_write)
+{
+    H5FD_family_piece_t *pieces    = NULL;    /* Pieces of the extents        */
+    size_t               npieces   = 0;       /* # of pieces                  */
+    size_t               u;                   /* Local index variable         */
+    uint32_t             v;                   /* Local index variable         */
+    herr_t               ret_value = SUCCEED; /* Return value                 */
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+    H5FD_family_worker_t *workers = NULL; /* Work for each thread         */
+    pthread_t *           threads = NULL; /* Threads started              */
+    hbool_t *             started = NULL; /* Whether each thread started  */
+#endif                                    /* H5FD_FAMILY_CONCURRENT_IO */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert((types && addrs && sizes && bufs) || 0 == count);
+
+    /* Count the pieces */
+    for (v = 0; v < count; v++) {
+        haddr_t addr = addrs[v];
+        size_t  size = sizes[v];
+
+        while (size > 0) {
+            hsize_t tempreq = file->memb_size - (addr % file->memb_size);
+            size_t  req     = (tempreq > SIZET_MAX) ? size : MIN(size, (size_t)tempreq);
+
+            addr += req;
+            size -= req;
+            npieces++;
+        } /* end while */
+    }     /* end for */
+    if (0 == npieces)
+        HGOTO_DONE(SUCCEED)
+
+    /* Split the extents */
+    if (NULL == (pieces = (H5FD_family_piece_t *)H5MM_malloc(npieces * sizeof(H5FD_family_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate member request list")
+    u = 0;
+    for (v = 0; v < count; v++) {
+        haddr_t        addr = addrs[v];
+        size_t         size = sizes[v];
+        unsigned char *buf  = (unsigned char *)bufs[v];
+
+        while (size > 0) {
+            hsize_t tempreq;
+
+            H5_CHECKED_ASSIGN(pieces[u].memb, unsigned, addr / file->memb_size, hsize_t);
+            pieces[u].type = types[v];
+            pieces[u].addr = addr % file->memb_size;
+
+            /* Avoid overflowing a 32-bit size_t (see H5FD__family_read) */
+            tempreq = file->memb_size - pieces[u].addr;
+            if (tempreq > SIZET_MAX)
+                tempreq = SIZET_MAX;
+            pieces[u].size = MIN(size, (size_t)tempreq);
+            pieces[u].buf  = buf;
+
+            HDassert(pieces[u].memb < file->nmembs);
+
+            addr += pieces[u].size;
+            buf += pieces[u].size;
+            size -= pieces[u].size;
+            u++;
+        } /* end while */
+    }     /* end for */
+    HDassert(u == npieces);
+
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+    if (file->nthreads > 1 && H5FD__family_can_run_concurrent(file, pieces, npieces)) {
+        unsigned first_memb = pieces[0].memb; /* Lowest member index used  */
+        unsigned last_memb  = pieces[0].memb; /* Highest member index used */
+        unsigned nworkers;                    /* # of threads doing I/O    */
+        unsigned w;                           /* Local index variable      */
+
+        /* Check the pieces against the members' EOAs, as H5FDread/write
+         * would, since the member callbacks are called directly
+         */
+        for (u = 0; u < npieces; u++) {
+            H5FD_t *memb = file->memb[pieces[u].memb];
+            haddr_t eoa  = (memb->cls->get_eoa)(memb, pieces[u].type);
+
+            if (HADDR_UNDEF == eoa || pieces[u].addr + pieces[u].size > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                            "addr overflow, member = %u, addr = %llu, size = %llu, eoa = %llu",
+                            pieces[u].memb, (unsigned long long)pieces[u].addr,
+                            (unsigned long long)pieces[u].size, (unsigned long long)eoa)
+            first_memb = MIN(first_memb, pieces[u].memb);
+            last_memb  = MAX(last_memb, pieces[u].memb);
+        } /* end for */
+        nworkers = MIN(file->nthreads, (last_memb - first_memb) + 1);
+
+        if (NULL == (workers = (H5FD_family_worker_t *)H5MM_malloc(nworkers * sizeof(H5FD_family_worker_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread work descriptions")
+        if (NULL == (threads = (pthread_t *)H5MM_malloc(nworkers * sizeof(pthread_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread handles")
+        if (NULL == (started = (hbool_t *)H5MM_calloc(nworkers * sizeof(hbool_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread flags")
+
+        for (w = 0; w < nworkers; w++) {
+            workers[w].file     = file;
+            workers[w].pieces   = pieces;
+            workers[w].npieces  = npieces;
+            workers[w].first    = w;
+            workers[w].stride   = nworkers;
+            workers[w].dxpl_id  = dxpl_id;
+            workers[w].do_write = do_write;
+            workers[w].failed   = 0;
+        } /* end for */
+
+        /* Start the extra threads, then do the first share of the work here */
+        for (w = 1; w < nworkers; w++)
+            if (0 == pthread_create(&threads[w], NULL, H5FD__family_worker, &workers[w]))
+                started[w] = TRUE;
+        H5FD__family_worker(&workers[0]);
+
+        /* Wait for the other threads, or do their work if they didn't start */
+        for (w = 1; w < nworkers; w++) {
+            if (started[w])
+                pthread_join(threads[w], NULL);
+            else
+                H5FD__family_worker(&workers[w]);
+        } /* end for */
+
+        /* Report the first failure, which the threads couldn't */
+        for (w = 0; w < nworkers; w++)
+            if (workers[w].failed) {
+                if (do_write)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                                "member file write failed, errno = %d, error message = '%s'",
+                                workers[w].failed, HDstrerror(workers[w].failed))
+                else
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                                "member file read failed, errno = %d, error message = '%s'",
+                                workers[w].failed, HDstrerror(workers[w].failed))
+            } /* end if */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
+    /* Transfer the pieces one after the other */
+    for (u = 0; u < npieces; u++) {
+        if (do_write) {
+            if (H5FDwrite(file->memb[pieces[u].memb], pieces[u].type, dxpl_id, pieces[u].addr,
+                          pieces[u].size, pieces[u].buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+        } /* end if */
+        else {
+            if (H5FDread(file->memb[pieces[u].memb], pieces[u].type, dxpl_id, pieces[u].addr,
+                         pieces[u].size, pieces[u].buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+        } /* end else */
+    }     /* end for */
+
+done:
+    H5MM_xfree(pieces);
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+    H5MM_xfree(workers);
+    H5MM_xfree(threads);
+    H5MM_xfree(started);
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_io() */
+
+#ifdef H5FD_FAMILY_CONCURRENT_IO
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_can_run_concurrent
+ *
+ * Purpose:     Checks whether the NPIECES pieces in PIECES can be issued
+ *              to their members from several threads: they must be on
+ *              more than one member, and all those members must use the
+ *              sec2 driver.  The sec2 I/O callbacks only change the state
+ *              of the file they are called on, so one thread per member
+ *              is safe, as long as the errors they raise aren't pushed on
+ *              the library's error stack, which isn't safe to use from
+ *              several threads: H5FD__family_worker() drops them.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__family_can_run_concurrent(const H5FD_family_t *file, const H5FD_family_piece_t *pieces, size_t npieces)
+{
+    hid_t   sec2_id;           /* ID of the sec2 driver            */
+    hbool_t several = FALSE;   /* Whether several members are used */
+    size_t  u;                 /* Local index variable             */
+    hbool_t ret_value = TRUE;  /* Return value                     */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    sec2_id = H5FD_SEC2;
+    for (u = 0; u < npieces; u++) {
+        if (file->memb[pieces[u].memb]->driver_id != sec2_id)
+            HGOTO_DONE(FALSE)
+        if (pieces[u].memb != pieces[0].memb)
+            several = TRUE;
+    } /* end for */
+    ret_value = several;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_can_run_concurrent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_worker
+ *
+ * Purpose:     Thread start routine for concurrent member I/O: transfers
+ *              the pieces whose member index is 'first' modulo 'stride',
+ *              stopping at the first failure.
+ *
+ *              This runs outside of the library's API context, so it
+ *              doesn't use the FUNC_ENTER macros and calls the members'
+ *              I/O callbacks directly.  The errors those raise are
+ *              dropped rather than pushed on the error stack; a failure
+ *              is passed back as errno in 'failed' instead.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__family_worker(void *_worker)
+{
+    H5FD_family_worker_t *worker = (H5FD_family_worker_t *)_worker;
+    hbool_t               prev_suppress;
+    size_t                u;
+
+    if (H5E_suppress_thread_push(TRUE, &prev_suppress) < 0) {
+        worker->failed = errno;
+        return NULL;
+    } /* end if */
+
+    for (u = 0; u < worker->npieces; u++) {
+        const H5FD_family_piece_t *piece = &worker->pieces[u];
+        H5FD_t *                   memb;
+        herr_t                     status;
+
+        if (piece->memb % worker->stride != worker->first)
+            continue;
+
+        memb  = worker->file->memb[piece->memb];
+        errno = 0;
+        if (worker->do_write)
+            status =
+                (memb->cls->write)(memb, piece->type, worker->dxpl_id, piece->addr, piece->size, piece->buf);
+        else
+            status =
+                (memb->cls->read)(memb, piece->type, worker->dxpl_id, piece->addr, piece->size, piece->buf);
+        if (status < 0) {
+            worker->failed = errno ? errno : EIO;
+            break;
+        } /* end if */
+    }     /* end for */
+
+    H5E_suppress_thread_push(prev_suppress, NULL);
+
+    return NULL;
+} /* end H5FD__family_worker() */
+#endif /* H5FD_FAMILY_CONCURRENT_IO */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__family_flush
  *
@@ -22,6 +22,9 @@
 
 #define H5FD_FAMILY (H5FD_family_init())
 
+/* Largest number of threads accepted by H5Pset_fapl_family_concurrency */
+#define H5FD_FAMILY_THREADS_MAX 64
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +32,8 @@ extern "C" {
 H5_DLL hid_t  H5FD_family_init(void);
 H5_DLL herr_t H5Pset_fapl_family(hid_t fapl_id, hsize_t memb_size, hid_t memb_fapl_id);
 H5_DLL herr_t H5Pget_fapl_family(hid_t fapl_id, hsize_t *memb_size /*out*/, hid_t *memb_fapl_id /*out*/);
+H5_DLL herr_t H5Pset_fapl_family_concurrency(hid_t fapl_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_fapl_family_concurrency(hid_t fapl_id, unsigned *nthreads /*out*/);
 
 #ifdef __cplusplus
 }
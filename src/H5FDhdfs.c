@@ -311,7 +311,9 @@ static const H5FD_class_t H5FD_hdfs_g = {
     H5FD__hdfs_truncate,      /* truncate             */
     H5FD__hdfs_lock,          /* lock                 */
     H5FD__hdfs_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,     /* fl_map               */
+    NULL,                     /* read_vector          */
+    NULL                      /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_hdfs_t struct */
@@ -243,6 +243,187 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_vector
+ *
+ * Purpose:     Private version of H5FDread_vector()
+ *
+ *              Reads COUNT extents described by the TYPES, ADDRS and
+ *              SIZES arrays into the buffers in BUFS.  If the driver
+ *              provides a 'read_vector' callback the whole list is handed
+ *              to it in one call, otherwise each extent is dispatched to
+ *              the driver's 'read' callback in turn.
+ *
+ *              The addresses in ADDRS are relative to the base address
+ *              for the file.  They are adjusted in place for the duration
+ *              of the call and restored before returning.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                 void *bufs[] /*out*/)
+{
+    hid_t    dxpl_id;                  /* DXPL for operation */
+    uint32_t u;                        /* Local index variable */
+    hbool_t  addrs_adjusted = FALSE;   /* Whether the base address was added to the addresses */
+    herr_t   ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert((types && addrs && sizes && bufs) || 0 == count);
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* The no-op case */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check each extent against the EOA, unless the file is open for SWMR
+     * read access (see comment in H5FD_read())
+     */
+    if (!(file->access_flags & H5F_ACC_SWMR_READ))
+        for (u = 0; u < count; u++) {
+            haddr_t eoa;
+
+            HDassert(bufs[u] || 0 == sizes[u]);
+
+            if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+            if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                            "addr overflow, u = %lu, addr = %llu, size = %llu, eoa = %llu", (unsigned long)u,
+                            (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                            (unsigned long long)eoa)
+        } /* end for */
+
+    if (file->cls->read_vector) {
+        /* Convert to absolute file addresses for the driver */
+        if (file->base_addr > 0) {
+            for (u = 0; u < count; u++)
+                addrs[u] += file->base_addr;
+            addrs_adjusted = TRUE;
+        } /* end if */
+
+        /* Dispatch to driver */
+        if ((file->cls->read_vector)(file, dxpl_id, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read vector request failed")
+    } /* end if */
+    else
+        /* Fall back to one driver read per extent */
+        for (u = 0; u < count; u++) {
+            if (0 == sizes[u])
+                continue;
+            if ((file->cls->read)(file, types[u], dxpl_id, addrs[u] + file->base_addr, sizes[u], bufs[u]) <
+                0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+        } /* end for */
+
+done:
+    /* Restore the caller's relative addresses */
+    if (addrs_adjusted)
+        for (u = 0; u < count; u++)
+            addrs[u] -= file->base_addr;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_vector
+ *
+ * Purpose:     Private version of H5FDwrite_vector()
+ *
+ *              Writes COUNT extents described by the TYPES, ADDRS and
+ *              SIZES arrays from the buffers in BUFS.  If the driver
+ *              provides a 'write_vector' callback the whole list is
+ *              handed to it in one call, otherwise each extent is
+ *              dispatched to the driver's 'write' callback in turn.
+ *
+ *              The addresses in ADDRS are relative to the base address
+ *              for the file.  They are adjusted in place for the duration
+ *              of the call and restored before returning.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                  const void *bufs[])
+{
+    hid_t    dxpl_id;                  /* DXPL for operation */
+    uint32_t u;                        /* Local index variable */
+    hbool_t  addrs_adjusted = FALSE;   /* Whether the base address was added to the addresses */
+    herr_t   ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert((types && addrs && sizes && bufs) || 0 == count);
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* The no-op case */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check each extent against the EOA */
+    for (u = 0; u < count; u++) {
+        haddr_t eoa;
+
+        HDassert(bufs[u] || 0 == sizes[u]);
+
+        if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+        if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                        "addr overflow, u = %lu, addr = %llu, size = %llu, eoa = %llu", (unsigned long)u,
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                        (unsigned long long)eoa)
+    } /* end for */
+
+    if (file->cls->write_vector) {
+        /* Convert to absolute file addresses for the driver */
+        if (file->base_addr > 0) {
+            for (u = 0; u < count; u++)
+                addrs[u] += file->base_addr;
+            addrs_adjusted = TRUE;
+        } /* end if */
+
+        /* Dispatch to driver */
+        if ((file->cls->write_vector)(file, dxpl_id, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write vector request failed")
+    } /* end if */
+    else
+        /* Fall back to one driver write per extent */
+        for (u = 0; u < count; u++) {
+            if (0 == sizes[u])
+                continue;
+            if ((file->cls->write)(file, types[u], dxpl_id, addrs[u] + file->base_addr, sizes[u], bufs[u]) <
+                0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+        } /* end for */
+
+done:
+    /* Restore the caller's relative addresses */
+    if (addrs_adjusted)
+        for (u = 0; u < count; u++)
+            addrs[u] -= file->base_addr;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
  *
@@ -132,6 +132,12 @@ typedef struct H5FD_log_t {
     size_t             iosize;              /* Size of I/O information buffers                  */
     FILE *             logfp;               /* Log file pointer                                 */
     H5FD_log_fapl_t    fa;                  /* Driver-specific file access properties           */
+
+    /* Fields for the binary trace (H5FD_LOG_BINARY_TRACE) */
+    H5FD_log_trace_record_t *trace_buf;   /* Buffered records, written out when full          */
+    size_t                   trace_max;   /* Capacity of trace_buf, in records                */
+    size_t                   trace_nused; /* Number of records currently in trace_buf         */
+    uint64_t                 trace_t0;    /* Clock value when the file was opened, in ns      */
 } H5FD_log_t;
 
 /*
@@ -178,6 +184,13 @@ static herr_t  H5FD__log_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
 static herr_t  H5FD__log_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__log_unlock(H5FD_t *_file);
 
+static uint64_t H5FD__log_trace_now(void);
+static herr_t   H5FD__log_trace_open(H5FD_log_t *file);
+static herr_t   H5FD__log_trace_flush(H5FD_log_t *file);
+static herr_t   H5FD__log_trace_close(H5FD_log_t *file);
+static herr_t   H5FD__log_trace_add(H5FD_log_t *file, uint8_t op, H5FD_mem_t type, haddr_t addr, size_t size,
+                                    uint64_t start_ns);
+
 static const H5FD_class_t H5FD_log_g = {
     "log",                   /* name			*/
     MAXADDR,                 /* maxaddr		*/
@@ -210,7 +223,9 @@ static const H5FD_class_t H5FD_log_g = {
     H5FD__log_truncate,      /* truncate		*/
     H5FD__log_lock,          /* lock                 */
     H5FD__log_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY     /* fl_map		*/
+    H5FD_FLMAP_DICHOTOMY,    /* fl_map		*/
+    NULL,                    /* read_vector          */
+    NULL                     /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_log_t struct */
@@ -587,8 +602,13 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
         file->fa.logfile = NULL;
     file->fa.buf_size = fa->buf_size;
 
-    /* Check if we are doing any logging at all */
-    if (file->fa.flags != 0) {
+    /* Check if we are writing a binary trace, which replaces all text logging */
+    if (file->fa.flags & H5FD_LOG_BINARY_TRACE) {
+        file->fa.flags = H5FD_LOG_BINARY_TRACE;
+        if (H5FD__log_trace_open(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to start binary trace")
+    } /* end if */
+    else if (file->fa.flags != 0) {
         /* Allocate buffers for tracking file accesses and data "flavor" */
         file->iosize = fa->buf_size;
         if (file->fa.flags & H5FD_LOG_FILE_READ) {
@@ -654,8 +674,15 @@ done:
     if (NULL == ret_value) {
         if (fd >= 0)
             HDclose(fd);
-        if (file)
+        if (file) {
+            if (file->trace_buf)
+                file->trace_buf = (H5FD_log_trace_record_t *)H5MM_xfree(file->trace_buf);
+            if (file->logfp && file->logfp != stderr)
+                HDfclose(file->logfp);
+            if (file->fa.logfile)
+                file->fa.logfile = (char *)H5MM_xfree(file->fa.logfile);
             file = H5FL_FREE(H5FD_log_t, file);
+        } /* end if */
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -700,8 +727,15 @@ H5FD__log_close(H5FD_t *_file)
     if (file->fa.flags & H5FD_LOG_TIME_CLOSE)
         H5_timer_stop(&close_timer);
 
+    /* Write out any buffered trace records (keep going on failure, so the
+     * rest of the file's resources are still released)
+     */
+    if (file->fa.flags & H5FD_LOG_BINARY_TRACE) {
+        if (H5FD__log_trace_close(file) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to finish binary trace")
+    } /* end if */
     /* Dump I/O information */
-    if (file->fa.flags != 0) {
+    else if (file->fa.flags != 0) {
         haddr_t       addr;
         haddr_t       last_addr;
         unsigned char last_val;
@@ -1179,6 +1213,7 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
     haddr_t       orig_addr = addr;
     H5_timer_t    read_timer; /* Timer for read operation */
     H5_timevals_t read_times; /* Elapsed time for read operation */
+    uint64_t      trace_start = 0; /* Start time for binary trace record */
 #ifndef H5_HAVE_PREADWRITE
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
@@ -1253,6 +1288,8 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
 #endif /* H5_HAVE_PREADWRITE */
 
     /* Start timer for read operation */
+    if (file->fa.flags & H5FD_LOG_BINARY_TRACE)
+        trace_start = H5FD__log_trace_now();
     if (file->fa.flags & H5FD_LOG_TIME_READ) {
         H5_timer_init(&read_timer);
         H5_timer_start(&read_timer);
@@ -1356,6 +1393,11 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
             HDfprintf(file->logfp, "\n");
     } /* end if */
 
+    /* Record the read in the binary trace */
+    if (file->fa.flags & H5FD_LOG_BINARY_TRACE)
+        if (H5FD__log_trace_add(file, H5FD_LOG_TRACE_OP_READ, type, orig_addr, orig_size, trace_start) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to record read in binary trace")
+
     /* Update current position */
     file->pos = addr;
     file->op  = OP_READ;
@@ -1393,6 +1435,7 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     haddr_t       orig_addr = addr;
     H5_timer_t    write_timer; /* Timer for write operation */
     H5_timevals_t write_times; /* Elapsed time for write operation */
+    uint64_t      trace_start = 0; /* Start time for binary trace record */
 #ifndef H5_HAVE_PREADWRITE
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
@@ -1475,6 +1518,8 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
 #endif /* H5_HAVE_PREADWRITE */
 
     /* Start timer for write operation */
+    if (file->fa.flags & H5FD_LOG_BINARY_TRACE)
+        trace_start = H5FD__log_trace_now();
     if (file->fa.flags & H5FD_LOG_TIME_WRITE) {
         H5_timer_init(&write_timer);
         H5_timer_start(&write_timer);
@@ -1571,6 +1616,11 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
             HDfprintf(file->logfp, "\n");
     } /* end if */
 
+    /* Record the write in the binary trace */
+    if (file->fa.flags & H5FD_LOG_BINARY_TRACE)
+        if (H5FD__log_trace_add(file, H5FD_LOG_TRACE_OP_WRITE, type, orig_addr, orig_size, trace_start) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to record write in binary trace")
+
     /* Update current position and eof */
     file->pos = addr;
     file->op  = OP_WRITE;
@@ -1612,10 +1662,13 @@ H5FD__log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
 
     /* Extend the file to make sure it's large enough */
     if (!H5F_addr_eq(file->eoa, file->eof)) {
-        H5_timer_t    trunc_timer; /* Timer for truncate operation */
-        H5_timevals_t trunc_times; /* Elapsed time for truncate operation */
+        H5_timer_t    trunc_timer;     /* Timer for truncate operation */
+        H5_timevals_t trunc_times;     /* Elapsed time for truncate operation */
+        uint64_t      trace_start = 0; /* Start time for binary trace record */
 
         /* Start timer for truncate operation */
+        if (file->fa.flags & H5FD_LOG_BINARY_TRACE)
+            trace_start = H5FD__log_trace_now();
         if (file->fa.flags & H5FD_LOG_TIME_TRUNCATE) {
             H5_timer_init(&trunc_timer);
             H5_timer_start(&trunc_timer);
@@ -1682,6 +1735,12 @@ H5FD__log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
                 HDfprintf(file->logfp, "\n");
         } /* end if */
 
+        /* Record the truncate in the binary trace */
+        if (file->fa.flags & H5FD_LOG_BINARY_TRACE)
+            if (H5FD__log_trace_add(file, H5FD_LOG_TRACE_OP_TRUNCATE, H5FD_MEM_DEFAULT, file->eoa, (size_t)0,
+                                    trace_start) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to record truncate in binary trace")
+
         /* Update the eof value */
         file->eof = file->eoa;
 
@@ -1772,3 +1831,195 @@ H5FD__log_unlock(H5FD_t *_file)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_now
+ *
+ * Purpose:     Read the monotonic clock used to time binary trace records.
+ *
+ * Return:      Current time, in nanoseconds (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5FD__log_trace_now(void)
+{
+    uint64_t now = 0; /* Current time, in nanoseconds */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#if defined(H5_HAVE_CLOCK_GETTIME)
+    {
+        struct timespec ts;
+
+        HDclock_gettime(CLOCK_MONOTONIC, &ts);
+        now = ((uint64_t)ts.tv_sec * (uint64_t)1000000000) + (uint64_t)ts.tv_nsec;
+    }
+#else  /* H5_HAVE_CLOCK_GETTIME */
+    now = H5_now_usec() * (uint64_t)1000;
+#endif /* H5_HAVE_CLOCK_GETTIME */
+
+    FUNC_LEAVE_NOAPI(now)
+} /* end H5FD__log_trace_now() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_open
+ *
+ * Purpose:     Set up binary tracing for a newly opened file: open the
+ *              trace file, write its header and allocate the record
+ *              buffer.
+ *
+ *              The stdio buffer of the trace file is disabled, since
+ *              records are already accumulated in the driver's own buffer
+ *              and written out in a single call when it fills up.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_trace_open(H5FD_log_t *file)
+{
+    H5FD_log_trace_header_t header;              /* Trace file header */
+    size_t                  buf_size;            /* Size of the record buffer, in bytes */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(NULL == file->logfp);
+
+    if (NULL == file->fa.logfile)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "binary trace requires a log file name")
+
+    /* Size the record buffer */
+    buf_size = file->fa.buf_size > 0 ? file->fa.buf_size : H5FD_LOG_TRACE_DEFAULT_BUF_SIZE;
+    file->trace_max = MAX(1, buf_size / sizeof(H5FD_log_trace_record_t));
+    if (NULL == (file->trace_buf = (H5FD_log_trace_record_t *)H5MM_malloc(
+                     file->trace_max * sizeof(H5FD_log_trace_record_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate trace record buffer")
+    file->trace_nused = 0;
+
+    /* Open the trace file and write the header */
+    if (NULL == (file->logfp = HDfopen(file->fa.logfile, "wb")))
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open trace file")
+    HDsetvbuf(file->logfp, NULL, _IONBF, 0);
+
+    HDmemset(&header, 0, sizeof(header));
+    HDmemcpy(header.magic, H5FD_LOG_TRACE_MAGIC, (size_t)H5FD_LOG_TRACE_MAGIC_LEN);
+    header.version     = H5FD_LOG_TRACE_VERSION;
+    header.record_size = (uint32_t)sizeof(H5FD_log_trace_record_t);
+    header.byte_order  = H5FD_LOG_TRACE_BYTE_ORDER;
+    if (1 != HDfwrite(&header, sizeof(header), (size_t)1, file->logfp))
+        HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace file header")
+
+    file->trace_t0 = H5FD__log_trace_now();
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_trace_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_flush
+ *
+ * Purpose:     Write all buffered trace records to the trace file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_trace_flush(H5FD_log_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->logfp);
+
+    if (file->trace_nused > 0) {
+        if (file->trace_nused !=
+            HDfwrite(file->trace_buf, sizeof(H5FD_log_trace_record_t), file->trace_nused, file->logfp))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace records")
+        file->trace_nused = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_trace_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_close
+ *
+ * Purpose:     Write out the remaining trace records, close the trace file
+ *              and release the record buffer.  Resources are released even
+ *              when the final write fails.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_trace_close(H5FD_log_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (file->logfp) {
+        if (H5FD__log_trace_flush(file) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to flush trace records")
+        if (HDfclose(file->logfp) < 0)
+            HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close trace file")
+        file->logfp = NULL;
+    } /* end if */
+    file->trace_buf = (H5FD_log_trace_record_t *)H5MM_xfree(file->trace_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_trace_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_add
+ *
+ * Purpose:     Append a record for a completed operation to the trace
+ *              buffer, writing the buffer out when it is full.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_trace_add(H5FD_log_t *file, uint8_t op, H5FD_mem_t type, haddr_t addr, size_t size,
+                    uint64_t start_ns)
+{
+    H5FD_log_trace_record_t *rec;                 /* Record being filled in */
+    uint64_t                 end_ns;              /* Completion time of the operation */
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->trace_buf);
+    HDassert(file->trace_nused < file->trace_max);
+
+    end_ns = H5FD__log_trace_now();
+
+    rec = &file->trace_buf[file->trace_nused];
+    HDmemset(rec, 0, sizeof(*rec));
+    rec->start_ns    = start_ns - file->trace_t0;
+    rec->duration_ns = end_ns - start_ns;
+    rec->addr        = (uint64_t)addr;
+    rec->size        = (uint64_t)size;
+    rec->op          = op;
+    rec->type        = (uint8_t)type;
+
+    if (++file->trace_nused == file->trace_max)
+        if (H5FD__log_trace_flush(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to flush trace records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_trace_add() */
@@ -60,6 +60,46 @@
 #define H5FD_LOG_ALL                                                                                         \
     (H5FD_LOG_FREE | H5FD_LOG_ALLOC | H5FD_LOG_TIME_IO | H5FD_LOG_NUM_IO | H5FD_LOG_FLAVOR |                 \
      H5FD_LOG_FILE_IO | H5FD_LOG_LOC_IO | H5FD_LOG_META_IO)
+/* Flag for writing a compact binary trace of every read/write/truncate
+ * instead of text.  When set, all the text logging flags above are ignored,
+ * a log file name is required and the 'buf_size' argument to
+ * H5Pset_fapl_log() gives the size in bytes of the in-memory record buffer
+ * (0 selects H5FD_LOG_TRACE_DEFAULT_BUF_SIZE).  Not part of H5FD_LOG_ALL.
+ */
+#define H5FD_LOG_BINARY_TRACE 0x00100000
+
+/* Binary trace file layout: one H5FD_log_trace_header_t followed by a
+ * sequence of fixed-size H5FD_log_trace_record_t entries, all in the byte
+ * order of the machine that wrote the trace (see 'byte_order').
+ */
+#define H5FD_LOG_TRACE_MAGIC            "H5FDLOGT"
+#define H5FD_LOG_TRACE_MAGIC_LEN        8
+#define H5FD_LOG_TRACE_VERSION          1
+#define H5FD_LOG_TRACE_BYTE_ORDER       0x01020304
+#define H5FD_LOG_TRACE_DEFAULT_BUF_SIZE (1024 * 1024)
+
+/* Operations recorded in a binary trace */
+#define H5FD_LOG_TRACE_OP_READ     1
+#define H5FD_LOG_TRACE_OP_WRITE    2
+#define H5FD_LOG_TRACE_OP_TRUNCATE 3
+
+typedef struct H5FD_log_trace_header_t {
+    char     magic[H5FD_LOG_TRACE_MAGIC_LEN]; /* H5FD_LOG_TRACE_MAGIC, not NUL-terminated */
+    uint32_t version;                        /* H5FD_LOG_TRACE_VERSION                   */
+    uint32_t record_size;                    /* sizeof(H5FD_log_trace_record_t)          */
+    uint32_t byte_order;                     /* H5FD_LOG_TRACE_BYTE_ORDER, as written    */
+    uint32_t reserved;                       /* Zero                                     */
+} H5FD_log_trace_header_t;
+
+typedef struct H5FD_log_trace_record_t {
+    uint64_t start_ns;    /* Start of the operation, in ns since the file was opened */
+    uint64_t duration_ns; /* Time spent in the operation, in ns                      */
+    uint64_t addr;        /* File address (new EOF for truncates)                    */
+    uint64_t size;        /* Number of bytes transferred (0 for truncates)           */
+    uint8_t  op;          /* One of the H5FD_LOG_TRACE_OP_* values                   */
+    uint8_t  type;        /* H5FD_mem_t of the operation                             */
+    uint8_t  pad[6];      /* Zero                                                    */
+} H5FD_log_trace_record_t;
 
 #ifdef __cplusplus
 extern "C" {
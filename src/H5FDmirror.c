@@ -43,6 +43,13 @@ typedef struct H5FD_mirror_t {
     int                sock_fd; /* Handle of socket to remote operator    */
     H5FD_mirror_xmit_t xmit;    /* Primary communication header           */
     uint32_t           xmit_i;  /* Counter of transmission sent and rec'd */
+
+    /* Write batching (fa.write_batch_size > 0); see H5FD__mirror_batch_send() */
+    unsigned char *batch;      /* Pending BATCH xmit; encoded header first */
+    size_t         batch_used; /* Bytes of `batch` in use, header included */
+    uint32_t       batch_n;    /* Number of records in `batch`             */
+    uint32_t       n_unacked;  /* Batches sent whose reply is not yet read */
+    uint32_t       ack_i;      /* Expected xmit_count of the oldest reply  */
 } H5FD_mirror_t;
 
 /*
@@ -153,11 +160,17 @@ static herr_t  H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id,
                                   const void *buf);
 static herr_t  H5FD__mirror_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                  void *buf);
+static herr_t  H5FD__mirror_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__mirror_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__mirror_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__mirror_unlock(H5FD_t *_file);
 
+static herr_t H5FD__mirror_receive_reply(H5FD_mirror_t *file, uint32_t xmit_count);
 static herr_t H5FD__mirror_verify_reply(H5FD_mirror_t *file);
+static herr_t H5FD__mirror_batch_add(H5FD_mirror_t *file, uint8_t op, H5FD_mem_t type, haddr_t addr,
+                                     size_t size, const void *buf);
+static herr_t H5FD__mirror_batch_send(H5FD_mirror_t *file);
+static herr_t H5FD__mirror_batch_sync(H5FD_mirror_t *file);
 
 static const H5FD_class_t H5FD_mirror_g = {
     "mirror",               /* name                 */
@@ -187,11 +200,13 @@ static const H5FD_class_t H5FD_mirror_g = {
     NULL,                   /* get_handle           */
     H5FD__mirror_read,      /* read                 */
     H5FD__mirror_write,     /* write                */
-    NULL,                   /* flush                */
+    H5FD__mirror_flush,     /* flush                */
     H5FD__mirror_truncate,  /* truncate             */
     H5FD__mirror_lock,      /* lock                 */
     H5FD__mirror_unlock,    /* unlock               */
-    H5FD_FLMAP_DICHOTOMY    /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,   /* fl_map               */
+    NULL,                   /* read_vector          */
+    NULL                    /* write_vector         */
 };
 
 /* Declare a free list to manage the transmission buffers */
@@ -524,6 +539,42 @@ H5FD__mirror_xmit_encode_uint8(unsigned char *dest, uint8_t v)
     return 1;
 } /* end H5FD__mirror_xmit_encode_uint8() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_decode_batch
+ *
+ * Purpose:     Extract a mirror_xmit_batch_t from the bytes-buffer.
+ *
+ *              Fields will be lifted from the buffer and stored in the
+ *              target structure, using in the correct location (different
+ *              systems may insert different padding between components) and
+ *              word order (Big- vs Little-Endian).
+ *
+ *              The programmer must ensure that the received buffer holds
+ *              at least the expected size of data.
+ *
+ *              The resulting structure should be sanity-checked with
+ *              H5FD_mirror_xmit_is_batch() before use.
+ *
+ * Return:      The number of bytes consumed from the buffer.
+ * ---------------------------------------------------------------------------
+ */
+size_t
+H5FD_mirror_xmit_decode_batch(H5FD_mirror_xmit_batch_t *out, const unsigned char *buf)
+{
+    size_t n_eaten = 0;
+
+    LOG_OP_CALL(__func__);
+
+    HDassert(out && buf);
+
+    n_eaten += H5FD_mirror_xmit_decode_header(&(out->pub), buf);
+    n_eaten += H5FD__mirror_xmit_decode_uint32(&(out->count), &buf[n_eaten]);
+    n_eaten += H5FD__mirror_xmit_decode_uint64(&(out->size), &buf[n_eaten]);
+    HDassert(n_eaten == H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    return n_eaten;
+} /* end H5FD_mirror_xmit_decode_batch() */
+
 /* ---------------------------------------------------------------------------
  * Function:    H5FD_mirror_xmit_decode_header
  *
@@ -748,6 +799,37 @@ H5FD_mirror_xmit_decode_write(H5FD_mirror_xmit_write_t *out, const unsigned char
     return n_eaten;
 } /* end H5FD_mirror_xmit_decode_write() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_encode_batch
+ *
+ * Purpose:     Encode a mirror_xmit_batch_t to the bytes-buffer.
+ *
+ *              Fields will be packed into the buffer in a predictable manner,
+ *              any numbers stored in "network" (Big-Endian) word order.
+ *
+ *              The programmer must ensure that the destination buffer is
+ *              large enough to hold the expected data.
+ *
+ * Return:      The number of bytes written to the buffer.
+ * ---------------------------------------------------------------------------
+ */
+size_t
+H5FD_mirror_xmit_encode_batch(unsigned char *dest, const H5FD_mirror_xmit_batch_t *x)
+{
+    size_t n_writ = 0;
+
+    LOG_OP_CALL(__func__);
+
+    HDassert(dest && x);
+
+    n_writ += H5FD_mirror_xmit_encode_header(dest, (const H5FD_mirror_xmit_t *)&(x->pub));
+    n_writ += H5FD__mirror_xmit_encode_uint32(&dest[n_writ], x->count);
+    n_writ += H5FD__mirror_xmit_encode_uint64(&dest[n_writ], x->size);
+    HDassert(n_writ == H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    return n_writ;
+} /* end H5FD_mirror_xmit_encode_batch() */
+
 /* ---------------------------------------------------------------------------
  * Function:    H5FD_mirror_xmit_encode_header
  *
@@ -944,6 +1026,29 @@ H5FD_mirror_xmit_encode_write(unsigned char *dest, const H5FD_mirror_xmit_write_
     return n_writ;
 } /* end H5FD_mirror_xmit_encode_write() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_is_batch
+ *
+ * Purpose:     Verify that a mirror_xmit_batch_t is a valid BATCH xmit.
+ *
+ *              Checks header validity and op code.
+ *
+ * Return:      TRUE if valid; else FALSE.
+ * ---------------------------------------------------------------------------
+ */
+H5_ATTR_PURE hbool_t
+H5FD_mirror_xmit_is_batch(const H5FD_mirror_xmit_batch_t *xmit)
+{
+    LOG_OP_CALL(__func__);
+
+    HDassert(xmit);
+
+    if ((TRUE == H5FD_mirror_xmit_is_xmit(&(xmit->pub))) && (H5FD_MIRROR_OP_BATCH == xmit->pub.op))
+        return TRUE;
+
+    return FALSE;
+} /* end H5FD_mirror_xmit_is_batch() */
+
 /* ---------------------------------------------------------------------------
  * Function:    H5FD_mirror_xmit_is_close
  *
@@ -1107,10 +1212,11 @@ H5FD_mirror_xmit_is_xmit(const H5FD_mirror_xmit_t *xmit)
 } /* end H5FD_mirror_xmit_is_xmit() */
 
 /* ----------------------------------------------------------------------------
- * Function:    H5FD__mirror_verify_reply
+ * Function:    H5FD__mirror_receive_reply
  *
  * Purpose:     Wait for and read reply data from remote processes.
- *              Sanity-check that a reply is well-formed and valid.
+ *              Sanity-check that a reply is well-formed and valid, and that
+ *              it carries the given transmission count.
  *              If all checks pass, inspect the reply contents and handle
  *              reported error, if not an OK reply.
  *
@@ -1118,7 +1224,7 @@ H5FD_mirror_xmit_is_xmit(const H5FD_mirror_xmit_t *xmit)
  * ----------------------------------------------------------------------------
  */
 static herr_t
-H5FD__mirror_verify_reply(H5FD_mirror_t *file)
+H5FD__mirror_receive_reply(H5FD_mirror_t *file, uint32_t xmit_count)
 {
     unsigned char *                 xmit_buf = NULL;
     struct H5FD_mirror_xmit_reply_t reply;
@@ -1151,7 +1257,7 @@ H5FD__mirror_verify_reply(H5FD_mirror_t *file)
 
     if (reply.pub.session_token != file->xmit.session_token)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "wrong session");
-    if (reply.pub.xmit_count != (file->xmit_i)++)
+    if (reply.pub.xmit_count != xmit_count)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "xmit out of sync");
     if (reply.status != H5FD_MIRROR_STATUS_OK)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "%s", (const char *)(reply.message));
@@ -1160,9 +1266,186 @@ done:
     if (xmit_buf)
         xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
 
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_receive_reply() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_verify_reply
+ *
+ * Purpose:     Wait for and check the reply to the transmission just sent.
+ *              No batch replies may be outstanding.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_verify_reply(H5FD_mirror_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file && 0 == file->n_unacked);
+
+    if (H5FD__mirror_receive_reply(file, (file->xmit_i)++) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
+
+done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* end H5FD__mirror_verify_reply() */
 
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_batch_add
+ *
+ * Purpose:     Append a write or set-eoa record to the pending batch,
+ *              first sending the batch if the record would not fit.
+ *
+ *              The caller must ensure that a record of this size fits in an
+ *              empty batch.
+ *
+ * Return:      SUCCEED/FAIL
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_batch_add(H5FD_mirror_t *file, uint8_t op, H5FD_mem_t type, haddr_t addr, size_t size,
+                       const void *buf)
+{
+    unsigned char *p         = NULL;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file && file->batch);
+    HDassert(H5FD_MIRROR_BATCH_RECORD_SIZE + size <= file->fa.write_batch_size);
+    HDassert(0 == size || buf);
+
+    if (file->batch_used + H5FD_MIRROR_BATCH_RECORD_SIZE + size >
+        H5FD_MIRROR_XMIT_BATCH_SIZE + (size_t)file->fa.write_batch_size)
+        if (H5FD__mirror_batch_send(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to send batch");
+
+    p = file->batch + file->batch_used;
+    p += H5FD__mirror_xmit_encode_uint8(p, op);
+    p += H5FD__mirror_xmit_encode_uint8(p, (uint8_t)type);
+    p += H5FD__mirror_xmit_encode_uint64(p, (uint64_t)addr);
+    p += H5FD__mirror_xmit_encode_uint64(p, (uint64_t)size);
+    if (size > 0)
+        H5MM_memcpy(p, buf, size);
+
+    file->batch_used += H5FD_MIRROR_BATCH_RECORD_SIZE + size;
+    file->batch_n++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_batch_add() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_batch_send
+ *
+ * Purpose:     Transmit the pending batch, if any, without waiting for the
+ *              Writer to reply.
+ *
+ *              Each batch uses two transmission counts: its own and that of
+ *              the reply it will get. Replies arrive in the order the
+ *              batches were sent, so only the count of the oldest unread
+ *              reply (`ack_i`) need be kept. If `write_window` batches are
+ *              already unacknowledged, the oldest reply is read first.
+ *
+ * Return:      SUCCEED/FAIL
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_batch_send(H5FD_mirror_t *file)
+{
+    H5FD_mirror_xmit_batch_t xmit_batch;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file);
+
+    if (NULL == file->batch || 0 == file->batch_n)
+        HGOTO_DONE(SUCCEED);
+
+    if (file->n_unacked >= file->fa.write_window) {
+        file->n_unacked--;
+        file->ack_i += 2;
+        if (H5FD__mirror_receive_reply(file, file->ack_i - 2) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply to batch");
+    }
+
+    if (0 == file->n_unacked)
+        file->ack_i = file->xmit_i + 1;
+
+    file->xmit.xmit_count = file->xmit_i;
+    file->xmit.op         = H5FD_MIRROR_OP_BATCH;
+    file->xmit_i += 2;
+
+    xmit_batch.pub   = file->xmit;
+    xmit_batch.count = file->batch_n;
+    xmit_batch.size  = (uint64_t)(file->batch_used - H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    if (H5FD_mirror_xmit_encode_batch(file->batch, &xmit_batch) != H5FD_MIRROR_XMIT_BATCH_SIZE)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode batch");
+
+    LOG_XMIT_BYTES("batch", file->batch, H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    if (HDwrite(file->sock_fd, file->batch, file->batch_used) != (ssize_t)file->batch_used)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit batch");
+
+    file->n_unacked++;
+    file->batch_used = H5FD_MIRROR_XMIT_BATCH_SIZE;
+    file->batch_n    = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_batch_send() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_batch_sync
+ *
+ * Purpose:     Transmit the pending batch and read every outstanding batch
+ *              reply, in order. Afterwards the Writer has applied all
+ *              operations made so far and the next transmission may expect
+ *              an immediate reply.
+ *
+ * Return:      SUCCEED/FAIL
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_batch_sync(H5FD_mirror_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file);
+
+    if (H5FD__mirror_batch_send(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to send batch");
+
+    while (file->n_unacked > 0) {
+        /* Count the reply as read even if it is bad, so that a failed batch
+         * is reported only once.
+         */
+        file->n_unacked--;
+        file->ack_i += 2;
+        if (H5FD__mirror_receive_reply(file, file->ack_i - 2) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply to batch");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_batch_sync() */
+
 /* -------------------------------------------------------------------------
  * Function:    H5FD__mirror_fapl_get
  *
@@ -1266,7 +1549,10 @@ H5FD__mirror_fapl_free(void *_fa)
  * Function:    H5Pget_fapl_mirror
  *
  * Purpose:     Get the configuration information for this fapl.
- *              Data is memcopied into the fa_dst pointer.
+ *              Data is copied into the fa_dst pointer. The batching
+ *              fields are only filled in when fa_dst arrives with a valid
+ *              magic number and a version of 2 or later; otherwise it is
+ *              taken to be a version 1 structure.
  *
  * Return:      SUCCEED/FAIL
  * -------------------------------------------------------------------------
@@ -1274,9 +1560,10 @@ H5FD__mirror_fapl_free(void *_fa)
 herr_t
 H5Pget_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa_dst /*out*/)
 {
-    const H5FD_mirror_fapl_t *fa_src    = NULL;
-    H5P_genplist_t *          plist     = NULL;
-    herr_t                    ret_value = SUCCEED;
+    const H5FD_mirror_fapl_t *fa_src      = NULL;
+    H5P_genplist_t *          plist       = NULL;
+    uint32_t                  dst_version = 1;
+    herr_t                    ret_value   = SUCCEED;
 
     FUNC_ENTER_API(FAIL)
     H5TRACE2("e", "ix", fapl_id, fa_dst);
@@ -1298,7 +1585,21 @@ H5Pget_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa_dst /*out*/)
 
     HDassert(fa_src->magic == H5FD_MIRROR_FAPL_MAGIC); /* sanity check */
 
-    H5MM_memcpy(fa_dst, fa_src, sizeof(H5FD_mirror_fapl_t));
+    /* A caller's structure is only known to hold the version 2 fields if it
+     * says so; anything else is treated as a version 1 structure.
+     */
+    if (H5FD_MIRROR_FAPL_MAGIC == fa_dst->magic && fa_dst->version >= 2 &&
+        fa_dst->version <= H5FD_MIRROR_CURR_FAPL_T_VERSION)
+        dst_version = fa_dst->version;
+
+    fa_dst->magic          = fa_src->magic;
+    fa_dst->version        = MIN(fa_src->version, dst_version);
+    fa_dst->handshake_port = fa_src->handshake_port;
+    H5MM_memcpy(fa_dst->remote_ip, fa_src->remote_ip, sizeof(fa_dst->remote_ip));
+    if (dst_version >= 2) {
+        fa_dst->write_batch_size = fa_src->write_batch_size;
+        fa_dst->write_window     = fa_src->write_window;
+    }
 
 done:
     FUNC_LEAVE_API(ret_value);
@@ -1316,8 +1617,9 @@ done:
 herr_t
 H5Pset_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa)
 {
-    H5P_genplist_t *plist     = NULL;
-    herr_t          ret_value = FAIL;
+    H5FD_mirror_fapl_t fa_copy;
+    H5P_genplist_t *   plist     = NULL;
+    herr_t             ret_value = FAIL;
 
     FUNC_ENTER_API(FAIL)
     H5TRACE2("e", "i*#", fapl_id, fa);
@@ -1331,10 +1633,33 @@ H5Pset_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null fapl_t pointer");
     if (H5FD_MIRROR_FAPL_MAGIC != fa->magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid fapl_t magic");
-    if (H5FD_MIRROR_CURR_FAPL_T_VERSION != fa->version)
+    if (fa->version < 1 || fa->version > H5FD_MIRROR_CURR_FAPL_T_VERSION)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown fapl_t version");
 
-    ret_value = H5P_set_driver(plist, H5FD_MIRROR, (const void *)fa);
+    /* Copy only the fields present in the caller's version of the structure */
+    fa_copy.magic          = fa->magic;
+    fa_copy.version        = fa->version;
+    fa_copy.handshake_port = fa->handshake_port;
+    H5MM_memcpy(fa_copy.remote_ip, fa->remote_ip, sizeof(fa_copy.remote_ip));
+    if (fa->version >= 2) {
+        fa_copy.write_batch_size = fa->write_batch_size;
+        fa_copy.write_window     = fa->write_window;
+    }
+    else {
+        /* Version 1 structures have no batching fields */
+        fa_copy.write_batch_size = 0;
+        fa_copy.write_window     = 0;
+    }
+
+    if (fa_copy.write_batch_size > 0) {
+        if (fa_copy.write_batch_size < H5FD_MIRROR_BATCH_RECORD_SIZE ||
+            fa_copy.write_batch_size > H5FD_MIRROR_WRITE_BATCH_MAX)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write_batch_size out of range");
+        if (0 == fa_copy.write_window)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write_window must be positive when batching");
+    }
+
+    ret_value = H5P_set_driver(plist, H5FD_MIRROR, (const void *)&fa_copy);
 
 done:
     FUNC_LEAVE_API(ret_value)
@@ -1383,11 +1708,13 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     if (ADDR_OVERFLOW(maxaddr))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
 
+    fa.magic   = H5FD_MIRROR_FAPL_MAGIC;
+    fa.version = H5FD_MIRROR_CURR_FAPL_T_VERSION;
     if (H5Pget_fapl_mirror(fapl_id, &fa) == FAIL)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "can't get config info");
     if (H5FD_MIRROR_FAPL_MAGIC != fa.magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid fapl magic");
-    if (H5FD_MIRROR_CURR_FAPL_T_VERSION != fa.version)
+    if (fa.version < 1 || fa.version > H5FD_MIRROR_CURR_FAPL_T_VERSION)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid fapl version");
 
     /* --------------------- */
@@ -1417,6 +1744,14 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
 
     file->sock_fd = live_socket;
     file->xmit_i  = 0;
+    H5MM_memcpy(&(file->fa), &fa, sizeof(H5FD_mirror_fapl_t));
+
+    if (fa.write_batch_size > 0) {
+        file->batch = (unsigned char *)H5MM_malloc(H5FD_MIRROR_XMIT_BATCH_SIZE + (size_t)fa.write_batch_size);
+        if (NULL == file->batch)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate batch buffer");
+        file->batch_used = H5FD_MIRROR_XMIT_BATCH_SIZE;
+    }
 
     file->xmit.magic         = H5FD_MIRROR_XMIT_MAGIC;
     file->xmit.version       = H5FD_MIRROR_XMIT_CURR_VERSION;
@@ -1454,8 +1789,10 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
 
 done:
     if (NULL == ret_value) {
-        if (file)
+        if (file) {
+            H5MM_xfree(file->batch);
             file = H5FL_FREE(H5FD_mirror_t, file);
+        }
         if (live_socket >= 0 && HDclose(live_socket) < 0)
             HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "can't close socket");
     }
@@ -1499,6 +1836,9 @@ H5FD__mirror_close(H5FD_t *_file)
     HDassert(file);
     HDassert(file->sock_fd >= 0);
 
+    if (H5FD__mirror_batch_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete batched writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_CLOSE;
 
@@ -1544,6 +1884,7 @@ done:
                 HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close socket");
     } /* end if error */
 
+    H5MM_xfree(file->batch);
     file = H5FL_FREE(H5FD_mirror_t, file); /* always release resources */
 
     if (xmit_buf)
@@ -1635,6 +1976,13 @@ H5FD__mirror_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 
     file->eoa = addr; /* local copy */
 
+    /* Keep the eoa in order with batched writes, without a round trip */
+    if (file->batch) {
+        if (H5FD__mirror_batch_add(file, H5FD_MIRROR_OP_SET_EOA, type, addr, 0, NULL) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to batch set-eoa");
+        HGOTO_DONE(SUCCEED);
+    }
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_SET_EOA;
 
@@ -1722,7 +2070,12 @@ H5FD__mirror_read(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type,
  *              Both transmission expect an OK reply from the Writer.
  *              This two-exchange approach incurs significant overhead,
  *              but is a simple and modular approach.
- *              Start optimizations here.
+ *
+ *              If batching is configured, a write small enough to fit in the
+ *              batch buffer is instead copied there, to be sent together
+ *              with others and acknowledged later (see
+ *              H5FD__mirror_batch_send()). Any outstanding batches are
+ *              completed before a large write is sent the usual way.
  *
  * Return:      SUCCEED/FAIL
  *-------------------------------------------------------------------------
@@ -1743,6 +2096,16 @@ H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
     HDassert(file);
     HDassert(buf);
 
+    if (file->batch) {
+        if (size <= (size_t)file->fa.write_batch_size - H5FD_MIRROR_BATCH_RECORD_SIZE) {
+            if (H5FD__mirror_batch_add(file, H5FD_MIRROR_OP_WRITE, type, addr, size, buf) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to batch write");
+            HGOTO_DONE(SUCCEED);
+        }
+        if (H5FD__mirror_batch_sync(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete batched writes");
+    }
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_WRITE;
 
@@ -1783,6 +2146,34 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__mirror_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mirror_flush
+ *
+ * Purpose:     Sends any pending batch of writes and waits until the Writer
+ *              has acknowledged every batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_mirror_t *file      = (H5FD_mirror_t *)_file;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file);
+
+    if (H5FD__mirror_batch_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete batched writes");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mirror_truncate
  *
@@ -1803,6 +2194,9 @@ H5FD__mirror_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_AT
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_batch_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete batched writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_TRUNCATE;
 
@@ -1851,6 +2245,9 @@ H5FD__mirror_lock(H5FD_t *_file, hbool_t rw)
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_batch_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete batched writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_LOCK;
 
@@ -1898,6 +2295,9 @@ H5FD__mirror_unlock(H5FD_t *_file)
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_batch_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete batched writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_UNLOCK;
 
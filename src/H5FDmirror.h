@@ -49,16 +49,38 @@ extern "C" {
  *
  * `remote_ip` (char[])
  *      IP address string of "Mirror Server" remote host.
+ *
+ * `write_batch_size` (uint32_t)
+ *      (Version 2 and later.)
+ *      Size in bytes of the buffer in which small writes are gathered, to
+ *      be sent to the remote Writer in one transmission. A write which does
+ *      not fit in the buffer on its own is sent by itself, as without
+ *      batching. Must not exceed H5FD_MIRROR_WRITE_BATCH_MAX.
+ *      0 (the default) sends every write by itself and waits for the
+ *      Writer's replies, as older Writers expect.
+ *
+ * `write_window` (uint32_t)
+ *      (Version 2 and later.)
+ *      Number of batches which may be sent before the Writer's reply to the
+ *      oldest one is read. Must be at least 1 when write_batch_size is set.
+ *      Changes to the EOA travel in the batches with the writes. All
+ *      outstanding replies are read, in order, at flush and before any other
+ *      operation (such as truncating or closing) is sent, so the remote file
+ *      sees all operations in the order they were made. A failure in a
+ *      batched write is reported by the next operation which reads replies.
  * ---------------------------------------------------------------------------
  */
 #define H5FD_MIRROR_FAPL_MAGIC          0xF8DD514C
-#define H5FD_MIRROR_CURR_FAPL_T_VERSION 1
+#define H5FD_MIRROR_CURR_FAPL_T_VERSION 2
 #define H5FD_MIRROR_MAX_IP_LEN          32
+#define H5FD_MIRROR_WRITE_BATCH_MAX     (64 * 1024 * 1024)
 typedef struct H5FD_mirror_fapl_t {
     uint32_t magic;
     uint32_t version;
     int      handshake_port;
     char     remote_ip[H5FD_MIRROR_MAX_IP_LEN + 1];
+    uint32_t write_batch_size;
+    uint32_t write_window;
 } H5FD_mirror_fapl_t;
 
 H5_DLL hid_t  H5FD_mirror_init(void);
@@ -44,6 +44,7 @@ extern "C" {
 #define H5FD_MIRROR_OP_SET_EOA  6
 #define H5FD_MIRROR_OP_LOCK     7
 #define H5FD_MIRROR_OP_UNLOCK   8
+#define H5FD_MIRROR_OP_BATCH    9
 
 #define H5FD_MIRROR_STATUS_OK          0
 #define H5FD_MIRROR_STATUS_ERROR       1
@@ -65,11 +66,17 @@ extern "C" {
 #define H5FD_MIRROR_XMIT_OPEN_SIZE   (H5FD_MIRROR_XMIT_HEADER_SIZE + 20 + H5FD_MIRROR_XMIT_FILEPATH_MAX)
 #define H5FD_MIRROR_XMIT_REPLY_SIZE  (H5FD_MIRROR_XMIT_HEADER_SIZE + 4 + H5FD_MIRROR_STATUS_MESSAGE_MAX)
 #define H5FD_MIRROR_XMIT_WRITE_SIZE  (H5FD_MIRROR_XMIT_HEADER_SIZE + 17)
+#define H5FD_MIRROR_XMIT_BATCH_SIZE  (H5FD_MIRROR_XMIT_HEADER_SIZE + 12)
+
+/* Size of the fixed part of each record in a batch payload.
+ * See H5FD_mirror_xmit_batch_t. */
+#define H5FD_MIRROR_BATCH_RECORD_SIZE 18
 
 /* Maximum length of any xmit. */
 #define H5FD_MIRROR_XMIT_BUFFER_MAX                                                                          \
-    MAX2(MAX3(H5FD_MIRROR_XMIT_HEADER_SIZE, H5FD_MIRROR_XMIT_EOA_SIZE, H5FD_MIRROR_XMIT_LOCK_SIZE),          \
-         MAX3(H5FD_MIRROR_XMIT_OPEN_SIZE, H5FD_MIRROR_XMIT_REPLY_SIZE, H5FD_MIRROR_XMIT_WRITE_SIZE))
+    MAX3(MAX3(H5FD_MIRROR_XMIT_HEADER_SIZE, H5FD_MIRROR_XMIT_EOA_SIZE, H5FD_MIRROR_XMIT_LOCK_SIZE),          \
+         MAX3(H5FD_MIRROR_XMIT_OPEN_SIZE, H5FD_MIRROR_XMIT_REPLY_SIZE, H5FD_MIRROR_XMIT_WRITE_SIZE),         \
+         H5FD_MIRROR_XMIT_BATCH_SIZE)
 
 /* ---------------------------------------------------------------------------
  * Structure:   H5FD_mirror_xmit_t
@@ -267,6 +274,40 @@ typedef struct H5FD_mirror_xmit_write_t {
     uint64_t           size;
 } H5FD_mirror_xmit_write_t;
 
+/* ---------------------------------------------------------------------------
+ * Structure:   H5FD_mirror_xmit_batch_t
+ *
+ * Structure describing a batch of deferred operations from the VFD sender.
+ *
+ * The header is immediately followed by `size` bytes of payload: a packed
+ * sequence of `count` records, each of which is
+ *
+ *      op     (uint8_t)  -- H5FD_MIRROR_OP_WRITE or H5FD_MIRROR_OP_SET_EOA
+ *      type   (uint8_t)  -- H5FD_mem_t of the write or eoa
+ *      addr   (uint64_t) -- write offset or new eoa
+ *      size   (uint64_t) -- length of the write data; zero for set-eoa
+ *
+ * with the data of a write following its record directly.
+ * The records are applied in order and acknowledged by a single reply.
+ *
+ * `pub` (H5FD_mirror_xmit_t)
+ *      Common transmission header, containing session information.
+ *      Must be first.
+ *
+ * `count` (uint32_t)
+ *      Number of records in the payload.
+ *
+ * `size` (uint64_t)
+ *      Length of the payload in bytes, records and data included.
+ *
+ * ---------------------------------------------------------------------------
+ */
+typedef struct H5FD_mirror_xmit_batch_t {
+    H5FD_mirror_xmit_t pub;
+    uint32_t           count;
+    uint64_t           size;
+} H5FD_mirror_xmit_batch_t;
+
 /* Encode/decode routines are required to "pack" the xmit data into a known
  * byte format for transmission over the wire.
  *
@@ -286,6 +327,7 @@ H5_DLL size_t H5FD__mirror_xmit_encode_uint32(unsigned char *dest, uint32_t v);
 H5_DLL size_t H5FD__mirror_xmit_encode_uint64(unsigned char *dest, uint64_t v);
 H5_DLL size_t H5FD__mirror_xmit_encode_uint8(unsigned char *dest, uint8_t v);
 
+H5_DLL size_t H5FD_mirror_xmit_decode_batch(H5FD_mirror_xmit_batch_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_header(H5FD_mirror_xmit_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_lock(H5FD_mirror_xmit_lock_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_open(H5FD_mirror_xmit_open_t *out, const unsigned char *buf);
@@ -293,6 +335,7 @@ H5_DLL size_t H5FD_mirror_xmit_decode_reply(H5FD_mirror_xmit_reply_t *out, const
 H5_DLL size_t H5FD_mirror_xmit_decode_set_eoa(H5FD_mirror_xmit_eoa_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_write(H5FD_mirror_xmit_write_t *out, const unsigned char *buf);
 
+H5_DLL size_t H5FD_mirror_xmit_encode_batch(unsigned char *dest, const H5FD_mirror_xmit_batch_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_header(unsigned char *dest, const H5FD_mirror_xmit_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_lock(unsigned char *dest, const H5FD_mirror_xmit_lock_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_open(unsigned char *dest, const H5FD_mirror_xmit_open_t *x);
@@ -300,6 +343,7 @@ H5_DLL size_t H5FD_mirror_xmit_encode_reply(unsigned char *dest, const H5FD_mirr
 H5_DLL size_t H5FD_mirror_xmit_encode_set_eoa(unsigned char *dest, const H5FD_mirror_xmit_eoa_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_write(unsigned char *dest, const H5FD_mirror_xmit_write_t *x);
 
+H5_DLL hbool_t H5FD_mirror_xmit_is_batch(const H5FD_mirror_xmit_batch_t *xmit);
 H5_DLL hbool_t H5FD_mirror_xmit_is_close(const H5FD_mirror_xmit_t *xmit);
 H5_DLL hbool_t H5FD_mirror_xmit_is_lock(const H5FD_mirror_xmit_lock_t *xmit);
 H5_DLL hbool_t H5FD_mirror_xmit_is_open(const H5FD_mirror_xmit_open_t *xmit);
@@ -0,0 +1,785 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The read-only memory-mapped file driver.  The whole file is
+ *          mapped with mmap() when it is opened and reads are served with
+ *          a memcpy() from the mapping, so raw data is copied once, from
+ *          the operating system's page cache straight into the
+ *          application's buffer.  The driver doesn't advertise data
+ *          sieving or metadata accumulation, which would only add a
+ *          second copy.
+ *
+ *          The library can also hand out pointers into the mapping for
+ *          raw data that needs no conversion (see H5Dget_mapped_ptr()),
+ *          through H5FD_mmap_get_ptr().
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDmmap.h"    /* mmap file driver         */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_MMAP
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_MMAP_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* The description of a file belonging to this driver.  The 'eof' is the
+ * size of the file when it was opened, which is also the length of the
+ * mapping; the 'eoa' is the amount of hdf5 address space in use.  Reads
+ * between the two return zeros, as they do for the other POSIX drivers.
+ */
+typedef struct H5FD_mmap_t {
+    H5FD_t  pub;  /* public stuff, must be first      */
+    int     fd;   /* the filesystem file descriptor   */
+    haddr_t eoa;  /* end of allocated region          */
+    haddr_t eof;  /* end of file; length of mapping   */
+    void *  base; /* start of the mapping, or NULL    */
+    hbool_t ignore_disabled_file_locks;
+
+    /* On most systems the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    hbool_t fam_to_single;
+} H5FD_mmap_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__mmap_term(void);
+static H5FD_t *H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__mmap_close(H5FD_t *_file);
+static int     H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__mmap_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__mmap_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                               void *buf);
+static herr_t  H5FD__mmap_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                const void *buf);
+static herr_t  H5FD__mmap_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__mmap_unlock(H5FD_t *_file);
+
+static const H5FD_class_t H5FD_mmap_g = {
+    "mmap",                /* name                 */
+    MAXADDR,               /* maxaddr              */
+    H5F_CLOSE_WEAK,        /* fc_degree            */
+    H5FD__mmap_term,       /* terminate            */
+    NULL,                  /* sb_size              */
+    NULL,                  /* sb_encode            */
+    NULL,                  /* sb_decode            */
+    0,                     /* fapl_size            */
+    NULL,                  /* fapl_get             */
+    NULL,                  /* fapl_copy            */
+    NULL,                  /* fapl_free            */
+    0,                     /* dxpl_size            */
+    NULL,                  /* dxpl_copy            */
+    NULL,                  /* dxpl_free            */
+    H5FD__mmap_open,       /* open                 */
+    H5FD__mmap_close,      /* close                */
+    H5FD__mmap_cmp,        /* cmp                  */
+    H5FD__mmap_query,      /* query                */
+    NULL,                  /* get_type_map         */
+    NULL,                  /* alloc                */
+    NULL,                  /* free                 */
+    H5FD__mmap_get_eoa,    /* get_eoa              */
+    H5FD__mmap_set_eoa,    /* set_eoa              */
+    H5FD__mmap_get_eof,    /* get_eof              */
+    H5FD__mmap_get_handle, /* get_handle           */
+    H5FD__mmap_read,       /* read                 */
+    H5FD__mmap_write,      /* write                */
+    NULL,                  /* flush                */
+    NULL,                  /* truncate             */
+    H5FD__mmap_lock,       /* lock                 */
+    H5FD__mmap_unlock,     /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,  /* fl_map               */
+    NULL,                  /* read_vector          */
+    NULL                   /* write_vector         */
+};
+
+/* Declare a free list to manage the H5FD_mmap_t struct */
+H5FL_DEFINE_STATIC(H5FD_mmap_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_mmap_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize mmap VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the mmap driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_mmap_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_MMAP_g))
+        H5FD_MMAP_g = H5FD_register(&H5FD_mmap_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_MMAP_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__mmap_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_MMAP_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_mmap
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_MMAP
+ *              driver defined in this source file.  There are no driver
+ *              specific properties.  Files can only be opened read-only
+ *              with this driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mmap(hid_t fapl_id)
+{
+    H5P_genplist_t *plist; /* Property list pointer */
+    herr_t          ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", fapl_id);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    ret_value = H5P_set_driver(plist, H5FD_MMAP, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_get_ptr
+ *
+ * Purpose:     Looks up where SIZE bytes of the file, starting at
+ *              (relative) address ADDR, are found in memory.  This is how
+ *              the library gives applications direct access to raw data
+ *              in the mapping.
+ *
+ *              *PTR is set to NULL when FILE doesn't belong to this
+ *              driver, or when part of the region lies beyond the end of
+ *              the mapping.  The pointer stays valid until the file is
+ *              closed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_mmap_get_ptr(const H5FD_t *_file, haddr_t addr, size_t size, const void **ptr /*out*/)
+{
+    const H5FD_mmap_t *file      = (const H5FD_mmap_t *)_file;
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file);
+    HDassert(ptr);
+
+    *ptr = NULL;
+
+    /* Only files opened with this driver are mapped */
+    if (file->pub.driver_id != H5FD_MMAP_g)
+        HGOTO_DONE(SUCCEED)
+
+    /* Convert the relative address to an absolute one */
+    addr += file->pub.base_addr;
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+    if ((addr + size) > file->eoa)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                    (unsigned long long)addr, (unsigned long long)size, (unsigned long long)file->eoa)
+
+    /* Data past the end of the file isn't in the mapping */
+    if ((addr + size) <= file->eof && file->base)
+        *ptr = (const unsigned char *)file->base + addr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_get_ptr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_open
+ *
+ * Purpose:     Opens an HDF5 file read-only and maps the whole file into
+ *              memory.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_mmap_t *   file = NULL; /* mmap VFD info            */
+    int             fd   = -1;   /* File descriptor          */
+    h5_stat_t       sb;
+    H5P_genplist_t *plist;            /* Property list pointer */
+    H5FD_t *        ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+    if (flags != H5F_ACC_RDONLY)
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, NULL, "only Read-Only access allowed")
+
+    /* Open the file */
+    if ((fd = HDopen(name, O_RDONLY, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL,
+                    "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x", name,
+                    myerrno, HDstrerror(myerrno), flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_mmap_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+
+    /* Map the file (mmap() refuses zero-length mappings) */
+    if (file->eof > 0) {
+        if ((haddr_t)((size_t)file->eof) != file->eof)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "file too large to map, size = %llu",
+                        (unsigned long long)file->eof)
+        if (MAP_FAILED == (file->base = HDmmap(NULL, (size_t)file->eof, PROT_READ, MAP_SHARED, fd, 0))) {
+            file->base = NULL;
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to map file")
+        } /* end if */
+    }     /* end if */
+
+    /* Get the FAPL */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Check for non-default FAPL */
+    if (H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+
+        /* This step is for h5repart tool only. If user wants to change file driver from
+         * family to one that uses single files (sec2, etc.) while using h5repart, this
+         * private property should be set so that in the later step, the library can ignore
+         * the family driver information saved in the superblock.
+         */
+        if (H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+            if (H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file) {
+            if (file->base)
+                HDmunmap(file->base, (size_t)file->eof);
+            file = H5FL_FREE(H5FD_mmap_t, file);
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_close
+ *
+ * Purpose:     Unmaps and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_close(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Remove the mapping */
+    if (file->base) {
+        if (HDmunmap(file->base, (size_t)file->eof) < 0)
+            HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to unmap file")
+        file->base = NULL;
+    } /* end if */
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_mmap_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_mmap_t *f1        = (const H5FD_mmap_t *)_f1;
+    const H5FD_mmap_t *f2        = (const H5FD_mmap_t *)_f2;
+    int                ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file; /* mmap VFD info */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports.  Reads are
+     * already served from memory, so there is nothing to gain from data
+     * sieving or the metadata accumulator.
+     */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+
+        /* Check for flags that are set by h5repart */
+        if (file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which
+                                                    eliminates it) */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__mmap_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              file when it was opened.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              mapped file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__mmap_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_handle
+ *
+ * Purpose:     Returns the file handle of the mmap file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF, by copying them from the mapping.  Bytes
+ *              past the end of the file read as zeros.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                size_t size, void *buf /*out*/)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Copy the part of the request that lies within the file */
+    if (addr < file->eof) {
+        size_t nbytes = (size_t)MIN((haddr_t)size, file->eof - addr);
+
+        H5MM_memcpy(buf, (const unsigned char *)file->base + addr, nbytes);
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    } /* end if */
+
+    /* end of file but not end of format address space */
+    if (size > 0)
+        HDmemset(buf, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_write
+ *
+ * Purpose:     Writes are not supported by this read-only driver.
+ *
+ * Return:      FAIL (always)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                 haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    herr_t ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "cannot write to read-only file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    int          lock_flags;                  /* file locking flags       */
+    herr_t       ret_value = SUCCEED;         /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_unlock(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    herr_t       ret_value = SUCCEED;              /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_unlock() */
+
+#endif /* H5_HAVE_MMAP */
@@ -0,0 +1,39 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only mmap driver.
+ */
+#ifndef H5FDmmap_H
+#define H5FDmmap_H
+
+#ifdef H5_HAVE_MMAP
+#define H5FD_MMAP (H5FD_mmap_init())
+#else
+#define H5FD_MMAP (H5I_INVALID_HID)
+#endif /* H5_HAVE_MMAP */
+
+#ifdef H5_HAVE_MMAP
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t  H5FD_mmap_init(void);
+H5_DLL herr_t H5Pset_fapl_mmap(hid_t fapl_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_MMAP */
+
+#endif
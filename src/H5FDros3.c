@@ -129,6 +129,69 @@ typedef struct {
 
 #endif /* ROS3_STATS */
 
+/* Name of the fapl property holding the block cache and connection settings */
+#define ROS3_CACHE_PROP_NAME "ros3_cache_prop"
+
+/* Smallest piece a large read is split into for concurrent range GETs */
+#define ROS3_MIN_PARALLEL_PART (256 * 1024)
+
+/***************************************************************************
+ *
+ * Structure: H5FD_ros3_cache_config_t
+ *
+ * Purpose:
+ *
+ *     Settings stored on the fapl by `H5Pset_fapl_ros3_cache()`; see
+ *     H5FDros3.h for the meaning of each field.
+ *
+ ***************************************************************************/
+typedef struct H5FD_ros3_cache_config_t {
+    size_t   block_size;
+    size_t   nblocks;
+    size_t   prefetch_size;
+    unsigned nconnections;
+} H5FD_ros3_cache_config_t;
+
+/***************************************************************************
+ *
+ * Structure: H5FD_ros3_block_t
+ *
+ * Purpose:
+ *
+ *     One slot of the block cache.
+ *
+ * `addr` (haddr_t)
+ *
+ *     File address of the block (a multiple of the block size), or
+ *     HADDR_UNDEF if the slot holds no valid data.
+ *
+ * `len` (size_t)
+ *
+ *     Number of valid bytes in `data`; less than the block size only for the
+ *     last block of the file.
+ *
+ * `data` (unsigned char *)
+ *
+ *     Block contents, allocated when the slot is first used.
+ *
+ * `hnext` (H5FD_ros3_block_t *)
+ *
+ *     Next slot in the same hash bucket.
+ *
+ * `prev`, `next` (H5FD_ros3_block_t *)
+ *
+ *     Neighbors in the LRU list.
+ *
+ ***************************************************************************/
+typedef struct H5FD_ros3_block_t {
+    haddr_t                   addr;
+    size_t                    len;
+    unsigned char *           data;
+    struct H5FD_ros3_block_t *hnext;
+    struct H5FD_ros3_block_t *prev;
+    struct H5FD_ros3_block_t *next;
+} H5FD_ros3_block_t;
+
 /***************************************************************************
  *
  * Structure: H5FD_ros3_t
@@ -166,6 +229,30 @@ typedef struct {
  *     Responsible for communicating with remote host and presenting file
  *     contents as indistinguishable from a file on the local filesystem.
  *
+ * `cache_config` (H5FD_ros3_cache_config_t)
+ *
+ *     Block cache, prefetch, and connection settings taken from the fapl
+ *     at open.
+ *
+ * `pool` (s3r_t **)
+ *
+ *     `cache_config.nconnections` request handles on the same resource,
+ *     each with its own connection.  The first entry is `s3r_handle`.
+ *
+ * `prefetch` (unsigned char *)
+ * `prefetch_len` (size_t)
+ *
+ *     Copy of the first `prefetch_len` bytes of the file, fetched at open.
+ *
+ * `blocks` (H5FD_ros3_block_t *)
+ * `buckets` (H5FD_ros3_block_t **)
+ * `lru_head`, `lru_tail` (H5FD_ros3_block_t *)
+ * `nblocks_used` (size_t)
+ *
+ *     Block cache: `cache_config.nblocks` slots, hashed by block address
+ *     into as many buckets and kept on a most- to least-recently used list.
+ *     Slots in flight or never used are on neither.
+ *
  * *** present only if ROS3_SATS is flagged to enable stats collection ***
  *
  * `meta` (ros3_statsbin[])
@@ -190,10 +277,19 @@ typedef struct {
  *
  ***************************************************************************/
 typedef struct H5FD_ros3_t {
-    H5FD_t           pub;
-    H5FD_ros3_fapl_t fa;
-    haddr_t          eoa;
-    s3r_t *          s3r_handle;
+    H5FD_t                   pub;
+    H5FD_ros3_fapl_t         fa;
+    haddr_t                  eoa;
+    s3r_t *                  s3r_handle;
+    H5FD_ros3_cache_config_t cache_config;
+    s3r_t **                 pool;
+    unsigned char *          prefetch;
+    size_t                   prefetch_len;
+    H5FD_ros3_block_t *      blocks;
+    H5FD_ros3_block_t **     buckets;
+    H5FD_ros3_block_t *      lru_head;
+    H5FD_ros3_block_t *      lru_tail;
+    size_t                   nblocks_used;
 #if ROS3_STATS
     ros3_statsbin meta[ROS3_STATS_BIN_COUNT + 1];
     ros3_statsbin raw[ROS3_STATS_BIN_COUNT + 1];
@@ -235,6 +331,11 @@ static herr_t  H5FD__ros3_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__ros3_unlock(H5FD_t *_file);
 
 static herr_t H5FD__ros3_validate_config(const H5FD_ros3_fapl_t *fa);
+static herr_t H5FD__ros3_get_cache_config(hid_t fapl_id, H5FD_ros3_cache_config_t *config);
+static herr_t H5FD__ros3_fetch(H5FD_ros3_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t H5FD__ros3_fetch_blocks(H5FD_ros3_t *file, H5FD_ros3_block_t *blocks[], size_t count);
+static herr_t H5FD__ros3_read_cached(H5FD_ros3_t *file, haddr_t addr, size_t size, unsigned char *buf);
+static void   H5FD__ros3_cache_free(H5FD_ros3_t *file);
 
 static const H5FD_class_t H5FD_ros3_g = {
     "ros3",                   /* name                 */
@@ -268,7 +369,9 @@ static const H5FD_class_t H5FD_ros3_g = {
     H5FD__ros3_truncate,      /* truncate             */
     H5FD__ros3_lock,          /* lock                 */
     H5FD__ros3_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,     /* fl_map               */
+    NULL,                     /* read_vector          */
+    NULL                      /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_ros3_t struct */
@@ -506,6 +609,153 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_fapl_ros3() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_ros3_cache
+ *
+ * Purpose:     Configure the block cache, open-time prefetch, and number
+ *              of server connections used by the ros3 driver.
+ *
+ *              The fapl must already be set to use the ros3 driver; the
+ *              settings are kept in a separate property so that the
+ *              public H5FD_ros3_fapl_t is unchanged.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_ros3_cache(hid_t fapl_id, size_t block_size, size_t nblocks, size_t prefetch_size,
+                       unsigned nconnections)
+{
+    H5P_genplist_t *         plist = NULL; /* Property list pointer */
+    H5FD_ros3_cache_config_t config;
+    htri_t                   exists    = FAIL;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "izzzIu", fapl_id, block_size, nblocks, prefetch_size, nconnections);
+
+#if ROS3_DEBUG
+    HDfprintf(stdout, "H5Pset_fapl_ros3_cache() called.\n");
+#endif
+
+    plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS);
+    if (plist == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (H5FD_ROS3 != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (nblocks > 0 && block_size == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block cache requires a non-zero block size")
+    if (nconnections == 0 || nconnections > H5FD_ROS3_MAX_CONNECTIONS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of connections out of range")
+
+    config.block_size    = block_size;
+    config.nblocks       = nblocks;
+    config.prefetch_size = prefetch_size;
+    config.nconnections  = nconnections;
+
+    if ((exists = H5P_exist_plist(plist, ROS3_CACHE_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check if property exists")
+    if (exists) {
+        if (H5P_set(plist, ROS3_CACHE_PROP_NAME, &config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set ros3 cache settings")
+    }
+    else if (H5P_insert(plist, ROS3_CACHE_PROP_NAME, sizeof(H5FD_ros3_cache_config_t), &config, NULL, NULL,
+                        NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "unable to register ros3 cache settings")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_ros3_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_ros3_cache
+ *
+ * Purpose:     Returns the settings stored by H5Pset_fapl_ros3_cache(),
+ *              or the defaults if none were set.  Any of the out
+ *              pointers may be NULL.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_ros3_cache(hid_t fapl_id, size_t *block_size /*out*/, size_t *nblocks /*out*/,
+                       size_t *prefetch_size /*out*/, unsigned *nconnections /*out*/)
+{
+    H5P_genplist_t *         plist = NULL; /* Property list pointer */
+    H5FD_ros3_cache_config_t config;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ixxxx", fapl_id, block_size, nblocks, prefetch_size, nconnections);
+
+#if ROS3_DEBUG
+    HDfprintf(stdout, "H5Pget_fapl_ros3_cache() called.\n");
+#endif
+
+    plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS);
+    if (plist == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_ROS3 != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+
+    if (FAIL == H5FD__ros3_get_cache_config(fapl_id, &config))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get ros3 cache settings")
+
+    if (block_size)
+        *block_size = config.block_size;
+    if (nblocks)
+        *nblocks = config.nblocks;
+    if (prefetch_size)
+        *prefetch_size = config.prefetch_size;
+    if (nconnections)
+        *nconnections = config.nconnections;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_ros3_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_get_cache_config
+ *
+ * Purpose:     Read the cache settings from a file access property list,
+ *              falling back to the defaults (no block cache, no prefetch,
+ *              a single connection) when none were set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_get_cache_config(hid_t fapl_id, H5FD_ros3_cache_config_t *config)
+{
+    H5P_genplist_t *plist     = NULL;
+    htri_t          exists    = FAIL;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(config != NULL);
+
+    config->block_size    = H5FD_ROS3_DEFAULT_BLOCK_SIZE;
+    config->nblocks       = 0;
+    config->prefetch_size = 0;
+    config->nconnections  = 1;
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    if ((exists = H5P_exist_plist(plist, ROS3_CACHE_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check if property exists")
+    if (exists)
+        if (H5P_get(plist, ROS3_CACHE_PROP_NAME, config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get ros3 cache settings")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_get_cache_config() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__ros3_fapl_get
  *
@@ -706,6 +956,8 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     unsigned char    signing_key[SHA256_DIGEST_LENGTH];
     s3r_t *          handle = NULL;
     H5FD_ros3_fapl_t fa;
+    size_t           filesize  = 0;
+    unsigned         u         = 0;
     H5FD_t *         ret_value = NULL;
 
     FUNC_ENTER_STATIC
@@ -770,6 +1022,47 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     file->s3r_handle = handle;
     H5MM_memcpy(&(file->fa), &fa, sizeof(H5FD_ros3_fapl_t));
 
+    if (FAIL == H5FD__ros3_get_cache_config(fapl_id, &(file->cache_config)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "unable to get ros3 cache settings")
+
+    /* Open the extra connections used for concurrent range GETs */
+    file->pool = (s3r_t **)H5MM_calloc(file->cache_config.nconnections * sizeof(s3r_t *));
+    if (file->pool == NULL)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate connection pool")
+    file->pool[0] = handle;
+    for (u = 1; u < file->cache_config.nconnections; u++) {
+        if (fa.authenticate == TRUE)
+            file->pool[u] =
+                H5FD_s3comms_s3r_open(url, (const char *)fa.aws_region, (const char *)fa.secret_id,
+                                      (const unsigned char *)signing_key);
+        else
+            file->pool[u] = H5FD_s3comms_s3r_open(url, NULL, NULL, NULL);
+        if (file->pool[u] == NULL)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "could not open additional connection")
+    }
+
+    /* Set up the (initially empty) block cache */
+    if (file->cache_config.nblocks > 0) {
+        file->blocks =
+            (H5FD_ros3_block_t *)H5MM_calloc(file->cache_config.nblocks * sizeof(H5FD_ros3_block_t));
+        file->buckets =
+            (H5FD_ros3_block_t **)H5MM_calloc(file->cache_config.nblocks * sizeof(H5FD_ros3_block_t *));
+        if (file->blocks == NULL || file->buckets == NULL)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate block cache")
+    }
+
+    /* Fetch the start of the file, where the superblock and early metadata
+     * live, so that opening the file does not cost a round trip per object
+     */
+    filesize           = H5FD_s3comms_s3r_get_filesize(handle);
+    file->prefetch_len = MIN(file->cache_config.prefetch_size, filesize);
+    if (file->prefetch_len > 0) {
+        if (NULL == (file->prefetch = (unsigned char *)H5MM_malloc(file->prefetch_len)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate prefetch buffer")
+        if (FAIL == H5FD__ros3_fetch(file, 0, file->prefetch_len, file->prefetch))
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, NULL, "unable to prefetch start of file")
+    }
+
 #if ROS3_STATS
     if (FAIL == ros3_reset_stats(file))
         HGOTO_ERROR(H5E_INTERNAL, H5E_UNINITIALIZED, NULL, "unable to reset file statistics")
@@ -782,8 +1075,16 @@ done:
         if (handle != NULL)
             if (FAIL == H5FD_s3comms_s3r_close(handle))
                 HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "unable to close s3 file handle")
-        if (file != NULL)
+        if (file != NULL) {
+            if (file->pool != NULL) {
+                for (u = 1; u < file->cache_config.nconnections; u++)
+                    if (file->pool[u] != NULL && FAIL == H5FD_s3comms_s3r_close(file->pool[u]))
+                        HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "unable to close s3 file handle")
+                H5MM_xfree(file->pool);
+            }
+            H5FD__ros3_cache_free(file);
             file = H5FL_FREE(H5FD_ros3_t, file);
+        }
         curl_global_cleanup(); /* early cleanup because open failed */
     }                          /* end if null return value (error) */
 
@@ -1091,6 +1392,7 @@ static herr_t
 H5FD__ros3_close(H5FD_t H5_ATTR_UNUSED *_file)
 {
     H5FD_ros3_t *file      = (H5FD_ros3_t *)_file;
+    unsigned     u         = 0;
     herr_t       ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -1108,6 +1410,13 @@ H5FD__ros3_close(H5FD_t H5_ATTR_UNUSED *_file)
     if (FAIL == H5FD_s3comms_s3r_close(file->s3r_handle))
         HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close S3 request handle")
 
+    /* Close the extra connections and release the caches */
+    for (u = 1; u < file->cache_config.nconnections; u++)
+        if (FAIL == H5FD_s3comms_s3r_close(file->pool[u]))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close S3 request handle")
+    H5MM_xfree(file->pool);
+    H5FD__ros3_cache_free(file);
+
 #if ROS3_STATS
     /* TODO: mechanism to re-target stats printout */
     if (ros3_fprint_stats(stdout, file) == FAIL)
@@ -1426,6 +1735,411 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__ros3_get_handle() */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_fetch()
+ *
+ * Purpose:
+ *
+ *     Read SIZE bytes at ADDR from the server into BUF, bypassing the block
+ *     cache.
+ *
+ *     When more than one connection is configured and the read is large
+ *     enough, it is split into contiguous pieces of at least
+ *     ROS3_MIN_PARALLEL_PART bytes, one per connection, which are
+ *     requested concurrently.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_fetch(H5FD_ros3_t *file, haddr_t addr, size_t size, void *buf)
+{
+    haddr_t offsets[H5FD_ROS3_MAX_CONNECTIONS];
+    size_t  lens[H5FD_ROS3_MAX_CONNECTIONS];
+    void *  dests[H5FD_ROS3_MAX_CONNECTIONS];
+    size_t  nparts    = 0;
+    size_t  part_size = 0;
+    size_t  u         = 0;
+    herr_t  ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* A zero-length request would fetch the rest of the object */
+    if (size == 0)
+        HGOTO_DONE(SUCCEED)
+
+    nparts = MIN((size_t)file->cache_config.nconnections, size / ROS3_MIN_PARALLEL_PART);
+
+    if (nparts <= 1) {
+        if (H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+    }
+    else {
+        part_size = size / nparts;
+        for (u = 0; u < nparts; u++) {
+            offsets[u] = addr + (haddr_t)(u * part_size);
+            lens[u]    = (u == nparts - 1) ? size - (u * part_size) : part_size;
+            dests[u]   = (unsigned char *)buf + (u * part_size);
+        }
+
+        if (H5FD_s3comms_s3r_read_multi(file->pool, nparts, offsets, lens, dests) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute concurrent reads")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_fetch() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_fetch_blocks()
+ *
+ * Purpose:
+ *
+ *     Fill COUNT block cache slots, sorted by address, from the server.
+ *
+ *     Each run of adjacent blocks is fetched with a single range GET, and
+ *     up to one run per connection is in flight at a time.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_fetch_blocks(H5FD_ros3_t *file, H5FD_ros3_block_t *blocks[], size_t count)
+{
+    haddr_t offsets[H5FD_ROS3_MAX_CONNECTIONS];
+    size_t  lens[H5FD_ROS3_MAX_CONNECTIONS];
+    void *  dests[H5FD_ROS3_MAX_CONNECTIONS];
+    size_t  first[H5FD_ROS3_MAX_CONNECTIONS]; /* first block of each run */
+    size_t  last[H5FD_ROS3_MAX_CONNECTIONS];  /* last block of each run  */
+    size_t  nreq      = 0;
+    size_t  i         = 0;
+    size_t  j         = 0;
+    size_t  k         = 0;
+    size_t  r         = 0;
+    herr_t  ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file->cache_config.nconnections <= H5FD_ROS3_MAX_CONNECTIONS);
+
+    while (i < count) {
+        /* Gather up to one run of adjacent blocks per connection.  A run of
+         * a single block is read in place; longer runs go through a
+         * temporary buffer.
+         */
+        for (nreq = 0; i < count && nreq < file->cache_config.nconnections; nreq++) {
+            j = i;
+            while (j + 1 < count && blocks[j + 1]->addr == blocks[j]->addr + file->cache_config.block_size)
+                j++;
+            first[nreq]   = i;
+            last[nreq]    = j;
+            offsets[nreq] = blocks[i]->addr;
+            lens[nreq]    = (size_t)(blocks[j]->addr - blocks[i]->addr) + blocks[j]->len;
+            if (i == j)
+                dests[nreq] = blocks[i]->data;
+            else if (NULL == (dests[nreq] = H5MM_malloc(lens[nreq])))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate read buffer")
+            i = j + 1;
+        }
+
+        if (H5FD_s3comms_s3r_read_multi(file->pool, nreq, offsets, lens, dests) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+
+        /* Scatter the longer runs into their blocks */
+        for (r = 0; r < nreq; r++)
+            if (first[r] != last[r]) {
+                for (k = first[r]; k <= last[r]; k++)
+                    H5MM_memcpy(blocks[k]->data, (unsigned char *)dests[r] + (blocks[k]->addr - offsets[r]),
+                                blocks[k]->len);
+                dests[r] = H5MM_xfree(dests[r]);
+            }
+    }
+
+done:
+    if (ret_value == FAIL)
+        for (r = 0; r < nreq; r++)
+            if (first[r] != last[r])
+                H5MM_xfree(dests[r]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_fetch_blocks() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_lru_unlink()
+ *
+ * Purpose:
+ *
+ *     Remove a block cache slot from the LRU list.
+ *
+ * Return:
+ *
+ *     void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__ros3_lru_unlink(H5FD_ros3_t *file, H5FD_ros3_block_t *blk)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if (blk->prev != NULL)
+        blk->prev->next = blk->next;
+    else
+        file->lru_head = blk->next;
+    if (blk->next != NULL)
+        blk->next->prev = blk->prev;
+    else
+        file->lru_tail = blk->prev;
+    blk->prev = NULL;
+    blk->next = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__ros3_lru_unlink() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_lru_insert()
+ *
+ * Purpose:
+ *
+ *     Put a block cache slot on the LRU list: at the head (most recently
+ *     used) if AT_HEAD is TRUE, otherwise at the tail (next to be reused).
+ *
+ * Return:
+ *
+ *     void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__ros3_lru_insert(H5FD_ros3_t *file, H5FD_ros3_block_t *blk, hbool_t at_head)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if (at_head) {
+        blk->prev = NULL;
+        blk->next = file->lru_head;
+        if (file->lru_head != NULL)
+            file->lru_head->prev = blk;
+        else
+            file->lru_tail = blk;
+        file->lru_head = blk;
+    }
+    else {
+        blk->next = NULL;
+        blk->prev = file->lru_tail;
+        if (file->lru_tail != NULL)
+            file->lru_tail->next = blk;
+        else
+            file->lru_head = blk;
+        file->lru_tail = blk;
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__ros3_lru_insert() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_hash_unlink()
+ *
+ * Purpose:
+ *
+ *     Remove a block cache slot from its hash bucket and mark it empty.
+ *
+ * Return:
+ *
+ *     void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__ros3_hash_unlink(H5FD_ros3_t *file, H5FD_ros3_block_t *blk)
+{
+    H5FD_ros3_block_t **link = NULL;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (blk->addr != HADDR_UNDEF) {
+        link = &file->buckets[(blk->addr / file->cache_config.block_size) % file->cache_config.nblocks];
+        while (*link != NULL && *link != blk)
+            link = &(*link)->hnext;
+        if (*link == blk)
+            *link = blk->hnext;
+        blk->hnext = NULL;
+        blk->addr  = HADDR_UNDEF;
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__ros3_hash_unlink() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_read_cached()
+ *
+ * Purpose:
+ *
+ *     Read SIZE bytes at ADDR into BUF through the block cache.
+ *
+ *     Cached blocks are copied out directly.  Missing blocks are claimed
+ *     from the empty slots or, once the cache is full, from the least
+ *     recently used end, then fetched together with
+ *     H5FD__ros3_fetch_blocks().  Reads spanning more than a quarter of
+ *     the cache are sent straight to the server so that one large raw
+ *     read does not flush the metadata the cache is mostly there for.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_read_cached(H5FD_ros3_t *file, haddr_t addr, size_t size, unsigned char *buf)
+{
+    size_t              block_size = file->cache_config.block_size;
+    size_t              nblocks    = file->cache_config.nblocks;
+    H5FD_ros3_block_t **missing    = NULL;
+    H5FD_ros3_block_t * blk        = NULL;
+    size_t              nmissing   = 0;
+    size_t              nspan      = 0;
+    size_t              filesize   = 0;
+    haddr_t             first_blk  = 0;
+    haddr_t             b          = 0;
+    haddr_t             lo         = 0;
+    haddr_t             hi         = 0;
+    size_t              bucket     = 0;
+    size_t              u          = 0;
+    herr_t              ret_value  = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(nblocks > 0);
+    HDassert(size > 0);
+
+    first_blk = addr / block_size;
+    nspan     = (size_t)((addr + size - 1) / block_size - first_blk) + 1;
+
+    if (nspan > MAX(1, nblocks / 4)) {
+        if (H5FD__ros3_fetch(file, addr, size, buf) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+        HGOTO_DONE(SUCCEED)
+    }
+
+    filesize = H5FD_s3comms_s3r_get_filesize(file->s3r_handle);
+
+    for (b = first_blk; b < first_blk + nspan; b++) {
+        for (blk = file->buckets[b % nblocks]; blk != NULL; blk = blk->hnext)
+            if (blk->addr == b * block_size)
+                break;
+
+        if (blk != NULL) {
+            /* Hit: move to the head of the LRU list and copy out */
+            H5FD__ros3_lru_unlink(file, blk);
+            H5FD__ros3_lru_insert(file, blk, TRUE);
+
+            lo = MAX(addr, blk->addr);
+            hi = MIN(addr + size, blk->addr + blk->len);
+            H5MM_memcpy(buf + (lo - addr), blk->data + (lo - blk->addr), (size_t)(hi - lo));
+            continue;
+        }
+
+        /* Miss: claim a slot.  Claimed slots are on neither the LRU list
+         * nor a hash chain until their data arrives.
+         */
+        if (missing == NULL)
+            if (NULL == (missing = (H5FD_ros3_block_t **)H5MM_malloc(nspan * sizeof(H5FD_ros3_block_t *))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate block list")
+
+        if (file->nblocks_used < nblocks) {
+            blk       = &file->blocks[file->nblocks_used++];
+            blk->addr = HADDR_UNDEF;
+        }
+        else {
+            blk = file->lru_tail;
+            HDassert(blk != NULL);
+            H5FD__ros3_lru_unlink(file, blk);
+            H5FD__ros3_hash_unlink(file, blk);
+        }
+        missing[nmissing++] = blk;
+
+        if (blk->data == NULL)
+            if (NULL == (blk->data = (unsigned char *)H5MM_malloc(block_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate cache block")
+        blk->addr = b * block_size;
+        blk->len  = MIN(block_size, filesize - (size_t)blk->addr);
+    }
+
+    if (nmissing > 0) {
+        if (H5FD__ros3_fetch_blocks(file, missing, nmissing) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to fetch blocks")
+
+        for (u = 0; u < nmissing; u++) {
+            blk = missing[u];
+
+            bucket                = (size_t)((blk->addr / block_size) % nblocks);
+            blk->hnext            = file->buckets[bucket];
+            file->buckets[bucket] = blk;
+            H5FD__ros3_lru_insert(file, blk, TRUE);
+
+            lo = MAX(addr, blk->addr);
+            hi = MIN(addr + size, blk->addr + blk->len);
+            H5MM_memcpy(buf + (lo - addr), blk->data + (lo - blk->addr), (size_t)(hi - lo));
+        }
+        nmissing = 0;
+    }
+
+done:
+    /* Slots claimed for a failed fetch go back, empty, to be reused first */
+    for (u = 0; u < nmissing; u++) {
+        missing[u]->addr = HADDR_UNDEF;
+        H5FD__ros3_lru_insert(file, missing[u], FALSE);
+    }
+    H5MM_xfree(missing);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_read_cached() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_cache_free()
+ *
+ * Purpose:
+ *
+ *     Release the block cache and prefetch buffer of a file.
+ *
+ * Return:
+ *
+ *     void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__ros3_cache_free(H5FD_ros3_t *file)
+{
+    size_t u = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (file->blocks != NULL) {
+        for (u = 0; u < file->nblocks_used; u++)
+            H5MM_xfree(file->blocks[u].data);
+        file->blocks = (H5FD_ros3_block_t *)H5MM_xfree(file->blocks);
+    }
+    file->buckets  = (H5FD_ros3_block_t **)H5MM_xfree(file->buckets);
+    file->prefetch = (unsigned char *)H5MM_xfree(file->prefetch);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__ros3_cache_free() */
+
 /*-------------------------------------------------------------------------
  *
  * Function: H5FD__ros3_read()
@@ -1454,6 +2168,7 @@ H5FD__ros3_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
 {
     H5FD_ros3_t *file      = (H5FD_ros3_t *)_file;
     size_t       filesize  = 0;
+    size_t       nbytes    = 0; /* bytes served from the prefetch buffer */
     herr_t       ret_value = SUCCEED;
 #if ROS3_STATS
     /* working variables for storing stats */
@@ -1476,8 +2191,21 @@ H5FD__ros3_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if ((addr > filesize) || ((addr + size) > filesize))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "range exceeds file address")
 
-    if (H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+    /* Serve what we can from the prefetched start of the file */
+    if (addr < file->prefetch_len) {
+        nbytes = MIN(size, file->prefetch_len - (size_t)addr);
+        H5MM_memcpy(buf, file->prefetch + addr, nbytes);
+    }
+
+    if (nbytes < size) {
+        if (file->cache_config.nblocks > 0) {
+            if (H5FD__ros3_read_cached(file, addr + nbytes, size - nbytes, (unsigned char *)buf + nbytes) ==
+                FAIL)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+        }
+        else if (H5FD__ros3_fetch(file, addr + nbytes, size - nbytes, (unsigned char *)buf + nbytes) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+    }
 
 #if ROS3_STATS
 
@@ -85,6 +85,38 @@ typedef struct H5FD_ros3_fapl_t {
     char    secret_key[H5FD_ROS3_MAX_SECRET_KEY_LEN + 1];
 } H5FD_ros3_fapl_t;
 
+/****************************************************************************
+ *
+ * Read caching and connection settings, set with H5Pset_fapl_ros3_cache()
+ * on a file access property list already configured for the ros3 driver.
+ *
+ * `block_size`
+ *
+ *     Size in bytes of the blocks in which the driver fetches and caches
+ *     file contents.
+ *
+ * `nblocks`
+ *
+ *     Capacity of the block cache.  Blocks are evicted in least-recently-
+ *     used order.  Zero (the default) disables the block cache.
+ *
+ * `prefetch_size`
+ *
+ *     Number of bytes at the start of the file fetched when it is opened
+ *     and held for the life of the file.  This is where the superblock and
+ *     most early metadata live.  Zero (the default) disables prefetching.
+ *
+ * `nconnections`
+ *
+ *     Number of connections kept open to the server.  Large reads are split
+ *     into range requests that are in flight over these connections at the
+ *     same time.  One (the default) issues every request in turn.
+ *
+ ****************************************************************************/
+
+#define H5FD_ROS3_DEFAULT_BLOCK_SIZE (64 * 1024)
+#define H5FD_ROS3_MAX_CONNECTIONS    16
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -92,6 +124,10 @@ extern "C" {
 H5_DLL hid_t  H5FD_ros3_init(void);
 H5_DLL herr_t H5Pget_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa_out);
 H5_DLL herr_t H5Pset_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa);
+H5_DLL herr_t H5Pget_fapl_ros3_cache(hid_t fapl_id, size_t *block_size /*out*/, size_t *nblocks /*out*/,
+                                     size_t *prefetch_size /*out*/, unsigned *nconnections /*out*/);
+H5_DLL herr_t H5Pset_fapl_ros3_cache(hid_t fapl_id, size_t block_size, size_t nblocks, size_t prefetch_size,
+                                     unsigned nconnections);
 
 #ifdef __cplusplus
 }
@@ -1163,66 +1163,48 @@ done:
 
 /*----------------------------------------------------------------------------
  *
- * Function: H5FD_s3comms_s3r_read()
+ * Function: H5FD__s3comms_s3r_prep_request()
  *
  * Purpose:
  *
- *     Read file pointed to by request handle, writing specified
- *     `offset` .. `offset + len` bytes to buffer `dest`.
+ *     Configure the curl handle of `handle` for a single range GET of
+ *     `offset` .. `offset + len` bytes, without performing it.
  *
- *     If `len` is 0, reads entirety of file starting at `offset`.
- *     If `offset` and `len` are both 0, reads entire file.
- *
- *     If `offset` or `offset+len` is greater than the file size, read is
- *     aborted and returns `FAIL`.
+ *     Range semantics are those of `H5FD_s3comms_s3r_read()`.
  *
- *     Uses configured "curl easy handle" to perform request.
+ *     If `sds` is not NULL, it is installed as the write target of the curl
+ *     handle; it must remain valid until the request has been performed.
  *
- *     In event of error, buffer should remain unaltered.
- *
- *     If handle is set to authorize a request, creates a new (temporary)
- *     HTTP Request object (hrb_t) for generating requisite headers,
- *     which is then translated to a `curl slist` and set in the curl handle
- *     for the request.
- *
- *     `dest` _may_ be NULL, but no body data will be recorded.
- *
- *     - In general practice, NULL should never be passed in as `dest`.
- *     - NULL `dest` passed in by internal function `s3r_getsize()`, in
- *       conjunction with CURLOPT_NOBODY to preempt transmission of file data
- *       from server.
+ *     If the handle is set to authorize requests, the generated headers are
+ *     returned through `curlheaders`; the list is referenced by the curl
+ *     handle and must be released with `H5FD__s3comms_s3r_reset_request()`
+ *     once the request has been performed.
  *
  * Return:
  *
  *     - SUCCESS: `SUCCEED`
  *     - FAILURE: `FAIL`
  *
- * Programmer: Jacob Smith
- *             2017-08-22
- *
  *----------------------------------------------------------------------------
  */
-herr_t
-H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
+static herr_t
+H5FD__s3comms_s3r_prep_request(s3r_t *handle, haddr_t offset, size_t len, struct s3r_datastruct *sds,
+                               struct curl_slist **curlheaders)
 {
-    CURL *             curlh         = NULL;
-    CURLcode           p_status      = CURLE_OK;
-    struct curl_slist *curlheaders   = NULL;
-    hrb_node_t *       headers       = NULL;
-    hrb_node_t *       node          = NULL;
-    struct tm *        now           = NULL;
-    char *             rangebytesstr = NULL;
-    hrb_t *            request       = NULL;
-    int                ret           = 0; /* working variable to check  */
-                                          /* return value of HDsnprintf  */
-    struct s3r_datastruct *sds       = NULL;
-    herr_t                 ret_value = SUCCEED;
+    CURL *      curlh         = NULL;
+    hrb_node_t *headers       = NULL;
+    hrb_node_t *node          = NULL;
+    struct tm * now           = NULL;
+    char *      rangebytesstr = NULL;
+    hrb_t *     request       = NULL;
+    int         ret           = 0; /* working variable to check  */
+                                   /* return value of HDsnprintf  */
+    herr_t ret_value = SUCCEED;
 
-    FUNC_ENTER_NOAPI_NOINIT
+    FUNC_ENTER_STATIC
 
-#if S3COMMS_DEBUG
-    HDfprintf(stdout, "called H5FD_s3comms_s3r_read.\n");
-#endif
+    HDassert(curlheaders != NULL);
+    HDassert(*curlheaders == NULL);
 
     /**************************************
      * ABSOLUTELY NECESSARY SANITY-CHECKS *
@@ -1246,18 +1228,10 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
      * PREPARE WRITEDATA *
      *********************/
 
-    if (dest != NULL) {
-        sds = (struct s3r_datastruct *)H5MM_malloc(sizeof(struct s3r_datastruct));
-        if (sds == NULL)
-            HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructure.");
-
-        sds->magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
-        sds->data  = (char *)dest;
-        sds->size  = 0;
+    if (sds != NULL)
         if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, sds))
             HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
                         "error while setting CURL option (CURLOPT_WRITEDATA).");
-    }
 
     /*********************
      * FORMAT HTTP RANGE *
@@ -1296,6 +1270,7 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
             bytesrange_ptr++; /* move to first char past '=' */
             HDassert(*bytesrange_ptr != '\0');
 
+            /* curl keeps its own copy of the range string */
             if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_RANGE, bytesrange_ptr))
                 HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL,
                             "error while setting CURL option (CURLOPT_RANGE). ");
@@ -1422,23 +1397,149 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
         node = request->first_header;
         while (node != NULL) {
             HDassert(node->magic == S3COMMS_HRB_NODE_MAGIC);
-            curlheaders = curl_slist_append(curlheaders, (const char *)node->cat);
-            if (curlheaders == NULL)
+            *curlheaders = curl_slist_append(*curlheaders, (const char *)node->cat);
+            if (*curlheaders == NULL)
                 HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not append header to curl slist.");
             node = node->next;
         }
 
         /* sanity-check */
-        if (curlheaders == NULL)
+        if (*curlheaders == NULL)
             /* above loop was probably never run */
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "curlheaders was never populated.");
 
         /* finally, set http headers in curl handle */
-        if (curl_easy_setopt(curlh, CURLOPT_HTTPHEADER, curlheaders) != CURLE_OK)
+        if (curl_easy_setopt(curlh, CURLOPT_HTTPHEADER, *curlheaders) != CURLE_OK)
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
                         "error while setting CURL option (CURLOPT_HTTPHEADER).");
     } /* end if should authenticate (info provided) */
 
+done:
+    /* clean any malloc'd resources
+     */
+    if (rangebytesstr != NULL) {
+        H5MM_xfree(rangebytesstr);
+        rangebytesstr = NULL;
+    }
+    if (request != NULL) {
+        while (headers != NULL)
+            if (FAIL == H5FD_s3comms_hrb_node_set(&headers, headers->name, NULL))
+                HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header node")
+        HDassert(NULL == headers);
+        if (FAIL == H5FD_s3comms_hrb_destroy(&request))
+            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header request structure")
+        HDassert(NULL == request);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* H5FD__s3comms_s3r_prep_request */
+
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD__s3comms_s3r_reset_request()
+ *
+ * Purpose:
+ *
+ *     Undo the per-request settings made by
+ *     `H5FD__s3comms_s3r_prep_request()` and release the header list.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *
+ *----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__s3comms_s3r_reset_request(s3r_t *handle, struct curl_slist **curlheaders)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(curlheaders != NULL);
+
+    if (handle != NULL && handle->curlhandle != NULL) {
+        /* clear any Range */
+        if (CURLE_OK != curl_easy_setopt(handle->curlhandle, CURLOPT_RANGE, NULL))
+            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot unset CURLOPT_RANGE")
+
+        /* clear headers */
+        if (CURLE_OK != curl_easy_setopt(handle->curlhandle, CURLOPT_HTTPHEADER, NULL))
+            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot unset CURLOPT_HTTPHEADER")
+    }
+
+    if (*curlheaders != NULL) {
+        curl_slist_free_all(*curlheaders);
+        *curlheaders = NULL;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* H5FD__s3comms_s3r_reset_request */
+
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD_s3comms_s3r_read()
+ *
+ * Purpose:
+ *
+ *     Read file pointed to by request handle, writing specified
+ *     `offset` .. `offset + len` bytes to buffer `dest`.
+ *
+ *     If `len` is 0, reads entirety of file starting at `offset`.
+ *     If `offset` and `len` are both 0, reads entire file.
+ *
+ *     If `offset` or `offset+len` is greater than the file size, read is
+ *     aborted and returns `FAIL`.
+ *
+ *     Uses configured "curl easy handle" to perform request.
+ *
+ *     In event of error, buffer should remain unaltered.
+ *
+ *     If handle is set to authorize a request, creates a new (temporary)
+ *     HTTP Request object (hrb_t) for generating requisite headers,
+ *     which is then translated to a `curl slist` and set in the curl handle
+ *     for the request.
+ *
+ *     `dest` _may_ be NULL, but no body data will be recorded.
+ *
+ *     - In general practice, NULL should never be passed in as `dest`.
+ *     - NULL `dest` passed in by internal function `s3r_getsize()`, in
+ *       conjunction with CURLOPT_NOBODY to preempt transmission of file data
+ *       from server.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *
+ * Programmer: Jacob Smith
+ *             2017-08-22
+ *
+ *----------------------------------------------------------------------------
+ */
+herr_t
+H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
+{
+    CURL *                curlh       = NULL;
+    CURLcode              p_status    = CURLE_OK;
+    struct curl_slist *   curlheaders = NULL;
+    struct s3r_datastruct sds         = {S3COMMS_CALLBACK_DATASTRUCT_MAGIC, NULL, 0};
+    herr_t                ret_value   = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#if S3COMMS_DEBUG
+    HDfprintf(stdout, "called H5FD_s3comms_s3r_read.\n");
+#endif
+
+    sds.data = (char *)dest;
+    if (FAIL == H5FD__s3comms_s3r_prep_request(handle, offset, len, (dest != NULL) ? &sds : NULL,
+                                               &curlheaders))
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "unable to prepare request")
+
+    curlh = handle->curlhandle;
+
     /*******************
      * PERFORM REQUEST *
      *******************/
@@ -1478,56 +1579,148 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
     if (dest != NULL) {
         HDfprintf(stderr, "len: %d\n", (int)len);
         HDfprintf(stderr, "CHECKING FOR BUFFER OVERFLOW\n");
-        if (sds == NULL)
-            HDfprintf(stderr, "sds is NULL!\n");
-        else {
-            HDfprintf(stderr, "sds: 0x%lx\n", (long long)sds);
-            HDfprintf(stderr, "sds->size: %d\n", (int)sds->size);
-            if (len > sds->size)
-                HDfprintf(stderr, "buffer overwrite\n");
-        }
+        HDfprintf(stderr, "sds.size: %d\n", (int)sds.size);
+        if (len > sds.size)
+            HDfprintf(stderr, "buffer overwrite\n");
     }
     else
         HDfprintf(stderr, "performed on entire file\n");
 #endif
 
 done:
-    /* clean any malloc'd resources
-     */
-    if (curlheaders != NULL) {
-        curl_slist_free_all(curlheaders);
-        curlheaders = NULL;
+    if (FAIL == H5FD__s3comms_s3r_reset_request(handle, &curlheaders))
+        HDONE_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "unable to reset request")
+    sds.magic += 1; /* set to bad magic */
+
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* H5FD_s3comms_s3r_read */
+
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD_s3comms_s3r_read_multi()
+ *
+ * Purpose:
+ *
+ *     Perform `count` range GETs concurrently, request `i` reading
+ *     `offsets[i]` .. `offsets[i] + lens[i]` bytes into `dests[i]` through
+ *     request handle `handles[i]`.
+ *
+ *     Every request must use a distinct handle, as each handle owns a single
+ *     curl easy handle (connection).  All handles must refer to the same
+ *     object.  The transfers are driven together through a curl multi
+ *     handle, so the requests are in flight at the same time without the
+ *     library having to spawn threads.
+ *
+ *     Unlike `H5FD_s3comms_s3r_read()`, every length must be non-zero, and
+ *     a request that returns fewer bytes than asked for is an error.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *         - contents of the destination buffers are undefined
+ *
+ *----------------------------------------------------------------------------
+ */
+herr_t
+H5FD_s3comms_s3r_read_multi(s3r_t *handles[], size_t count, const haddr_t offsets[], const size_t lens[],
+                            void *dests[])
+{
+    CURLM *                multih      = NULL;
+    CURLMsg *              msg         = NULL;
+    struct curl_slist **   curlheaders = NULL;
+    struct s3r_datastruct *sds         = NULL;
+    size_t                 nadded      = 0;
+    size_t                 i           = 0;
+    int                    running     = 0;
+    int                    nmsgs       = 0;
+    herr_t                 ret_value   = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#if S3COMMS_DEBUG
+    HDfprintf(stdout, "called H5FD_s3comms_s3r_read_multi.\n");
+#endif
+
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+    if (handles == NULL || offsets == NULL || lens == NULL || dests == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "request arrays cannot be null.");
+
+    /* A single request gains nothing from the multi interface */
+    if (count == 1)
+        HGOTO_DONE(H5FD_s3comms_s3r_read(handles[0], offsets[0], lens[0], dests[0]))
+
+    sds         = (struct s3r_datastruct *)H5MM_calloc(count * sizeof(struct s3r_datastruct));
+    curlheaders = (struct curl_slist **)H5MM_calloc(count * sizeof(struct curl_slist *));
+    if (sds == NULL || curlheaders == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not allocate request bookkeeping.");
+
+    if (NULL == (multih = curl_multi_init()))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "could not create curl multi handle.");
+
+    /*******************
+     * PREPARE EACH GET *
+     *******************/
+
+    for (i = 0; i < count; i++) {
+        if (lens[i] == 0 || dests[i] == NULL)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "multi-read requests must be non-empty.");
+
+        sds[i].magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
+        sds[i].data  = (char *)dests[i];
+        sds[i].size  = 0;
+
+        if (FAIL == H5FD__s3comms_s3r_prep_request(handles[i], offsets[i], lens[i], &sds[i], &curlheaders[i]))
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "unable to prepare request")
+
+        if (CURLM_OK != curl_multi_add_handle(multih, handles[i]->curlhandle))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "could not add request to curl multi handle.");
+        nadded++;
     }
-    if (rangebytesstr != NULL) {
-        H5MM_xfree(rangebytesstr);
-        rangebytesstr = NULL;
+
+    /********************
+     * PERFORM REQUESTS *
+     ********************/
+
+    do {
+        if (CURLM_OK != curl_multi_perform(multih, &running))
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "curl cannot perform requests")
+        if (running > 0)
+            if (CURLM_OK != curl_multi_wait(multih, NULL, 0, 1000, NULL))
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "curl cannot wait on requests")
+    } while (running > 0);
+
+    while (NULL != (msg = curl_multi_info_read(multih, &nmsgs)))
+        if (msg->msg == CURLMSG_DONE && msg->data.result != CURLE_OK)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "curl cannot perform request")
+
+    for (i = 0; i < count; i++)
+        if (sds[i].size != lens[i])
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "short range response")
+
+done:
+    if (multih != NULL) {
+        for (i = 0; i < nadded; i++)
+            if (CURLM_OK != curl_multi_remove_handle(multih, handles[i]->curlhandle))
+                HDONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "cannot remove request from curl multi handle")
+        if (CURLM_OK != curl_multi_cleanup(multih))
+            HDONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "cannot release curl multi handle")
+    }
+    if (curlheaders != NULL) {
+        for (i = 0; i < count; i++)
+            if (FAIL == H5FD__s3comms_s3r_reset_request(handles[i], &curlheaders[i]))
+                HDONE_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "unable to reset request")
+        H5MM_xfree(curlheaders);
     }
     if (sds != NULL) {
+        for (i = 0; i < count; i++)
+            sds[i].magic += 1; /* set to bad magic */
         H5MM_xfree(sds);
-        sds = NULL;
-    }
-    if (request != NULL) {
-        while (headers != NULL)
-            if (FAIL == H5FD_s3comms_hrb_node_set(&headers, headers->name, NULL))
-                HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header node")
-        HDassert(NULL == headers);
-        if (FAIL == H5FD_s3comms_hrb_destroy(&request))
-            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header request structure")
-        HDassert(NULL == request);
-    }
-
-    if (curlh != NULL) {
-        /* clear any Range */
-        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_RANGE, NULL))
-            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot unset CURLOPT_RANGE")
-
-        /* clear headers */
-        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HTTPHEADER, NULL))
-            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot unset CURLOPT_HTTPHEADER")
     }
 
     FUNC_LEAVE_NOAPI(ret_value);
-} /* H5FD_s3comms_s3r_read */
+} /* H5FD_s3comms_s3r_read_multi */
 
 /****************************************************************************
  * MISCELLANEOUS FUNCTIONS
@@ -21,6 +21,14 @@
  *          changed based on previous I/O through this driver (don't mix
  *          I/O from this driver with I/O from other parts of the
  *          application to the same file).
+ *
+ *          Large reads can be striped: the request is split into slices
+ *          which several threads read at once with pread() (see
+ *          H5Pset_fapl_sec2_striping).
+ *
+ *          Raw data reads can be watched for sequential or fixed-stride
+ *          access, which is then read ahead (see
+ *          H5Pset_fapl_sec2_readahead).
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -35,12 +43,60 @@
 #include "H5MMprivate.h" /* Memory management        */
 #include "H5Pprivate.h"  /* Property lists           */
 
+/* Large reads are only striped across threads when positional I/O and
+ * Pthreads are both available.
+ */
+#if defined(H5_HAVE_PREADWRITE) && defined(H5_HAVE_PTHREAD_H) && defined(H5_HAVE_LIBPTHREAD)
+#define H5FD_SEC2_STRIPED_READ
+#include <pthread.h>
+#endif
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SEC2_g = 0;
 
 /* Whether to ignore file locks when disabled (env var value) */
 static htri_t ignore_disabled_file_locks_s = FAIL;
 
+/* Driver-specific file access properties */
+typedef struct H5FD_sec2_fapl_t {
+    size_t   stripe_size;   /* Size of the slices of a striped read      */
+    unsigned nthreads;      /* Max. # of threads reading one request     */
+    size_t   readahead_max; /* Largest read-ahead window (0 = disabled)  */
+} H5FD_sec2_fapl_t;
+
+/* Driver-specific file access properties used when none were set (no
+ * striping, no read-ahead)
+ */
+static const H5FD_sec2_fapl_t H5FD_sec2_default_fa_g = {H5FD_SEC2_STRIPE_SIZE_DEF, 1, 0};
+
+/* Read-ahead tuning.  A pattern must hold for H5FD_SEC2_RA_TRIGGER reads
+ * in a row before anything is read ahead.  The first sequential window is
+ * at least H5FD_SEC2_RA_WINDOW_MIN bytes and doubles each time it is used
+ * up, up to the fapl's limit.  Fixed-stride access is advised to the
+ * kernel H5FD_SEC2_RA_STRIDE_DEPTH reads ahead.
+ */
+#define H5FD_SEC2_RA_TRIGGER      2
+#define H5FD_SEC2_RA_WINDOW_MIN   (64 * 1024)
+#define H5FD_SEC2_RA_STRIDE_DEPTH 4
+
+#ifdef H5FD_SEC2_STRIPED_READ
+/* The part of a striped read done by one thread: every 'stride'-th slice,
+ * starting with slice number 'first'.  'err' is the errno value of a
+ * failed read (zero on success) and 'err_offset' where it happened.
+ */
+typedef struct H5FD_sec2_stripe_t {
+    int            fd;          /* the filesystem file descriptor   */
+    HDoff_t        offset;      /* file offset of the whole read    */
+    unsigned char *buf;         /* buffer for the whole read        */
+    size_t         size;        /* size of the whole read           */
+    size_t         stripe_size; /* size of each slice               */
+    size_t         first;       /* first slice read by this thread  */
+    size_t         stride;      /* distance to the next slice       */
+    int            err;         /* errno value, if the read failed  */
+    HDoff_t        err_offset;  /* file offset of the failed read   */
+} H5FD_sec2_stripe_t;
+#endif /* H5FD_SEC2_STRIPED_READ */
+
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
  * of the file (the current size of the underlying filesystem file). The
@@ -53,14 +109,33 @@ static htri_t ignore_disabled_file_locks_s = FAIL;
  * occurs), and 'op' will be set to H5F_OP_UNKNOWN.
  */
 typedef struct H5FD_sec2_t {
-    H5FD_t         pub; /* public stuff, must be first      */
-    int            fd;  /* the filesystem file descriptor   */
-    haddr_t        eoa; /* end of allocated region          */
-    haddr_t        eof; /* end of file; current file size   */
-    haddr_t        pos; /* current file I/O position        */
-    H5FD_file_op_t op;  /* last operation                   */
-    hbool_t        ignore_disabled_file_locks;
-    char           filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    H5FD_t           pub; /* public stuff, must be first      */
+    int              fd;  /* the filesystem file descriptor   */
+    haddr_t          eoa; /* end of allocated region          */
+    haddr_t          eof; /* end of file; current file size   */
+    haddr_t          pos; /* current file I/O position        */
+    H5FD_file_op_t   op;  /* last operation                   */
+    hbool_t          ignore_disabled_file_locks;
+    H5FD_sec2_fapl_t fa;                              /* file access properties           */
+    char             filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+
+    /* Read-ahead of raw data.  The history of the last raw data read is
+     * used to spot sequential or fixed-stride access; sequential data is
+     * read ahead into 'ra_buf', which holds 'ra_len' bytes of the file from
+     * 'ra_addr'.
+     */
+    haddr_t        ra_last_addr; /* address of the last raw data read    */
+    size_t         ra_last_size; /* size of the last raw data read       */
+    hsize_t        ra_stride;    /* distance between the last two reads  */
+    unsigned       ra_streak;    /* # of reads in a row matching pattern */
+    size_t         ra_window;    /* current read-ahead window size       */
+    unsigned char *ra_buf;       /* read-ahead buffer                    */
+    haddr_t        ra_addr;      /* file address of the buffer contents  */
+    size_t         ra_len;       /* # of valid bytes in the buffer       */
+    hsize_t        ra_reads;     /* # of raw data reads                  */
+    hsize_t        ra_hits;      /* # of reads served from the buffer    */
+    hsize_t        ra_fills;     /* # of read-ahead reads                */
+    hsize_t        ra_advised;   /* # of ranges advised to the kernel    */
 #ifndef H5_HAVE_WIN32_API
     /* On most systems the combination of device and i-node number uniquely
      * identify a file.  Note that Cygwin, MinGW and other Windows POSIX
@@ -121,8 +196,17 @@ typedef struct H5FD_sec2_t {
 #define REGION_OVERFLOW(A, Z)                                                                                \
     (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
 
+/* Maximum number of I/O vectors handed to a single preadv()/pwritev() call */
+#ifdef IOV_MAX
+#define H5FD_SEC2_IOV_MAX ((uint32_t)IOV_MAX)
+#else
+#define H5FD_SEC2_IOV_MAX ((uint32_t)1024)
+#endif
+
 /* Prototypes */
 static herr_t  H5FD__sec2_term(void);
+static void *  H5FD__sec2_fapl_get(H5FD_t *file);
+static void *  H5FD__sec2_fapl_copy(const void *_old_fa);
 static H5FD_t *H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
 static herr_t  H5FD__sec2_close(H5FD_t *_file);
 static int     H5FD__sec2_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
@@ -135,43 +219,61 @@ static herr_t  H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+static herr_t  H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], const void *bufs[]);
+#ifdef H5_HAVE_PREADWRITEV
+static uint32_t H5FD__sec2_vector_run(uint32_t count, const haddr_t addrs[], const size_t sizes[],
+                                      uint32_t start, size_t *run_size);
+static herr_t   H5FD__sec2_readv(H5FD_sec2_t *file, haddr_t addr, struct iovec *iov, int iovcnt, size_t size);
+static herr_t   H5FD__sec2_writev(H5FD_sec2_t *file, haddr_t addr, struct iovec *iov, int iovcnt,
+                                  size_t size);
+#endif /* H5_HAVE_PREADWRITEV */
+#ifdef H5FD_SEC2_STRIPED_READ
+static herr_t H5FD__sec2_read_striped(H5FD_sec2_t *file, haddr_t addr, size_t size, void *buf);
+static void * H5FD__sec2_stripe_read(void *_stripe);
+#endif /* H5FD_SEC2_STRIPED_READ */
+static size_t  H5FD__sec2_readahead_plan(H5FD_sec2_t *file, haddr_t addr, size_t size, hbool_t hit);
 static herr_t  H5FD__sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__sec2_unlock(H5FD_t *_file);
 
 static const H5FD_class_t H5FD_sec2_g = {
-    "sec2",                /* name                 */
-    MAXADDR,               /* maxaddr              */
-    H5F_CLOSE_WEAK,        /* fc_degree            */
-    H5FD__sec2_term,       /* terminate            */
-    NULL,                  /* sb_size              */
-    NULL,                  /* sb_encode            */
-    NULL,                  /* sb_decode            */
-    0,                     /* fapl_size            */
-    NULL,                  /* fapl_get             */
-    NULL,                  /* fapl_copy            */
-    NULL,                  /* fapl_free            */
-    0,                     /* dxpl_size            */
-    NULL,                  /* dxpl_copy            */
-    NULL,                  /* dxpl_free            */
-    H5FD__sec2_open,       /* open                 */
-    H5FD__sec2_close,      /* close                */
-    H5FD__sec2_cmp,        /* cmp                  */
-    H5FD__sec2_query,      /* query                */
-    NULL,                  /* get_type_map         */
-    NULL,                  /* alloc                */
-    NULL,                  /* free                 */
-    H5FD__sec2_get_eoa,    /* get_eoa              */
-    H5FD__sec2_set_eoa,    /* set_eoa              */
-    H5FD__sec2_get_eof,    /* get_eof              */
-    H5FD__sec2_get_handle, /* get_handle           */
-    H5FD__sec2_read,       /* read                 */
-    H5FD__sec2_write,      /* write                */
-    NULL,                  /* flush                */
-    H5FD__sec2_truncate,   /* truncate             */
-    H5FD__sec2_lock,       /* lock                 */
-    H5FD__sec2_unlock,     /* unlock               */
-    H5FD_FLMAP_DICHOTOMY   /* fl_map               */
+    "sec2",                   /* name                 */
+    MAXADDR,                  /* maxaddr              */
+    H5F_CLOSE_WEAK,           /* fc_degree            */
+    H5FD__sec2_term,          /* terminate            */
+    NULL,                     /* sb_size              */
+    NULL,                     /* sb_encode            */
+    NULL,                     /* sb_decode            */
+    sizeof(H5FD_sec2_fapl_t), /* fapl_size            */
+    H5FD__sec2_fapl_get,      /* fapl_get             */
+    H5FD__sec2_fapl_copy,     /* fapl_copy            */
+    NULL,                     /* fapl_free            */
+    0,                        /* dxpl_size            */
+    NULL,                     /* dxpl_copy            */
+    NULL,                     /* dxpl_free            */
+    H5FD__sec2_open,          /* open                 */
+    H5FD__sec2_close,         /* close                */
+    H5FD__sec2_cmp,           /* cmp                  */
+    H5FD__sec2_query,         /* query                */
+    NULL,                     /* get_type_map         */
+    NULL,                     /* alloc                */
+    NULL,                     /* free                 */
+    H5FD__sec2_get_eoa,       /* get_eoa              */
+    H5FD__sec2_set_eoa,       /* set_eoa              */
+    H5FD__sec2_get_eof,       /* get_eof              */
+    H5FD__sec2_get_handle,    /* get_handle           */
+    H5FD__sec2_read,          /* read                 */
+    H5FD__sec2_write,         /* write                */
+    NULL,                     /* flush                */
+    H5FD__sec2_truncate,      /* truncate             */
+    H5FD__sec2_lock,          /* lock                 */
+    H5FD__sec2_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,     /* fl_map               */
+    H5FD__sec2_read_vector,   /* read_vector          */
+    H5FD__sec2_write_vector   /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -268,8 +370,8 @@ H5FD__sec2_term(void)
  * Function:    H5Pset_fapl_sec2
  *
  * Purpose:     Modify the file access property list to use the H5FD_SEC2
- *              driver defined in this source file.  There are no driver
- *              specific properties.
+ *              driver defined in this source file.  Large reads aren't
+ *              striped (see H5Pset_fapl_sec2_striping).
  *
  * Return:      SUCCEED/FAIL
  *
@@ -296,6 +398,266 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_fapl_sec2() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_sec2_striping
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_SEC2
+ *              driver, with large reads striped across threads.  A read
+ *              larger than STRIPE_SIZE bytes is split into slices of that
+ *              size, which up to NTHREADS threads (counting the calling
+ *              thread) read at once.  A zero STRIPE_SIZE selects the
+ *              default, H5FD_SEC2_STRIPE_SIZE_DEF; an NTHREADS of zero or
+ *              one turns striping off.  Other sec2 settings in the list,
+ *              such as read-ahead, are kept.
+ *
+ *              Striping needs pread() and Pthreads.  Where they are not
+ *              available the settings are accepted but reads are never
+ *              striped.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_sec2_striping(hid_t fapl_id, size_t stripe_size, unsigned nthreads)
+{
+    H5P_genplist_t *        plist;  /* Property list pointer */
+    const H5FD_sec2_fapl_t *old_fa; /* Current sec2 settings */
+    H5FD_sec2_fapl_t        fa;
+    herr_t                  ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "izIu", fapl_id, stripe_size, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (nthreads > H5FD_SEC2_STRIPE_THREADS_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many threads")
+
+    /* Keep the other sec2 settings, if the list already has any */
+    if (H5FD_SEC2 == H5P_peek_driver(plist) && NULL != (old_fa = H5P_peek_driver_info(plist)))
+        fa = *old_fa;
+    else
+        fa = H5FD_sec2_default_fa_g;
+    fa.stripe_size = (stripe_size != 0) ? stripe_size : H5FD_SEC2_STRIPE_SIZE_DEF;
+    fa.nthreads    = (nthreads != 0) ? nthreads : 1;
+
+    ret_value = H5P_set_driver(plist, H5FD_SEC2, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_sec2_striping() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_sec2_striping
+ *
+ * Purpose:     Returns the read striping settings of a sec2 file access
+ *              property list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_sec2_striping(hid_t fapl_id, size_t *stripe_size /*out*/, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *        plist; /* Property list pointer */
+    const H5FD_sec2_fapl_t *fa;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, stripe_size, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_SEC2 != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_sec2_fapl_t *)H5P_peek_driver_info(plist)))
+        fa = &H5FD_sec2_default_fa_g;
+    if (stripe_size)
+        *stripe_size = fa->stripe_size;
+    if (nthreads)
+        *nthreads = fa->nthreads;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_sec2_striping() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_sec2_readahead
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_SEC2
+ *              driver, with read-ahead of raw data.  The driver watches
+ *              the addresses of raw data reads.  Once they run forward
+ *              sequentially, the data after each read is read with it,
+ *              in a window which starts small and doubles while the
+ *              application keeps reading on, up to MAX_SIZE bytes.  Later
+ *              reads in the window are copied from memory.  Reads a fixed
+ *              distance apart are announced to the kernel ahead of time
+ *              with posix_fadvise(), where it exists.
+ *
+ *              A MAX_SIZE of zero turns read-ahead off.  Other sec2
+ *              settings in the list, such as striping, are kept.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_sec2_readahead(hid_t fapl_id, size_t max_size)
+{
+    H5P_genplist_t *        plist;  /* Property list pointer */
+    const H5FD_sec2_fapl_t *old_fa; /* Current sec2 settings */
+    H5FD_sec2_fapl_t        fa;
+    herr_t                  ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, max_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    /* Keep the other sec2 settings, if the list already has any */
+    if (H5FD_SEC2 == H5P_peek_driver(plist) && NULL != (old_fa = H5P_peek_driver_info(plist)))
+        fa = *old_fa;
+    else
+        fa = H5FD_sec2_default_fa_g;
+    fa.readahead_max = max_size;
+
+    ret_value = H5P_set_driver(plist, H5FD_SEC2, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_sec2_readahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_sec2_readahead
+ *
+ * Purpose:     Returns the largest read-ahead window of a sec2 file access
+ *              property list through the function argument.  Zero means
+ *              read-ahead is off.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_sec2_readahead(hid_t fapl_id, size_t *max_size /*out*/)
+{
+    H5P_genplist_t *        plist; /* Property list pointer */
+    const H5FD_sec2_fapl_t *fa;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, max_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_SEC2 != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_sec2_fapl_t *)H5P_peek_driver_info(plist)))
+        fa = &H5FD_sec2_default_fa_g;
+    if (max_size)
+        *max_size = fa->readahead_max;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_sec2_readahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_get_readahead_stats
+ *
+ * Purpose:     Retrieves the read-ahead counters of a file: the number of
+ *              raw data reads, how many of them were served from the
+ *              read-ahead buffer, and how many read-ahead reads were made.
+ *              All are zero when read-ahead is off.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_sec2_get_readahead_stats(const H5FD_t *_file, hsize_t *reads /*out*/, hsize_t *hits /*out*/,
+                              hsize_t *fills /*out*/)
+{
+    const H5FD_sec2_t *file      = (const H5FD_sec2_t *)_file;
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file);
+
+    if (file->pub.driver_id != H5FD_SEC2_g)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file driver doesn't read ahead")
+
+    if (reads)
+        *reads = file->ra_reads;
+    if (hits)
+        *hits = file->ra_hits;
+    if (fills)
+        *fills = file->ra_fills;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_get_readahead_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct, or NULL
+ *                          if reads are neither striped nor read ahead.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__sec2_fapl_get(H5FD_t *_file)
+{
+    H5FD_sec2_t *file      = (H5FD_sec2_t *)_file;
+    void *       ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Files opened without striping or read-ahead have no driver info, as
+     * before
+     */
+    if (file->fa.nthreads > 1 || file->fa.readahead_max > 0)
+        ret_value = H5FD__sec2_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_fapl_copy
+ *
+ * Purpose:     Copies the sec2-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__sec2_fapl_copy(const void *_old_fa)
+{
+    const H5FD_sec2_fapl_t *old_fa = (const H5FD_sec2_fapl_t *)_old_fa;
+    H5FD_sec2_fapl_t *      new_fa = H5MM_calloc(sizeof(H5FD_sec2_fapl_t));
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(new_fa);
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_sec2_fapl_t));
+
+    FUNC_LEAVE_NOAPI(new_fa)
+} /* end H5FD__sec2_fapl_copy() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_open
  *
@@ -320,9 +682,10 @@ H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
 #ifdef H5_HAVE_WIN32_API
     struct _BY_HANDLE_FILE_INFORMATION fileinfo;
 #endif
-    h5_stat_t       sb;
-    H5P_genplist_t *plist;            /* Property list pointer */
-    H5FD_t *        ret_value = NULL; /* Return value */
+    h5_stat_t               sb;
+    const H5FD_sec2_fapl_t *fa;               /* Driver properties     */
+    H5P_genplist_t *        plist;            /* Property list pointer */
+    H5FD_t *                ret_value = NULL; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -364,8 +727,10 @@ H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
 
     file->fd = fd;
     H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
-    file->pos = HADDR_UNDEF;
-    file->op  = OP_UNKNOWN;
+    file->pos          = HADDR_UNDEF;
+    file->op           = OP_UNKNOWN;
+    file->ra_last_addr = HADDR_UNDEF;
+    file->ra_addr      = HADDR_UNDEF;
 #ifdef H5_HAVE_WIN32_API
     file->hFile = (HANDLE)_get_osfhandle(fd);
     if (INVALID_HANDLE_VALUE == file->hFile)
@@ -386,6 +751,11 @@ H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
         HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
 
+    /* Get the driver specific information */
+    if (NULL == (fa = (const H5FD_sec2_fapl_t *)H5P_peek_driver_info(plist)))
+        fa = &H5FD_sec2_default_fa_g;
+    file->fa = *fa;
+
     /* Check the file locking flags in the fapl */
     if (ignore_disabled_file_locks_s != FAIL)
         /* The environment variable was set, so use that preferentially */
@@ -455,6 +825,9 @@ H5FD__sec2_close(H5FD_t *_file)
     if (HDclose(file->fd) < 0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
 
+    /* Release the read-ahead buffer */
+    file->ra_buf = (unsigned char *)H5MM_xfree(file->ra_buf);
+
     /* Release the file info */
     file = H5FL_FREE(H5FD_sec2_t, file);
 
@@ -696,11 +1069,13 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
-                size_t size, void *buf /*out*/)
+H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr, size_t size,
+                void *buf /*out*/)
 {
     H5FD_sec2_t *file      = (H5FD_sec2_t *)_file;
     HDoff_t      offset    = (HDoff_t)addr;
+    void *       user_buf  = NULL;    /* Caller's buffer, during a read-ahead */
+    size_t       user_size = 0;       /* Caller's size, during a read-ahead   */
     herr_t       ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -714,6 +1089,32 @@ H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
 
+    /* Raw data reads may be served from, or start, a read-ahead */
+    if (file->fa.readahead_max > 0 && H5FD_MEM_DRAW == type) {
+        hbool_t hit;       /* Whether the buffer holds all the data */
+        size_t  fill_size; /* Size of the read-ahead to do          */
+
+        hit = file->ra_len > 0 && addr >= file->ra_addr && (addr + size) <= (file->ra_addr + file->ra_len);
+        fill_size = H5FD__sec2_readahead_plan(file, addr, size, hit);
+
+        file->ra_reads++;
+        if (hit) {
+            H5MM_memcpy(buf, file->ra_buf + (addr - file->ra_addr), size);
+            file->ra_hits++;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Read the whole window into the buffer instead */
+        if (fill_size > 0) {
+            user_buf      = buf;
+            user_size     = size;
+            buf           = file->ra_buf;
+            size          = fill_size;
+            file->ra_addr = addr;
+            file->ra_len  = 0;
+        } /* end if */
+    }     /* end if */
+
 #ifndef H5_HAVE_PREADWRITE
     /* Seek to the correct location (if we don't have pread) */
     if (addr != file->pos || OP_READ != file->op)
@@ -721,6 +1122,16 @@ H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
             HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
 #endif /* H5_HAVE_PREADWRITE */
 
+#ifdef H5FD_SEC2_STRIPED_READ
+    /* Split large reads across several threads */
+    if (file->fa.nthreads > 1 && size > file->fa.stripe_size) {
+        if (H5FD__sec2_read_striped(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "striped file read failed")
+        addr += (haddr_t)size;
+        size = 0;
+    } /* end if */
+#endif /* H5FD_SEC2_STRIPED_READ */
+
     /* Read data, being careful of interrupted system calls, partial results,
      * and the end of the file.
      */
@@ -775,6 +1186,13 @@ H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         buf = (char *)buf + bytes_read;
     } /* end while */
 
+    /* Hand the caller its part of a read-ahead */
+    if (user_buf) {
+        file->ra_len = (size_t)(addr - file->ra_addr);
+        file->ra_fills++;
+        H5MM_memcpy(user_buf, file->ra_buf, user_size);
+    } /* end if */
+
     /* Update current position */
     file->pos = addr;
     file->op  = OP_READ;
@@ -789,6 +1207,265 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_read() */
 
+#ifdef H5FD_SEC2_STRIPED_READ
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_read_striped
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF, split into slices of the file's stripe
+ *              size.  The calling thread and up to nthreads - 1 extra
+ *              threads each read every nthreads-th slice, straight into
+ *              its place in BUF.
+ *
+ *              If a thread can't be started, its slices are read by the
+ *              calling thread instead.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_read_striped(H5FD_sec2_t *file, haddr_t addr, size_t size, void *buf)
+{
+    H5FD_sec2_stripe_t *stripes   = NULL;    /* Work for each thread         */
+    pthread_t *         threads   = NULL;    /* Threads started              */
+    hbool_t *           started   = NULL;    /* Whether each thread started  */
+    size_t              nslices;             /* # of slices in the read      */
+    size_t              nworkers;            /* # of threads reading         */
+    size_t              u;                   /* Local index variable         */
+    herr_t              ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file->fa.nthreads > 1);
+    HDassert(file->fa.stripe_size > 0);
+
+    nslices  = (size + file->fa.stripe_size - 1) / file->fa.stripe_size;
+    nworkers = MIN(nslices, (size_t)file->fa.nthreads);
+
+    if (NULL == (stripes = (H5FD_sec2_stripe_t *)H5MM_malloc(nworkers * sizeof(H5FD_sec2_stripe_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate stripe descriptions")
+    if (NULL == (threads = (pthread_t *)H5MM_malloc(nworkers * sizeof(pthread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread handles")
+    if (NULL == (started = (hbool_t *)H5MM_calloc(nworkers * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread flags")
+
+    for (u = 0; u < nworkers; u++) {
+        stripes[u].fd          = file->fd;
+        stripes[u].offset      = (HDoff_t)addr;
+        stripes[u].buf         = (unsigned char *)buf;
+        stripes[u].size        = size;
+        stripes[u].stripe_size = file->fa.stripe_size;
+        stripes[u].first       = u;
+        stripes[u].stride      = nworkers;
+        stripes[u].err         = 0;
+        stripes[u].err_offset  = 0;
+    } /* end for */
+
+    /* Start the extra threads, then do the first share of the work here */
+    for (u = 1; u < nworkers; u++)
+        if (0 == pthread_create(&threads[u], NULL, H5FD__sec2_stripe_read, &stripes[u]))
+            started[u] = TRUE;
+    H5FD__sec2_stripe_read(&stripes[0]);
+
+    /* Wait for the other threads, or do their work if they didn't start */
+    for (u = 1; u < nworkers; u++) {
+        if (started[u])
+            pthread_join(threads[u], NULL);
+        else
+            H5FD__sec2_stripe_read(&stripes[u]);
+    } /* end for */
+
+    /* Report the first error */
+    for (u = 0; u < nworkers; u++)
+        if (stripes[u].err != 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file read failed: filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', total read size = %llu, offset = %llu",
+                        file->filename, file->fd, stripes[u].err, HDstrerror(stripes[u].err),
+                        (unsigned long long)size, (unsigned long long)stripes[u].err_offset);
+
+done:
+    H5MM_xfree(stripes);
+    H5MM_xfree(threads);
+    H5MM_xfree(started);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_read_striped() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_stripe_read
+ *
+ * Purpose:     Thread start routine for striped reads: reads every
+ *              stride-th slice of the request, starting with slice
+ *              'first'.  Bytes past the end of the file read as zeros.
+ *
+ *              This runs outside of the library's API context, so it
+ *              doesn't use the FUNC_ENTER macros or the error stack and
+ *              just records the errno value of a failed read.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__sec2_stripe_read(void *_stripe)
+{
+    H5FD_sec2_stripe_t *stripe = (H5FD_sec2_stripe_t *)_stripe;
+    size_t              slice_start;
+
+    for (slice_start = stripe->first * stripe->stripe_size; slice_start < stripe->size;
+         slice_start += stripe->stride * stripe->stripe_size) {
+        unsigned char *buf    = stripe->buf + slice_start;
+        HDoff_t        offset = stripe->offset + (HDoff_t)slice_start;
+        size_t         size   = MIN(stripe->stripe_size, stripe->size - slice_start);
+
+        /* Read the slice, being careful of interrupted system calls,
+         * partial results, and the end of the file.
+         */
+        while (size > 0) {
+            h5_posix_io_t     bytes_in   = 0;  /* # of bytes to read       */
+            h5_posix_io_ret_t bytes_read = -1; /* # of bytes actually read */
+
+            if (size > H5_POSIX_MAX_IO_BYTES)
+                bytes_in = H5_POSIX_MAX_IO_BYTES;
+            else
+                bytes_in = (h5_posix_io_t)size;
+
+            do {
+                bytes_read = HDpread(stripe->fd, buf, bytes_in, offset);
+            } while (-1 == bytes_read && EINTR == errno);
+
+            if (-1 == bytes_read) {
+                stripe->err        = errno;
+                stripe->err_offset = offset;
+                return NULL;
+            } /* end if */
+
+            if (0 == bytes_read) {
+                /* end of file but not end of format address space */
+                HDmemset(buf, 0, size);
+                break;
+            } /* end if */
+
+            size -= (size_t)bytes_read;
+            offset += bytes_read;
+            buf += bytes_read;
+        } /* end while */
+    }     /* end for */
+
+    return NULL;
+} /* end H5FD__sec2_stripe_read() */
+#endif /* H5FD_SEC2_STRIPED_READ */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_readahead_plan
+ *
+ * Purpose:     Records a raw data read of SIZE bytes at ADDR in the access
+ *              history of FILE and decides what to read ahead for it.
+ *              HIT tells whether the read-ahead buffer already holds the
+ *              data.
+ *
+ *              Once H5FD_SEC2_RA_TRIGGER reads in a row have each started
+ *              where the one before ended, a read the buffer can't serve
+ *              is widened to the read-ahead window, which doubles every
+ *              time, up to the fapl's limit.  Once they have each been
+ *              the same distance apart instead, the next reads of the
+ *              pattern are advised to the kernel, where posix_fadvise()
+ *              is available.  Any other read resets the window.
+ *
+ * Return:      Size to read into the read-ahead buffer instead of SIZE
+ *              bytes, or zero to read as usual.  Never fails; read-ahead
+ *              is skipped if its buffer can't be allocated.
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5FD__sec2_readahead_plan(H5FD_sec2_t *file, haddr_t addr, size_t size, hbool_t hit)
+{
+    hbool_t sequential = FALSE; /* Whether this read follows the last one */
+    hbool_t strided    = FALSE; /* Whether it is one stride past the last */
+    size_t  ret_value  = 0;     /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(file->fa.readahead_max > 0);
+
+    /* Classify this read against the last one */
+    if (H5F_addr_defined(file->ra_last_addr)) {
+        if (addr == file->ra_last_addr + file->ra_last_size)
+            sequential = TRUE;
+        else if (addr > file->ra_last_addr && file->ra_stride == (hsize_t)(addr - file->ra_last_addr))
+            strided = TRUE;
+    } /* end if */
+    if (sequential || strided)
+        file->ra_streak++;
+    else {
+        file->ra_streak = 0;
+        file->ra_window = 0;
+    } /* end else */
+
+    /* Update the history */
+    if (H5F_addr_defined(file->ra_last_addr) && addr > file->ra_last_addr)
+        file->ra_stride = (hsize_t)(addr - file->ra_last_addr);
+    else
+        file->ra_stride = 0;
+    file->ra_last_addr = addr;
+    file->ra_last_size = size;
+
+    if (hit || file->ra_streak < H5FD_SEC2_RA_TRIGGER)
+        HGOTO_DONE(0)
+
+    if (sequential) {
+        size_t window; /* Read-ahead window for this read */
+
+        /* Reads as large as the window gain nothing from it */
+        if (size >= file->fa.readahead_max || addr >= file->eof)
+            HGOTO_DONE(0)
+
+        if (NULL == file->ra_buf)
+            if (NULL == (file->ra_buf = (unsigned char *)H5MM_malloc(file->fa.readahead_max)))
+                HGOTO_DONE(0)
+
+        if (0 == file->ra_window)
+            window = MAX(2 * size, H5FD_SEC2_RA_WINDOW_MIN);
+        else
+            window = 2 * file->ra_window;
+        file->ra_window = MIN(window, file->fa.readahead_max);
+
+        /* Don't read ahead past the end of the file */
+        window = (size_t)MIN((haddr_t)file->ra_window, file->eof - addr);
+        if (window > size)
+            ret_value = window;
+
+#ifdef H5_HAVE_POSIX_FADVISE
+        /* Have the kernel start on the window after this one */
+        if (ret_value > 0 && (addr + ret_value) < file->eof)
+            if (0 == HDposix_fadvise(file->fd, (HDoff_t)(addr + ret_value), (HDoff_t)file->ra_window,
+                                     POSIX_FADV_WILLNEED))
+                file->ra_advised++;
+#endif /* H5_HAVE_POSIX_FADVISE */
+    }  /* end if */
+#ifdef H5_HAVE_POSIX_FADVISE
+    else {
+        unsigned u;
+
+        /* Advise all the next reads when the pattern is first seen, then
+         * the one furthest ahead for each read after that
+         */
+        u = (file->ra_streak == H5FD_SEC2_RA_TRIGGER) ? 1 : H5FD_SEC2_RA_STRIDE_DEPTH;
+        for (; u <= H5FD_SEC2_RA_STRIDE_DEPTH; u++)
+            if (0 == HDposix_fadvise(file->fd, (HDoff_t)(addr + u * file->ra_stride), (HDoff_t)size,
+                                     POSIX_FADV_WILLNEED))
+                file->ra_advised++;
+    } /* end else */
+#endif /* H5_HAVE_POSIX_FADVISE */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_readahead_plan() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_write
  *
@@ -823,6 +1500,10 @@ H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
                     (unsigned long long)addr, (unsigned long long)size)
 
+    /* Drop read-ahead data this write makes stale */
+    if (file->ra_len > 0 && addr < (file->ra_addr + file->ra_len) && file->ra_addr < (addr + size))
+        file->ra_len = 0;
+
 #ifndef H5_HAVE_PREADWRITE
     /* Seek to the correct location (if we don't have pwrite) */
     if (addr != file->pos || OP_WRITE != file->op)
@@ -894,6 +1575,377 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_write() */
 
+#ifdef H5_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_vector_run
+ *
+ * Purpose:     Determines how many extents, starting with extent START,
+ *              form a run of file-adjacent extents that can be handed to
+ *              a single preadv()/pwritev() call.  Zero-sized extents
+ *              inside the run are absorbed into it.
+ *
+ * Return:      Number of extents in the run (always at least one).  The
+ *              total number of bytes in the run is returned in RUN_SIZE.
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5FD__sec2_vector_run(uint32_t count, const haddr_t addrs[], const size_t sizes[], uint32_t start,
+                      size_t *run_size)
+{
+    haddr_t  next_addr = addrs[start] + sizes[start]; /* Address following the run so far */
+    size_t   total     = sizes[start];                /* Bytes in the run so far */
+    uint32_t nvec      = 1;                           /* Number of extents in the run */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while (start + nvec < count && nvec < H5FD_SEC2_IOV_MAX) {
+        uint32_t u = start + nvec;
+
+        /* Stop at the first gap (or overlap) in the file */
+        if (sizes[u] > 0 && addrs[u] != next_addr)
+            break;
+
+        /* Don't let the run grow beyond what one POSIX I/O call may transfer */
+        if (sizes[u] > (size_t)H5_POSIX_MAX_IO_BYTES - total)
+            break;
+
+        total += sizes[u];
+        next_addr += sizes[u];
+        nvec++;
+    } /* end while */
+
+    *run_size = total;
+
+    FUNC_LEAVE_NOAPI(nvec)
+} /* end H5FD__sec2_vector_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_readv
+ *
+ * Purpose:     Reads SIZE bytes of contiguous file data beginning at
+ *              address ADDR into the IOVCNT memory buffers described by
+ *              IOV, being careful of interrupted system calls, partial
+ *              results, and the end of the file.  The IOV array is
+ *              modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_readv(H5FD_sec2_t *file, haddr_t addr, struct iovec *iov, int iovcnt, size_t size)
+{
+    HDoff_t offset    = (HDoff_t)addr;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while (size > 0) {
+        ssize_t bytes_read = -1; /* # of bytes actually read */
+
+        do {
+            bytes_read = HDpreadv(file->fd, iov, iovcnt, offset);
+        } while (-1 == bytes_read && EINTR == errno);
+
+        if (-1 == bytes_read) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = "
+                        "%d, error message = '%s', total read size = %llu, vector count = %d, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno),
+                        (unsigned long long)size, iovcnt, (unsigned long long)offset);
+        } /* end if */
+
+        if (0 == bytes_read) {
+            /* end of file but not end of format address space */
+            while (iovcnt > 0) {
+                HDmemset(iov->iov_base, 0, iov->iov_len);
+                iov++;
+                iovcnt--;
+            } /* end while */
+            break;
+        } /* end if */
+
+        HDassert((size_t)bytes_read <= size);
+
+        size -= (size_t)bytes_read;
+        offset += (HDoff_t)bytes_read;
+
+        /* Skip past the buffers that were filled completely */
+        while (iovcnt > 0 && (size_t)bytes_read >= iov->iov_len) {
+            bytes_read -= (ssize_t)iov->iov_len;
+            iov++;
+            iovcnt--;
+        } /* end while */
+
+        /* Adjust the partially filled buffer */
+        if (bytes_read > 0) {
+            iov->iov_base = (char *)iov->iov_base + bytes_read;
+            iov->iov_len -= (size_t)bytes_read;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_readv() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_writev
+ *
+ * Purpose:     Writes SIZE bytes of contiguous file data beginning at
+ *              address ADDR from the IOVCNT memory buffers described by
+ *              IOV, being careful of interrupted system calls and partial
+ *              results.  The IOV array is modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_writev(H5FD_sec2_t *file, haddr_t addr, struct iovec *iov, int iovcnt, size_t size)
+{
+    HDoff_t offset    = (HDoff_t)addr;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while (size > 0) {
+        ssize_t bytes_wrote = -1; /* # of bytes written */
+
+        do {
+            bytes_wrote = HDpwritev(file->fd, iov, iovcnt, offset);
+        } while (-1 == bytes_wrote && EINTR == errno);
+
+        if (-1 == bytes_wrote) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = "
+                        "%d, error message = '%s', total write size = %llu, vector count = %d, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno),
+                        (unsigned long long)size, iovcnt, (unsigned long long)offset);
+        } /* end if */
+
+        HDassert(bytes_wrote > 0);
+        HDassert((size_t)bytes_wrote <= size);
+
+        size -= (size_t)bytes_wrote;
+        offset += (HDoff_t)bytes_wrote;
+
+        /* Skip past the buffers that were written completely */
+        while (iovcnt > 0 && (size_t)bytes_wrote >= iov->iov_len) {
+            bytes_wrote -= (ssize_t)iov->iov_len;
+            iov++;
+            iovcnt--;
+        } /* end while */
+
+        /* Adjust the partially written buffer */
+        if (bytes_wrote > 0) {
+            iov->iov_base = (char *)iov->iov_base + bytes_wrote;
+            iov->iov_len -= (size_t)bytes_wrote;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_writev() */
+#endif /* H5_HAVE_PREADWRITEV */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_read_vector
+ *
+ * Purpose:     Reads COUNT extents, described by the ADDRS and SIZES
+ *              arrays, into the buffers in BUFS.  Runs of extents that
+ *              are adjacent in the file are read with a single preadv()
+ *              call when it is available; isolated extents go through
+ *              H5FD__sec2_read().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t * file      = (H5FD_sec2_t *)_file;
+    struct iovec *iov       = NULL;    /* I/O vectors for preadv() */
+    uint32_t      u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(types && addrs && sizes && bufs);
+
+    u = 0;
+    while (u < count) {
+        size_t   run_size = sizes[u]; /* Bytes in the current run of extents */
+        uint32_t nvec     = 1;        /* Number of extents in the current run */
+
+#ifdef H5_HAVE_PREADWRITEV
+        nvec = H5FD__sec2_vector_run(count, addrs, sizes, u, &run_size);
+#endif /* H5_HAVE_PREADWRITEV */
+
+        if (0 == run_size)
+            ; /* nothing to do */
+        else if (1 == nvec) {
+            if (H5FD__sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        } /* end if */
+#ifdef H5_HAVE_PREADWRITEV
+        else {
+            uint32_t v;
+            int      iovcnt = 0;
+
+            /* Check for overflow conditions */
+            if (!H5F_addr_defined(addrs[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                            (unsigned long long)addrs[u])
+            if (REGION_OVERFLOW(addrs[u], run_size))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu",
+                            (unsigned long long)addrs[u])
+
+            /* Allocate the I/O vectors the first time they're needed */
+            if (NULL == iov && NULL == (iov = (struct iovec *)H5MM_malloc(
+                                            (size_t)MIN(count, H5FD_SEC2_IOV_MAX) * sizeof(struct iovec))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vectors")
+
+            for (v = u; v < u + nvec; v++)
+                if (sizes[v] > 0) {
+                    iov[iovcnt].iov_base = bufs[v];
+                    iov[iovcnt].iov_len  = sizes[v];
+                    iovcnt++;
+                } /* end if */
+
+            if (H5FD__sec2_readv(file, addrs[u], iov, iovcnt, run_size) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+            /* Update current position */
+            file->pos = addrs[u] + run_size;
+            file->op  = OP_READ;
+        } /* end else */
+#endif /* H5_HAVE_PREADWRITEV */
+
+        u += nvec;
+    } /* end while */
+
+done:
+    if (iov)
+        H5MM_xfree(iov);
+
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_write_vector
+ *
+ * Purpose:     Writes COUNT extents, described by the ADDRS and SIZES
+ *              arrays, from the buffers in BUFS.  Runs of extents that
+ *              are adjacent in the file are written with a single
+ *              pwritev() call when it is available; isolated extents go
+ *              through H5FD__sec2_write().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t * file      = (H5FD_sec2_t *)_file;
+    struct iovec *iov       = NULL;    /* I/O vectors for pwritev() */
+    uint32_t      u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(types && addrs && sizes && bufs);
+
+    /* Drop any read-ahead data, which the writes may make stale */
+    file->ra_len = 0;
+
+    u = 0;
+    while (u < count) {
+        size_t   run_size = sizes[u]; /* Bytes in the current run of extents */
+        uint32_t nvec     = 1;        /* Number of extents in the current run */
+
+#ifdef H5_HAVE_PREADWRITEV
+        nvec = H5FD__sec2_vector_run(count, addrs, sizes, u, &run_size);
+#endif /* H5_HAVE_PREADWRITEV */
+
+        if (0 == run_size)
+            ; /* nothing to do */
+        else if (1 == nvec) {
+            if (H5FD__sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end if */
+#ifdef H5_HAVE_PREADWRITEV
+        else {
+            uint32_t v;
+            int      iovcnt = 0;
+
+            /* Check for overflow conditions */
+            if (!H5F_addr_defined(addrs[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                            (unsigned long long)addrs[u])
+            if (REGION_OVERFLOW(addrs[u], run_size))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                            (unsigned long long)addrs[u], (unsigned long long)run_size)
+
+            /* Allocate the I/O vectors the first time they're needed */
+            if (NULL == iov && NULL == (iov = (struct iovec *)H5MM_malloc(
+                                            (size_t)MIN(count, H5FD_SEC2_IOV_MAX) * sizeof(struct iovec))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vectors")
+
+            for (v = u; v < u + nvec; v++)
+                if (sizes[v] > 0) {
+                    H5_GCC_DIAG_OFF("cast-qual")
+                    iov[iovcnt].iov_base = (void *)bufs[v];
+                    H5_GCC_DIAG_ON("cast-qual")
+                    iov[iovcnt].iov_len = sizes[v];
+                    iovcnt++;
+                } /* end if */
+
+            if (H5FD__sec2_writev(file, addrs[u], iov, iovcnt, run_size) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+
+            /* Update current position and eof */
+            file->pos = addrs[u] + run_size;
+            file->op  = OP_WRITE;
+            if (file->pos > file->eof)
+                file->eof = file->pos;
+        } /* end else */
+#endif /* H5_HAVE_PREADWRITEV */
+
+        u += nvec;
+    } /* end while */
+
+done:
+    if (iov)
+        H5MM_xfree(iov);
+
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_truncate
  *
@@ -956,6 +2008,9 @@ H5FD__sec2_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
+
+        /* Drop any read-ahead data, which may lie past the new end */
+        file->ra_len = 0;
     } /* end if */
 
 done:
@@ -26,8 +26,21 @@
 extern "C" {
 #endif
 
+/* Default size of the slices a large read is split into when it is striped
+ * across several threads.  Application can set this value and the number of
+ * threads through the function H5Pset_fapl_sec2_striping. */
+#define H5FD_SEC2_STRIPE_SIZE_DEF (8 * 1024 * 1024)
+
+/* Largest number of threads accepted by H5Pset_fapl_sec2_striping */
+#define H5FD_SEC2_STRIPE_THREADS_MAX 64
+
 H5_DLL hid_t  H5FD_sec2_init(void);
 H5_DLL herr_t H5Pset_fapl_sec2(hid_t fapl_id);
+H5_DLL herr_t H5Pset_fapl_sec2_striping(hid_t fapl_id, size_t stripe_size, unsigned nthreads);
+H5_DLL herr_t H5Pget_fapl_sec2_striping(hid_t fapl_id, size_t *stripe_size /*out*/,
+                                        unsigned *nthreads /*out*/);
+H5_DLL herr_t H5Pset_fapl_sec2_readahead(hid_t fapl_id, size_t max_size);
+H5_DLL herr_t H5Pget_fapl_sec2_readahead(hid_t fapl_id, size_t *max_size /*out*/);
 
 #ifdef __cplusplus
 }
@@ -14,6 +14,10 @@
  * Purpose:     The Splitter VFD implements a file driver which relays all the
  *              VFD calls to an underlying VFD, and send all the write calls to
  *              another underlying VFD. Maintains two files simultaneously.
+ *
+ *              Writes to the W/O channel can optionally be queued and
+ *              issued by a background thread ("write-behind"), so that
+ *              writes only wait for the R/W channel.
  */
 
 /* This source code file is part of the H5FD driver module */
@@ -28,6 +32,15 @@
 #include "H5Iprivate.h"   /* IDs                      */
 #include "H5MMprivate.h"  /* Memory management        */
 #include "H5Pprivate.h"   /* Property lists           */
+#include "H5FDsec2.h"     /* Sec2 file driver         */
+
+/* W/O channel writes are only issued from a background thread when
+ * Pthreads are available, and the code stack (which is global) isn't in use.
+ */
+#if defined(H5_HAVE_PTHREAD_H) && defined(H5_HAVE_LIBPTHREAD) && !defined(H5_HAVE_CODESTACK)
+#define H5FD_SPLITTER_WRITE_BEHIND
+#include <pthread.h>
+#endif
 
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SPLITTER_g = 0;
@@ -39,18 +52,56 @@ typedef struct H5FD_splitter_fapl_t {
     char    wo_path[H5FD_SPLITTER_PATH_MAX + 1];       /* file name for the W/O channel */
     char    log_file_path[H5FD_SPLITTER_PATH_MAX + 1]; /* file to record errors reported by the W/O channel */
     hbool_t ignore_wo_errs;                            /* TRUE to ignore errors on the W/O channel */
+    size_t  wo_write_behind_size;                      /* memory budget for queued W/O writes */
 } H5FD_splitter_fapl_t;
 
+/* Write-behind state for the W/O channel, defined below */
+struct H5FD_splitter_wb_t;
+
 /* The information of this splitter */
 typedef struct H5FD_splitter_t {
-    H5FD_t               pub;     /* public stuff, must be first    */
-    unsigned             version; /* version of the H5FD_splitter_vfd_config_t structure used */
-    H5FD_splitter_fapl_t fa;      /* driver-specific file access properties */
-    H5FD_t *             rw_file; /* pointer of R/W channel */
-    H5FD_t *             wo_file; /* pointer of W/O channel */
-    FILE *               logfp;   /* Log file pointer */
+    H5FD_t                     pub;     /* public stuff, must be first    */
+    unsigned                   version; /* version of the H5FD_splitter_vfd_config_t structure used */
+    H5FD_splitter_fapl_t       fa;      /* driver-specific file access properties */
+    H5FD_t *                   rw_file; /* pointer of R/W channel */
+    H5FD_t *                   wo_file; /* pointer of W/O channel */
+    FILE *                     logfp;   /* Log file pointer */
+    struct H5FD_splitter_wb_t *wb;      /* W/O write-behind state; NULL when W/O writes are synchronous */
 } H5FD_splitter_t;
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+/* A write queued for the W/O channel.  The data follows the struct. */
+typedef struct H5FD_splitter_wb_op_t {
+    struct H5FD_splitter_wb_op_t *next; /* next write in the queue */
+    H5FD_mem_t                    type; /* type of the data */
+    haddr_t                       addr; /* address of the write */
+    size_t                        size; /* size of the write */
+} H5FD_splitter_wb_op_t;
+
+/* The W/O write-behind queue and its thread.  'mutex' protects the queue,
+ * the counters and the flags; 'io_mutex' is held by the thread while it
+ * writes to the W/O file, and by the main thread while it changes the W/O
+ * file's EOA.
+ */
+typedef struct H5FD_splitter_wb_t {
+    H5FD_t *               wo_file;    /* the W/O channel */
+    size_t                 budget;     /* max. # of bytes queued */
+    pthread_t              thread;     /* the write-behind thread */
+    pthread_mutex_t        mutex;      /* protects everything below */
+    pthread_mutex_t        io_mutex;   /* serializes access to wo_file */
+    pthread_cond_t         work_cond;  /* signalled when work is queued or on shutdown */
+    pthread_cond_t         space_cond; /* signalled when a queued write completes */
+    H5FD_splitter_wb_op_t *head;       /* oldest queued write */
+    H5FD_splitter_wb_op_t *tail;       /* newest queued write */
+    size_t                 queued;     /* # of bytes queued or being written */
+    hbool_t                busy;       /* whether the thread is writing */
+    hbool_t                shutdown;   /* whether the thread should exit */
+    unsigned long          nfailed;    /* # of failed writes */
+    unsigned long          nreported;  /* # of failed writes reported so far */
+    int                    last_errno; /* errno of the latest failed write */
+} H5FD_splitter_wb_t;
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
 /*
  * These macros check for overflow of various quantities.  These macros
  * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
@@ -84,6 +135,20 @@ typedef struct H5FD_splitter_t {
             HGOTO_ERROR((errmajor), (errminor), (ret), (mesg))                                               \
     }
 
+/* Like H5FD_SPLITTER_WO_ERROR, for queued W/O writes that failed on the
+ * write-behind thread with errno 'err'.
+ */
+#define H5FD_SPLITTER_WB_ERROR(file, funcname, err)                                                          \
+    {                                                                                                        \
+        char wb_mesg[128];                                                                                   \
+                                                                                                             \
+        HDsnprintf(wb_mesg, sizeof(wb_mesg), "unable to write W/O file, errno = %d, error message = '%s'",   \
+                   (err), HDstrerror(err));                                                                  \
+        H5FD__splitter_log_error((file), (funcname), wb_mesg);                                               \
+        if (FALSE == (file)->fa.ignore_wo_errs)                                                              \
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "%s", wb_mesg)                                        \
+    }
+
 #define H5FD_SPLITTER_DEBUG_OP_CALLS 0 /* debugging print toggle; 0 disables */
 
 #if H5FD_SPLITTER_DEBUG_OP_CALLS
@@ -102,6 +167,17 @@ typedef struct H5FD_splitter_t {
 static herr_t H5FD__splitter_log_error(const H5FD_splitter_t *file, const char *atfunc, const char *msg);
 static int    H5FD__copy_plist(hid_t fapl_id, hid_t *id_out_ptr);
 
+/* W/O channel write-behind */
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+static herr_t  H5FD__splitter_wb_start(H5FD_splitter_t *file);
+static void    H5FD__splitter_wb_stop(H5FD_splitter_t *file);
+static herr_t  H5FD__splitter_wb_write(H5FD_splitter_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                                       size_t size, const void *buf);
+static void    H5FD__splitter_wb_drain(H5FD_splitter_wb_t *wb);
+static int     H5FD__splitter_wb_new_failures(H5FD_splitter_wb_t *wb);
+static void *  H5FD__splitter_wb_worker(void *_wb);
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
 /* Prototypes */
 static herr_t  H5FD__splitter_term(void);
 static hsize_t H5FD__splitter_sb_size(H5FD_t *_file);
@@ -162,7 +238,9 @@ static const H5FD_class_t H5FD_splitter_g = {
     H5FD__splitter_truncate,      /* truncate             */
     H5FD__splitter_lock,          /* lock                 */
     H5FD__splitter_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY          /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,         /* fl_map               */
+    NULL,                         /* read_vector          */
+    NULL                          /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_splitter_t struct */
@@ -303,7 +381,7 @@ H5Pset_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *vfd_config)
 
     if (H5FD_SPLITTER_MAGIC != vfd_config->magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid configuration (magic number mismatch)")
-    if (H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION != vfd_config->version)
+    if (vfd_config->version < 1 || H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION < vfd_config->version)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid config (version number mismatch)")
     if (NULL == (plist_ptr = (H5P_genplist_t *)H5I_object(fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a valid property list")
@@ -339,6 +417,8 @@ H5Pset_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *vfd_config)
         HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate file access property list struct")
 
     info->ignore_wo_errs = vfd_config->ignore_wo_errs;
+    if (vfd_config->version >= 2)
+        info->wo_write_behind_size = vfd_config->wo_write_behind_size;
     HDstrncpy(info->wo_path, vfd_config->wo_path, H5FD_SPLITTER_PATH_MAX);
     HDstrncpy(info->log_file_path, vfd_config->log_file_path, H5FD_SPLITTER_PATH_MAX);
     info->rw_fapl_id = H5P_FILE_ACCESS_DEFAULT; /* pre-set value */
@@ -396,7 +476,7 @@ H5Pget_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config /*out*/)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "config pointer is null")
     if (H5FD_SPLITTER_MAGIC != config->magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "info-out pointer invalid (magic number mismatch)")
-    if (H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION != config->version)
+    if (config->version < 1 || H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION < config->version)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "info-out pointer invalid (version unsafe)")
 
     /* Pre-set out FAPL IDs with intent to replace these values */
@@ -414,6 +494,8 @@ H5Pget_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config /*out*/)
     HDstrncpy(config->wo_path, fapl_ptr->wo_path, H5FD_SPLITTER_PATH_MAX);
     HDstrncpy(config->log_file_path, fapl_ptr->log_file_path, H5FD_SPLITTER_PATH_MAX);
     config->ignore_wo_errs = fapl_ptr->ignore_wo_errs;
+    if (config->version >= 2)
+        config->wo_write_behind_size = fapl_ptr->wo_write_behind_size;
 
     /* Copy R/W and W/O FAPLs */
     if (H5FD__copy_plist(fapl_ptr->rw_fapl_id, &(config->rw_fapl_id)) < 0)
@@ -446,6 +528,15 @@ H5FD__splitter_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closin
     /* Public API for dxpl "context" */
     if (H5FDflush(file->rw_file, dxpl_id, closing) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush R/W file")
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    if (file->wb) {
+        int wb_errno; /* errno of a queued W/O write that failed */
+
+        H5FD__splitter_wb_drain(file->wb);
+        if (0 != (wb_errno = H5FD__splitter_wb_new_failures(file->wb)))
+            H5FD_SPLITTER_WB_ERROR(file, FUNC, wb_errno)
+    }
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
     if (H5FDflush(file->wo_file, dxpl_id, closing) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush W/O file")
 
@@ -525,8 +616,21 @@ H5FD__splitter_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr
     /* Public API for dxpl "context" */
     if (H5FDwrite(file->rw_file, type, dxpl_id, addr, size, buf) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "R/W file write failed")
-    if (H5FDwrite(file->wo_file, type, dxpl_id, addr, size, buf) < 0)
-        H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write W/O file")
+    if (NULL == file->wb) {
+        if (H5FDwrite(file->wo_file, type, dxpl_id, addr, size, buf) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write W/O file")
+    }
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    else {
+        int wb_errno; /* errno of a queued W/O write that failed */
+
+        /* Report earlier W/O writes which failed in the background first */
+        if (0 != (wb_errno = H5FD__splitter_wb_new_failures(file->wb)))
+            H5FD_SPLITTER_WB_ERROR(file, FUNC, wb_errno)
+        if (H5FD__splitter_wb_write(file, type, dxpl_id, addr, size, buf) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write W/O file")
+    }
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -689,7 +793,8 @@ H5FD__splitter_open(const char *name, unsigned flags, hid_t splitter_fapl_id, ha
     /* Copy simpler info */
     HDstrncpy(file_ptr->fa.wo_path, fapl_ptr->wo_path, H5FD_SPLITTER_PATH_MAX);
     HDstrncpy(file_ptr->fa.log_file_path, fapl_ptr->log_file_path, H5FD_SPLITTER_PATH_MAX);
-    file_ptr->fa.ignore_wo_errs = fapl_ptr->ignore_wo_errs;
+    file_ptr->fa.ignore_wo_errs       = fapl_ptr->ignore_wo_errs;
+    file_ptr->fa.wo_write_behind_size = fapl_ptr->wo_write_behind_size;
 
     /* Copy R/W and W/O channel FAPLs. */
     if (H5FD__copy_plist(fapl_ptr->rw_fapl_id, &(file_ptr->fa.rw_fapl_id)) < 0)
@@ -717,6 +822,17 @@ H5FD__splitter_open(const char *name, unsigned flags, hid_t splitter_fapl_id, ha
     if (!file_ptr->wo_file)
         H5FD_SPLITTER_WO_ERROR(file_ptr, FUNC, H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to open W/O file")
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    /* Queue W/O writes to a background thread, if requested.  The thread
+     * calls the W/O driver directly, which is only safe for drivers which
+     * don't touch library state in their write callback, i.e. sec2.
+     */
+    if (file_ptr->fa.wo_write_behind_size > 0 && file_ptr->wo_file &&
+        H5FD_SEC2 == file_ptr->wo_file->driver_id)
+        if (H5FD__splitter_wb_start(file_ptr) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to start W/O write-behind thread")
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     ret_value = (H5FD_t *)file_ptr;
 
 done:
@@ -752,6 +868,7 @@ static herr_t
 H5FD__splitter_close(H5FD_t *_file)
 {
     H5FD_splitter_t *file      = (H5FD_splitter_t *)_file;
+    int              wb_errno  = 0; /* errno of a queued W/O write that failed */
     herr_t           ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -761,6 +878,15 @@ H5FD__splitter_close(H5FD_t *_file)
     /* Sanity check */
     HDassert(file);
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    /* Finish the queued W/O writes and stop the write-behind thread */
+    if (file->wb) {
+        H5FD__splitter_wb_drain(file->wb);
+        wb_errno = H5FD__splitter_wb_new_failures(file->wb);
+        H5FD__splitter_wb_stop(file);
+    }
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     if (H5I_dec_ref(file->fa.rw_fapl_id) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_ARGS, FAIL, "can't close R/W FAPL")
     if (H5I_dec_ref(file->fa.wo_fapl_id) < 0)
@@ -772,6 +898,8 @@ H5FD__splitter_close(H5FD_t *_file)
     if (file->wo_file)
         if (H5FD_close(file->wo_file) == FAIL)
             H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close W/O file")
+    if (wb_errno)
+        H5FD_SPLITTER_WB_ERROR(file, FUNC, wb_errno)
 
     if (file->logfp) {
         HDfclose(file->logfp);
@@ -847,8 +975,27 @@ H5FD__splitter_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t ad
     if (H5FD_set_eoa(file->rw_file, type, addr) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "H5FDset_eoa failed for R/W file")
 
-    if (H5FD_set_eoa(file->wo_file, type, addr) < 0)
-        H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTSET, FAIL, "unable to set EOA for W/O file")
+    if (NULL == file->wb) {
+        if (H5FD_set_eoa(file->wo_file, type, addr) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTSET, FAIL, "unable to set EOA for W/O file")
+    }
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    else {
+        herr_t status;
+
+        /* Queued writes may lie past a lowered EOA, so let them finish
+         * first.  Otherwise just keep the thread out of the W/O file while
+         * its EOA changes.
+         */
+        if (H5F_addr_lt(addr, H5FD_get_eoa(file->wo_file, type)))
+            H5FD__splitter_wb_drain(file->wb);
+        pthread_mutex_lock(&file->wb->io_mutex);
+        status = H5FD_set_eoa(file->wo_file, type, addr);
+        pthread_mutex_unlock(&file->wb->io_mutex);
+        if (status < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTSET, FAIL, "unable to set EOA for W/O file")
+    }
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -912,6 +1059,16 @@ H5FD__splitter_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     if (H5FDtruncate(file->rw_file, dxpl_id, closing) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate R/W file")
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    if (file->wb) {
+        int wb_errno; /* errno of a queued W/O write that failed */
+
+        H5FD__splitter_wb_drain(file->wb);
+        if (0 != (wb_errno = H5FD__splitter_wb_new_failures(file->wb)))
+            H5FD_SPLITTER_WB_ERROR(file, FUNC, wb_errno)
+    }
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     if (H5FDtruncate(file->wo_file, dxpl_id, closing) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate W/O file")
 
@@ -1204,8 +1361,24 @@ H5FD__splitter_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, hsize_t size
     if ((ret_value = H5FDalloc(file->rw_file, type, dxpl_id, size)) == HADDR_UNDEF)
         HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, HADDR_UNDEF, "unable to allocate for R/W file")
 
-    if (H5FDalloc(file->wo_file, type, dxpl_id, size) == HADDR_UNDEF)
-        H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, HADDR_UNDEF, "unable to alloc for W/O file")
+    if (NULL == file->wb) {
+        if (H5FDalloc(file->wo_file, type, dxpl_id, size) == HADDR_UNDEF)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, HADDR_UNDEF,
+                                   "unable to alloc for W/O file")
+    }
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    else {
+        haddr_t wo_addr;
+
+        /* Keep the write-behind thread out of the W/O file while its EOA changes */
+        pthread_mutex_lock(&file->wb->io_mutex);
+        wo_addr = H5FDalloc(file->wo_file, type, dxpl_id, size);
+        pthread_mutex_unlock(&file->wb->io_mutex);
+        if (HADDR_UNDEF == wo_addr)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, HADDR_UNDEF,
+                                   "unable to alloc for W/O file")
+    }
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1266,6 +1439,14 @@ H5FD__splitter_free(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     if (H5FDfree(file->rw_file, type, dxpl_id, addr, size) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free for R/W file")
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    /* Freeing space at the end of the file lowers the W/O file's EOA, which
+     * queued writes may lie past, so let them finish first.
+     */
+    if (file->wb)
+        H5FD__splitter_wb_drain(file->wb);
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     if (H5FDfree(file->wo_file, type, dxpl_id, addr, size) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, FAIL, "unable to free for W/O file")
 
@@ -1312,3 +1493,284 @@ H5FD__splitter_log_error(const H5FD_splitter_t *file, const char *atfunc, const
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__splitter_log_error() */
+
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_start
+ *
+ * Purpose:     Set up the W/O write-behind queue and start the thread
+ *              which drains it.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wb_start(H5FD_splitter_t *file)
+{
+    H5FD_splitter_wb_t *wb        = NULL;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(file);
+    HDassert(file->wo_file);
+    HDassert(NULL == file->wb);
+
+    if (NULL == (wb = (H5FD_splitter_wb_t *)H5MM_calloc(sizeof(H5FD_splitter_wb_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate write-behind state")
+    wb->wo_file = file->wo_file;
+    wb->budget  = file->fa.wo_write_behind_size;
+
+    pthread_mutex_init(&wb->mutex, NULL);
+    pthread_mutex_init(&wb->io_mutex, NULL);
+    pthread_cond_init(&wb->work_cond, NULL);
+    pthread_cond_init(&wb->space_cond, NULL);
+
+    if (0 != pthread_create(&wb->thread, NULL, H5FD__splitter_wb_worker, wb)) {
+        pthread_cond_destroy(&wb->space_cond);
+        pthread_cond_destroy(&wb->work_cond);
+        pthread_mutex_destroy(&wb->io_mutex);
+        pthread_mutex_destroy(&wb->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, FAIL, "unable to create write-behind thread")
+    }
+
+    file->wb = wb;
+
+done:
+    if (ret_value < 0)
+        H5MM_xfree(wb);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wb_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_stop
+ *
+ * Purpose:     Stop the write-behind thread, once it has issued all the
+ *              queued writes, and release the write-behind state.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__splitter_wb_stop(H5FD_splitter_t *file)
+{
+    H5FD_splitter_wb_t *wb = file->wb;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(wb);
+
+    pthread_mutex_lock(&wb->mutex);
+    wb->shutdown = TRUE;
+    pthread_cond_signal(&wb->work_cond);
+    pthread_mutex_unlock(&wb->mutex);
+    pthread_join(wb->thread, NULL);
+
+    HDassert(NULL == wb->head);
+    pthread_cond_destroy(&wb->space_cond);
+    pthread_cond_destroy(&wb->work_cond);
+    pthread_mutex_destroy(&wb->io_mutex);
+    pthread_mutex_destroy(&wb->mutex);
+
+    file->wb = (H5FD_splitter_wb_t *)H5MM_xfree(wb);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__splitter_wb_stop() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_write
+ *
+ * Purpose:     Queue a copy of a write for the W/O channel.  Waits while
+ *              the queue can't take the write within the memory budget.
+ *              A write larger than the whole budget (or one whose copy
+ *              can't be allocated) waits for the queue to drain, and is
+ *              then written directly.
+ *
+ *              Failures of queued writes are only reported later, by
+ *              H5FD__splitter_wb_new_failures().
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wb_write(H5FD_splitter_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                        const void *buf)
+{
+    H5FD_splitter_wb_t *   wb        = file->wb;
+    H5FD_splitter_wb_op_t *op        = NULL;
+    herr_t                 ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(wb);
+
+    /* The queued copies are freed by the write-behind thread, so they don't
+     * use the library's memory routines.
+     */
+    if (size <= wb->budget)
+        op = (H5FD_splitter_wb_op_t *)HDmalloc(sizeof(H5FD_splitter_wb_op_t) + size);
+
+    if (NULL == op) {
+        H5FD__splitter_wb_drain(wb);
+
+        /* Public API for dxpl "context" */
+        if (H5FDwrite(wb->wo_file, type, dxpl_id, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "W/O file write failed")
+    }
+    else {
+        op->next = NULL;
+        op->type = type;
+        op->addr = addr;
+        op->size = size;
+        H5MM_memcpy(op + 1, buf, size);
+
+        pthread_mutex_lock(&wb->mutex);
+        while (wb->queued + size > wb->budget)
+            pthread_cond_wait(&wb->space_cond, &wb->mutex);
+        if (wb->tail)
+            wb->tail->next = op;
+        else
+            wb->head = op;
+        wb->tail = op;
+        wb->queued += size;
+        pthread_cond_signal(&wb->work_cond);
+        pthread_mutex_unlock(&wb->mutex);
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wb_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_drain
+ *
+ * Purpose:     Wait until the write-behind thread has issued all the
+ *              queued writes.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__splitter_wb_drain(H5FD_splitter_wb_t *wb)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(wb);
+
+    pthread_mutex_lock(&wb->mutex);
+    while (wb->head || wb->busy)
+        pthread_cond_wait(&wb->space_cond, &wb->mutex);
+    pthread_mutex_unlock(&wb->mutex);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__splitter_wb_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_new_failures
+ *
+ * Purpose:     Check whether any queued writes have failed since the
+ *              last check.
+ *
+ * Return:      The errno of the latest failed write, or 0 if none failed
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__splitter_wb_new_failures(H5FD_splitter_wb_t *wb)
+{
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(wb);
+
+    pthread_mutex_lock(&wb->mutex);
+    if (wb->nfailed != wb->nreported)
+        ret_value = wb->last_errno;
+    wb->nreported = wb->nfailed;
+    pthread_mutex_unlock(&wb->mutex);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wb_new_failures() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_worker
+ *
+ * Purpose:     Body of the write-behind thread: issues the queued writes
+ *              to the W/O channel in order, until asked to shut down
+ *              with an empty queue.
+ *
+ *              The W/O driver's write callback is called directly, since
+ *              the library's API routines can't be used from this thread.
+ *              The error stack and the IDs it references can't be used
+ *              from it either, so the errors the callback raises are
+ *              dropped: a failed write is counted and its errno kept, for
+ *              the main thread to report.  If the errors can't be dropped,
+ *              no write is issued and each one fails.
+ *
+ * Return:      NULL
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__splitter_wb_worker(void *_wb)
+{
+    H5FD_splitter_wb_t *   wb = (H5FD_splitter_wb_t *)_wb;
+    H5FD_splitter_wb_op_t *op;
+    herr_t                 status;
+    int                    err       = 0; /* errno of the current write */
+    int                    setup_err = 0; /* errno from turning off error pushes */
+
+    if (H5E_suppress_thread_push(TRUE, NULL) < 0)
+        setup_err = errno;
+
+    pthread_mutex_lock(&wb->mutex);
+    for (;;) {
+        while (NULL == wb->head && !wb->shutdown)
+            pthread_cond_wait(&wb->work_cond, &wb->mutex);
+        if (NULL == wb->head)
+            break;
+
+        op       = wb->head;
+        wb->head = op->next;
+        if (NULL == wb->head)
+            wb->tail = NULL;
+        wb->busy = TRUE;
+        pthread_mutex_unlock(&wb->mutex);
+
+        if (setup_err) {
+            status = FAIL;
+            err    = setup_err;
+        }
+        else {
+            pthread_mutex_lock(&wb->io_mutex);
+            errno  = 0;
+            status = (wb->wo_file->cls->write)(wb->wo_file, op->type, H5P_DATASET_XFER_DEFAULT,
+                                               op->addr + wb->wo_file->base_addr, op->size, op + 1);
+            if (status < 0)
+                err = errno ? errno : EIO;
+            pthread_mutex_unlock(&wb->io_mutex);
+        }
+
+        pthread_mutex_lock(&wb->mutex);
+        if (status < 0) {
+            wb->nfailed++;
+            wb->last_errno = err;
+        }
+        wb->queued -= op->size;
+        wb->busy = FALSE;
+        HDfree(op);
+        pthread_cond_broadcast(&wb->space_cond);
+    }
+    pthread_mutex_unlock(&wb->mutex);
+
+    return NULL;
+} /* end H5FD__splitter_wb_worker() */
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
@@ -19,8 +19,10 @@
 
 #define H5FD_SPLITTER (H5FD_splitter_init())
 
-/* The version of the H5FD_splitter_vfd_config_t structure used */
-#define H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION 1
+/* The version of the H5FD_splitter_vfd_config_t structure used.
+ * Version 1 structures (without wo_write_behind_size) are still accepted.
+ */
+#define H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION 2
 
 /* Maximum length of a filename/path string in the Write-Only channel,
  * including the NULL-terminator.
@@ -72,6 +74,20 @@
  *      Toggle flag for how judiciously to respond to errors on the Write-Only
  *      channel.
  *
+ * wo_write_behind_size (size_t)
+ *      (Version 2 and later.)  Memory budget, in bytes, for writes queued to
+ *      the Write-Only channel.  When non-zero, writes to the W/O channel are
+ *      copied into a queue and issued by a background thread, so a write
+ *      only waits for the Read/Write channel.  When the queue is full, new
+ *      writes wait for the thread to catch up; a write larger than the whole
+ *      budget waits for the queue to drain and is then issued directly.
+ *      Flushing, truncating or closing the file waits for the queue to
+ *      drain.  Failed W/O writes are logged and reported (subject to
+ *      ignore_wo_errs) by the next write, flush, truncate or close.
+ *      Only used when the W/O channel uses the sec2 driver and the library
+ *      was built with Pthreads; otherwise W/O writes stay synchronous.
+ *      0 (the default) disables write-behind.
+ *
  * ----------------------------------------------------------------------------
  */
 typedef struct H5FD_splitter_vfd_config_t {
@@ -82,6 +98,7 @@ typedef struct H5FD_splitter_vfd_config_t {
     char         wo_path[H5FD_SPLITTER_PATH_MAX + 1];
     char         log_file_path[H5FD_SPLITTER_PATH_MAX + 1];
     hbool_t      ignore_wo_errs;
+    size_t       wo_write_behind_size;
 } H5FD_splitter_vfd_config_t;
 
 #ifdef __cplusplus
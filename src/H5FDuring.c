@@ -0,0 +1,1250 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The io_uring file driver.  This is the sec2 driver with its
+ *          pread()/pwrite() calls replaced by requests on a Linux
+ *          io_uring submission queue.  Single reads and writes behave
+ *          the same as in sec2, but the extents of a vector read or
+ *          write are all submitted together (up to the queue depth set
+ *          with H5Pset_fapl_uring) so that the storage device can
+ *          service them in parallel, instead of one blocking system
+ *          call at a time.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDuring.h"   /* io_uring file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_URING_VFD
+
+#include <liburing.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_URING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_uring_fapl_t {
+    unsigned queue_depth; /* Max. # of I/O requests in flight at once */
+} H5FD_uring_fapl_t;
+
+/* Driver-specific file access properties used when none were set */
+static const H5FD_uring_fapl_t H5FD_uring_default_fa_g = {H5FD_URING_QUEUE_DEPTH_DEF};
+
+/* The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  All I/O
+ * is positional, so unlike sec2 there is no need to remember the file
+ * position or the last operation.  The 'ring_valid' flag is cleared if the
+ * io_uring instance could not be recovered after an error, after which all
+ * I/O on the file fails.
+ */
+typedef struct H5FD_uring_t {
+    H5FD_t            pub;        /* public stuff, must be first      */
+    int               fd;         /* the filesystem file descriptor   */
+    haddr_t           eoa;        /* end of allocated region          */
+    haddr_t           eof;        /* end of file; current file size   */
+    H5FD_uring_fapl_t fa;         /* file access properties           */
+    struct io_uring   ring;       /* submission & completion queues   */
+    hbool_t           ring_valid; /* whether 'ring' may be used       */
+    hbool_t           ignore_disabled_file_locks;
+    char              filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+
+    /* On Linux the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    hbool_t fam_to_single;
+} H5FD_uring_t;
+
+/* State of one extent of a transfer, while its requests are in flight */
+typedef struct H5FD_uring_req_t {
+    char *  buf;       /* Next byte of memory to transfer      */
+    haddr_t addr;      /* Next file address to transfer        */
+    size_t  remaining; /* # of bytes left to transfer          */
+} H5FD_uring_req_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Largest number of bytes transferred by a single io_uring request.  The
+ * request length is an unsigned 32-bit quantity, and Linux never transfers
+ * more than about 2 GiB per read/write anyway.
+ */
+#define H5FD_URING_MAX_IO_BYTES ((size_t)1 << 30)
+
+/* Prototypes */
+static herr_t  H5FD__uring_term(void);
+static void *  H5FD__uring_fapl_get(H5FD_t *file);
+static void *  H5FD__uring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__uring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__uring_close(H5FD_t *_file);
+static int     H5FD__uring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__uring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__uring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__uring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__uring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__uring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__uring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                void *buf);
+static herr_t  H5FD__uring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                 const void *buf);
+static herr_t  H5FD__uring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__uring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__uring_transfer(H5FD_uring_t *file, H5FD_file_op_t op, uint32_t count,
+                                    const haddr_t addrs[], const size_t sizes[], void *const bufs[]);
+static hbool_t H5FD__uring_prep(H5FD_uring_t *file, H5FD_file_op_t op, H5FD_uring_req_t *req);
+static herr_t  H5FD__uring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__uring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__uring_unlock(H5FD_t *_file);
+
+static const H5FD_class_t H5FD_uring_g = {
+    "uring",                   /* name                 */
+    MAXADDR,                   /* maxaddr              */
+    H5F_CLOSE_WEAK,            /* fc_degree            */
+    H5FD__uring_term,          /* terminate            */
+    NULL,                      /* sb_size              */
+    NULL,                      /* sb_encode            */
+    NULL,                      /* sb_decode            */
+    sizeof(H5FD_uring_fapl_t), /* fapl_size            */
+    H5FD__uring_fapl_get,      /* fapl_get             */
+    H5FD__uring_fapl_copy,     /* fapl_copy            */
+    NULL,                      /* fapl_free            */
+    0,                         /* dxpl_size            */
+    NULL,                      /* dxpl_copy            */
+    NULL,                      /* dxpl_free            */
+    H5FD__uring_open,          /* open                 */
+    H5FD__uring_close,         /* close                */
+    H5FD__uring_cmp,           /* cmp                  */
+    H5FD__uring_query,         /* query                */
+    NULL,                      /* get_type_map         */
+    NULL,                      /* alloc                */
+    NULL,                      /* free                 */
+    H5FD__uring_get_eoa,       /* get_eoa              */
+    H5FD__uring_set_eoa,       /* set_eoa              */
+    H5FD__uring_get_eof,       /* get_eof              */
+    H5FD__uring_get_handle,    /* get_handle           */
+    H5FD__uring_read,          /* read                 */
+    H5FD__uring_write,         /* write                */
+    NULL,                      /* flush                */
+    H5FD__uring_truncate,      /* truncate             */
+    H5FD__uring_lock,          /* lock                 */
+    H5FD__uring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,      /* fl_map               */
+    H5FD__uring_read_vector,   /* read_vector          */
+    H5FD__uring_write_vector   /* write_vector         */
+};
+
+/* Declare a free list to manage the H5FD_uring_t struct */
+H5FL_DEFINE_STATIC(H5FD_uring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_uring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_uring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_uring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_URING_g))
+        H5FD_URING_g = H5FD_register(&H5FD_uring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_URING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_uring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__uring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_URING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__uring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_uring
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_URING
+ *              driver defined in this source file.  QUEUE_DEPTH is the
+ *              maximum number of read or write requests the driver keeps
+ *              in flight at once; zero selects the default,
+ *              H5FD_URING_QUEUE_DEPTH_DEF.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_uring(hid_t fapl_id, unsigned queue_depth)
+{
+    H5P_genplist_t *  plist; /* Property list pointer */
+    H5FD_uring_fapl_t fa;
+    herr_t            ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", fapl_id, queue_depth);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (queue_depth > H5FD_URING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth too large")
+
+    HDmemset(&fa, 0, sizeof(H5FD_uring_fapl_t));
+    if (queue_depth != 0)
+        fa.queue_depth = queue_depth;
+    else
+        fa.queue_depth = H5FD_URING_QUEUE_DEPTH_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_URING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_uring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_uring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_uring(hid_t fapl_id, unsigned *queue_depth /*out*/)
+{
+    H5P_genplist_t *         plist; /* Property list pointer */
+    const H5FD_uring_fapl_t *fa;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, queue_depth);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_URING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_uring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_uring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__uring_fapl_get(H5FD_t *_file)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    void *        ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__uring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__uring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_uring_fapl_t *old_fa = (const H5FD_uring_fapl_t *)_old_fa;
+    H5FD_uring_fapl_t *      new_fa = H5MM_calloc(sizeof(H5FD_uring_fapl_t));
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(new_fa);
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_uring_fapl_t));
+
+    FUNC_LEAVE_NOAPI(new_fa)
+} /* end H5FD__uring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file and sets up the
+ *              io_uring instance used for its I/O.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__uring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_uring_t *           file = NULL; /* io_uring VFD info        */
+    int                      fd   = -1;   /* File descriptor          */
+    int                      o_flags;     /* Flags for open() call    */
+    int                      ret;         /* liburing return value    */
+    const H5FD_uring_fapl_t *fa;          /* Driver properties        */
+    h5_stat_t                sb;
+    H5P_genplist_t *         plist;            /* Property list pointer */
+    H5FD_t *                 ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_uring_fapl_t *)H5P_peek_driver_info(plist)))
+        fa = &H5FD_uring_default_fa_g;
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_uring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device         = sb.st_dev;
+    file->inode          = sb.st_ino;
+    file->fa.queue_depth = fa->queue_depth;
+
+    /* Set up the submission and completion queues */
+    if ((ret = io_uring_queue_init(file->fa.queue_depth, &file->ring, 0)) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL,
+                    "unable to set up io_uring: queue depth = %u, errno = %d, error message = '%s'",
+                    file->fa.queue_depth, -ret, HDstrerror(-ret))
+    file->ring_valid = TRUE;
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Check for non-default FAPL */
+    if (H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+
+        /* This step is for h5repart tool only. If user wants to change file driver from
+         * family to one that uses single files (sec2, etc.) while using h5repart, this
+         * private property should be set so that in the later step, the library can ignore
+         * the family driver information saved in the superblock.
+         */
+        if (H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+            if (H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file) {
+            if (file->ring_valid)
+                io_uring_queue_exit(&file->ring);
+            file = H5FL_FREE(H5FD_uring_t, file);
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_close(H5FD_t *_file)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Tear down the queues.  No requests are ever left in flight between
+     * calls into the driver, so there is nothing to wait for.
+     */
+    if (file->ring_valid) {
+        io_uring_queue_exit(&file->ring);
+        file->ring_valid = FALSE;
+    } /* end if */
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_uring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__uring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_uring_t *f1        = (const H5FD_uring_t *)_f1;
+    const H5FD_uring_t *f2        = (const H5FD_uring_t *)_f2;
+    int                 ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_uring_t *file = (const H5FD_uring_t *)_file; /* io_uring VFD info */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports.  Data sieving is
+     * deliberately not advertised: the sieve buffer would turn many
+     * independent raw data extents back into one serial read, instead of
+     * handing them to the driver as a vector that can be kept in flight.
+     */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |=
+            H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+
+        /* Check for flags that are set by h5repart */
+        if (file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which
+                                                    eliminates it) */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__uring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__uring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_uring_t *file = (const H5FD_uring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__uring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__uring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__uring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_uring_t *file = (const H5FD_uring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__uring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_get_handle
+ *
+ * Purpose:     Returns the file handle of the io_uring file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_prep
+ *
+ * Purpose:     Places a read or write request for the next piece of the
+ *              extent described by REQ on the submission queue.  The
+ *              request is not handed to the kernel until the queue is
+ *              submitted.
+ *
+ * Return:      TRUE if the request was queued, FALSE if the submission
+ *              queue is full.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__uring_prep(H5FD_uring_t *file, H5FD_file_op_t op, H5FD_uring_req_t *req)
+{
+    struct io_uring_sqe *sqe;           /* Submission queue entry   */
+    hbool_t              ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(req->remaining > 0);
+
+    if (NULL == (sqe = io_uring_get_sqe(&file->ring)))
+        HGOTO_DONE(FALSE)
+
+    if (OP_READ == op)
+        io_uring_prep_read(sqe, file->fd, req->buf, (unsigned)MIN(req->remaining, H5FD_URING_MAX_IO_BYTES),
+                           (__u64)req->addr);
+    else
+        io_uring_prep_write(sqe, file->fd, req->buf, (unsigned)MIN(req->remaining, H5FD_URING_MAX_IO_BYTES),
+                            (__u64)req->addr);
+    io_uring_sqe_set_data(sqe, req);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_prep() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_transfer
+ *
+ * Purpose:     Reads (OP is OP_READ) or writes (OP is OP_WRITE) the COUNT
+ *              extents described by ADDRS and SIZES, to or from the
+ *              buffers in BUFS.
+ *
+ *              Up to the configured queue depth of requests are kept in
+ *              flight at once; as each one completes, the next extent is
+ *              queued.  Partial transfers and interrupted requests are
+ *              resubmitted for the rest of their extent, and reads past
+ *              the end of the file return zeros, as in the sec2 driver.
+ *              Because the requests may complete in any order, the
+ *              extents of a write must not overlap.
+ *
+ *              If a request fails, no further extents are queued, but all
+ *              requests already in flight are waited for before returning
+ *              so that the kernel is done with the caller's buffers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_transfer(H5FD_uring_t *file, H5FD_file_op_t op, uint32_t count, const haddr_t addrs[],
+                     const size_t sizes[], void *const bufs[])
+{
+    H5FD_uring_req_t  single_req;           /* Request state for a single extent */
+    H5FD_uring_req_t *reqs       = &single_req; /* Request state for each extent */
+    uint32_t          next       = 0;       /* Next extent to queue */
+    unsigned          queued     = 0;       /* # of requests queued but not submitted */
+    unsigned          inflight   = 0;       /* # of requests submitted but not completed */
+    int               io_errno   = 0;       /* errno value of the first failure */
+    haddr_t           err_addr   = HADDR_UNDEF; /* File address of the first failure */
+    hbool_t           reset_ring = FALSE;   /* Whether the queues must be rebuilt */
+    herr_t            ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(OP_READ == op || OP_WRITE == op);
+
+    if (!file->ring_valid)
+        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "io_uring not usable after earlier failure")
+
+    if (count > 1 && NULL == (reqs = (H5FD_uring_req_t *)H5MM_malloc(count * sizeof(H5FD_uring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate request state")
+
+    while (inflight > 0 || (0 == io_errno && next < count)) {
+        struct io_uring_cqe *cqe = NULL; /* Completion queue entry */
+        H5FD_uring_req_t *   req;        /* Request that completed */
+        int                  ret;        /* liburing return value */
+        int                  res;        /* Result of the request */
+
+        /* Keep the queue full */
+        while (0 == io_errno && next < count && inflight + queued < file->fa.queue_depth) {
+            if (sizes[next] > 0) {
+                req = &reqs[next];
+                H5_GCC_DIAG_OFF("cast-qual")
+                req->buf = (char *)bufs[next];
+                H5_GCC_DIAG_ON("cast-qual")
+                req->addr      = addrs[next];
+                req->remaining = sizes[next];
+
+                if (!H5FD__uring_prep(file, op, req))
+                    break;
+                queued++;
+            } /* end if */
+            next++;
+        } /* end while */
+
+        /* Hand the queued requests to the kernel */
+        while (queued > 0) {
+            do {
+                ret = io_uring_submit(&file->ring);
+            } while (-EINTR == ret);
+
+            if (ret <= 0) {
+                /* The queued requests can't be withdrawn, so the queues must
+                 * be rebuilt once everything in flight has completed.
+                 */
+                if (0 == io_errno) {
+                    io_errno = (ret < 0) ? -ret : EAGAIN;
+                    err_addr = HADDR_UNDEF;
+                } /* end if */
+                reset_ring = TRUE;
+                break;
+            } /* end if */
+
+            HDassert((unsigned)ret <= queued);
+            queued -= (unsigned)ret;
+            inflight += (unsigned)ret;
+        } /* end while */
+
+        /* Nothing to wait for (i.e. all remaining extents were empty) */
+        if (0 == inflight)
+            continue;
+
+        /* Wait for a request to complete */
+        do {
+            ret = io_uring_wait_cqe(&file->ring, &cqe);
+        } while (-EINTR == ret);
+
+        if (ret < 0) {
+            /* The state of the requests in flight is unknown, so the file
+             * can't be used any more.
+             */
+            if (0 == io_errno) {
+                io_errno = -ret;
+                err_addr = HADDR_UNDEF;
+            } /* end if */
+            file->ring_valid = FALSE;
+            break;
+        } /* end if */
+
+        req = (H5FD_uring_req_t *)io_uring_cqe_get_data(cqe);
+        res = cqe->res;
+        io_uring_cqe_seen(&file->ring, cqe);
+        inflight--;
+
+        if (res < 0) {
+            if ((-EINTR == res || -EAGAIN == res) && 0 == io_errno) {
+                /* Try again */
+                if (H5FD__uring_prep(file, op, req))
+                    queued++;
+                else {
+                    io_errno = -res;
+                    err_addr = req->addr;
+                } /* end else */
+            }     /* end if */
+            else if (0 == io_errno) {
+                io_errno = -res;
+                err_addr = req->addr;
+            } /* end if */
+        }     /* end if */
+        else if (0 == res) {
+            if (OP_READ == op)
+                /* end of file but not end of format address space */
+                HDmemset(req->buf, 0, req->remaining);
+            else if (0 == io_errno) {
+                /* A write that makes no progress would never finish */
+                io_errno = EIO;
+                err_addr = req->addr;
+            } /* end if */
+        }     /* end if */
+        else {
+            HDassert((size_t)res <= req->remaining);
+
+            req->buf += res;
+            req->addr += (haddr_t)res;
+            req->remaining -= (size_t)res;
+
+            /* Submit the rest of a partial transfer */
+            if (req->remaining > 0 && 0 == io_errno) {
+                if (H5FD__uring_prep(file, op, req))
+                    queued++;
+                else {
+                    io_errno = EAGAIN;
+                    err_addr = req->addr;
+                } /* end else */
+            }     /* end if */
+        }         /* end else */
+    }             /* end while */
+
+    /* Discard requests that could not be submitted */
+    if (reset_ring && file->ring_valid) {
+        io_uring_queue_exit(&file->ring);
+        if (io_uring_queue_init(file->fa.queue_depth, &file->ring, 0) < 0)
+            file->ring_valid = FALSE;
+    } /* end if */
+
+    if (io_errno != 0) {
+        time_t mytime = HDtime(NULL);
+
+        HGOTO_ERROR(H5E_IO, (OP_READ == op ? H5E_READERROR : H5E_WRITEERROR), FAIL,
+                    "file %s failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error "
+                    "message = '%s', extent count = %llu, addr = %llu",
+                    (OP_READ == op ? "read" : "write"), HDctime(&mytime), file->filename, file->fd, io_errno,
+                    HDstrerror(io_errno), (unsigned long long)count, (unsigned long long)err_addr)
+    } /* end if */
+
+    /* Update the eof */
+    if (OP_WRITE == op) {
+        uint32_t u;
+
+        for (u = 0; u < count; u++)
+            if (sizes[u] > 0 && addrs[u] + sizes[u] > file->eof)
+                file->eof = addrs[u] + sizes[u];
+    } /* end if */
+
+done:
+    if (reqs != &single_req)
+        H5MM_xfree(reqs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_transfer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                 size_t size, void *buf /*out*/)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if (H5FD__uring_transfer(file, OP_READ, 1, &addr, &size, &buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                  size_t size, const void *buf)
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file;
+    void *        vbuf;                /* Buffer, as handed to the kernel */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+
+    H5_GCC_DIAG_OFF("cast-qual")
+    vbuf = (void *)buf;
+    H5_GCC_DIAG_ON("cast-qual")
+
+    if (H5FD__uring_transfer(file, OP_WRITE, 1, &addr, &size, &vbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_read_vector
+ *
+ * Purpose:     Reads COUNT extents, described by the ADDRS and SIZES
+ *              arrays, into the buffers in BUFS, keeping as many of the
+ *              reads in flight at once as the queue depth allows.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                        H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                        void *bufs[] /*out*/)
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file;
+    uint32_t      u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(addrs && sizes && bufs);
+
+    /* Check for overflow conditions */
+    for (u = 0; u < count; u++) {
+        if (!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[u])
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu",
+                        (unsigned long long)addrs[u])
+    } /* end for */
+
+    if (H5FD__uring_transfer(file, OP_READ, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_write_vector
+ *
+ * Purpose:     Writes COUNT extents, described by the ADDRS and SIZES
+ *              arrays, from the buffers in BUFS, keeping as many of the
+ *              writes in flight at once as the queue depth allows.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                         H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                         const void *bufs[])
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file;
+    uint32_t      u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(addrs && sizes && bufs);
+
+    /* Check for overflow conditions */
+    for (u = 0; u < count; u++) {
+        if (!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[u])
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+    } /* end for */
+
+    H5_GCC_DIAG_OFF("cast-qual")
+    if (H5FD__uring_transfer(file, OP_WRITE, count, addrs, sizes, (void *const *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+    H5_GCC_DIAG_ON("cast-qual")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file; /* VFD file struct          */
+    int           lock_flags;                   /* file locking flags       */
+    herr_t        ret_value = SUCCEED;          /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_unlock(H5FD_t *_file)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file; /* VFD file struct          */
+    herr_t        ret_value = SUCCEED;               /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_unlock() */
+
+#endif /* H5_HAVE_URING_VFD */
@@ -0,0 +1,47 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the io_uring driver.
+ */
+#ifndef H5FDuring_H
+#define H5FDuring_H
+
+#ifdef H5_HAVE_URING_VFD
+#define H5FD_URING (H5FD_uring_init())
+#else
+#define H5FD_URING (H5I_INVALID_HID)
+#endif /* H5_HAVE_URING_VFD */
+
+#ifdef H5_HAVE_URING_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default number of I/O requests the driver keeps in flight at once.
+ * Application can set this value through the function H5Pset_fapl_uring. */
+#define H5FD_URING_QUEUE_DEPTH_DEF 64
+
+/* Largest queue depth accepted by H5Pset_fapl_uring */
+#define H5FD_URING_QUEUE_DEPTH_MAX 4096
+
+H5_DLL hid_t  H5FD_uring_init(void);
+H5_DLL herr_t H5Pset_fapl_uring(hid_t fapl_id, unsigned queue_depth);
+H5_DLL herr_t H5Pget_fapl_uring(hid_t fapl_id, unsigned *queue_depth /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_URING_VFD */
+
+#endif
@@ -49,6 +49,9 @@
 #define H5F_ACCUM_THRESHOLD 2048
 #define H5F_ACCUM_MAX_SIZE  (1024 * 1024) /* Max. accum. buf size (max. I/Os will be 1/2 this size) */
 
+/* Max. # of dirty regions set aside when the accumulator moves elsewhere in the file */
+#define H5F_ACCUM_MAX_REGIONS 16
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -67,6 +70,13 @@ typedef enum {
 /* Local Prototypes */
 /********************/
 
+static herr_t H5F__accum_set_aside(H5F_shared_t *f_sh);
+static herr_t H5F__accum_write_region(H5F_shared_t *f_sh, size_t idx);
+static herr_t H5F__accum_write_regions(H5F_shared_t *f_sh, haddr_t addr, size_t size);
+static void   H5F__accum_read_regions(const H5F_meta_accum_t *accum, haddr_t addr, size_t size,
+                                      unsigned char *buf);
+static herr_t H5F__accum_free_regions(H5F_shared_t *f_sh, haddr_t addr, hsize_t size);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -82,6 +92,12 @@ typedef enum {
 /* Declare a PQ free list to manage the metadata accumulator buffer */
 H5FL_BLK_DEFINE_STATIC(meta_accum);
 
+/* Declare a PQ free list to manage the buffers of dirty regions set aside */
+H5FL_BLK_DEFINE_STATIC(meta_accum_region);
+
+/* Declare a free list to manage the array of dirty regions set aside */
+H5FL_SEQ_DEFINE_STATIC(H5F_accum_region_t);
+
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_read
  *
@@ -115,13 +131,17 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
     file = f_sh->lf;
 
     /* Check if this information is in the metadata accumulator */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
+    /* (Raw data is only checked when it overlaps metadata held in memory,
+     *  which happens when freed metadata space is reused for raw data)
+     */
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
+        (map_type != H5FD_MEM_DRAW || H5F__accum_overlaps(f_sh, addr, size))) {
         H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
 
         /* Set up alias for file's metadata accumulator info */
         accum = &f_sh->accum;
 
-        if (size < H5F_ACCUM_MAX_SIZE) {
+        if (size < H5F_ACCUM_MAX_SIZE && map_type != H5FD_MEM_DRAW) {
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
 
@@ -132,6 +152,11 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
                 haddr_t new_addr;      /* New address of the accumulator buffer */
                 size_t  new_size;      /* New size of the accumulator buffer */
 
+                /* Write out any dirty regions set aside that the accumulator will now cover */
+                if (accum->nregions > 0)
+                    if (H5F__accum_write_regions(f_sh, addr, size) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions")
+
                 /* Compute new values for accumulator */
                 new_addr = MIN(addr, accum->loc);
                 new_size = (size_t)(MAX((addr + size), (accum->loc + accum->size)) - new_addr);
@@ -200,6 +225,9 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
                 /* Dispatch to driver */
                 if (H5FD_read(file, map_type, addr, size, buf) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
+
+                /* Copy in any dirty regions set aside */
+                H5F__accum_read_regions(accum, addr, size, (unsigned char *)buf);
             } /* end else */
         }     /* end if */
         else {
@@ -207,6 +235,9 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
             if (H5FD_read(file, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
 
+            /* Copy in any dirty regions set aside */
+            H5F__accum_read_regions(accum, addr, size, (unsigned char *)buf);
+
             /* Check for overlap w/dirty accumulator */
             /* (Note that this could be improved by updating the non-dirty
              *  information in the accumulator with [some of] the information
@@ -215,34 +246,13 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
             if (accum->dirty &&
                 H5F_addr_overlap(addr, size, accum->loc + accum->dirty_off, accum->dirty_len)) {
                 haddr_t dirty_loc = accum->loc + accum->dirty_off; /* File offset of dirty information */
-                size_t  buf_off;                                   /* Offset of dirty region in buffer */
-                size_t  dirty_off;                                 /* Offset within dirty region */
-                size_t  overlap_size;                              /* Size of overlap with dirty region */
-
-                /* Check for read starting before beginning dirty region */
-                if (H5F_addr_le(addr, dirty_loc)) {
-                    /* Compute offset of dirty region within buffer */
-                    buf_off = (size_t)(dirty_loc - addr);
-
-                    /* Compute offset within dirty region */
-                    dirty_off = 0;
-
-                    /* Check for read ending within dirty region */
-                    if (H5F_addr_lt(addr + size, dirty_loc + accum->dirty_len))
-                        overlap_size = (size_t)((addr + size) - buf_off);
-                    else /* Access covers whole dirty region */
-                        overlap_size = accum->dirty_len;
-                }      /* end if */
-                else { /* Read starts after beginning of dirty region */
-                    /* Compute dirty offset within buffer and overlap size */
-                    buf_off      = 0;
-                    dirty_off    = (size_t)(addr - dirty_loc);
-                    overlap_size = (size_t)((dirty_loc + accum->dirty_len) - addr);
-                } /* end else */
+                haddr_t dirty_end = dirty_loc + accum->dirty_len;  /* File offset after dirty information */
+                haddr_t start     = MAX(addr, dirty_loc);          /* Start of overlap */
+                haddr_t end       = MIN(addr + size, dirty_end);   /* End of overlap */
 
                 /* Copy the dirty region to buffer */
-                H5MM_memcpy((unsigned char *)buf + buf_off,
-                            (unsigned char *)accum->buf + accum->dirty_off + dirty_off, overlap_size);
+                H5MM_memcpy((unsigned char *)buf + (start - addr),
+                            accum->buf + accum->dirty_off + (start - dirty_loc), (size_t)(end - start));
             } /* end if */
         }     /* end else */
     }         /* end if */
@@ -426,16 +436,28 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
     file = f_sh->lf;
 
     /* Check for accumulating metadata */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
+    /* (Raw data is only checked when it overlaps metadata held in memory,
+     *  which happens when freed metadata space is reused for raw data)
+     */
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
+        (map_type != H5FD_MEM_DRAW || H5F__accum_overlaps(f_sh, addr, size))) {
         H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
 
         /* Set up alias for file's metadata accumulator info */
         accum = &f_sh->accum;
 
-        if (size < H5F_ACCUM_MAX_SIZE) {
+        if (size < H5F_ACCUM_MAX_SIZE && map_type != H5FD_MEM_DRAW) {
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
 
+            /* Write out any dirty regions set aside that the new metadata overlaps */
+            /* (They hold older versions of the metadata and would otherwise end
+             *  up overlapping the accumulator)
+             */
+            if (accum->nregions > 0)
+                if (H5F__accum_write_regions(f_sh, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions")
+
             /* Check if there is already metadata in the accumulator */
             if (accum->size > 0) {
                 /* Check if the new metadata adjoins the beginning of the current accumulator */
@@ -635,11 +657,22 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 }     /* end if */
                 /* New piece of metadata doesn't adjoin or overlap the existing accumulator */
                 else {
-                    /* Write out the existing metadata accumulator, with dispatch to driver */
                     if (accum->dirty) {
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
-                                       accum->dirty_len, accum->buf + accum->dirty_off) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                        /* Set the dirty metadata aside, to be written out later in address order.
+                         * (SWMR readers must see the writes in the order they're made, though)
+                         */
+                        if (!(H5F_SHARED_INTENT(f_sh) & H5F_ACC_SWMR_WRITE) &&
+                            accum->dirty_len < H5F_ACCUM_MAX_SIZE) {
+                            if (H5F__accum_set_aside(f_sh) < 0)
+                                HGOTO_ERROR(H5E_IO, H5E_CANTINSERT, FAIL,
+                                            "can't set aside dirty metadata accumulator region")
+                        } /* end if */
+                        else {
+                            /* Write out the existing metadata accumulator, with dispatch to driver */
+                            if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
+                                           accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                        } /* end else */
 
                         /* Reset accumulator dirty flag */
                         accum->dirty = FALSE;
@@ -737,6 +770,11 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 if (H5F__accum_reset(f_sh, TRUE) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
 
+            /* Write out any dirty regions set aside that the new metadata overlaps */
+            if (accum->nregions > 0)
+                if (H5F__accum_write_regions(f_sh, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions")
+
             /* Write the data */
             if (H5FD_write(file, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
@@ -787,7 +825,11 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                         /* Reset accumulator, but don't flush */
                         if (H5F__accum_reset(f_sh, FALSE) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
-                    }                    /* end else */
+                    } /* end else */
+                }     /* end if */
+                else if (H5F_addr_le(addr + size, accum->loc + accum->size)) {
+                    /* Write falls within the accumulator, keep its copy current */
+                    H5MM_memcpy(accum->buf + (addr - accum->loc), buf, size);
                 }                        /* end if */
                 else {                   /* Write starts after beginning of accumulator */
                     size_t overlap_size; /* Size of overlapping region */
@@ -835,6 +877,43 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_overlaps
+ *
+ * Purpose:     Check whether a block of the file overlaps the metadata
+ *              accumulator or any dirty region set aside.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F__accum_overlaps(const H5F_shared_t *f_sh, haddr_t addr, size_t size)
+{
+    const H5F_meta_accum_t *accum;             /* Alias for file's metadata accumulator */
+    size_t                  u;                 /* Local index variable */
+    hbool_t                 ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(f_sh);
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    if (accum->size > 0 && H5F_addr_overlap(addr, size, accum->loc, accum->size))
+        HGOTO_DONE(TRUE)
+
+    /* The regions are in address order, so stop at the first one past the block */
+    for (u = 0; u < accum->nregions && H5F_addr_lt(accum->regions[u].loc, addr + size); u++)
+        if (H5F_addr_overlap(addr, size, accum->regions[u].loc, accum->regions[u].size))
+            HGOTO_DONE(TRUE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_overlaps() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F__accum_free
  *
@@ -998,6 +1077,11 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
         } /* end else */
     }     /* end if */
 
+    /* Remove the freed block from any dirty regions set aside */
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && accum->nregions > 0)
+        if (H5F__accum_free_regions(f_sh, addr, size) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFREE, FAIL, "can't adjust dirty metadata regions")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_free() */
@@ -1007,6 +1091,9 @@ done:
  *
  * Purpose:	Flush the metadata accumulator to the file
  *
+ *              The dirty region of the accumulator and any dirty regions
+ *              set aside are written out in address order.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Quincey Koziol
@@ -1025,19 +1112,34 @@ H5F__accum_flush(H5F_shared_t *f_sh)
     HDassert(f_sh);
 
     /* Check if we need to flush out the metadata accumulator */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.dirty) {
-        H5FD_t *file; /* File driver pointer */
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
+        (f_sh->accum.dirty || f_sh->accum.nregions > 0)) {
+        H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
 
-        /* Translate to file driver pointer */
-        file = f_sh->lf;
+        /* Set up alias for file's metadata accumulator info */
+        accum = &f_sh->accum;
 
-        /* Flush the metadata contents */
-        if (H5FD_write(file, H5FD_MEM_DEFAULT, f_sh->accum.loc + f_sh->accum.dirty_off, f_sh->accum.dirty_len,
-                       f_sh->accum.buf + f_sh->accum.dirty_off) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        if (accum->dirty) {
+            haddr_t dirty_loc = accum->loc + accum->dirty_off; /* File offset of dirty information */
+
+            /* Write out the dirty regions set aside below the accumulator first */
+            while (accum->nregions > 0 && H5F_addr_lt(accum->regions[0].loc, dirty_loc))
+                if (H5F__accum_write_region(f_sh, 0) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata region")
+
+            /* Flush the metadata contents */
+            if (H5FD_write(f_sh->lf, H5FD_MEM_DEFAULT, dirty_loc, accum->dirty_len,
+                           accum->buf + accum->dirty_off) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
-        /* Reset the dirty flag */
-        f_sh->accum.dirty = FALSE;
+            /* Reset the dirty flag */
+            accum->dirty = FALSE;
+        } /* end if */
+
+        /* Write out the rest of the dirty regions set aside */
+        while (accum->nregions > 0)
+            if (H5F__accum_write_region(f_sh, 0) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata region")
     } /* end if */
 
 done:
@@ -1049,6 +1151,9 @@ done:
  *
  * Purpose:	Reset the metadata accumulator for the file
  *
+ *              Dirty regions set aside are only dropped when FLUSH is
+ *              TRUE, after they have been written out.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Quincey Koziol
@@ -1082,8 +1187,313 @@ H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush)
         f_sh->accum.loc                           = HADDR_UNDEF;
         f_sh->accum.dirty                         = FALSE;
         f_sh->accum.dirty_len                     = 0;
+
+        /* Free the array of dirty regions set aside, once they are all written */
+        /* (Regions set aside are outside the accumulator and are kept when
+         *  resetting without flushing)
+         */
+        if (f_sh->accum.regions && 0 == f_sh->accum.nregions)
+            f_sh->accum.regions = H5FL_SEQ_FREE(H5F_accum_region_t, f_sh->accum.regions);
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_set_aside
+ *
+ * Purpose:     Set the dirty region of the metadata accumulator aside, so
+ *              that the accumulator can move to another part of the file
+ *              without writing the dirty metadata out yet.
+ *
+ *              The region is merged with any region set aside that it
+ *              adjoins.  When there's no room left for it, all of the
+ *              regions set aside are written out first.
+ *
+ *              The accumulator's dirty flag is left for the caller to
+ *              reset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_set_aside(H5F_shared_t *f_sh)
+{
+    H5F_meta_accum_t *  accum;               /* Alias for file's metadata accumulator */
+    H5F_accum_region_t *region;              /* Region holding the dirty metadata */
+    haddr_t             dirty_loc;           /* File offset of dirty information */
+    size_t              next;                /* Index of the region after the dirty metadata */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    /* Sanity checks */
+    HDassert(accum->dirty);
+    HDassert(accum->dirty_len < H5F_ACCUM_MAX_SIZE);
+
+    /* Write out the regions already set aside, if there's no room for this one */
+    if (accum->nregions == H5F_ACCUM_MAX_REGIONS ||
+        (accum->regions_size + accum->dirty_len) > H5F_ACCUM_MAX_SIZE)
+        while (accum->nregions > 0)
+            if (H5F__accum_write_region(f_sh, 0) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata region")
+
+    /* Allocate the array of regions, the first time it's needed */
+    if (NULL == accum->regions)
+        if (NULL == (accum->regions = H5FL_SEQ_MALLOC(H5F_accum_region_t, (size_t)H5F_ACCUM_MAX_REGIONS)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator regions")
+
+    /* Locate the first region after the dirty metadata */
+    dirty_loc = accum->loc + accum->dirty_off;
+    for (next = 0; next < accum->nregions; next++)
+        if (H5F_addr_gt(accum->regions[next].loc, dirty_loc))
+            break;
+
+    /* Check if the dirty metadata adjoins the end of the region before it */
+    if (next > 0 && H5F_addr_eq(accum->regions[next - 1].loc + accum->regions[next - 1].size, dirty_loc)) {
+        region = &accum->regions[next - 1];
+
+        /* Extend the region's buffer */
+        if (NULL == (region->buf = H5FL_BLK_REALLOC(meta_accum_region, region->buf,
+                                                    region->size + accum->dirty_len)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator region")
+        H5MM_memcpy(region->buf + region->size, accum->buf + accum->dirty_off, accum->dirty_len);
+        region->size += accum->dirty_len;
+    } /* end if */
+    else {
+        unsigned char *buf; /* Buffer for the dirty metadata */
+
+        /* Copy the dirty metadata */
+        if (NULL == (buf = H5FL_BLK_MALLOC(meta_accum_region, accum->dirty_len)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator region")
+        H5MM_memcpy(buf, accum->buf + accum->dirty_off, accum->dirty_len);
+
+        /* Insert a new region, keeping the regions in address order */
+        if (next < accum->nregions)
+            HDmemmove(&accum->regions[next + 1], &accum->regions[next],
+                      (accum->nregions - next) * sizeof(H5F_accum_region_t));
+        region       = &accum->regions[next];
+        region->buf  = buf;
+        region->loc  = dirty_loc;
+        region->size = accum->dirty_len;
+        accum->nregions++;
+        next++;
+    } /* end else */
+    accum->regions_size += accum->dirty_len;
+
+    /* Check if the region now adjoins the beginning of the region after it */
+    if (next < accum->nregions && H5F_addr_eq(region->loc + region->size, accum->regions[next].loc)) {
+        /* Move the following region's metadata into this region */
+        if (NULL == (region->buf = H5FL_BLK_REALLOC(meta_accum_region, region->buf,
+                                                    region->size + accum->regions[next].size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator region")
+        H5MM_memcpy(region->buf + region->size, accum->regions[next].buf, accum->regions[next].size);
+        region->size += accum->regions[next].size;
+
+        /* Remove the following region */
+        accum->regions[next].buf = H5FL_BLK_FREE(meta_accum_region, accum->regions[next].buf);
+        accum->nregions--;
+        if (next < accum->nregions)
+            HDmemmove(&accum->regions[next], &accum->regions[next + 1],
+                      (accum->nregions - next) * sizeof(H5F_accum_region_t));
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_set_aside() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_write_region
+ *
+ * Purpose:     Write out a dirty region set aside and remove it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_write_region(H5F_shared_t *f_sh, size_t idx)
+{
+    H5F_meta_accum_t *  accum;               /* Alias for file's metadata accumulator */
+    H5F_accum_region_t *region;              /* Region to write */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    /* Sanity check */
+    HDassert(idx < accum->nregions);
+
+    region = &accum->regions[idx];
+
+    /* Write the dirty metadata */
+    if (H5FD_write(f_sh->lf, H5FD_MEM_DEFAULT, region->loc, region->size, region->buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+    /* Remove the region */
+    accum->regions_size -= region->size;
+    region->buf = H5FL_BLK_FREE(meta_accum_region, region->buf);
+    accum->nregions--;
+    if (idx < accum->nregions)
+        HDmemmove(region, region + 1, (accum->nregions - idx) * sizeof(H5F_accum_region_t));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_write_region() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_write_regions
+ *
+ * Purpose:     Write out and remove the dirty regions set aside that
+ *              overlap a block of the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_write_regions(H5F_shared_t *f_sh, haddr_t addr, size_t size)
+{
+    H5F_meta_accum_t *accum;               /* Alias for file's metadata accumulator */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    /* The regions are in address order, so stop at the first one past the block */
+    u = 0;
+    while (u < accum->nregions && H5F_addr_lt(accum->regions[u].loc, addr + size)) {
+        if (H5F_addr_overlap(addr, size, accum->regions[u].loc, accum->regions[u].size)) {
+            if (H5F__accum_write_region(f_sh, u) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata region")
+        } /* end if */
+        else
+            u++;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_write_regions() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_read_regions
+ *
+ * Purpose:     Copy the parts of the dirty regions set aside that overlap
+ *              a block of the file into a buffer holding the block.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_read_regions(const H5F_meta_accum_t *accum, haddr_t addr, size_t size, unsigned char *buf)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* The regions are in address order, so stop at the first one past the block */
+    for (u = 0; u < accum->nregions && H5F_addr_lt(accum->regions[u].loc, addr + size); u++) {
+        const H5F_accum_region_t *region = &accum->regions[u]; /* Region to check */
+
+        if (H5F_addr_overlap(addr, size, region->loc, region->size)) {
+            haddr_t start = MAX(addr, region->loc);                       /* Start of overlap */
+            haddr_t end   = MIN(addr + size, region->loc + region->size); /* End of overlap */
+
+            H5MM_memcpy(buf + (start - addr), region->buf + (start - region->loc), (size_t)(end - start));
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_read_regions() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_free_regions
+ *
+ * Purpose:     Remove a block of freed space from the dirty regions set
+ *              aside, so the freed space is never written to.
+ *
+ *              A region that loses a piece from its middle has the part
+ *              after the freed block written out.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_free_regions(H5F_shared_t *f_sh, haddr_t addr, hsize_t size)
+{
+    H5F_meta_accum_t *accum;               /* Alias for file's metadata accumulator */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    /* The regions are in address order, so stop at the first one past the block */
+    u = 0;
+    while (u < accum->nregions && H5F_addr_lt(accum->regions[u].loc, addr + size)) {
+        H5F_accum_region_t *region = &accum->regions[u];         /* Region to check */
+        haddr_t             end    = region->loc + region->size; /* End of region */
+
+        /* Skip regions that the freed block doesn't touch */
+        if (!H5F_addr_overlap(addr, size, region->loc, region->size)) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Check for the freed block covering the beginning of the region */
+        if (H5F_addr_le(addr, region->loc)) {
+            /* Check for the freed block covering the whole region */
+            if (H5F_addr_ge(addr + size, end)) {
+                accum->regions_size -= region->size;
+                region->buf = H5FL_BLK_FREE(meta_accum_region, region->buf);
+                accum->nregions--;
+                if (u < accum->nregions)
+                    HDmemmove(region, region + 1, (accum->nregions - u) * sizeof(H5F_accum_region_t));
+            } /* end if */
+            else {
+                size_t overlap_size = (size_t)((addr + size) - region->loc); /* Size freed from region */
+
+                /* Trim the beginning of the region off */
+                HDmemmove(region->buf, region->buf + overlap_size, region->size - overlap_size);
+                region->loc += overlap_size;
+                region->size -= overlap_size;
+                accum->regions_size -= overlap_size;
+                u++;
+            } /* end else */
+        }     /* end if */
+        else {
+            size_t new_size = (size_t)(addr - region->loc); /* Size of region before freed block */
+
+            /* Write out the part of the region after the freed block, if there is one */
+            if (H5F_addr_lt(addr + size, end)) {
+                size_t tail_off = (size_t)((addr + size) - region->loc); /* Offset of part after block */
+
+                if (H5FD_write(f_sh->lf, H5FD_MEM_DEFAULT, addr + size, region->size - tail_off,
+                               region->buf + tail_off) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            } /* end if */
+
+            /* Trim the end of the region off */
+            accum->regions_size -= region->size - new_size;
+            region->size = new_size;
+            u++;
+        } /* end else */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_free_regions() */
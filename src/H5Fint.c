@@ -386,6 +386,10 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set data cache byte size")
     if (H5P_set(new_plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set preempt read chunks")
+    if (H5P_set(new_plist, H5F_ACS_FILTER_THREADS_NAME, &(f->shared->filter_threads)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set number of filter threads")
+    if (H5P_set(new_plist, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, &(f->shared->rdcc_shared_size)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set shared data cache byte size")
     if (H5P_set(new_plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set alignment threshold")
     if (H5P_set(new_plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -424,6 +428,8 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
             0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5I_INVALID_HID,
                         "can't set minimum raw data fraction of page buffer")
+        if (H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &(f->shared->page_buf->policy)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5I_INVALID_HID, "can't set page buffer policy")
     } /* end if */
 #ifdef H5_HAVE_PARALLEL
     if (H5P_set(new_plist, H5_COLL_MD_READ_FLAG_NAME, &(f->shared->coll_md_read)) < 0)
@@ -1173,6 +1179,10 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get data cache byte size")
         if (H5P_get(plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get preempt read chunk")
+        if (H5P_get(plist, H5F_ACS_FILTER_THREADS_NAME, &(f->shared->filter_threads)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get number of filter threads")
+        if (H5P_get(plist, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, &(f->shared->rdcc_shared_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get shared data cache byte size")
         if (H5P_get(plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold")
         if (H5P_get(plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -1551,6 +1561,13 @@ H5F__dest(H5F_t *f, hbool_t flush)
         if (H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if (f->shared->rdcc_shared) {
+            /* Release the shared chunk cache (all datasets are closed by now) */
+            if (H5UC_DEC(f->shared->rdcc_shared) < 0)
+                /* Push error, but keep going*/
+                HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing shared chunk cache")
+            f->shared->rdcc_shared = NULL;
+        } /* end if */
 
         /* Destroy file creation properties */
         if (H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -1734,23 +1751,24 @@ done:
 H5F_t *
 H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 {
-    H5F_t *            file   = NULL; /*the success return value      */
-    H5F_shared_t *     shared = NULL; /*shared part of `file'         */
-    H5FD_t *           lf     = NULL; /*file driver part of `shared'  */
-    unsigned           tent_flags;    /*tentative flags               */
-    H5FD_class_t *     drvr;          /*file driver class info        */
-    H5P_genplist_t *   a_plist;       /*file access property list     */
-    H5F_close_degree_t fc_degree;     /*file close degree             */
-    size_t             page_buf_size;
-    unsigned           page_buf_min_meta_perc = 0;
-    unsigned           page_buf_min_raw_perc  = 0;
-    hbool_t            set_flag               = FALSE; /*set the status_flags in the superblock */
-    hbool_t            clear                  = FALSE; /*clear the status_flags         */
-    hbool_t            evict_on_close;                 /* evict on close value from plist  */
-    hbool_t            use_file_locking = TRUE;        /* Using file locks? */
-    hbool_t            ci_load          = FALSE;       /* whether MDC ci load requested */
-    hbool_t            ci_write         = FALSE;       /* whether MDC CI write requested */
-    H5F_t *            ret_value        = NULL;        /*actual return value           */
+    H5F_t *               file   = NULL; /*the success return value      */
+    H5F_shared_t *        shared = NULL; /*shared part of `file'         */
+    H5FD_t *              lf     = NULL; /*file driver part of `shared'  */
+    unsigned              tent_flags;    /*tentative flags               */
+    H5FD_class_t *        drvr;          /*file driver class info        */
+    H5P_genplist_t *      a_plist;       /*file access property list     */
+    H5F_close_degree_t    fc_degree;     /*file close degree             */
+    size_t                page_buf_size;
+    unsigned              page_buf_min_meta_perc = 0;
+    unsigned              page_buf_min_raw_perc  = 0;
+    H5F_page_buf_policy_t page_buf_policy        = H5F_PAGE_BUF_POLICY_LRU;
+    hbool_t               set_flag               = FALSE; /*set the status_flags in the superblock */
+    hbool_t               clear                  = FALSE; /*clear the status_flags         */
+    hbool_t               evict_on_close;                 /* evict on close value from plist  */
+    hbool_t               use_file_locking = TRUE;        /* Using file locks? */
+    hbool_t               ci_load          = FALSE;       /* whether MDC ci load requested */
+    hbool_t               ci_write         = FALSE;       /* whether MDC CI write requested */
+    H5F_t *               ret_value        = NULL;        /*actual return value           */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -1914,6 +1932,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum metadata fraction of page buffer")
         if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &page_buf_min_raw_perc) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum raw data fraction of page buffer")
+        if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &page_buf_policy) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer policy")
     } /* end if */
 
     /*
@@ -1929,7 +1949,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 
         /* Create the page buffer before initializing the superblock */
         if (page_buf_size)
-            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc,
+                            page_buf_policy) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Initialize information about the superblock and allocate space for it */
@@ -1951,7 +1972,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 
         /* Create the page buffer before initializing the superblock */
         if (page_buf_size)
-            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc,
+                            page_buf_policy) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Open the root group */
@@ -2896,6 +2918,30 @@ H5F_set_grp_btree_shared(H5F_t *f, H5UC_t *rc)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_grp_btree_shared() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_rdcc_shared
+ *
+ * Purpose:     Set the rdcc_shared field with a valid ref-count pointer.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_set_rdcc_shared(H5F_t *f, H5UC_t *rc)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(rc);
+
+    f->shared->rdcc_shared = rc;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5F_set_rdcc_shared() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
  *
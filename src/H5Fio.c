@@ -54,6 +54,9 @@
 /* Local Prototypes */
 /********************/
 
+static hbool_t H5F__vector_direct(const H5F_shared_t *f_sh, uint32_t count, const H5FD_mem_t types[],
+                                  const haddr_t addrs[], const size_t sizes[]);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -238,6 +241,192 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F__vector_direct
+ *
+ * Purpose:     Determines whether a vector of I/O requests can be passed
+ *              straight to the file driver.  This is only possible when
+ *              no page buffer is in use and, if metadata is accumulated,
+ *              all the extents are raw data that doesn't overlap the
+ *              metadata accumulator or the dirty regions it set aside.
+ *              (Freed metadata space can be reused for raw data while
+ *              the accumulator still holds it.)
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5F__vector_direct(const H5F_shared_t *f_sh, uint32_t count, const H5FD_mem_t types[],
+                   const haddr_t addrs[], const size_t sizes[])
+{
+    uint32_t u;                /* Local index variable */
+    hbool_t  ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (f_sh->page_buf)
+        HGOTO_DONE(FALSE)
+
+    if (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
+        for (u = 0; u < count; u++)
+            if (H5FD_MEM_DRAW != types[u] || H5F__accum_overlaps(f_sh, addrs[u], sizes[u]))
+                HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__vector_direct() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_read
+ *
+ * Purpose:     Reads COUNT blocks of data from a file/server/etc into the
+ *              buffers in BUFS.  The addresses are relative to the base
+ *              address for the file.  Global heap blocks must be passed
+ *              with type H5FD_MEM_DRAW.
+ *
+ *              When neither the page buffer nor the metadata accumulator
+ *              can be involved, the whole vector is handed to the file
+ *              driver in one call.  Otherwise each block goes through
+ *              the page buffer layer in turn.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_read(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert((types && addrs && sizes && bufs) || 0 == count);
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        HDassert(H5FD_MEM_GHEAP != types[u]);
+
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    if (H5F__vector_direct(f_sh, count, types, addrs, sizes)) {
+        /* Pass the whole vector to the file driver */
+        if (H5FD_read_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read through file driver failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            /* Pass through page buffer layer */
+            if (H5PB_read(f_sh, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_write
+ *
+ * Purpose:     Writes COUNT blocks of data from the buffers in BUFS to a
+ *              file/server/etc.  The addresses are relative to the base
+ *              address for the file.  Global heap blocks must be passed
+ *              with type H5FD_MEM_DRAW.
+ *
+ *              When neither the page buffer nor the metadata accumulator
+ *              can be involved, the whole vector is handed to the file
+ *              driver in one call.  Otherwise each block goes through
+ *              the page buffer layer in turn.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_write(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert((types && addrs && sizes && bufs) || 0 == count);
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        HDassert(H5FD_MEM_GHEAP != types[u]);
+
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    if (H5F__vector_direct(f_sh, count, types, addrs, sizes)) {
+        /* Pass the whole vector to the file driver */
+        if (H5FD_write_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write through file driver failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            /* Pass through page buffer layer */
+            if (H5PB_write(f_sh, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_get_mapped_ptr
+ *
+ * Purpose:     Looks up where SIZE bytes of raw data, starting at ADDR,
+ *              can be read directly from memory.  The address is relative
+ *              to the base address for the file.
+ *
+ *              *PTR is set to NULL when the file driver doesn't map the
+ *              file into memory (only the mmap VFD does).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_get_mapped_ptr(H5F_shared_t *f_sh, haddr_t addr, size_t size, const void **ptr /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(ptr);
+
+    *ptr = NULL;
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5F_addr_le(f_sh->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+#ifdef H5_HAVE_MMAP
+    if (H5FD_mmap_get_ptr(f_sh->lf, addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't get pointer into mapped file")
+#endif /* H5_HAVE_MMAP */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_get_mapped_ptr() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
  *
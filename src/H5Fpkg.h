@@ -186,15 +186,28 @@ struct H5F_blk_aggr_t {
     haddr_t       addr;         /* Location of block left */
 };
 
+/* Dirty metadata set aside when the accumulator moves to a new location */
+typedef struct H5F_accum_region_t {
+    unsigned char *buf;  /* Buffer holding the dirty metadata */
+    haddr_t        loc;  /* File location (offset) of the dirty metadata */
+    size_t         size; /* Size of the dirty metadata (in bytes) */
+} H5F_accum_region_t;
+
 /* Structure for metadata accumulator fields */
+/* (The set aside dirty regions are kept sorted by address, don't overlap
+ *  each other and never overlap the accumulated metadata in 'buf')
+ */
 typedef struct H5F_meta_accum_t {
-    unsigned char *buf;        /* Buffer to hold the accumulated metadata */
-    haddr_t        loc;        /* File location (offset) of the accumulated metadata */
-    size_t         size;       /* Size of the accumulated metadata buffer used (in bytes) */
-    size_t         alloc_size; /* Size of the accumulated metadata buffer allocated (in bytes) */
-    size_t         dirty_off;  /* Offset of the dirty region in the accumulator buffer */
-    size_t         dirty_len;  /* Length of the dirty region in the accumulator buffer */
-    hbool_t        dirty;      /* Flag to indicate that the accumulated metadata is dirty */
+    unsigned char *     buf;          /* Buffer to hold the accumulated metadata */
+    haddr_t             loc;          /* File location (offset) of the accumulated metadata */
+    size_t              size;         /* Size of the accumulated metadata buffer used (in bytes) */
+    size_t              alloc_size;   /* Size of the accumulated metadata buffer allocated (in bytes) */
+    size_t              dirty_off;    /* Offset of the dirty region in the accumulator buffer */
+    size_t              dirty_len;    /* Length of the dirty region in the accumulator buffer */
+    hbool_t             dirty;        /* Flag to indicate that the accumulated metadata is dirty */
+    H5F_accum_region_t *regions;      /* Dirty regions set aside, in address order */
+    size_t              nregions;     /* Number of dirty regions set aside */
+    size_t              regions_size; /* Total size of the dirty regions set aside (in bytes) */
 } H5F_meta_accum_t;
 
 /* A record of the mount table */
@@ -292,6 +305,7 @@ struct H5F_shared_t {
     size_t   rdcc_nslots;    /* Size of raw data chunk cache (slots)	*/
     size_t   rdcc_nbytes;    /* Size of raw data chunk cache	(bytes)	*/
     double   rdcc_w0;        /* Preempt read chunks first? [0.0..1.0]*/
+    unsigned filter_threads; /* Threads running the chunk filter pipeline */
     size_t   sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hsize_t  threshold;      /* Threshold for alignment		*/
     hsize_t  alignment;      /* Alignment				*/
@@ -304,6 +318,8 @@ struct H5F_shared_t {
     struct H5G_t *       root_grp;          /* Open root group			*/
     H5FO_t *             open_objs;         /* Open objects in file                 */
     H5UC_t *             grp_btree_shared;  /* Ref-counted group B-tree node info   */
+    H5UC_t *             rdcc_shared;       /* Ref-counted chunk cache shared by all datasets */
+    size_t               rdcc_shared_size;  /* Size of the shared chunk cache (bytes), 0 if none */
     hbool_t              use_file_locking;  /* Whether or not to use file locking */
     hbool_t              closing;           /* File is in the process of being closed */
 
@@ -437,12 +453,13 @@ H5_DLL herr_t H5F__super_ext_remove_msg(H5F_t *f, unsigned id);
 H5_DLL herr_t H5F__super_ext_close(H5F_t *f, H5O_loc_t *ext_ptr, hbool_t was_created);
 
 /* Metadata accumulator routines */
-H5_DLL herr_t H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf);
-H5_DLL herr_t H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
-                               const void *buf);
-H5_DLL herr_t H5F__accum_free(H5F_shared_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size);
-H5_DLL herr_t H5F__accum_flush(H5F_shared_t *f_sh);
-H5_DLL herr_t H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush);
+H5_DLL herr_t  H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf);
+H5_DLL herr_t  H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                                const void *buf);
+H5_DLL herr_t  H5F__accum_free(H5F_shared_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size);
+H5_DLL hbool_t H5F__accum_overlaps(const H5F_shared_t *f_sh, haddr_t addr, size_t size);
+H5_DLL herr_t  H5F__accum_flush(H5F_shared_t *f_sh);
+H5_DLL herr_t  H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush);
 
 /* Shared file list related routines */
 H5_DLL herr_t H5F__sfile_add(H5F_shared_t *shared);
@@ -358,12 +358,16 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)               ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)               ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)                   ((F)->shared->rdcc_w0)
+#define H5F_FILTER_THREADS(F)            ((F)->shared->filter_threads)
+#define H5F_RDCC_SHARED_NBYTES(F)        ((F)->shared->rdcc_shared_size)
 #define H5F_SIEVE_BUF_SIZE(F)            ((F)->shared->sieve_buf_size)
 #define H5F_GC_REF(F)                    ((F)->shared->gc_ref)
 #define H5F_STORE_MSG_CRT_IDX(F)         ((F)->shared->store_msg_crt_idx)
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F)          ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_RDCC_SHARED(F)               ((F)->shared->rdcc_shared)
+#define H5F_SET_RDCC_SHARED(F, RC)       (((F)->shared->rdcc_shared = (RC)) ? SUCCEED : FAIL)
 #define H5F_USE_TMP_SPACE(F)             ((F)->shared->fs.use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_addr_le((F)->shared->fs.tmp_addr, (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -421,12 +425,16 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)               (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)               (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)                   (H5F_rdcc_w0(F))
+#define H5F_FILTER_THREADS(F)            (H5F_filter_threads(F))
+#define H5F_RDCC_SHARED_NBYTES(F)        (H5F_rdcc_shared_nbytes(F))
 #define H5F_SIEVE_BUF_SIZE(F)            (H5F_sieve_buf_size(F))
 #define H5F_GC_REF(F)                    (H5F_gc_ref(F))
 #define H5F_STORE_MSG_CRT_IDX(F)         (H5F_store_msg_crt_idx(F))
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F)          (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_RDCC_SHARED(F)               (H5F_rdcc_shared(F))
+#define H5F_SET_RDCC_SHARED(F, RC)       (H5F_set_rdcc_shared((F), (RC)))
 #define H5F_USE_TMP_SPACE(F)             (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_is_tmp_addr((F), (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -610,11 +618,16 @@ typedef struct H5F_t H5F_t;
     "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME                                                                \
     "page_buffer_min_raw_perc" /* the min raw data percentage for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_POLICY_NAME                                                                      \
+    "page_buffer_policy" /* the replacement policy for the page buffer cache */
 #define H5F_ACS_USE_FILE_LOCKING_NAME                                                                        \
     "use_file_locking" /* whether or not we use file locks for SWMR control and to prevent multiple writers  \
                         */
 #define H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME                                                              \
     "ignore_disabled_file_locks" /* whether or not we ignore "locks disabled" errors */
+#define H5F_ACS_FILTER_THREADS_NAME "filter_threads" /* Threads running the chunk filter pipeline */
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME                                                             \
+    "rdcc_shared_nbytes" /* Size of the chunk cache shared by all datasets in the file */
 #ifdef H5_HAVE_PARALLEL
 #define H5F_ACS_MPI_PARAMS_COMM_NAME "mpi_params_comm" /* the MPI communicator */
 #define H5F_ACS_MPI_PARAMS_INFO_NAME "mpi_params_info" /* the MPI info struct */
@@ -880,12 +893,16 @@ H5_DLL hbool_t            H5F_get_evict_on_close(const H5F_t *f);
 H5_DLL size_t             H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t             H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double             H5F_rdcc_w0(const H5F_t *f);
+H5_DLL unsigned           H5F_filter_threads(const H5F_t *f);
+H5_DLL size_t             H5F_rdcc_shared_nbytes(const H5F_t *f);
 H5_DLL size_t             H5F_sieve_buf_size(const H5F_t *f);
 H5_DLL unsigned           H5F_gc_ref(const H5F_t *f);
 H5_DLL hbool_t            H5F_store_msg_crt_idx(const H5F_t *f);
 H5_DLL herr_t             H5F_set_store_msg_crt_idx(H5F_t *f, hbool_t flag);
 H5_DLL struct H5UC_t *    H5F_grp_btree_shared(const H5F_t *f);
 H5_DLL herr_t             H5F_set_grp_btree_shared(H5F_t *f, struct H5UC_t *rc);
+H5_DLL struct H5UC_t *    H5F_rdcc_shared(const H5F_t *f);
+H5_DLL herr_t             H5F_set_rdcc_shared(H5F_t *f, struct H5UC_t *rc);
 H5_DLL hbool_t            H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t            H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
 H5_DLL hsize_t            H5F_get_alignment(const H5F_t *f);
@@ -919,6 +936,12 @@ H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t siz
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                      const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5F_shared_vector_read(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                                     size_t sizes[], void *bufs[] /*out*/);
+H5_DLL herr_t H5F_shared_vector_write(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                                      size_t sizes[], const void *bufs[]);
+H5_DLL herr_t H5F_shared_get_mapped_ptr(H5F_shared_t *f_sh, haddr_t addr, size_t size,
+                                        const void **ptr /*out*/);
 
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
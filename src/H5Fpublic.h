@@ -210,6 +210,19 @@ typedef enum H5F_fspace_strategy_t {
     H5F_FSPACE_STRATEGY_NTYPES    /**< Sentinel */
 } H5F_fspace_strategy_t;
 
+/**
+ * Page buffer replacement policy
+ */
+typedef enum H5F_page_buf_policy_t {
+    H5F_PAGE_BUF_POLICY_LRU = 0, /**< One least-recently-used list for all pages.
+                                      This is the library default */
+    H5F_PAGE_BUF_POLICY_2Q  = 1, /**< 2Q: new pages enter a short FIFO and only pages referenced again
+                                      after leaving it are kept in the LRU list */
+    H5F_PAGE_BUF_POLICY_ARC = 2, /**< Adaptive replacement cache: balances recently and frequently
+                                      used pages using the history of evicted pages */
+    H5F_PAGE_BUF_POLICY_NTYPES   /**< Sentinel */
+} H5F_page_buf_policy_t;
+
 /**
  * File space handling strategy for release 1.10.0
  *
@@ -1980,6 +1993,105 @@ H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
  */
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2], unsigned hits[2],
                                           unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+/**
+ * \ingroup H5F
+ *
+ * \brief Retrieves page buffer statistics for each type of file memory
+ *
+ * \file_id
+ * \param[out] hits Array of #H5FD_MEM_NTYPES integers for the number of hits
+ *                  in the page buffer, indexed by #H5F_mem_t
+ * \param[out] misses Array of #H5FD_MEM_NTYPES integers for the number of
+ *                    misses in the page buffer, indexed by #H5F_mem_t
+ * \param[out] evictions Array of #H5FD_MEM_NTYPES integers for the number of
+ *                       pages evicted from the page buffer, indexed by
+ *                       #H5F_mem_t
+ *
+ * \return \herr_t
+ *
+ * \details H5Fget_page_buffering_type_stats() retrieves the same counts as
+ *          H5Fget_page_buffering_stats(), split by the type of the page
+ *          (#H5FD_MEM_SUPER, #H5FD_MEM_BTREE, #H5FD_MEM_DRAW, ...) instead
+ *          of into metadata and raw data.  Any of the output parameters may
+ *          be NULL.  The counts are reset by H5Freset_page_buffering_stats().
+ *
+ * \since 1.13.1
+ *
+ */
+H5_DLL herr_t H5Fget_page_buffering_type_stats(hid_t file_id, unsigned hits[H5FD_MEM_NTYPES],
+                                               unsigned misses[H5FD_MEM_NTYPES],
+                                               unsigned evictions[H5FD_MEM_NTYPES]);
+/**
+ * \ingroup H5F
+ *
+ * \brief Retrieves statistics about read-ahead of raw data by the file driver
+ *
+ * \file_id
+ * \param[out] reads Number of raw data reads
+ * \param[out] hits Number of raw data reads served from read-ahead data
+ * \param[out] fills Number of read-ahead reads made by the driver
+ *
+ * \return \herr_t
+ *
+ * \details H5Fget_readahead_stats() retrieves the read-ahead statistics of a
+ *          file opened with read-ahead enabled through
+ *          H5Pset_fapl_sec2_readahead().  The hit rate is \p hits divided by
+ *          \p reads.  All the counts are zero when read-ahead is off.  Any
+ *          of the output parameters may be NULL.
+ *
+ *          The function fails for files opened with a file driver that
+ *          doesn't read ahead.
+ *
+ * \since 1.13.1
+ *
+ */
+H5_DLL herr_t H5Fget_readahead_stats(hid_t file_id, hsize_t *reads, hsize_t *hits, hsize_t *fills);
+/**
+ * \ingroup H5F
+ *
+ * \brief Retrieves statistics about the chunk cache shared by a file's datasets
+ *
+ * \file_id
+ * \param[out] hits Number of chunk accesses found in the cache
+ * \param[out] misses Number of chunk accesses not found in the cache
+ * \param[out] evictions Number of chunks preempted to make room for others
+ * \param[out] nbytes_used Bytes of chunk data currently in the cache
+ * \param[out] nchunks Number of chunks currently in the cache
+ *
+ * \return \herr_t
+ *
+ * \details H5Fget_shared_chunk_cache_stats() retrieves the statistics of
+ *          the raw data chunk cache that the file's datasets share when the
+ *          file was opened with a file access property list on which
+ *          H5Pset_shared_chunk_cache() set a nonzero size.  The counts cover
+ *          all the datasets using the shared cache and are reset by
+ *          H5Freset_shared_chunk_cache_stats().  Any of the output
+ *          parameters may be NULL.
+ *
+ *          The function fails if the file doesn't have a shared chunk cache.
+ *
+ * \since 1.13.1
+ *
+ */
+H5_DLL herr_t H5Fget_shared_chunk_cache_stats(hid_t file_id, unsigned *hits, unsigned *misses,
+                                              unsigned *evictions, size_t *nbytes_used, size_t *nchunks);
+/**
+ * \ingroup H5F
+ *
+ * \brief Resets the statistics of the chunk cache shared by a file's datasets
+ *
+ * \file_id
+ *
+ * \return \herr_t
+ *
+ * \details H5Freset_shared_chunk_cache_stats() sets the hit, miss and
+ *          eviction counts reported by H5Fget_shared_chunk_cache_stats()
+ *          back to zero.
+ *
+ * \since 1.13.1
+ *
+ */
+H5_DLL herr_t H5Freset_shared_chunk_cache_stats(hid_t file_id);
 /**
  * \ingroup MDC
  *
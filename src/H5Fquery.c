@@ -641,6 +641,52 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_filter_threads
+ *
+ * Purpose:  Retrieve the number of threads that may run the filter
+ *           pipeline over the file's chunks at once.
+ *
+ * Return:   Success:    The number of filter threads (one or less
+ *                              means chunks are filtered serially).
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_filter_threads(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->filter_threads)
+} /* end H5F_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_rdcc_shared_nbytes
+ *
+ * Purpose:  Retrieve the size of the chunk cache shared by the file's
+ *           datasets.
+ *
+ * Return:   Success:    The size in bytes (zero when each dataset
+ *                              has its own chunk cache).
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_rdcc_shared_nbytes(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->rdcc_shared_size)
+} /* end H5F_rdcc_shared_nbytes() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_get_base_addr
  *
@@ -688,6 +734,28 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_rdcc_shared
+ *
+ * Purpose:  Retrieve the chunk cache shared by the file's datasets.
+ *
+ * Return:   Success:    The ref-counted shared chunk cache, or NULL
+ *                              if it hasn't been created.
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+H5UC_t *
+H5F_rdcc_shared(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->rdcc_shared)
+} /* end H5F_rdcc_shared() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_sieve_buf_size
  *
@@ -106,6 +106,41 @@
                       (page_buf)->LRU_list_len)                                                              \
     }
 
+#define H5PB__REMOVE_PAGE(page_buf, page_ptr)                                                                \
+    {                                                                                                        \
+        HDassert(page_buf);                                                                                  \
+        HDassert(page_ptr);                                                                                  \
+        /* remove the entry from the LRU or the probation list. */                                           \
+        if (H5PB_LIST_PROBATION == (page_ptr)->list)                                                         \
+            H5PB__REMOVE((page_ptr), (page_buf)->probation_head_ptr, (page_buf)->probation_tail_ptr,         \
+                         (page_buf)->probation_list_len)                                                     \
+        else                                                                                                 \
+            H5PB__REMOVE_LRU((page_buf), (page_ptr))                                                         \
+    }
+
+/* Update the lists for a hit on a page.  A page on the LRU list moves to
+ * the top.  ARC moves a page on the probation list to the top of the LRU
+ * list, since it has now been referenced twice.  2Q leaves it where it is:
+ * references shortly after a page was loaded are usually the same access
+ * (e.g. a scan reading the page piece by piece), so only a reference after
+ * the page has left the probation list promotes it.
+ */
+#define H5PB__HIT(page_buf, page_ptr)                                                                        \
+    {                                                                                                        \
+        if (H5PB_LIST_LRU == (page_ptr)->list)                                                               \
+            H5PB__MOVE_TO_TOP_LRU((page_buf), (page_ptr))                                                    \
+        else if (H5F_PAGE_BUF_POLICY_ARC == (page_buf)->policy) {                                            \
+            H5PB__REMOVE((page_ptr), (page_buf)->probation_head_ptr, (page_buf)->probation_tail_ptr,         \
+                         (page_buf)->probation_list_len)                                                     \
+            (page_ptr)->list = H5PB_LIST_LRU;                                                                \
+            H5PB__INSERT_LRU((page_buf), (page_ptr))                                                         \
+        } /* end if */                                                                                       \
+    }
+
+/* Whether a page is counted as raw data (otherwise it is metadata) */
+#define H5PB__IS_RAW(page_ptr)                                                                               \
+    (H5F_MEM_PAGE_DRAW == (page_ptr)->type || H5F_MEM_PAGE_GHEAP == (page_ptr)->type)
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -124,7 +159,14 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
-static htri_t H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type);
+static htri_t H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type,
+                               haddr_t inserted_addr);
+static H5PB_entry_t *H5PB__find_victim(const H5PB_t *page_buf, H5PB_entry_t *page_entry,
+                                       H5FD_mem_t inserted_type);
+static size_t        H5PB__arc_target(const H5PB_t *page_buf, const H5PB_entry_t *ghost);
+static herr_t        H5PB__add_ghost(H5PB_t *page_buf, H5PB_entry_t *page_entry);
+static herr_t        H5PB__remove_ghost(H5PB_t *page_buf, H5PB_entry_t *ghost);
+static herr_t        H5PB__trim_ghosts(H5PB_t *page_buf);
 static herr_t H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry);
 
 /*********************/
@@ -179,6 +221,9 @@ H5PB_reset_stats(H5PB_t *page_buf)
     page_buf->evictions[1] = 0;
     page_buf->bypasses[0]  = 0;
     page_buf->bypasses[1]  = 0;
+    HDmemset(page_buf->type_hits, 0, sizeof(page_buf->type_hits));
+    HDmemset(page_buf->type_misses, 0, sizeof(page_buf->type_misses));
+    HDmemset(page_buf->type_evictions, 0, sizeof(page_buf->type_evictions));
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_reset_stats() */
@@ -225,6 +270,35 @@ H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2], u
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_get_stats */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5PB_get_type_stats
+ *
+ * Purpose:     Retrieve the page hits, misses and evictions for each
+ *              H5FD_mem_t type of page.  Any of the arrays may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_get_type_stats(const H5PB_t *page_buf, unsigned hits[H5FD_MEM_NTYPES], unsigned misses[H5FD_MEM_NTYPES],
+                    unsigned evictions[H5FD_MEM_NTYPES])
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    HDassert(page_buf);
+
+    if (hits)
+        H5MM_memcpy(hits, page_buf->type_hits, sizeof(page_buf->type_hits));
+    if (misses)
+        H5MM_memcpy(misses, page_buf->type_misses, sizeof(page_buf->type_misses));
+    if (evictions)
+        H5MM_memcpy(evictions, page_buf->type_evictions, sizeof(page_buf->type_evictions));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5PB_get_type_stats */
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB_print_stats()
  *
@@ -276,6 +350,10 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *
  * Purpose:     Create and setup the PB on the file.
  *
+ *              With the 2Q policy, the probation list may hold a quarter
+ *              of the pages, and the addresses of half as many pages as
+ *              fit in the page buffer are remembered after they leave it.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Mohamad Chaarawi
@@ -283,7 +361,8 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+            H5F_page_buf_policy_t policy)
 {
     H5PB_t *page_buf  = NULL;
     herr_t  ret_value = SUCCEED; /* Return value */
@@ -292,6 +371,7 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
 
     /* Sanity checks */
     HDassert(f_sh);
+    HDassert(policy >= H5F_PAGE_BUF_POLICY_LRU && policy < H5F_PAGE_BUF_POLICY_NTYPES);
 
     /* Check args */
     if (f_sh->fs_strategy != H5F_FSPACE_STRATEGY_PAGE)
@@ -321,10 +401,19 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     page_buf->min_meta_count = (unsigned)((size * page_buf_min_meta_perc) / (f_sh->fs_page_size * 100));
     page_buf->min_raw_count  = (unsigned)((size * page_buf_min_raw_perc) / (f_sh->fs_page_size * 100));
 
+    /* Set up the replacement policy */
+    page_buf->policy        = policy;
+    page_buf->max_pages     = size / page_buf->page_size;
+    page_buf->probation_max = MAX(page_buf->max_pages / 4, 1);
+    page_buf->ghost_max     = MAX(page_buf->max_pages / 2, 1);
+    page_buf->arc_target    = 0;
+
     if (NULL == (page_buf->slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
     if (NULL == (page_buf->mf_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
+    if (NULL == (page_buf->ghost_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
 
     if (NULL == (page_buf->page_fac = H5FL_fac_init(page_buf->page_size)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "can't create page factory")
@@ -338,6 +427,8 @@ done:
                 H5SL_close(page_buf->slist_ptr);
             if (page_buf->mf_slist_ptr != NULL)
                 H5SL_close(page_buf->mf_slist_ptr);
+            if (page_buf->ghost_slist_ptr != NULL)
+                H5SL_close(page_buf->ghost_slist_ptr);
             if (page_buf->page_fac != NULL)
                 H5FL_fac_term(page_buf->page_fac);
             page_buf = H5FL_FREE(H5PB_t, page_buf);
@@ -438,9 +529,9 @@ H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
     HDassert(op_data);
     HDassert(op_data->page_buf);
 
-    /* Remove entry from LRU list */
+    /* Remove entry from LRU or probation list */
     if (op_data->actual_slist) {
-        H5PB__REMOVE_LRU(op_data->page_buf, page_entry)
+        H5PB__REMOVE_PAGE(op_data->page_buf, page_entry)
         page_entry->page_buf_ptr = H5FL_FAC_FREE(op_data->page_buf->page_fac, page_entry->page_buf_ptr);
     } /* end if */
 
@@ -492,6 +583,10 @@ H5PB_dest(H5F_shared_t *f_sh)
         if (H5SL_destroy(page_buf->mf_slist_ptr, H5PB__dest_cb, &op_data))
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list")
 
+        /* Destroy the skip list containing the ghost entries */
+        if (H5SL_destroy(page_buf->ghost_slist_ptr, H5PB__dest_cb, &op_data))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list")
+
         /* Destroy the page factory */
         if (H5FL_fac_term(page_buf->page_fac) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTRELEASE, FAIL, "can't destroy page buffer page factory")
@@ -601,8 +696,8 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
         offset = addr - page_addr;
         H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf, size);
 
-        /* move to top of LRU list */
-        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+        /* Update the replacement policy */
+        H5PB__HIT(page_buf, page_entry)
     } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -646,9 +741,9 @@ H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr)
         if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
             HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Page Entry is not in skip list")
 
-        /* Remove from LRU list */
-        H5PB__REMOVE_LRU(page_buf, page_entry)
-        HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+        /* Remove from LRU or probation list */
+        H5PB__REMOVE_PAGE(page_buf, page_entry)
+        HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len + page_buf->probation_list_len);
 
         page_buf->meta_count--;
 
@@ -810,8 +905,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                         H5MM_memcpy(buf, (uint8_t *)page_entry->page_buf_ptr + offset,
                                     page_buf->page_size - (size_t)offset);
 
-                        /* move to top of LRU list */
-                        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                        /* Update the replacement policy */
+                        H5PB__HIT(page_buf, page_entry)
                     } /* end if */
                     /* special handling for the last page if it is not a full page access */
                     else if (num_touched_pages > 1 && i == num_touched_pages - 1 &&
@@ -822,8 +917,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                         H5MM_memcpy((uint8_t *)buf + offset, page_entry->page_buf_ptr,
                                     (size_t)((addr + size) - last_page_addr));
 
-                        /* move to top of LRU list */
-                        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                        /* Update the replacement policy */
+                        H5PB__HIT(page_buf, page_entry)
                     } /* end else-if */
                     /* copy the entire fully accessed pages */
                     else {
@@ -866,14 +961,15 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 H5MM_memcpy((uint8_t *)buf + buf_offset, (uint8_t *)page_entry->page_buf_ptr + offset,
                             access_size);
 
-                /* Update LRU */
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                /* Update the replacement policy */
+                H5PB__HIT(page_buf, page_entry)
 
                 /* Update statistics */
                 if (type == H5FD_MEM_DRAW)
                     page_buf->hits[1]++;
                 else
                     page_buf->hits[0]++;
+                page_buf->type_hits[type]++;
             } /* end if */
             /* if not found */
             else {
@@ -886,7 +982,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                     htri_t can_make_space;
 
                     /* check if we can make space in page buffer */
-                    if ((can_make_space = H5PB__make_space(f_sh, page_buf, type)) < 0)
+                    if ((can_make_space = H5PB__make_space(f_sh, page_buf, type, search_addr)) < 0)
                         HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed")
 
                     /* if make_space returns 0, then we can't use the page
@@ -952,6 +1048,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                     page_buf->misses[1]++;
                 else
                     page_buf->misses[0]++;
+                page_buf->type_misses[type]++;
             } /* end else */
         }     /* end for */
     }         /* end else */
@@ -1098,9 +1195,9 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf,
                                 page_buf->page_size - (size_t)offset);
 
-                    /* Mark page dirty and push to top of LRU */
+                    /* Mark page dirty and update the replacement policy */
                     page_entry->is_dirty = TRUE;
-                    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                    H5PB__HIT(page_buf, page_entry)
                 } /* end if */
             }     /* end if */
             /* Special handling for the last page if it is not a full page update */
@@ -1118,20 +1215,20 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     H5MM_memcpy(page_entry->page_buf_ptr, (const uint8_t *)buf + offset,
                                 (size_t)((addr + size) - last_page_addr));
 
-                    /* Mark page dirty and push to top of LRU */
+                    /* Mark page dirty and update the replacement policy */
                     page_entry->is_dirty = TRUE;
-                    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                    H5PB__HIT(page_buf, page_entry)
                 } /* end if */
             }     /* end else-if */
             /* Discard all fully written pages from the page buffer */
             else {
                 page_entry = (H5PB_entry_t *)H5SL_remove(page_buf->slist_ptr, (void *)(&search_addr));
                 if (page_entry) {
-                    /* Remove from LRU list */
-                    H5PB__REMOVE_LRU(page_buf, page_entry)
+                    /* Remove from LRU or probation list */
+                    H5PB__REMOVE_PAGE(page_buf, page_entry)
 
                     /* Decrement page count of appropriate type */
-                    if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+                    if (H5PB__IS_RAW(page_entry))
                         page_buf->raw_count--;
                     else
                         page_buf->meta_count--;
@@ -1171,15 +1268,16 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, (const uint8_t *)buf + buf_offset,
                             access_size);
 
-                /* Mark page dirty and push to top of LRU */
+                /* Mark page dirty and update the replacement policy */
                 page_entry->is_dirty = TRUE;
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                H5PB__HIT(page_buf, page_entry)
 
                 /* Update statistics */
                 if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
                     page_buf->hits[1]++;
                 else
                     page_buf->hits[0]++;
+                page_buf->type_hits[type]++;
             } /* end if */
             /* If not found */
             else {
@@ -1191,7 +1289,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     htri_t can_make_space;
 
                     /* Check if we can make space in page buffer */
-                    if ((can_make_space = H5PB__make_space(f_sh, page_buf, type)) < 0)
+                    if ((can_make_space = H5PB__make_space(f_sh, page_buf, type, search_addr)) < 0)
                         HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed")
 
                     /* If make_space returns 0, then we can't use the page
@@ -1237,6 +1335,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                         page_buf->hits[1]++;
                     else
                         page_buf->hits[0]++;
+                    page_buf->type_hits[type]++;
                 } /* end if */
                 /* Otherwise read page through the VFD layer, but make sure we don't read past the EOA. */
                 else {
@@ -1285,6 +1384,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                             page_buf->misses[1]++;
                         else
                             page_buf->misses[0]++;
+                        page_buf->type_misses[type]++;
                     } /* end if */
                 }     /* end else */
 
@@ -1320,6 +1420,11 @@ done:
  *
  *                                               JRM -- 12/22/16
  *
+ *              With the 2Q and ARC policies, a page whose address is
+ *              remembered in a ghost entry was evicted recently and is
+ *              going on the LRU list; any other page goes on the
+ *              probation list.  For ARC, finding a ghost entry also
+ *              adapts the target length of the probation list.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -1340,13 +1445,39 @@ H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
     HDassert(H5SL_count(page_buf->slist_ptr) * page_buf->page_size <= page_buf->max_size);
 
     /* Increment appropriate page count */
-    if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+    if (H5PB__IS_RAW(page_entry))
         page_buf->raw_count++;
     else
         page_buf->meta_count++;
 
-    /* Insert entry in LRU */
-    H5PB__INSERT_LRU(page_buf, page_entry)
+    if (H5F_PAGE_BUF_POLICY_LRU == page_buf->policy) {
+        /* Insert entry in LRU */
+        page_entry->list = H5PB_LIST_LRU;
+        H5PB__INSERT_LRU(page_buf, page_entry)
+    } /* end if */
+    else {
+        H5PB_entry_t *ghost; /* Ghost entry for the page's address */
+
+        if (NULL != (ghost = (H5PB_entry_t *)H5SL_search(page_buf->ghost_slist_ptr, &(page_entry->addr)))) {
+            if (H5F_PAGE_BUF_POLICY_ARC == page_buf->policy)
+                page_buf->arc_target = H5PB__arc_target(page_buf, ghost);
+            if (H5PB__remove_ghost(page_buf, ghost) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTREMOVE, FAIL, "can't remove ghost entry")
+
+            /* Insert entry in LRU */
+            page_entry->list = H5PB_LIST_LRU;
+            H5PB__INSERT_LRU(page_buf, page_entry)
+        } /* end if */
+        else {
+            /* Insert entry in probation list */
+            page_entry->list = H5PB_LIST_PROBATION;
+            H5PB__PREPEND(page_entry, page_buf->probation_head_ptr, page_buf->probation_tail_ptr,
+                          page_buf->probation_list_len)
+        } /* end else */
+
+        if (H5PB__trim_ghosts(page_buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTREMOVE, FAIL, "can't trim ghost entries")
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1365,6 +1496,14 @@ done:
  *
  *                                             JRM -- 12/22/16
  *
+ *              The policy chooses the list to evict from: the LRU list
+ *              for LRU, the probation list for 2Q once it is longer than
+ *              its share, and for ARC the probation list when it is longer
+ *              than the adaptive target.  If every page on that list is
+ *              held by the minimum metadata or raw data count, the other
+ *              list is tried.  For 2Q and ARC, the address of the evicted
+ *              page is kept in a ghost entry.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Mohamad Chaarawi
@@ -1372,10 +1511,13 @@ done:
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
+H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type, haddr_t inserted_addr)
 {
-    H5PB_entry_t *page_entry;       /* Pointer to page eviction candidate */
-    htri_t        ret_value = TRUE; /* Return value */
+    H5PB_entry_t *page_entry;                /* Pointer to page eviction candidate */
+    H5PB_entry_t *first_head, *first_tail;   /* List to evict from first */
+    H5PB_entry_t *second_head, *second_tail; /* List to evict from next */
+    hbool_t       from_probation = FALSE;    /* Whether to evict from the probation list first */
+    htri_t        ret_value      = TRUE;     /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -1383,9 +1525,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
     HDassert(f_sh);
     HDassert(page_buf);
 
-    /* Get oldest entry */
-    page_entry = page_buf->LRU_tail_ptr;
-
     if (H5FD_MEM_DRAW == inserted_type) {
         /* If threshould is 100% metadata and page buffer is full of
            metadata, then we can't make space for raw data */
@@ -1393,15 +1532,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             HDassert(page_buf->meta_count * page_buf->page_size == page_buf->max_size);
             HGOTO_DONE(FALSE)
         } /* end if */
-
-        /* check the metadata threshold before evicting metadata items */
-        while (1) {
-            if (page_entry->prev && H5F_MEM_PAGE_META == page_entry->type &&
-                page_buf->min_meta_count >= page_buf->meta_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
     }     /* end if */
     else {
         /* If threshould is 100% raw data and page buffer is full of
@@ -1410,28 +1540,57 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             HDassert(page_buf->raw_count * page_buf->page_size == page_buf->max_size);
             HGOTO_DONE(FALSE)
         } /* end if */
-
-        /* check the raw data threshold before evicting raw data items */
-        while (1) {
-            if (page_entry->prev &&
-                (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) &&
-                page_buf->min_raw_count >= page_buf->raw_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
     }     /* end else */
 
+    /* Choose the list to evict from */
+    if (H5F_PAGE_BUF_POLICY_2Q == page_buf->policy)
+        from_probation = (page_buf->probation_list_len > page_buf->probation_max);
+    else if (H5F_PAGE_BUF_POLICY_ARC == page_buf->policy) {
+        const H5PB_entry_t *ghost; /* Ghost entry for the inserted page's address */
+        size_t              target;
+
+        ghost  = (const H5PB_entry_t *)H5SL_search(page_buf->ghost_slist_ptr, &inserted_addr);
+        target = H5PB__arc_target(page_buf, ghost);
+        from_probation =
+            (page_buf->probation_list_len > target ||
+             (ghost && H5PB_LIST_GHOST_LRU == ghost->list && page_buf->probation_list_len == target));
+    } /* end if */
+    if (0 == page_buf->probation_list_len)
+        from_probation = FALSE;
+    else if (0 == page_buf->LRU_list_len)
+        from_probation = TRUE;
+
+    if (from_probation) {
+        first_head  = page_buf->probation_head_ptr;
+        first_tail  = page_buf->probation_tail_ptr;
+        second_head = page_buf->LRU_head_ptr;
+        second_tail = page_buf->LRU_tail_ptr;
+    } /* end if */
+    else {
+        first_head  = page_buf->LRU_head_ptr;
+        first_tail  = page_buf->LRU_tail_ptr;
+        second_head = page_buf->probation_head_ptr;
+        second_tail = page_buf->probation_tail_ptr;
+    } /* end else */
+
+    /* Get the oldest entry that the thresholds allow to evict, or the
+     * newest entry of the first list if there is none
+     */
+    if (NULL == (page_entry = H5PB__find_victim(page_buf, first_tail, inserted_type)))
+        if (NULL == (page_entry = H5PB__find_victim(page_buf, second_tail, inserted_type)))
+            page_entry = first_head ? first_head : second_head;
+    HDassert(page_entry);
+
     /* Remove from page index */
     if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Tail Page Entry is not in skip list")
 
-    /* Remove entry from LRU list */
-    H5PB__REMOVE_LRU(page_buf, page_entry)
-    HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+    /* Remove entry from LRU or probation list */
+    H5PB__REMOVE_PAGE(page_buf, page_entry)
+    HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len + page_buf->probation_list_len);
 
     /* Decrement appropriate page type counter */
-    if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+    if (H5PB__IS_RAW(page_entry))
         page_buf->raw_count--;
     else
         page_buf->meta_count--;
@@ -1442,18 +1601,250 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
 
     /* Update statistics */
-    if (page_entry->type == H5F_MEM_PAGE_DRAW || H5F_MEM_PAGE_GHEAP == page_entry->type)
+    if (H5PB__IS_RAW(page_entry))
         page_buf->evictions[1]++;
     else
         page_buf->evictions[0]++;
+    HDassert(page_entry->type < H5FD_MEM_NTYPES);
+    page_buf->type_evictions[page_entry->type]++;
+
+    /* Keep the address of a page evicted under 2Q (from the probation list
+     * only) or ARC, release any other page
+     */
+    if (H5F_PAGE_BUF_POLICY_ARC == page_buf->policy ||
+        (H5F_PAGE_BUF_POLICY_2Q == page_buf->policy && H5PB_LIST_PROBATION == page_entry->list)) {
+        if (H5PB__add_ghost(page_buf, page_entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't add ghost entry")
+    } /* end if */
+    else {
+        page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+        page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__make_space() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__find_victim()
+ *
+ * Purpose:     Walk a list from PAGE_ENTRY, its tail, towards its head
+ *              and return the first page that the metadata or raw data
+ *              threshold allows to be evicted for a page of
+ *              INSERTED_TYPE.
+ *
+ * Return:      The page to evict, or NULL if there is none on the list
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5PB_entry_t *
+H5PB__find_victim(const H5PB_t *page_buf, H5PB_entry_t *page_entry, H5FD_mem_t inserted_type)
+{
+    H5PB_entry_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(page_buf);
+
+    while (page_entry) {
+        /* check the metadata threshold before evicting metadata items for
+         * raw data, and the raw data threshold before evicting raw data
+         * items for metadata
+         */
+        if (H5FD_MEM_DRAW == inserted_type) {
+            if (H5PB__IS_RAW(page_entry) || page_buf->min_meta_count < page_buf->meta_count)
+                break;
+        } /* end if */
+        else {
+            if (!H5PB__IS_RAW(page_entry) || page_buf->min_raw_count < page_buf->raw_count)
+                break;
+        } /* end else */
+
+        page_entry = page_entry->prev;
+    } /* end while */
+
+    ret_value = page_entry;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__find_victim() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__arc_target()
+ *
+ * Purpose:     Compute the ARC target length of the probation list for
+ *              a miss on a page.  A page remembered in the ghost
+ *              probation list would have been a hit with a longer
+ *              probation list, so the target grows; a page remembered in
+ *              the ghost LRU list makes it shrink.  The step is larger
+ *              when the other ghost list is the longer one.
+ *
+ * Return:      The target length
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5PB__arc_target(const H5PB_t *page_buf, const H5PB_entry_t *ghost)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(page_buf);
+
+    ret_value = page_buf->arc_target;
+    if (ghost) {
+        size_t delta;
+
+        if (H5PB_LIST_GHOST_PROBATION == ghost->list) {
+            delta     = MAX(page_buf->ghost_LRU_list_len / page_buf->ghost_probation_list_len, 1);
+            ret_value = MIN(ret_value + delta, page_buf->max_pages);
+        } /* end if */
+        else {
+            HDassert(H5PB_LIST_GHOST_LRU == ghost->list);
+            delta     = MAX(page_buf->ghost_probation_list_len / page_buf->ghost_LRU_list_len, 1);
+            ret_value = ret_value > delta ? ret_value - delta : 0;
+        } /* end else */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__arc_target() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__add_ghost()
+ *
+ * Purpose:     Turn a page that was just evicted into a ghost entry:
+ *              release its data and put it on the ghost list matching
+ *              the list it was evicted from.
+ *
+ *              The ghost lists are trimmed when the page that the space
+ *              was made for is inserted, so that its own ghost entry
+ *              can't be dropped before it is looked up.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__add_ghost(H5PB_t *page_buf, H5PB_entry_t *page_entry)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(page_entry);
+    HDassert(H5PB_LIST_LRU == page_entry->list || H5PB_LIST_PROBATION == page_entry->list);
 
     /* Release page */
     page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
-    page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
+    page_entry->is_dirty     = FALSE;
+
+    /* Insert entry in ghost skip list */
+    if (H5SL_insert(page_buf->ghost_slist_ptr, page_entry, &(page_entry->addr)) < 0) {
+        page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert entry in skip list")
+    } /* end if */
+
+    /* Insert entry in ghost list */
+    if (H5PB_LIST_PROBATION == page_entry->list) {
+        page_entry->list = H5PB_LIST_GHOST_PROBATION;
+        H5PB__PREPEND(page_entry, page_buf->ghost_probation_head_ptr, page_buf->ghost_probation_tail_ptr,
+                      page_buf->ghost_probation_list_len)
+    } /* end if */
+    else {
+        page_entry->list = H5PB_LIST_GHOST_LRU;
+        H5PB__PREPEND(page_entry, page_buf->ghost_LRU_head_ptr, page_buf->ghost_LRU_tail_ptr,
+                      page_buf->ghost_LRU_list_len)
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5PB__make_space() */
+} /* end H5PB__add_ghost() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__remove_ghost()
+ *
+ * Purpose:     Remove a ghost entry from the ghost skip list and its
+ *              ghost list, and free it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__remove_ghost(H5PB_t *page_buf, H5PB_entry_t *ghost)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(ghost);
+    HDassert(NULL == ghost->page_buf_ptr);
+
+    if (NULL == H5SL_remove(page_buf->ghost_slist_ptr, &(ghost->addr)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Ghost Entry is not in skip list")
+
+    if (H5PB_LIST_GHOST_PROBATION == ghost->list)
+        H5PB__REMOVE(ghost, page_buf->ghost_probation_head_ptr, page_buf->ghost_probation_tail_ptr,
+                     page_buf->ghost_probation_list_len)
+    else
+        H5PB__REMOVE(ghost, page_buf->ghost_LRU_head_ptr, page_buf->ghost_LRU_tail_ptr,
+                     page_buf->ghost_LRU_list_len)
+
+    ghost = H5FL_FREE(H5PB_entry_t, ghost);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__remove_ghost() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__trim_ghosts()
+ *
+ * Purpose:     Drop the oldest ghost entries beyond the policy's limits.
+ *              2Q keeps ghost_max addresses.  ARC keeps the probation
+ *              and ghost probation lists within the number of pages in
+ *              the page buffer, and all four lists within twice that.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__trim_ghosts(H5PB_t *page_buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(page_buf);
+
+    if (H5F_PAGE_BUF_POLICY_2Q == page_buf->policy) {
+        while (page_buf->ghost_probation_list_len > page_buf->ghost_max)
+            if (H5PB__remove_ghost(page_buf, page_buf->ghost_probation_tail_ptr) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTREMOVE, FAIL, "can't remove ghost entry")
+    } /* end if */
+    else if (H5F_PAGE_BUF_POLICY_ARC == page_buf->policy) {
+        while (page_buf->ghost_probation_list_len > 0 &&
+               page_buf->probation_list_len + page_buf->ghost_probation_list_len > page_buf->max_pages)
+            if (H5PB__remove_ghost(page_buf, page_buf->ghost_probation_tail_ptr) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTREMOVE, FAIL, "can't remove ghost entry")
+        while (page_buf->ghost_LRU_list_len > 0 &&
+               page_buf->LRU_list_len + page_buf->probation_list_len + page_buf->ghost_probation_list_len +
+                       page_buf->ghost_LRU_list_len >
+                   2 * page_buf->max_pages)
+            if (H5PB__remove_ghost(page_buf, page_buf->ghost_LRU_tail_ptr) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTREMOVE, FAIL, "can't remove ghost entry")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__trim_ghosts() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5PB__write_entry()
@@ -31,6 +31,14 @@
 /* Package Private Typedefs */
 /****************************/
 
+/* List that a page entry is on (see the replacement policy in H5PB_t) */
+typedef enum H5PB_list_t {
+    H5PB_LIST_LRU = 0,         /* LRU list (2Q: Am, ARC: T2) */
+    H5PB_LIST_PROBATION,       /* Probation list (2Q: A1in, ARC: T1) */
+    H5PB_LIST_GHOST_PROBATION, /* Ghost probation list (2Q: A1out, ARC: B1), no page data */
+    H5PB_LIST_GHOST_LRU        /* Ghost LRU list (ARC: B2), no page data */
+} H5PB_list_t;
+
 typedef struct H5PB_entry_t {
     void *         page_buf_ptr; /* Pointer to the buffer containing the data */
     haddr_t        addr;         /* Address of the page in the file */
@@ -38,8 +46,9 @@ typedef struct H5PB_entry_t {
     hbool_t        is_dirty;     /* Flag indicating whether the page has dirty data or not */
 
     /* Fields supporting replacement policies */
-    struct H5PB_entry_t *next; /* next pointer in the LRU list */
-    struct H5PB_entry_t *prev; /* previous pointer in the LRU list */
+    H5PB_list_t          list; /* List the entry is on */
+    struct H5PB_entry_t *next; /* next pointer in the list */
+    struct H5PB_entry_t *prev; /* previous pointer in the list */
 } H5PB_entry_t;
 
 /*****************************/
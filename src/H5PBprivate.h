@@ -59,10 +59,37 @@ typedef struct H5PB_t {
     H5SL_t *slist_ptr;    /* Skip list with all the active page entries */
     H5SL_t *mf_slist_ptr; /* Skip list containing newly allocated page entries inserted from the MF layer */
 
-    size_t               LRU_list_len; /* Number of entries in the LRU (identical to slist_ptr count) */
+    /* Replacement policy.  With H5F_PAGE_BUF_POLICY_LRU all pages are on
+     * the LRU list.  With 2Q and ARC, pages that have been referenced once
+     * are on the probation list (2Q: A1in, ARC: T1), and only pages
+     * referenced again move to the LRU list (2Q: Am, ARC: T2), so a scan
+     * can only push out other pages that were referenced once.  Ghost
+     * entries remember the addresses of recently evicted pages without
+     * their data (2Q: A1out on the ghost probation list, ARC: B1 and B2 on
+     * the ghost probation and ghost LRU lists).
+     */
+    H5F_page_buf_policy_t policy;        /* Replacement policy */
+    size_t                max_pages;     /* Number of pages that fit in the page buffer */
+    size_t                probation_max; /* 2Q: Length of the probation list before it is evicted from */
+    size_t                ghost_max;     /* 2Q: Maximum length of the ghost probation list */
+    size_t                arc_target;    /* ARC: Adaptive target length of the probation list */
+
+    size_t               LRU_list_len; /* Number of entries in the LRU */
     struct H5PB_entry_t *LRU_head_ptr; /* Head pointer of the LRU */
     struct H5PB_entry_t *LRU_tail_ptr; /* Tail pointer of the LRU */
 
+    size_t               probation_list_len; /* Number of entries in the probation list */
+    struct H5PB_entry_t *probation_head_ptr; /* Head pointer of the probation list */
+    struct H5PB_entry_t *probation_tail_ptr; /* Tail pointer of the probation list */
+
+    H5SL_t *             ghost_slist_ptr;          /* Skip list with all the ghost entries */
+    size_t               ghost_probation_list_len; /* Number of entries in the ghost probation list */
+    struct H5PB_entry_t *ghost_probation_head_ptr; /* Head pointer of the ghost probation list */
+    struct H5PB_entry_t *ghost_probation_tail_ptr; /* Tail pointer of the ghost probation list */
+    size_t               ghost_LRU_list_len;       /* Number of entries in the ghost LRU list */
+    struct H5PB_entry_t *ghost_LRU_head_ptr;       /* Head pointer of the ghost LRU list */
+    struct H5PB_entry_t *ghost_LRU_tail_ptr;       /* Tail pointer of the ghost LRU list */
+
     H5FL_fac_head_t *page_fac; /* Factory for allocating pages */
 
     /* Statistics */
@@ -71,6 +98,9 @@ typedef struct H5PB_t {
     unsigned misses[2];
     unsigned evictions[2];
     unsigned bypasses[2];
+    unsigned type_hits[H5FD_MEM_NTYPES];      /* Hits, by the H5FD_mem_t type of the page */
+    unsigned type_misses[H5FD_MEM_NTYPES];    /* Misses, by the H5FD_mem_t type of the page */
+    unsigned type_evictions[H5FD_MEM_NTYPES]; /* Evictions, by the H5FD_mem_t type of the page */
 } H5PB_t;
 
 /*****************************/
@@ -83,7 +113,7 @@ typedef struct H5PB_t {
 
 /* General routines */
 H5_DLL herr_t H5PB_create(H5F_shared_t *f_sh, size_t page_buffer_size, unsigned page_buf_min_meta_perc,
-                          unsigned page_buf_min_raw_perc);
+                          unsigned page_buf_min_raw_perc, H5F_page_buf_policy_t policy);
 H5_DLL herr_t H5PB_flush(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_dest(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr);
@@ -96,6 +126,8 @@ H5_DLL herr_t H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
 H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
                              unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+H5_DLL herr_t H5PB_get_type_stats(const H5PB_t *page_buf, unsigned hits[H5FD_MEM_NTYPES],
+                                  unsigned misses[H5FD_MEM_NTYPES], unsigned evictions[H5FD_MEM_NTYPES]);
 H5_DLL herr_t H5PB_print_stats(const H5PB_t *page_buf);
 
 #endif /* !_H5PBprivate_H */
@@ -59,6 +59,16 @@
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEF  H5D_CHUNK_CACHE_W0_DEFAULT
 #define H5D_ACS_PREEMPT_READ_CHUNKS_ENC  H5P__encode_double
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEC  H5P__decode_double
+/* Definitions for raw data chunk cache replacement policy */
+#define H5D_ACS_DATA_CACHE_POLICY_SIZE sizeof(H5D_chunk_cache_policy_t)
+#define H5D_ACS_DATA_CACHE_POLICY_DEF  H5D_CHUNK_CACHE_POLICY_DEFAULT
+#define H5D_ACS_DATA_CACHE_POLICY_ENC  H5P__dacc_chunk_cache_policy_enc
+#define H5D_ACS_DATA_CACHE_POLICY_DEC  H5P__dacc_chunk_cache_policy_dec
+/* Definitions for keeping the chunk index in memory */
+#define H5D_ACS_CHUNK_INDEX_CACHE_SIZE sizeof(hbool_t)
+#define H5D_ACS_CHUNK_INDEX_CACHE_DEF  FALSE
+#define H5D_ACS_CHUNK_INDEX_CACHE_ENC  H5P__encode_hbool_t
+#define H5D_ACS_CHUNK_INDEX_CACHE_DEC  H5P__decode_hbool_t
 /* Definitions for VDS view option */
 #define H5D_ACS_VDS_VIEW_SIZE sizeof(H5D_vds_view_t)
 #define H5D_ACS_VDS_VIEW_DEF  H5D_VDS_LAST_AVAILABLE
@@ -119,6 +129,8 @@ static herr_t H5P__encode_chunk_cache_nbytes(const void *value, void **_pp, size
 static herr_t H5P__decode_chunk_cache_nbytes(const void **_pp, void *_value);
 
 /* Property list callbacks */
+static herr_t H5P__dacc_chunk_cache_policy_enc(const void *value, void **pp, size_t *size);
+static herr_t H5P__dacc_chunk_cache_policy_dec(const void **pp, void *value);
 static herr_t H5P__dacc_vds_view_enc(const void *value, void **pp, size_t *size);
 static herr_t H5P__dacc_vds_view_dec(const void **pp, void *value);
 static herr_t H5P__dapl_vds_file_pref_set(hid_t prop_id, const char *name, size_t size, void *value);
@@ -197,6 +209,9 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     hsize_t        printf_gap   = H5D_ACS_VDS_PRINTF_GAP_DEF; /* Default VDS printf gap */
     herr_t         ret_value    = SUCCEED;                    /* Return value */
 
+    H5D_chunk_cache_policy_t rdcc_policy = H5D_ACS_DATA_CACHE_POLICY_DEF; /* Default chunk cache policy */
+    hbool_t                  idx_cache   = H5D_ACS_CHUNK_INDEX_CACHE_DEF; /* Default in-memory chunk index */
+
     FUNC_ENTER_STATIC
 
     /* Register the size of raw data chunk cache (elements) */
@@ -217,6 +232,18 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
                            H5D_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the replacement policy of the raw data chunk cache */
+    if (H5P__register_real(pclass, H5D_ACS_DATA_CACHE_POLICY_NAME, H5D_ACS_DATA_CACHE_POLICY_SIZE,
+                           &rdcc_policy, NULL, NULL, NULL, H5D_ACS_DATA_CACHE_POLICY_ENC,
+                           H5D_ACS_DATA_CACHE_POLICY_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the in-memory chunk index option */
+    if (H5P__register_real(pclass, H5D_ACS_CHUNK_INDEX_CACHE_NAME, H5D_ACS_CHUNK_INDEX_CACHE_SIZE, &idx_cache,
+                           NULL, NULL, NULL, H5D_ACS_CHUNK_INDEX_CACHE_ENC, H5D_ACS_CHUNK_INDEX_CACHE_DEC,
+                           NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the VDS view option */
     if (H5P__register_real(pclass, H5D_ACS_VDS_VIEW_NAME, H5D_ACS_VDS_VIEW_SIZE, &virtual_view, NULL, NULL,
                            NULL, H5D_ACS_VDS_VIEW_ENC, H5D_ACS_VDS_VIEW_DEC, NULL, NULL, NULL, NULL) < 0)
@@ -850,6 +877,228 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_cache_policy
+ *
+ * Purpose:     Sets the replacement policy of the raw data chunk cache of
+ *              datasets opened with this property list.
+ *
+ *              H5D_CHUNK_CACHE_POLICY_DEFAULT keeps the cache described
+ *              by H5Pset_chunk_cache: a hash table of RDCC_NSLOTS slots,
+ *              where two chunks mapping to the same slot preempt each
+ *              other, and preemption weighted by RDCC_W0.  The other
+ *              policies use an open hash table instead, so chunks are
+ *              only preempted when RDCC_NBYTES is exhausted (RDCC_NSLOTS
+ *              and RDCC_W0 are ignored), choosing the victim among the
+ *              unlocked chunks as the least recently used one
+ *              (H5D_CHUNK_CACHE_POLICY_LRU), by a clock sweep that spares
+ *              chunks used since it last passed them
+ *              (H5D_CHUNK_CACHE_POLICY_CLOCK), or as the least frequently
+ *              used one (H5D_CHUNK_CACHE_POLICY_LFU).
+ *
+ *              A dataset with a policy other than the default doesn't
+ *              use the file's shared chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t policy)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iDp", dapl_id, policy);
+
+    /* Check argument */
+    if (policy < H5D_CHUNK_CACHE_POLICY_DEFAULT || policy >= H5D_CHUNK_CACHE_NPOLICIES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a valid chunk cache replacement policy")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_ACS_DATA_CACHE_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache replacement policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_cache_policy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_cache_policy
+ *
+ * Purpose:     Retrieves the replacement policy of the raw data chunk
+ *              cache set with H5Pset_chunk_cache_policy.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t *policy /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, policy);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if (policy)
+        if (H5P_get(plist, H5D_ACS_DATA_CACHE_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache replacement policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_policy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_index_cache
+ *
+ * Purpose:     Sets whether datasets opened with this property list keep
+ *              a copy of their chunk index in memory.
+ *
+ *              When IN_MEMORY is TRUE, the first lookup of a chunk that
+ *              isn't in the raw data chunk cache reads the whole chunk
+ *              index (the scaled offset, address, size and filter mask
+ *              of every allocated chunk) into a hash table.  Later
+ *              lookups are answered from that table instead of walking
+ *              the B-tree, extensible array or fixed array through the
+ *              metadata cache, and chunks written or removed through the
+ *              dataset update it.  The table costs some tens of bytes
+ *              per allocated chunk.
+ *
+ *              The option is ignored for single chunk and implicit
+ *              indices, which are already looked up without I/O, and
+ *              for files opened for SWMR reading, whose index other
+ *              processes change.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_index_cache(hid_t dapl_id, hbool_t in_memory)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", dapl_id, in_memory);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_ACS_CHUNK_INDEX_CACHE_NAME, &in_memory) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set in-memory chunk index option")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_index_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_index_cache
+ *
+ * Purpose:     Retrieves whether datasets opened with this property list
+ *              keep a copy of their chunk index in memory, as set with
+ *              H5Pset_chunk_index_cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_index_cache(hid_t dapl_id, hbool_t *in_memory /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, in_memory);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if (in_memory)
+        if (H5P_get(plist, H5D_ACS_CHUNK_INDEX_CACHE_NAME, in_memory) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get in-memory chunk index option")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_index_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dacc_chunk_cache_policy_enc
+ *
+ * Purpose:     Callback routine which is called whenever the chunk cache
+ *              policy property in the dataset access property list is
+ *              encoded.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dacc_chunk_cache_policy_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5D_chunk_cache_policy_t *policy =
+        (const H5D_chunk_cache_policy_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(policy);
+    HDassert(size);
+
+    if (NULL != *pp)
+        /* Encode policy */
+        *(*pp)++ = (uint8_t)*policy;
+
+    /* Size of policy */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dacc_chunk_cache_policy_enc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dacc_chunk_cache_policy_dec
+ *
+ * Purpose:     Callback routine which is called whenever the chunk cache
+ *              policy property in the dataset access property list is
+ *              decoded.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dacc_chunk_cache_policy_dec(const void **_pp, void *_value)
+{
+    H5D_chunk_cache_policy_t *policy = (H5D_chunk_cache_policy_t *)_value;
+    const uint8_t **          pp     = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(policy);
+
+    /* Decode policy */
+    *policy = (H5D_chunk_cache_policy_t) * (*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dacc_chunk_cache_policy_dec() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__encode_chunk_cache_nslots
  *
@@ -76,6 +76,16 @@
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEF  0.75f
 #define H5F_ACS_PREEMPT_READ_CHUNKS_ENC  H5P__encode_double
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEC  H5P__decode_double
+/* Definition for number of threads running the chunk filter pipeline */
+#define H5F_ACS_FILTER_THREADS_SIZE sizeof(unsigned)
+#define H5F_ACS_FILTER_THREADS_DEF  1
+#define H5F_ACS_FILTER_THREADS_ENC  H5P__encode_unsigned
+#define H5F_ACS_FILTER_THREADS_DEC  H5P__decode_unsigned
+/* Definition for size of the chunk cache shared by all datasets */
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_SIZE sizeof(size_t)
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEF  0
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_ENC  H5P__encode_size_t
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEC  H5P__decode_size_t
 /* Definition for threshold for alignment */
 #define H5F_ACS_ALIGN_THRHD_SIZE sizeof(hsize_t)
 #define H5F_ACS_ALIGN_THRHD_DEF  H5F_ALIGN_THRHD_DEF
@@ -275,6 +285,11 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF  0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC  H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC  H5P__decode_unsigned
+/* Definition for replacement policy of page buffer */
+#define H5F_ACS_PAGE_BUFFER_POLICY_SIZE sizeof(H5F_page_buf_policy_t)
+#define H5F_ACS_PAGE_BUFFER_POLICY_DEF  H5F_PAGE_BUF_POLICY_LRU
+#define H5F_ACS_PAGE_BUFFER_POLICY_ENC  H5P__facc_page_buf_policy_enc
+#define H5F_ACS_PAGE_BUFFER_POLICY_DEC  H5P__facc_page_buf_policy_dec
 /* Definition for file VOL connector properties (ID, etc.) */
 #define H5F_ACS_VOL_CONN_SIZE sizeof(H5VL_connector_prop_t)
 #define H5F_ACS_VOL_CONN_DEF                                                                                 \
@@ -352,6 +367,8 @@ static herr_t H5P__facc_cache_config_dec(const void **_pp, void *value);
 static int    H5P__facc_cache_config_cmp(const void *value1, const void *value2, size_t size);
 static herr_t H5P__facc_fclose_degree_enc(const void *value, void **_pp, size_t *size);
 static herr_t H5P__facc_fclose_degree_dec(const void **pp, void *value);
+static herr_t H5P__facc_page_buf_policy_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__facc_page_buf_policy_dec(const void **_pp, void *value);
 static herr_t H5P__facc_multi_type_enc(const void *value, void **_pp, size_t *size);
 static herr_t H5P__facc_multi_type_dec(const void **_pp, void *value);
 static herr_t H5P__facc_libver_type_enc(const void *value, void **_pp, size_t *size);
@@ -438,6 +455,10 @@ static const size_t H5F_def_rdcc_nbytes_g =
     H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF; /* Default raw data chunk cache # of bytes */
 static const double H5F_def_rdcc_w0_g =
     H5F_ACS_PREEMPT_READ_CHUNKS_DEF; /* Default raw data chunk cache dirty ratio */
+static const unsigned H5F_def_filter_threads_g =
+    H5F_ACS_FILTER_THREADS_DEF; /* Default number of chunk filter threads */
+static const size_t H5F_def_rdcc_shared_nbytes_g =
+    H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEF; /* Default shared raw data chunk cache # of bytes */
 static const hsize_t H5F_def_threshold_g =
     H5F_ACS_ALIGN_THRHD_DEF;                                  /* Default allocation alignment threshold */
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF; /* Default allocation alignment value */
@@ -501,6 +522,8 @@ static const unsigned H5F_def_page_buf_min_meta_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF; /* Default page buffer mininum raw data size */
+static const H5F_page_buf_policy_t H5F_def_page_buf_policy_g =
+    H5F_ACS_PAGE_BUFFER_POLICY_DEF; /* Default page buffer replacement policy */
 static const hbool_t H5F_def_use_file_locking_g =
     H5F_ACS_USE_FILE_LOCKING_DEF; /* Default use file locking flag */
 static const hbool_t H5F_def_ignore_disabled_file_locks_g =
@@ -553,6 +576,19 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the number of chunk filter threads */
+    if (H5P__register_real(pclass, H5F_ACS_FILTER_THREADS_NAME, H5F_ACS_FILTER_THREADS_SIZE,
+                           &H5F_def_filter_threads_g, NULL, NULL, NULL, H5F_ACS_FILTER_THREADS_ENC,
+                           H5F_ACS_FILTER_THREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the size of the shared raw data chunk cache */
+    if (H5P__register_real(pclass, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME,
+                           H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_SIZE, &H5F_def_rdcc_shared_nbytes_g, NULL,
+                           NULL, NULL, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_ENC,
+                           H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the threshold for alignment */
     if (H5P__register_real(pclass, H5F_ACS_ALIGN_THRHD_NAME, H5F_ACS_ALIGN_THRHD_SIZE, &H5F_def_threshold_g,
                            NULL, NULL, NULL, H5F_ACS_ALIGN_THRHD_ENC, H5F_ACS_ALIGN_THRHD_DEC, NULL, NULL,
@@ -783,6 +819,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the page buffer replacement policy */
+    if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_POLICY_NAME, H5F_ACS_PAGE_BUFFER_POLICY_SIZE,
+                           &H5F_def_page_buf_policy_g, NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_POLICY_ENC,
+                           H5F_ACS_PAGE_BUFFER_POLICY_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the file VOL connector ID & info */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if (H5P__register_real(pclass, H5F_ACS_VOL_CONN_NAME, H5F_ACS_VOL_CONN_SIZE, &def_vol_prop,
@@ -1756,6 +1798,152 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_filter_threads
+ *
+ * Purpose:     Sets the number of threads that may run the I/O filter
+ *              pipeline over a dataset's chunks at the same time.  When
+ *              NTHREADS is greater than one, an H5Dread() that touches
+ *              several filtered chunks reads them and decodes them
+ *              together, and dirty chunks leaving the chunk cache are
+ *              encoded together.  Only the library's own filters are run
+ *              this way; pipelines that use other filters, or a dataset
+ *              transfer property list with a filter callback, are always
+ *              run serially.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if (nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of filter threads must be positive")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_FILTER_THREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of filter threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_filter_threads
+ *
+ * Purpose:     Retrieves the number of threads that may run the I/O
+ *              filter pipeline at the same time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_threads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (nthreads)
+        if (H5P_get(plist, H5F_ACS_FILTER_THREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of filter threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_shared_chunk_cache
+ *
+ * Purpose:     Sets the size of a raw data chunk cache that is shared by
+ *              all the chunked datasets of the file.  When RDCC_NBYTES is
+ *              greater than zero, datasets opened with the default chunk
+ *              cache settings (see H5Pset_chunk_cache()) keep their chunks
+ *              in one cache of at most RDCC_NBYTES bytes, and the least
+ *              recently used chunk of any of the datasets is preempted
+ *              when there is no room.  Datasets opened with their own
+ *              chunk cache settings keep a cache of their own.
+ *
+ *              A value of zero (the default) gives each dataset its own
+ *              chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_shared_chunk_cache(hid_t plist_id, size_t rdcc_nbytes)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, rdcc_nbytes);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, &rdcc_nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_shared_chunk_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_shared_chunk_cache
+ *
+ * Purpose:     Retrieves the size of the raw data chunk cache shared by
+ *              all the chunked datasets of the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_shared_chunk_cache(hid_t plist_id, size_t *rdcc_nbytes /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, rdcc_nbytes);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (rdcc_nbytes)
+        if (H5P_get(plist, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, rdcc_nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_shared_chunk_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_image_config
  *
@@ -3902,6 +4090,71 @@ H5P__facc_fclose_degree_dec(const void **_pp, void *_value)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_fclose_degree_dec() */
 
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_page_buf_policy_enc
+ *
+ * Purpose:        Callback routine which is called whenever the page
+ *                 buffer replacement policy property in the file access
+ *                 property list is encoded.
+ *
+ * Return:         Success:    Non-negative
+ *                 Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_page_buf_policy_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5F_page_buf_policy_t *policy = (const H5F_page_buf_policy_t *)value; /* Create local alias */
+    uint8_t **                   pp     = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(policy);
+    HDassert(size);
+
+    if (NULL != *pp)
+        /* Encode page buffer replacement policy */
+        *(*pp)++ = (uint8_t)*policy;
+
+    /* Size of page buffer replacement policy */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_page_buf_policy_enc() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_page_buf_policy_dec
+ *
+ * Purpose:        Callback routine which is called whenever the page
+ *                 buffer replacement policy property in the file access
+ *                 property list is decoded.
+ *
+ * Return:         Success:    Non-negative
+ *                 Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_page_buf_policy_dec(const void **_pp, void *_value)
+{
+    H5F_page_buf_policy_t *policy = (H5F_page_buf_policy_t *)_value; /* Page buffer replacement policy */
+    const uint8_t **       pp     = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(policy);
+
+    /* Decode page buffer replacement policy */
+    *policy = (H5F_page_buf_policy_t) * (*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_page_buf_policy_dec() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__facc_multi_type_enc
  *
@@ -5495,6 +5748,73 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_policy
+ *
+ * Purpose:     Set the replacement policy of the page buffer.  With
+ *              H5F_PAGE_BUF_POLICY_2Q or H5F_PAGE_BUF_POLICY_ARC, pages
+ *              that are only read once, as in a sequential scan, don't
+ *              push out pages that are referenced repeatedly.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t policy)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFp", plist_id, policy);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    if (policy < H5F_PAGE_BUF_POLICY_LRU || policy >= H5F_PAGE_BUF_POLICY_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid page buffer replacement policy")
+
+    /* Set policy */
+    if (H5P_set(plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer replacement policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_policy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_policy
+ *
+ * Purpose:     Retrieves the replacement policy of the page buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t *policy /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, policy);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get policy */
+    if (policy)
+        if (H5P_get(plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer replacement policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_policy() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P_set_vol
  *
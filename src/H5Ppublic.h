@@ -538,6 +538,10 @@ H5_DLL herr_t      H5Pset_cache(hid_t plist_id, int mdc_nelmts, size_t rdcc_nslo
                                 double rdcc_w0);
 H5_DLL herr_t      H5Pget_cache(hid_t plist_id, int *mdc_nelmts, /* out */
                                 size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/, double *rdcc_w0);
+H5_DLL herr_t      H5Pset_filter_threads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t      H5Pget_filter_threads(hid_t plist_id, unsigned *nthreads /*out*/);
+H5_DLL herr_t      H5Pset_shared_chunk_cache(hid_t plist_id, size_t rdcc_nbytes);
+H5_DLL herr_t      H5Pget_shared_chunk_cache(hid_t plist_id, size_t *rdcc_nbytes /*out*/);
 H5_DLL herr_t      H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t      H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr); /* out */
 H5_DLL herr_t      H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
@@ -560,6 +564,8 @@ H5_DLL herr_t      H5Pset_file_image_callbacks(hid_t fapl_id, H5FD_file_image_ca
 H5_DLL herr_t      H5Pget_file_image_callbacks(hid_t fapl_id, H5FD_file_image_callbacks_t *callbacks_ptr);
 H5_DLL herr_t      H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled, size_t page_size);
 H5_DLL herr_t      H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, size_t *page_size);
+H5_DLL herr_t      H5Pset_core_paged_store(hid_t fapl_id, hbool_t is_enabled);
+H5_DLL herr_t      H5Pget_core_paged_store(hid_t fapl_id, hbool_t *is_enabled);
 H5_DLL herr_t      H5Pset_metadata_read_attempts(hid_t plist_id, unsigned attempts);
 H5_DLL herr_t      H5Pget_metadata_read_attempts(hid_t plist_id, unsigned *attempts);
 H5_DLL herr_t      H5Pset_object_flush_cb(hid_t plist_id, H5F_flush_cb_t func, void *udata);
@@ -586,6 +592,8 @@ H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned
                                       unsigned min_raw_per);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per,
                                       unsigned *min_raw_per);
+H5_DLL herr_t H5Pset_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t policy);
+H5_DLL herr_t H5Pget_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t *policy);
 
 /* Dataset creation property list (DCPL) routines */
 
@@ -1197,6 +1205,10 @@ H5_DLL herr_t       H5Pset_dset_no_attrs_hint(hid_t dcpl_id, hbool_t minimize);
 H5_DLL herr_t  H5Pset_chunk_cache(hid_t dapl_id, size_t rdcc_nslots, size_t rdcc_nbytes, double rdcc_w0);
 H5_DLL herr_t  H5Pget_chunk_cache(hid_t dapl_id, size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/,
                                   double *rdcc_w0 /*out*/);
+H5_DLL herr_t  H5Pset_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t policy);
+H5_DLL herr_t  H5Pget_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t *policy /*out*/);
+H5_DLL herr_t  H5Pset_chunk_index_cache(hid_t dapl_id, hbool_t in_memory);
+H5_DLL herr_t  H5Pget_chunk_index_cache(hid_t dapl_id, hbool_t *in_memory /*out*/);
 H5_DLL herr_t  H5Pset_virtual_view(hid_t plist_id, H5D_vds_view_t view);
 H5_DLL herr_t  H5Pget_virtual_view(hid_t plist_id, H5D_vds_view_t *view);
 H5_DLL herr_t  H5Pset_virtual_printf_gap(hid_t plist_id, hsize_t gap_size);
@@ -44,16 +44,27 @@
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
  *      routine must be updated.
  */
-#define H5VL_NATIVE_DATASET_FORMAT_CONVERT          0 /* H5Dformat_convert (internal) */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_INDEX_TYPE    1 /* H5Dget_chunk_index_type      */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE  2 /* H5Dget_chunk_storage_size    */
-#define H5VL_NATIVE_DATASET_GET_NUM_CHUNKS          3 /* H5Dget_num_chunks            */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_IDX   4 /* H5Dget_chunk_info            */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD 5 /* H5Dget_chunk_info_by_coord   */
-#define H5VL_NATIVE_DATASET_CHUNK_READ              6 /* H5Dchunk_read                */
-#define H5VL_NATIVE_DATASET_CHUNK_WRITE             7 /* H5Dchunk_write               */
-#define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8 /* H5Dvlen_get_buf_size         */
-#define H5VL_NATIVE_DATASET_GET_OFFSET              9 /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_FORMAT_CONVERT          0  /* H5Dformat_convert (internal) */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_INDEX_TYPE    1  /* H5Dget_chunk_index_type      */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE  2  /* H5Dget_chunk_storage_size    */
+#define H5VL_NATIVE_DATASET_GET_NUM_CHUNKS          3  /* H5Dget_num_chunks            */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_IDX   4  /* H5Dget_chunk_info            */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD 5  /* H5Dget_chunk_info_by_coord   */
+#define H5VL_NATIVE_DATASET_CHUNK_READ              6  /* H5Dchunk_read                */
+#define H5VL_NATIVE_DATASET_CHUNK_WRITE             7  /* H5Dchunk_write               */
+#define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8  /* H5Dvlen_get_buf_size         */
+#define H5VL_NATIVE_DATASET_GET_OFFSET              9  /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_GET_MAPPED_PTR          10 /* H5Dget_mapped_ptr            */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_CACHE_STATS   11 /* H5Dget_chunk_cache_stats     */
+#define H5VL_NATIVE_DATASET_RESET_CHUNK_CACHE_STATS 12 /* H5Dreset_chunk_cache_stats   */
+#define H5VL_NATIVE_DATASET_READ_MULTI              13 /* H5Dread_multi                */
+#define H5VL_NATIVE_DATASET_WRITE_MULTI             14 /* H5Dwrite_multi               */
+#define H5VL_NATIVE_DATASET_CHUNK_ITER              15 /* H5Dchunk_iter                */
+#define H5VL_NATIVE_DATASET_CHUNK_READ_MULTI        16 /* H5Dread_chunks               */
+#define H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI       17 /* H5Dwrite_chunks              */
+#define H5VL_NATIVE_DATASET_GET_SIEVE_STATS         18 /* H5Dget_sieve_stats           */
+#define H5VL_NATIVE_DATASET_RESET_SIEVE_STATS       19 /* H5Dreset_sieve_stats         */
+#define H5VL_NATIVE_DATASET_PREFETCH                20 /* H5Dprefetch                  */
 
 /* Values for native VOL connector file optional VOL operations */
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
@@ -88,6 +99,10 @@
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY            26 /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY            27 /* H5Fset_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_POST_OPEN                    28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_GET_READAHEAD_STATS          29 /* H5Fget_readahead_stats               */
+#define H5VL_NATIVE_FILE_GET_PAGE_BUF_TYPE_STATS      30 /* H5Fget_page_buffering_type_stats     */
+#define H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS        31 /* H5Fget_shared_chunk_cache_stats      */
+#define H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS      32 /* H5Freset_shared_chunk_cache_stats    */
 
 /* Values for native VOL connector group optional VOL operations */
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
@@ -24,12 +24,61 @@
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_multi_setup
+ *
+ * Purpose:     Allocates and fills in the dataset and dataspace arrays for
+ *              a multi-dataset read or write
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_dataset_multi_setup(size_t count, void *obj[], const hid_t mem_space_id[],
+                                 const hid_t file_space_id[], H5D_t ***dset, const H5S_t ***mem_space,
+                                 const H5S_t ***file_space)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Allocate the arrays */
+    if (NULL == (*dset = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+    if (NULL == (*mem_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate memory dataspace array")
+    if (NULL == (*file_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate file dataspace array")
+
+    for (u = 0; u < count; u++) {
+        (*dset)[u] = (H5D_t *)obj[u];
+
+        /* Check arguments */
+        if (NULL == (*dset)[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+        /* Get validated dataspace pointers */
+        if (H5S_get_validated_dataspace(mem_space_id[u], &(*mem_space)[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from mem_space_id")
+        if (H5S_get_validated_dataspace(file_space_id[u], &(*file_space)[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from file_space_id")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_multi_setup() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_dataset_create
  *
@@ -162,7 +211,7 @@ H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid_
     H5CX_set_dxpl(dxpl_id);
 
     /* Read raw data */
-    if (H5D__read(dset, mem_type_id, mem_space, file_space, buf /*out*/) < 0)
+    if (H5D__read(dset, mem_type_id, mem_space, file_space, buf /*out*/, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
@@ -203,7 +252,7 @@ H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid
     H5CX_set_dxpl(dxpl_id);
 
     /* Write the data */
-    if (H5D__write(dset, mem_type_id, mem_space, file_space, buf) < 0)
+    if (H5D__write(dset, mem_type_id, mem_space, file_space, buf, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
 
 done:
@@ -367,8 +416,11 @@ herr_t
 H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type, hid_t dxpl_id,
                               void H5_ATTR_UNUSED **req, va_list arguments)
 {
-    H5D_t *dset      = (H5D_t *)obj; /* Dataset */
-    herr_t ret_value = SUCCEED;      /* Return value */
+    H5D_t *       dset             = (H5D_t *)obj; /* Dataset */
+    H5D_t **      multi_dset       = NULL;         /* Datasets of a multi-dataset operation */
+    const H5S_t **multi_mem_space  = NULL;         /* Memory dataspaces of a multi-dataset operation */
+    const H5S_t **multi_file_space = NULL;         /* File dataspaces of a multi-dataset operation */
+    herr_t        ret_value        = SUCCEED;      /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -515,6 +567,23 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        case H5VL_NATIVE_DATASET_CHUNK_ITER: { /* H5Dchunk_iter */
+            H5D_chunk_iter_op_t op      = HDva_arg(arguments, H5D_chunk_iter_op_t);
+            void *              op_data = HDva_arg(arguments, void *);
+
+            HDassert(dset->shared);
+
+            /* Make sure the dataset is chunked */
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            /* Call private function */
+            if (H5D__chunk_iter(dset, op, op_data) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+
+            break;
+        }
+
         case H5VL_NATIVE_DATASET_CHUNK_READ: { /* H5Dread_chunk */
             const hsize_t *offset  = HDva_arg(arguments, hsize_t *);
             uint32_t *     filters = HDva_arg(arguments, uint32_t *);
@@ -566,6 +635,45 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI: { /* H5Dread_chunks */
+            size_t          count   = HDva_arg(arguments, size_t);
+            const hsize_t **offsets = HDva_arg(arguments, const hsize_t **);
+            uint32_t *      filters = HDva_arg(arguments, uint32_t *);
+            void **         bufs    = HDva_arg(arguments, void **);
+
+            /* Check arguments */
+            if (NULL == dset->oloc.file)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            /* Read the raw chunks */
+            if (H5D__chunk_direct_read_multi(dset, count, offsets, filters, bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+            break;
+        }
+
+        case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI: { /* H5Dwrite_chunks */
+            size_t          count      = HDva_arg(arguments, size_t);
+            const uint32_t *filters    = HDva_arg(arguments, const uint32_t *);
+            const hsize_t **offsets    = HDva_arg(arguments, const hsize_t **);
+            const size_t *  data_sizes = HDva_arg(arguments, const size_t *);
+            const void **   bufs       = HDva_arg(arguments, const void **);
+
+            /* Check arguments */
+            if (NULL == dset->oloc.file)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            /* Write the chunks */
+            if (H5D__chunk_direct_write_multi(dset, count, filters, offsets, data_sizes, bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+            break;
+        }
+
         case H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE: { /* H5Dvlen_get_buf_size */
             hid_t    type_id  = HDva_arg(arguments, hid_t);
             hid_t    space_id = HDva_arg(arguments, hid_t);
@@ -587,11 +695,123 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        /* H5Dget_mapped_ptr */
+        case H5VL_NATIVE_DATASET_GET_MAPPED_PTR: {
+            hid_t          mem_type_id = HDva_arg(arguments, hid_t);
+            const hsize_t *offset      = HDva_arg(arguments, const hsize_t *);
+            const void **  ptr         = HDva_arg(arguments, const void **);
+            size_t *       size        = HDva_arg(arguments, size_t *);
+
+            /* Check arguments */
+            if (NULL == dset->oloc.file)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+            if (H5D__get_mapped_ptr(dset, mem_type_id, offset, ptr, size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get pointer to mapped data")
+            break;
+        }
+
+        /* H5Dget_chunk_cache_stats */
+        case H5VL_NATIVE_DATASET_GET_CHUNK_CACHE_STATS: {
+            unsigned *hits      = HDva_arg(arguments, unsigned *);
+            unsigned *misses    = HDva_arg(arguments, unsigned *);
+            unsigned *evictions = HDva_arg(arguments, unsigned *);
+
+            if (H5D__chunk_cache_stats(dset, hits, misses, evictions) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk cache statistics")
+            break;
+        }
+
+        /* H5Dreset_chunk_cache_stats */
+        case H5VL_NATIVE_DATASET_RESET_CHUNK_CACHE_STATS: {
+            if (H5D__chunk_cache_reset_stats(dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't reset chunk cache statistics")
+            break;
+        }
+
+        /* H5Dget_sieve_stats */
+        case H5VL_NATIVE_DATASET_GET_SIEVE_STATS: {
+            unsigned *hits     = HDva_arg(arguments, unsigned *);
+            unsigned *misses   = HDva_arg(arguments, unsigned *);
+            unsigned *bypasses = HDva_arg(arguments, unsigned *);
+            size_t *  buf_size = HDva_arg(arguments, size_t *);
+
+            if (H5D__contig_sieve_stats(dset, hits, misses, bypasses, buf_size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get sieve buffer statistics")
+            break;
+        }
+
+        /* H5Dreset_sieve_stats */
+        case H5VL_NATIVE_DATASET_RESET_SIEVE_STATS: {
+            if (H5D__contig_sieve_reset_stats(dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't reset sieve buffer statistics")
+            break;
+        }
+
+        case H5VL_NATIVE_DATASET_PREFETCH: { /* H5Dprefetch */
+            const H5S_t *space    = NULL;
+            hid_t        space_id = HDva_arg(arguments, hid_t);
+
+            /* When default dataspace is given, use the dataset's dataspace */
+            if (space_id == H5S_ALL)
+                space = dset->shared->space;
+            else /*  otherwise, use the given space ID */
+                if (NULL == (space = (const H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a valid dataspace ID")
+
+            /* Only chunks are cached, there's nothing to load for other layouts */
+            if (H5D_CHUNKED == dset->shared->layout.type)
+                if (H5D__chunk_prefetch(dset, space) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't prefetch chunks")
+            break;
+        }
+
+        /* H5Dread_multi */
+        case H5VL_NATIVE_DATASET_READ_MULTI: {
+            size_t       count         = HDva_arg(arguments, size_t);
+            void **      obj_arr       = HDva_arg(arguments, void **);
+            const hid_t *mem_type_id   = HDva_arg(arguments, const hid_t *);
+            const hid_t *mem_space_id  = HDva_arg(arguments, const hid_t *);
+            const hid_t *file_space_id = HDva_arg(arguments, const hid_t *);
+            void **      buf           = HDva_arg(arguments, void **);
+
+            if (H5VL__native_dataset_multi_setup(count, obj_arr, mem_space_id, file_space_id, &multi_dset,
+                                                 &multi_mem_space, &multi_file_space) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset read")
+
+            if (H5D__read_multi(count, multi_dset, mem_type_id, multi_mem_space, multi_file_space, buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            break;
+        }
+
+        /* H5Dwrite_multi */
+        case H5VL_NATIVE_DATASET_WRITE_MULTI: {
+            size_t       count         = HDva_arg(arguments, size_t);
+            void **      obj_arr       = HDva_arg(arguments, void **);
+            const hid_t *mem_type_id   = HDva_arg(arguments, const hid_t *);
+            const hid_t *mem_space_id  = HDva_arg(arguments, const hid_t *);
+            const hid_t *file_space_id = HDva_arg(arguments, const hid_t *);
+            const void **buf           = HDva_arg(arguments, const void **);
+
+            if (H5VL__native_dataset_multi_setup(count, obj_arr, mem_space_id, file_space_id, &multi_dset,
+                                                 &multi_mem_space, &multi_file_space) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset write")
+
+            if (H5D__write_multi(count, multi_dset, mem_type_id, multi_mem_space, multi_file_space, buf) <
+                0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
 
 done:
+    H5MM_xfree(multi_dset);
+    H5MM_xfree(multi_mem_space);
+    H5MM_xfree(multi_file_space);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_dataset_optional() */
 
@@ -20,6 +20,7 @@
 #include "H5private.h"   /* Generic Functions                        */
 #include "H5ACprivate.h" /* Metadata cache                           */
 #include "H5Cprivate.h"  /* Cache                                    */
+#include "H5Dprivate.h"  /* Datasets                                 */
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5Fpkg.h"      /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
@@ -671,6 +672,23 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
             break;
         }
 
+        /* H5Fget_page_buffering_type_stats */
+        case H5VL_NATIVE_FILE_GET_PAGE_BUF_TYPE_STATS: {
+            unsigned *hits      = HDva_arg(arguments, unsigned *);
+            unsigned *misses    = HDva_arg(arguments, unsigned *);
+            unsigned *evictions = HDva_arg(arguments, unsigned *);
+
+            /* Sanity check */
+            if (NULL == f->shared->page_buf)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page buffering not enabled on file")
+
+            /* Get the statistics */
+            if (H5PB_get_type_stats(f->shared->page_buf, hits, misses, evictions) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for page buffering")
+
+            break;
+        }
+
         /* H5Fget_mdc_image_info */
         case H5VL_NATIVE_FILE_GET_MDC_IMAGE_INFO: {
             haddr_t *image_addr = HDva_arg(arguments, haddr_t *);
@@ -784,6 +802,51 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
             break;
         }
 
+        /* H5Fget_readahead_stats */
+        case H5VL_NATIVE_FILE_GET_READAHEAD_STATS: {
+            hsize_t *reads = HDva_arg(arguments, hsize_t *);
+            hsize_t *hits  = HDva_arg(arguments, hsize_t *);
+            hsize_t *fills = HDva_arg(arguments, hsize_t *);
+
+            /* Get the statistics from the file driver */
+            if (H5FD_sec2_get_readahead_stats(f->shared->lf, reads, hits, fills) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for read-ahead")
+
+            break;
+        }
+
+        /* H5Fget_shared_chunk_cache_stats */
+        case H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS: {
+            unsigned *hits        = HDva_arg(arguments, unsigned *);
+            unsigned *misses      = HDva_arg(arguments, unsigned *);
+            unsigned *evictions   = HDva_arg(arguments, unsigned *);
+            size_t *  nbytes_used = HDva_arg(arguments, size_t *);
+            size_t *  nchunks     = HDva_arg(arguments, size_t *);
+
+            /* Sanity check */
+            if (0 == f->shared->rdcc_shared_size)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "shared chunk cache not enabled on file")
+
+            /* Get the statistics */
+            if (H5D_chunk_shared_cache_stats(f, hits, misses, evictions, nbytes_used, nchunks) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for shared chunk cache")
+
+            break;
+        }
+
+        /* H5Freset_shared_chunk_cache_stats */
+        case H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS: {
+            /* Sanity check */
+            if (0 == f->shared->rdcc_shared_size)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "shared chunk cache not enabled on file")
+
+            /* Reset the statistics */
+            if (H5D_chunk_shared_cache_reset_stats(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset stats for shared chunk cache")
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
@@ -87,14 +87,31 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD:
                 case H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE:
                 case H5VL_NATIVE_DATASET_GET_OFFSET:
+                case H5VL_NATIVE_DATASET_GET_CHUNK_CACHE_STATS:
+                case H5VL_NATIVE_DATASET_RESET_CHUNK_CACHE_STATS:
+                case H5VL_NATIVE_DATASET_GET_SIEVE_STATS:
+                case H5VL_NATIVE_DATASET_RESET_SIEVE_STATS:
                     *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
                     break;
 
+                case H5VL_NATIVE_DATASET_CHUNK_ITER:
+                    *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
+
+                    /* Don't allow asynchronous execution, due to iterator callbacks */
+                    *flags |= H5VL_OPT_QUERY_NO_ASYNC;
+                    break;
+
                 case H5VL_NATIVE_DATASET_CHUNK_READ:
+                case H5VL_NATIVE_DATASET_GET_MAPPED_PTR:
+                case H5VL_NATIVE_DATASET_READ_MULTI:
+                case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI:
+                case H5VL_NATIVE_DATASET_PREFETCH:
                     *flags |= H5VL_OPT_QUERY_READ_DATA;
                     break;
 
                 case H5VL_NATIVE_DATASET_CHUNK_WRITE:
+                case H5VL_NATIVE_DATASET_WRITE_MULTI:
+                case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI:
                     *flags |= H5VL_OPT_QUERY_WRITE_DATA;
                     break;
 
@@ -144,6 +161,9 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_FILE_FORMAT_CONVERT:
                 case H5VL_NATIVE_FILE_RESET_PAGE_BUFFERING_STATS:
                 case H5VL_NATIVE_FILE_GET_PAGE_BUFFERING_STATS:
+                case H5VL_NATIVE_FILE_GET_PAGE_BUF_TYPE_STATS:
+                case H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS:
+                case H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS:
                 case H5VL_NATIVE_FILE_GET_MDC_IMAGE_INFO:
                 case H5VL_NATIVE_FILE_GET_EOA:
                 case H5VL_NATIVE_FILE_INCR_FILESIZE:
@@ -153,6 +173,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_FILE_GET_MPI_ATOMICITY:
                 case H5VL_NATIVE_FILE_SET_MPI_ATOMICITY:
                 case H5VL_NATIVE_FILE_POST_OPEN:
+                case H5VL_NATIVE_FILE_GET_READAHEAD_STATS:
                     break;
 
                 default:
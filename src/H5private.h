@@ -122,6 +122,20 @@
 #include <sys/file.h>
 #endif
 
+/*
+ * Memory-mapped files.  Used by the mmap driver.
+ */
+#ifdef H5_HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
+/*
+ * Scatter/gather I/O.  Used by the sec2 driver's vector I/O callbacks.
+ */
+#ifdef H5_HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
+
 /*
  * Resource usage is not Posix.1 but HDF5 uses it anyway for some performance
  * and debugging code if available.
@@ -1181,6 +1195,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmalloc
 #define HDmalloc(Z) malloc(Z)
 #endif /* HDmalloc */
+#ifndef HDposix_fadvise
+#define HDposix_fadvise(F, O, L, A) posix_fadvise(F, O, L, A)
+#endif /* HDposix_fadvise */
 #ifndef HDposix_memalign
 #define HDposix_memalign(P, A, Z) posix_memalign(P, A, Z)
 #endif /* HDposix_memalign */
@@ -1217,9 +1234,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmktime
 #define HDmktime(T) mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+#define HDmmap(A, L, P, F, D, O) mmap(A, L, P, F, D, O)
+#endif /* HDmmap */
 #ifndef HDmodf
 #define HDmodf(X, Y) modf(X, Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+#define HDmunmap(A, L) munmap(A, L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
 #define HDnanosleep(N, O) nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1256,6 +1279,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpread
 #define HDpread(F, B, C, O) pread(F, B, C, O)
 #endif /* HDpread */
+#ifndef HDpreadv
+#define HDpreadv(F, V, C, O) preadv(F, V, C, O)
+#endif /* HDpreadv */
 #ifndef HDprintf
 #define HDprintf printf
 #endif /* HDprintf */
@@ -1322,6 +1348,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpwrite
 #define HDpwrite(F, B, C, O) pwrite(F, B, C, O)
 #endif /* HDpwrite */
+#ifndef HDpwritev
+#define HDpwritev(F, V, C, O) pwritev(F, V, C, O)
+#endif /* HDpwritev */
 #ifndef HDqsort
 #define HDqsort(M, N, Z, F) qsort(M, N, Z, F)
 #endif /* HDqsort*/
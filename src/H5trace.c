@@ -674,6 +674,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                         }     /* end block */
                         break;
 
+                        case 'C': /* H5D_chunk_iter_op_t */
+                        {
+                            H5D_chunk_iter_op_t cop = (H5D_chunk_iter_op_t)HDva_arg(ap, H5D_chunk_iter_op_t);
+
+                            H5RS_asprintf_cat(rs, "%p", (void *)(uintptr_t)cop);
+                        } /* end block */
+                        break;
+
                         case 'f': /* H5D_fill_time_t */
                         {
                             H5D_fill_time_t fill_time = (H5D_fill_time_t)HDva_arg(ap, int);
@@ -966,6 +974,39 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                         } /* end block */
                         break;
 
+                        case 'p': /* H5D_chunk_cache_policy_t */
+                        {
+                            H5D_chunk_cache_policy_t policy = (H5D_chunk_cache_policy_t)HDva_arg(ap, int);
+
+                            switch (policy) {
+                                case H5D_CHUNK_CACHE_POLICY_ERROR:
+                                    H5RS_acat(rs, "H5D_CHUNK_CACHE_POLICY_ERROR");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_DEFAULT:
+                                    H5RS_acat(rs, "H5D_CHUNK_CACHE_POLICY_DEFAULT");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_LRU:
+                                    H5RS_acat(rs, "H5D_CHUNK_CACHE_POLICY_LRU");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_CLOCK:
+                                    H5RS_acat(rs, "H5D_CHUNK_CACHE_POLICY_CLOCK");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_LFU:
+                                    H5RS_acat(rs, "H5D_CHUNK_CACHE_POLICY_LFU");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_NPOLICIES:
+                                default:
+                                    H5RS_asprintf_cat(rs, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        }     /* end block */
+                        break;
+
                         case 's': /* H5D_space_status_t */
                         {
                             H5D_space_status_t space_status = (H5D_space_status_t)HDva_arg(ap, int);
@@ -1282,6 +1323,31 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                         }     /* end block */
                         break;
 
+                        case 'p': /* H5F_page_buf_policy_t */
+                        {
+                            H5F_page_buf_policy_t policy = (H5F_page_buf_policy_t)HDva_arg(ap, int);
+
+                            switch (policy) {
+                                case H5F_PAGE_BUF_POLICY_LRU:
+                                    H5RS_acat(rs, "H5F_PAGE_BUF_POLICY_LRU");
+                                    break;
+
+                                case H5F_PAGE_BUF_POLICY_2Q:
+                                    H5RS_acat(rs, "H5F_PAGE_BUF_POLICY_2Q");
+                                    break;
+
+                                case H5F_PAGE_BUF_POLICY_ARC:
+                                    H5RS_acat(rs, "H5F_PAGE_BUF_POLICY_ARC");
+                                    break;
+
+                                case H5F_PAGE_BUF_POLICY_NTYPES:
+                                default:
+                                    H5RS_asprintf_cat(rs, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        }     /* end block */
+                        break;
+
                         case 's': /* H5F_scope_t */
                         {
                             H5F_scope_t scope = (H5F_scope_t)HDva_arg(ap, int);
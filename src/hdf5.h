@@ -47,12 +47,14 @@
 #include "H5FDhdfs.h"     /* Hadoop HDFS                              */
 #include "H5FDlog.h"      /* sec2 driver with I/O logging (for debugging) */
 #include "H5FDmirror.h"   /* Mirror VFD and IPC definitions           */
+#include "H5FDmmap.h"     /* Read-only memory-mapped file I/O         */
 #include "H5FDmpi.h"      /* MPI-based file drivers                   */
 #include "H5FDmulti.h"    /* Usage-partitioned file family            */
 #include "H5FDros3.h"     /* R/O S3 "file" I/O                        */
 #include "H5FDsec2.h"     /* POSIX unbuffered file I/O                */
 #include "H5FDsplitter.h" /* Twin-channel (R/W & R/O) I/O passthrough */
 #include "H5FDstdio.h"    /* Standard C buffered I/O                  */
+#include "H5FDuring.h"    /* Linux io_uring asynchronous I/O          */
 #ifdef H5_HAVE_WINDOWS
 #include "H5FDwindows.h" /* Win32 I/O                                */
 #endif
@@ -365,6 +365,7 @@ set (test_CLEANFILES
     earray_tmp.h5
     efc*.h5
     log_vfd_out.log
+    log_vfd_trace.bin
     log_ros3_out.log
     log_s3comms_out.log
     new_multi_file_v16-r.h5
@@ -29,6 +29,9 @@ set (VFD_LIST
 if (DIRECT_VFD)
   set (VFD_LIST ${VFD_LIST} direct)
 endif ()
+if (H5_HAVE_URING_VFD)
+  set (VFD_LIST ${VFD_LIST} uring)
+endif ()
 
 foreach (vfdtest ${VFD_LIST})
   file (MAKE_DIRECTORY "${PROJECT_BINARY_DIR}/${vfdtest}")
@@ -54,6 +54,8 @@ unsigned test_read_after(H5F_t *f);
 unsigned test_free(H5F_t *f);
 unsigned test_big(H5F_t *f);
 unsigned test_random_write(H5F_t *f);
+unsigned test_regions(H5F_t *f);
+unsigned test_vector_overlap(H5F_t *f);
 unsigned test_swmr_write_big(hbool_t newest_format);
 
 /* Helper Function Prototypes */
@@ -137,6 +139,8 @@ main(void)
     nerrors += test_free(f);
     nerrors += test_big(f);
     nerrors += test_random_write(f);
+    nerrors += test_regions(f);
+    nerrors += test_vector_overlap(f);
 
     /* Pop API context */
     if (api_ctx_pushed && H5CX_pop(FALSE) < 0)
@@ -2071,6 +2075,296 @@ error:
     return 1;
 } /* end test_random_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_regions
+ *
+ * Purpose:     This test will verify that dirty metadata is set aside,
+ *              rather than written to the file, when writes alternate
+ *              between two distant parts of the file.  The data is read
+ *              back through the accumulator and directly from the file
+ *              driver, before and after freeing a piece of it and after
+ *              flushing the accumulator.
+ *
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+#define REGION_CHUNK   512
+#define REGION_NCHUNKS 4
+#define REGION_A_ADDR  4096
+#define REGION_B_ADDR  65536
+#define REGION_SIZE    (REGION_CHUNK * REGION_NCHUNKS)
+#define REGION_SPAN    (128 * 1024)
+unsigned
+test_regions(H5F_t *f)
+{
+    uint8_t *zbuf = NULL; /* Buffer of zeros */
+    uint8_t *wbuf = NULL; /* Data written to the two regions */
+    uint8_t *rbuf = NULL; /* Data read back */
+    size_t   u;
+
+    TESTING("dirty regions set aside by accumulator");
+
+    /* Allocate buffers */
+    zbuf = (uint8_t *)HDcalloc((size_t)REGION_SPAN, (size_t)1);
+    HDassert(zbuf);
+    wbuf = (uint8_t *)HDmalloc((size_t)(2 * REGION_SIZE));
+    HDassert(wbuf);
+    rbuf = (uint8_t *)HDmalloc((size_t)REGION_SPAN);
+    HDassert(rbuf);
+
+    for (u = 0; u < 2 * REGION_SIZE; u++)
+        wbuf[u] = (uint8_t)((u % 251) + 1);
+
+    /* Start with zeros in the file */
+    if (accum_write(0, REGION_SPAN, zbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Alternate writes between the two regions */
+    for (u = 0; u < REGION_NCHUNKS; u++) {
+        if (accum_write(REGION_A_ADDR + u * REGION_CHUNK, REGION_CHUNK, wbuf + u * REGION_CHUNK) < 0)
+            FAIL_STACK_ERROR;
+        if (accum_write(REGION_B_ADDR + u * REGION_CHUNK, REGION_CHUNK,
+                        wbuf + REGION_SIZE + u * REGION_CHUNK) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+
+    /* The first region must still be held in memory */
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)REGION_A_ADDR, (size_t)REGION_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, zbuf, (size_t)REGION_SIZE) != 0)
+        TEST_ERROR;
+
+    /* Both regions must read back through the accumulator */
+    if (accum_read(REGION_A_ADDR, REGION_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, wbuf, (size_t)REGION_SIZE) != 0)
+        TEST_ERROR;
+    if (accum_read(REGION_B_ADDR, REGION_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, wbuf + REGION_SIZE, (size_t)REGION_SIZE) != 0)
+        TEST_ERROR;
+
+    /* A read straddling the beginning of the first region */
+    if (accum_read(REGION_A_ADDR - 16, 32, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, zbuf, (size_t)16) != 0 || HDmemcmp(rbuf + 16, wbuf, (size_t)16) != 0)
+        TEST_ERROR;
+
+    /* Free a piece from the middle of the first region.  The part after
+     * the freed piece is written out, the freed piece is never written. */
+    if (accum_free(f, REGION_A_ADDR + REGION_CHUNK, REGION_CHUNK) < 0)
+        FAIL_STACK_ERROR;
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)REGION_A_ADDR, (size_t)REGION_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, zbuf, (size_t)(2 * REGION_CHUNK)) != 0)
+        TEST_ERROR;
+    if (HDmemcmp(rbuf + 2 * REGION_CHUNK, wbuf + 2 * REGION_CHUNK, (size_t)(2 * REGION_CHUNK)) != 0)
+        TEST_ERROR;
+
+    /* Flush, then check the file directly */
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)0, (size_t)REGION_SPAN, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf + REGION_A_ADDR, wbuf, (size_t)REGION_CHUNK) != 0)
+        TEST_ERROR;
+    if (HDmemcmp(rbuf + REGION_A_ADDR + REGION_CHUNK, zbuf, (size_t)REGION_CHUNK) != 0)
+        TEST_ERROR;
+    if (HDmemcmp(rbuf + REGION_A_ADDR + 2 * REGION_CHUNK, wbuf + 2 * REGION_CHUNK,
+                 (size_t)(2 * REGION_CHUNK)) != 0)
+        TEST_ERROR;
+    if (HDmemcmp(rbuf + REGION_B_ADDR, wbuf + REGION_SIZE, (size_t)REGION_SIZE) != 0)
+        TEST_ERROR;
+
+    /* A read covering both regions, through the accumulator */
+    if (accum_read(0, REGION_SPAN, zbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, zbuf, (size_t)REGION_SPAN) != 0)
+        TEST_ERROR;
+
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    HDfree(zbuf);
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    /* Release memory */
+    HDfree(zbuf);
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 1;
+} /* end test_regions() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_overlap
+ *
+ * Purpose:     Test raw data vector I/O over metadata still held in memory
+ *              by the accumulator, as when freed metadata space is reused
+ *              for raw data.  Raw data written over the dirty accumulator
+ *              or a dirty region set aside must not be overwritten when
+ *              the metadata is flushed later, and raw data read there
+ *              must include the dirty metadata.
+ *
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+#define VECTOR_META_ADDR 8192
+#define VECTOR_META_SIZE 1024
+#define VECTOR_RAW_OFF   256
+#define VECTOR_RAW_SIZE  256
+#define VECTOR_FAR_ADDR  (VECTOR_META_ADDR + 4096)
+unsigned
+test_vector_overlap(H5F_t *f)
+{
+    H5FD_mem_t  types[2] = {H5FD_MEM_DRAW, H5FD_MEM_DRAW};     /* Types of the extents */
+    haddr_t     addrs[2];                                      /* Addresses of the extents */
+    size_t      sizes[2] = {VECTOR_RAW_SIZE, VECTOR_RAW_SIZE}; /* Sizes of the extents */
+    void *      rbufs[2];                                      /* Buffers to read the extents into */
+    const void *wbufs[2];                                      /* Buffers to write the extents from */
+    uint8_t *   zbuf = NULL;                                   /* Buffer of zeros */
+    uint8_t *   mbuf = NULL;                                   /* Metadata written */
+    uint8_t *   raw  = NULL;                                   /* Raw data written */
+    uint8_t *   exp  = NULL;                                   /* Data expected */
+    uint8_t *   rbuf = NULL;                                   /* Data read back */
+    size_t      u;
+
+    TESTING("raw data vector I/O overlapping dirty metadata");
+
+    /* Allocate buffers */
+    zbuf = (uint8_t *)HDcalloc((size_t)REGION_SPAN, (size_t)1);
+    HDassert(zbuf);
+    mbuf = (uint8_t *)HDmalloc((size_t)REGION_SIZE);
+    HDassert(mbuf);
+    raw = (uint8_t *)HDmalloc((size_t)(2 * VECTOR_RAW_SIZE));
+    HDassert(raw);
+    exp = (uint8_t *)HDmalloc((size_t)REGION_SIZE);
+    HDassert(exp);
+    rbuf = (uint8_t *)HDmalloc((size_t)REGION_SPAN);
+    HDassert(rbuf);
+
+    for (u = 0; u < REGION_SIZE; u++)
+        mbuf[u] = (uint8_t)((u % 251) + 1);
+    for (u = 0; u < 2 * VECTOR_RAW_SIZE; u++)
+        raw[u] = (uint8_t)(255 - (u % 127));
+
+    /* Start with zeros in the file */
+    if (accum_write(0, REGION_SPAN, zbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Dirty metadata in the accumulator, then a raw vector write with one
+     * extent inside it and one elsewhere */
+    if (accum_write(VECTOR_META_ADDR, VECTOR_META_SIZE, mbuf) < 0)
+        FAIL_STACK_ERROR;
+    addrs[0] = VECTOR_META_ADDR + VECTOR_RAW_OFF;
+    addrs[1] = VECTOR_FAR_ADDR;
+    wbufs[0] = raw;
+    wbufs[1] = raw + VECTOR_RAW_SIZE;
+    if (H5F_shared_vector_write(f->shared, 2, types, addrs, sizes, wbufs) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The raw data reads back, through a vector and through the accumulator */
+    rbufs[0] = rbuf;
+    rbufs[1] = rbuf + VECTOR_RAW_SIZE;
+    if (H5F_shared_vector_read(f->shared, 2, types, addrs, sizes, rbufs) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, raw, (size_t)(2 * VECTOR_RAW_SIZE)) != 0)
+        TEST_ERROR;
+    HDmemcpy(exp, mbuf, (size_t)VECTOR_META_SIZE);
+    HDmemcpy(exp + VECTOR_RAW_OFF, raw, (size_t)VECTOR_RAW_SIZE);
+    if (accum_read(VECTOR_META_ADDR, VECTOR_META_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, exp, (size_t)VECTOR_META_SIZE) != 0)
+        TEST_ERROR;
+
+    /* Flushing the metadata doesn't overwrite the raw data */
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)VECTOR_META_ADDR, (size_t)VECTOR_META_SIZE,
+                  rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, exp, (size_t)VECTOR_META_SIZE) != 0)
+        TEST_ERROR;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Alternate metadata writes between two regions, so the first one is
+     * set aside (see test_regions) */
+    for (u = 0; u < REGION_NCHUNKS; u++) {
+        if (accum_write(REGION_A_ADDR + u * REGION_CHUNK, REGION_CHUNK, mbuf + u * REGION_CHUNK) < 0)
+            FAIL_STACK_ERROR;
+        if (accum_write(REGION_B_ADDR + u * REGION_CHUNK, REGION_CHUNK, zbuf) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)REGION_A_ADDR, (size_t)REGION_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, zbuf, (size_t)REGION_SIZE) != 0)
+        TEST_ERROR;
+
+    /* A raw vector read there sees the dirty metadata */
+    addrs[0] = REGION_A_ADDR + VECTOR_RAW_OFF;
+    addrs[1] = VECTOR_FAR_ADDR;
+    if (H5F_shared_vector_read(f->shared, 2, types, addrs, sizes, rbufs) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, mbuf + VECTOR_RAW_OFF, (size_t)VECTOR_RAW_SIZE) != 0)
+        TEST_ERROR;
+
+    /* A raw vector write there survives the metadata being flushed */
+    if (H5F_shared_vector_write(f->shared, 2, types, addrs, sizes, wbufs) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    HDmemcpy(exp, mbuf, (size_t)REGION_SIZE);
+    HDmemcpy(exp + VECTOR_RAW_OFF, raw, (size_t)VECTOR_RAW_SIZE);
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)REGION_A_ADDR, (size_t)REGION_SIZE, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(rbuf, exp, (size_t)REGION_SIZE) != 0)
+        TEST_ERROR;
+
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    HDfree(zbuf);
+    HDfree(mbuf);
+    HDfree(raw);
+    HDfree(exp);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    /* Release memory */
+    HDfree(zbuf);
+    HDfree(mbuf);
+    HDfree(raw);
+    HDfree(exp);
+    HDfree(rbuf);
+
+    return 1;
+} /* end test_vector_overlap() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  *
@@ -54,6 +54,7 @@ const char *FILENAME[] = {"tchunk_info_earliest", "tchunk_info_v18",  "tchunk_in
 /* File to be used in test_failed_attempts */
 #define FILTERMASK_FILE "tflt_msk"
 #define BASIC_FILE      "basic_query"
+#define CHUNK_ITER_FILE "chunk_iter"
 
 /* Parameters for testing chunk querying */
 #define SIMPLE_CHUNKED_DSET_NAME    "Chunked Dataset"
@@ -2061,6 +2062,220 @@ error:
     return FAIL;
 } /* test_flt_msk_with_skip_compress() */
 
+/* Info gathered by the chunk iteration callback in test_chunk_iter */
+typedef struct chunk_iter_info_t {
+    unsigned nchunks;               /* Number of chunks visited */
+    unsigned stop_after;            /* Number of chunks to visit before stopping, 0 for all */
+    hsize_t  offset[NUM_CHUNKS][2]; /* Offsets of the chunks visited */
+    haddr_t  addr[NUM_CHUNKS];      /* Addresses of the chunks visited */
+    hsize_t  size[NUM_CHUNKS];      /* Sizes of the chunks visited */
+} chunk_iter_info_t;
+
+/*-------------------------------------------------------------------------
+ * Function:    iter_cb (helper function)
+ *
+ * Purpose:     Records each chunk visited by H5Dchunk_iter.
+ *
+ * Return:      0 to continue, 1 to stop, -1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+iter_cb(const hsize_t *offset, unsigned H5_ATTR_UNUSED filter_mask, haddr_t addr, hsize_t size,
+        void *op_data)
+{
+    chunk_iter_info_t *info = (chunk_iter_info_t *)op_data;
+
+    if (info->nchunks >= NUM_CHUNKS)
+        return -1;
+
+    info->offset[info->nchunks][0] = offset[0];
+    info->offset[info->nchunks][1] = offset[1];
+    info->addr[info->nchunks]      = addr;
+    info->size[info->nchunks]      = size;
+    info->nchunks++;
+
+    return (info->stop_after && info->nchunks == info->stop_after) ? 1 : 0;
+} /* iter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    fail_cb (helper function)
+ *
+ * Purpose:     Fails the chunk iteration.
+ *
+ * Return:      -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+fail_cb(const hsize_t H5_ATTR_UNUSED *offset, unsigned H5_ATTR_UNUSED filter_mask,
+        haddr_t H5_ATTR_UNUSED addr, hsize_t H5_ATTR_UNUSED size, void H5_ATTR_UNUSED *op_data)
+{
+    return -1;
+} /* fail_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_iter
+ *
+ * Purpose:     Tests H5Dchunk_iter: that every chunk is visited once, in
+ *              increasing address order, with the same info as returned
+ *              by H5Dget_chunk_info_by_coord, that the callback can stop
+ *              or fail the iteration, and that non-chunked datasets are
+ *              rejected.  Uses fixed and unlimited dimensions with the
+ *              earliest and the latest file formats, to cover the v1
+ *              B-tree, fixed array and v2 B-tree indexes.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_iter(hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];                     /* File name */
+    hid_t             file          = H5I_INVALID_HID;                 /* File ID */
+    hid_t             dspace        = H5I_INVALID_HID;                 /* Dataspace ID */
+    hid_t             dset          = H5I_INVALID_HID;                 /* Dataset ID */
+    hid_t             cparms        = H5I_INVALID_HID;                 /* Creation plist */
+    hsize_t           dims[2]       = {NX, NY};                        /* Dataset dimensions */
+    hsize_t           maxdims[2]    = {H5S_UNLIMITED, H5S_UNLIMITED};  /* Maximum dimensions */
+    hsize_t           chunk_dims[2] = {CHUNK_NX, CHUNK_NY};            /* Chunk dimensions */
+    int               direct_buf[CHUNK_NX][CHUNK_NY];                  /* Data in chunks */
+    chunk_iter_info_t info;                                            /* Info from the iteration */
+    hsize_t           offset[2];                                       /* Offset coordinates of a chunk */
+    hsize_t           size;                                            /* Size of a chunk */
+    haddr_t           addr;                                            /* Address of a chunk */
+    unsigned          flt_msk;                                         /* Filter mask */
+    unsigned          latest, unlim;                                   /* Test variations */
+    unsigned          ii, jj;                                          /* Array indices */
+    herr_t            ret;                                             /* Returned value of failing calls */
+
+    TESTING("iterating over all chunks");
+
+    for (ii = 0; ii < CHUNK_NX; ii++)
+        for (jj = 0; jj < CHUNK_NY; jj++)
+            direct_buf[ii][jj] = (int)(ii * jj);
+
+    for (latest = 0; latest < 2; latest++) {
+        /* Set version bounds for creating file */
+        if (H5Pset_libver_bounds(fapl, latest ? H5F_LIBVER_LATEST : H5F_LIBVER_EARLIEST, H5F_LIBVER_LATEST) <
+            0)
+            TEST_ERROR
+
+        h5_fixname(CHUNK_ITER_FILE, fapl, filename, sizeof filename);
+        if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR
+
+        for (unlim = 0; unlim < 2; unlim++) {
+            if ((dspace = H5Screate_simple(RANK, dims, unlim ? maxdims : NULL)) < 0)
+                TEST_ERROR
+            if ((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+                TEST_ERROR
+            if (H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+                TEST_ERROR
+            if ((dset = H5Dcreate2(file, unlim ? "unlimited" : "fixed", H5T_NATIVE_INT, dspace, H5P_DEFAULT,
+                                   cparms, H5P_DEFAULT)) < 0)
+                TEST_ERROR
+
+            /* No chunks to visit yet */
+            HDmemset(&info, 0, sizeof(info));
+            if (H5Dchunk_iter(dset, H5P_DEFAULT, iter_cb, &info) < 0)
+                TEST_ERROR
+            VERIFY(info.nchunks, 0, "H5Dchunk_iter, number of chunks");
+
+            /* Write all the chunks, in the reverse order of their offsets */
+            for (ii = NX / CHUNK_NX; ii > 0; ii--)
+                for (jj = NY / CHUNK_NY; jj > 0; jj--) {
+                    offset[0] = (ii - 1) * CHUNK_NX;
+                    offset[1] = (jj - 1) * CHUNK_NY;
+                    if (H5Dwrite_chunk(dset, H5P_DEFAULT, 0, offset, CHK_SIZE, direct_buf) < 0)
+                        TEST_ERROR
+                }
+
+            /* Visit all the chunks */
+            HDmemset(&info, 0, sizeof(info));
+            if (H5Dchunk_iter(dset, H5P_DEFAULT, iter_cb, &info) < 0)
+                TEST_ERROR
+            VERIFY(info.nchunks, NUM_CHUNKS, "H5Dchunk_iter, number of chunks");
+            for (ii = 0; ii < NUM_CHUNKS; ii++) {
+                if (ii > 0 && info.addr[ii] <= info.addr[ii - 1])
+                    FAIL_PUTS_ERROR("Chunks not visited in increasing address order\n");
+                for (jj = 0; jj < ii; jj++)
+                    if (info.offset[ii][0] == info.offset[jj][0] && info.offset[ii][1] == info.offset[jj][1])
+                        FAIL_PUTS_ERROR("Chunk visited twice\n");
+                if (H5Dget_chunk_info_by_coord(dset, info.offset[ii], &flt_msk, &addr, &size) < 0)
+                    TEST_ERROR
+                if (addr != info.addr[ii] || size != info.size[ii] || size != CHK_SIZE)
+                    FAIL_PUTS_ERROR("Chunk info differs from H5Dget_chunk_info_by_coord\n");
+            }
+
+            /* Stop early */
+            HDmemset(&info, 0, sizeof(info));
+            info.stop_after = 3;
+            if (H5Dchunk_iter(dset, H5P_DEFAULT, iter_cb, &info) < 0)
+                TEST_ERROR
+            VERIFY(info.nchunks, 3, "H5Dchunk_iter, number of chunks");
+
+            /* A failing callback fails the iteration */
+            H5E_BEGIN_TRY
+            {
+                ret = H5Dchunk_iter(dset, H5P_DEFAULT, fail_cb, NULL);
+            }
+            H5E_END_TRY;
+            if (ret >= 0)
+                FAIL_PUTS_ERROR("H5Dchunk_iter succeeded with a failing callback\n");
+
+            if (H5Dclose(dset) < 0)
+                TEST_ERROR
+            if (H5Pclose(cparms) < 0)
+                TEST_ERROR
+            if (H5Sclose(dspace) < 0)
+                TEST_ERROR
+        }
+
+        /* Non-chunked datasets can't be iterated over */
+        if ((dspace = H5Screate_simple(RANK, dims, NULL)) < 0)
+            TEST_ERROR
+        if ((dset = H5Dcreate2(file, CONTIGUOUS_DSET_NAME, H5T_NATIVE_INT, dspace, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dchunk_iter(dset, H5P_DEFAULT, iter_cb, &info);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            FAIL_PUTS_ERROR("H5Dchunk_iter succeeded on a contiguous dataset\n");
+
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR
+        if (H5Sclose(dspace) < 0)
+            TEST_ERROR
+        if (H5Fclose(file) < 0)
+            TEST_ERROR
+
+        /* Remove the test file */
+        HDremove(filename);
+    }
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(dspace);
+        H5Pclose(cparms);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    H5_FAILED();
+    return FAIL;
+} /* test_chunk_iter() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -2097,6 +2312,9 @@ main(void)
     /* Tests getting filter mask when compression filter is skipped */
     nerrors += test_flt_msk_with_skip_compress(fapl) < 0 ? 1 : 0;
 
+    /* Tests iterating over all the chunks of a dataset */
+    nerrors += test_chunk_iter(fapl) < 0 ? 1 : 0;
+
     if (nerrors)
         goto error;
 
@@ -36,6 +36,9 @@
 #define DATASETNAME10 "read_w_valid_cache"
 #define DATASETNAME11 "unallocated_chunk"
 #define DATASETNAME12 "unfiltered_data"
+/* Datasets for batched Direct Write/Read tests */
+#define DATASETNAME13 "multi_chunks"
+#define DATASETNAME14 "multi_chunks_filtered"
 
 #define RANK     2
 #define NX       16
@@ -43,6 +46,8 @@
 #define CHUNK_NX 4
 #define CHUNK_NY 4
 
+#define NUM_CHUNKS ((NX / CHUNK_NX) * (NY / CHUNK_NY))
+
 #define DEFLATE_SIZE_ADJUST(s) (HDceil(((double)(s)) * 1.001) + 12.0)
 
 /* Temporary filter IDs used for testing */
@@ -2071,6 +2076,214 @@ error:
     return 1;
 } /* test_read_unallocated_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_chunks_multi
+ *
+ * Purpose:     Test the basic functionality of H5Dwrite_chunks and
+ *              H5Dread_chunks, on datasets with and without filters.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunks_multi(hid_t file)
+{
+    hid_t          dataspace = -1, dataset = -1;
+    hid_t          cparms = -1;
+    hsize_t        dims[2]       = {NX, NY};
+    hsize_t        maxdims[2]    = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t        chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    int            data[NX][NY];
+    int            chunks[NUM_CHUNKS][CHUNK_NX * CHUNK_NY];
+    int            check[NUM_CHUNKS][CHUNK_NX * CHUNK_NY];
+    hsize_t        offsets[NUM_CHUNKS][2];
+    const hsize_t *offset_ptrs[NUM_CHUNKS];
+    uint32_t       filters[NUM_CHUNKS];
+    size_t         sizes[NUM_CHUNKS];
+    const void *   wbufs[NUM_CHUNKS];
+    void *         rbufs[NUM_CHUNKS];
+    hsize_t        storage_size;
+    haddr_t        addr, prev_addr = HADDR_UNDEF;
+    unsigned       flt_msk;
+    herr_t         status;
+    int            i, j, k, n;
+
+    TESTING("basic functionality of H5Dwrite_chunks/H5Dread_chunks");
+
+    /* Create an unfiltered dataset */
+    if ((dataspace = H5Screate_simple(RANK, dims, maxdims)) < 0)
+        goto error;
+    if ((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+        goto error;
+    if ((dataset = H5Dcreate2(file, DATASETNAME13, H5T_NATIVE_INT, dataspace, H5P_DEFAULT, cparms,
+                              H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Set up all the chunks, listed in reverse order */
+    for (n = 0; n < NUM_CHUNKS; n++) {
+        int c = NUM_CHUNKS - 1 - n;
+
+        offsets[n][0]  = (hsize_t)(c / (NY / CHUNK_NY)) * CHUNK_NX;
+        offsets[n][1]  = (hsize_t)(c % (NY / CHUNK_NY)) * CHUNK_NY;
+        offset_ptrs[n] = offsets[n];
+        filters[n]     = 0;
+        sizes[n]       = sizeof(chunks[n]);
+        wbufs[n]       = chunks[n];
+        rbufs[n]       = check[n];
+        for (k = 0; k < CHUNK_NX * CHUNK_NY; k++)
+            chunks[n][k] = c * 1000 + k;
+    }
+
+    /* Write all the chunks at once */
+    if ((status = H5Dwrite_chunks(dataset, H5P_DEFAULT, NUM_CHUNKS, filters, offset_ptrs, sizes, wbufs)) < 0)
+        goto error;
+
+    /* Check the data through the usual path */
+    if (H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        goto error;
+    for (i = 0; i < NX; i++)
+        for (j = 0; j < NY; j++) {
+            int c = (i / CHUNK_NX) * (NY / CHUNK_NY) + (j / CHUNK_NY);
+
+            if (data[i][j] != c * 1000 + (i % CHUNK_NX) * CHUNK_NY + (j % CHUNK_NY)) {
+                HDprintf("\n    Read different values than written at %d,%d\n", i, j);
+                goto error;
+            }
+        }
+
+    /* The new chunks should have been laid out in the file in chunk order */
+    for (n = NUM_CHUNKS - 1; n >= 0; n--) {
+        if (H5Dget_chunk_info_by_coord(dataset, offsets[n], &flt_msk, &addr, &storage_size) < 0)
+            goto error;
+        if (prev_addr != HADDR_UNDEF && addr != prev_addr + sizeof(chunks[n])) {
+            HDprintf("\n    Chunks not stored next to each other\n");
+            goto error;
+        }
+        prev_addr = addr;
+    }
+
+    /* Read all the chunks back at once */
+    HDmemset(check, 0, sizeof(check));
+    for (n = 0; n < NUM_CHUNKS; n++)
+        filters[n] = UINT_MAX;
+    if ((status = H5Dread_chunks(dataset, H5P_DEFAULT, NUM_CHUNKS, offset_ptrs, filters, rbufs)) < 0)
+        goto error;
+    for (n = 0; n < NUM_CHUNKS; n++) {
+        if (filters[n] != 0)
+            goto error;
+        if (HDmemcmp(check[n], chunks[n], sizeof(chunks[n])) != 0) {
+            HDprintf("\n    Read different chunk than written\n");
+            goto error;
+        }
+    }
+
+    /* Overwrite every other chunk, with the chunk cached and dirty */
+    if (H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        goto error;
+    for (n = 0; n < NUM_CHUNKS / 2; n++) {
+        offset_ptrs[n] = offsets[2 * n];
+        wbufs[n]       = chunks[2 * n];
+        rbufs[n]       = check[2 * n];
+        filters[n]     = 0;
+        for (k = 0; k < CHUNK_NX * CHUNK_NY; k++)
+            chunks[2 * n][k] = -chunks[2 * n][k];
+    }
+    if ((status = H5Dwrite_chunks(dataset, H5P_DEFAULT, NUM_CHUNKS / 2, filters, offset_ptrs, sizes, wbufs)) <
+        0)
+        goto error;
+    HDmemset(check, 0, sizeof(check));
+    if ((status = H5Dread_chunks(dataset, H5P_DEFAULT, NUM_CHUNKS / 2, offset_ptrs, filters, rbufs)) < 0)
+        goto error;
+    for (n = 0; n < NUM_CHUNKS / 2; n++)
+        if (HDmemcmp(check[2 * n], chunks[2 * n], sizeof(chunks[2 * n])) != 0) {
+            HDprintf("\n    Read different chunk than overwritten\n");
+            goto error;
+        }
+
+    /* A chunk given twice, or an unfiltered chunk of the wrong size, should fail */
+    offset_ptrs[1] = offset_ptrs[0];
+    H5E_BEGIN_TRY
+    {
+        status = H5Dwrite_chunks(dataset, H5P_DEFAULT, 2, filters, offset_ptrs, sizes, wbufs);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        goto error;
+    sizes[0] = sizeof(chunks[0]) / 2;
+    H5E_BEGIN_TRY
+    {
+        status = H5Dwrite_chunks(dataset, H5P_DEFAULT, 1, filters, offset_ptrs, sizes, wbufs);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        goto error;
+
+    if (H5Dclose(dataset) < 0)
+        goto error;
+
+    /* Create a filtered dataset, where the chunks can be of any size */
+    if (H5Zregister(H5Z_BOGUS1) < 0)
+        goto error;
+    if (H5Pset_filter(cparms, H5Z_FILTER_BOGUS1, 0, (size_t)0, NULL) < 0)
+        goto error;
+    if ((dataset = H5Dcreate2(file, DATASETNAME14, H5T_NATIVE_INT, dataspace, H5P_DEFAULT, cparms,
+                              H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Write the chunks twice, growing or shrinking each chunk the second time */
+    for (i = 0; i < 2; i++) {
+        for (n = 0; n < NUM_CHUNKS; n++) {
+            offset_ptrs[n] = offsets[n];
+            filters[n]     = (uint32_t)n;
+            sizes[n]       = (size_t)(i == 0 ? n + 1 : NUM_CHUNKS - n) * sizeof(int);
+            wbufs[n]       = chunks[n];
+            rbufs[n]       = check[n];
+        }
+        if ((status = H5Dwrite_chunks(dataset, H5P_DEFAULT, NUM_CHUNKS, filters, offset_ptrs, sizes, wbufs)) <
+            0)
+            goto error;
+
+        HDmemset(check, 0, sizeof(check));
+        HDmemset(filters, 0, sizeof(filters));
+        if ((status = H5Dread_chunks(dataset, H5P_DEFAULT, NUM_CHUNKS, offset_ptrs, filters, rbufs)) < 0)
+            goto error;
+        for (n = 0; n < NUM_CHUNKS; n++) {
+            if (H5Dget_chunk_storage_size(dataset, offsets[n], &storage_size) < 0)
+                goto error;
+            if (storage_size != sizes[n] || filters[n] != (uint32_t)n)
+                goto error;
+            if (HDmemcmp(check[n], chunks[n], sizes[n]) != 0) {
+                HDprintf("\n    Read different filtered chunk than written\n");
+                goto error;
+            }
+        }
+    }
+
+    /* Close/release resources. */
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+    }
+    H5E_END_TRY;
+
+    H5_FAILED();
+    return 1;
+} /* test_direct_chunks_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_single_chunk
  *
@@ -2277,6 +2490,9 @@ main(void)
     nerrors += test_read_unfiltered_dset(file_id);
     nerrors += test_read_unallocated_chunk(file_id);
 
+    /* Test batched direct chunk write and read */
+    nerrors += test_direct_chunks_multi(file_id);
+
     /* Loop over test configurations */
     for (config = 0; config < CONFIG_END; config++) {
         hbool_t need_comma = FALSE;
@@ -83,6 +83,16 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "filter_threads",      /* 27 */
+                          "shared_chunk_cache",  /* 28 */
+                          "chunk_cache_policy",  /* 29 */
+                          "chunk_index_cache",   /* 30 */
+                          "multi_dset_io",       /* 31 */
+                          "coalesced_read",      /* 32 */
+                          "adaptive_sieve",      /* 33 */
+                          "chunk_alloc_batch",   /* 34 */
+                          "chunk_prefetch",      /* 35 */
+                          "filter_threads_edc",  /* 36 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -9291,6 +9301,2249 @@ error:
     return FAIL;
 } /* end test_big_chunks_bypass_cache() */
 
+/* Parameters for the filter threads test */
+#define FILTER_THREADS_DSET_NAME "filter_threads"
+#define FILTER_THREADS_DIM       96
+#define FILTER_THREADS_CHUNK_DIM 8
+#define FILTER_THREADS_NTHREADS  4
+
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_threads
+ *
+ * Purpose:     Tests the filter_threads property on a FAPL and checks
+ *              that data written and read through a filtered, chunked
+ *              dataset is unchanged when the filter pipeline runs on
+ *              several threads.  The chunk cache is kept small so that
+ *              chunks are encoded when evicted as well as at close.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_threads(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid           = -1; /* File ID */
+    hid_t    fapl_local    = -1; /* Local fapl */
+    hid_t    fapl2         = -1; /* fapl retrieved from the file */
+    hid_t    dcpl          = -1; /* Dataset creation property list ID */
+    hid_t    sid           = -1; /* Dataspace ID */
+    hid_t    mid           = -1; /* Memory dataspace ID */
+    hid_t    dsid          = -1; /* Dataset ID */
+    hsize_t  dims[2]       = {FILTER_THREADS_DIM, FILTER_THREADS_DIM};
+    hsize_t  chunk_dims[2] = {FILTER_THREADS_CHUNK_DIM, FILTER_THREADS_CHUNK_DIM};
+    hsize_t  start[2], count[2];
+    int *    wbuf   = NULL; /* Data written */
+    int *    rbuf   = NULL; /* Data read back */
+    int *    pbuf   = NULL; /* Partial write buffer */
+    size_t   nelmts = FILTER_THREADS_DIM * FILTER_THREADS_DIM;
+    size_t   nbytes; /* Chunk cache size */
+    unsigned nthreads; /* Number of filter threads */
+    size_t   u, v;
+
+    TESTING("chunk filter pipeline on several threads");
+
+    if (NULL == (wbuf = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (pbuf = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < nelmts; u++) {
+        wbuf[u] = (int)(u % 1000) - 500;
+        pbuf[u] = -(int)u;
+    }
+
+    /* Check the default and that zero threads is rejected */
+    if ((fapl_local = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_filter_threads(fapl_local, &nthreads) < 0)
+        FAIL_STACK_ERROR
+    if (nthreads != 1)
+        FAIL_PUTS_ERROR("    Default number of filter threads is not 1.")
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_filter_threads(fapl_local, 0) >= 0)
+            FAIL_PUTS_ERROR("    Zero filter threads was accepted.")
+    }
+    H5E_END_TRY;
+
+    /* Use several threads and a chunk cache that holds only a few chunks */
+    if (H5Pset_filter_threads(fapl_local, FILTER_THREADS_NTHREADS) < 0)
+        FAIL_STACK_ERROR
+    nbytes = 8 * FILTER_THREADS_CHUNK_DIM * FILTER_THREADS_CHUNK_DIM * sizeof(int);
+    if (H5Pset_cache(fapl_local, 0, (size_t)521, nbytes, 0.75) < 0)
+        FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+
+    /* The setting is reported back by the file */
+    if ((fapl2 = H5Fget_access_plist(fid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_filter_threads(fapl2, &nthreads) < 0)
+        FAIL_STACK_ERROR
+    if (nthreads != FILTER_THREADS_NTHREADS)
+        FAIL_PUTS_ERROR("    Number of filter threads not retrieved from file.")
+    if (H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR
+    fapl2 = -1;
+
+    /* Create a filtered, chunked dataset */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_shuffle(dcpl) < 0)
+        FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if (H5Pset_deflate(dcpl, 6) < 0)
+        FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if (H5Pset_fletcher32(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid = H5Dcreate2(fid, FILTER_THREADS_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl,
+                           H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the whole dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Overwrite a block that covers only part of most of the chunks it
+     * touches, so those chunks are read back and decoded first.
+     */
+    start[0] = 3;
+    start[1] = 5;
+    count[0] = FILTER_THREADS_DIM - 10;
+    count[1] = FILTER_THREADS_DIM - 20;
+    if ((mid = H5Screate_simple(2, count, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, pbuf) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < count[0]; u++)
+        for (v = 0; v < count[1]; v++)
+            wbuf[(start[0] + u) * FILTER_THREADS_DIM + start[1] + v] = pbuf[u * count[1] + v];
+
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Reopen the file and read everything back */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid = H5Dopen2(fid, FILTER_THREADS_DSET_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < nelmts; u++)
+        if (rbuf[u] != wbuf[u]) {
+            HDprintf("    Read different values than written at element %zu: %d != %d\n", u, rbuf[u],
+                     wbuf[u]);
+            TEST_ERROR
+        }
+
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(fapl_local) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(pbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Fclose(fid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(fapl2);
+        H5Pclose(fapl_local);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(pbuf);
+    return FAIL;
+} /* end test_filter_threads() */
+
+/* Parameters for the filter threads checksum test */
+#define FILTER_THREADS_EDC_DSET_NAME "filter_threads_edc"
+#define FILTER_THREADS_EDC_NREADS    10
+#define FILTER_THREADS_EDC_RAW_SIZE  (FILTER_THREADS_CHUNK_DIM * FILTER_THREADS_CHUNK_DIM * sizeof(int) + 4)
+
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_threads_edc_cb
+ *
+ * Purpose:     H5Ewalk2() callback for test_filter_threads_edc(): counts
+ *              the error records and notes a Fletcher32 checksum failure.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_threads_edc_cb(unsigned H5_ATTR_UNUSED n, const H5E_error2_t *err_desc, void *_found)
+{
+    unsigned *found = (unsigned *)_found;
+
+    found[0]++;
+    if (err_desc->maj_num == H5E_STORAGE && err_desc->min_num == H5E_READERROR)
+        found[1]++;
+
+    return 0;
+} /* end test_filter_threads_edc_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_threads_edc
+ *
+ * Purpose:     Tests reading a dataset whose Fletcher32 checksums fail in
+ *              many chunks while the filter pipeline runs on several
+ *              threads: every read must fail cleanly, with the checksum
+ *              error on the error stack, and the library's error classes
+ *              and messages must be intact afterwards.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_threads_edc(hid_t fapl)
+{
+    char          filename[FILENAME_BUF_SIZE];
+    char          msg[64];                          /* Error message text */
+    hid_t         fid           = -1;               /* File ID */
+    hid_t         fapl_local    = -1;               /* Local fapl */
+    hid_t         dcpl          = -1;               /* Dataset creation property list ID */
+    hid_t         dxpl          = -1;               /* Dataset transfer property list ID */
+    hid_t         sid           = -1;               /* Dataspace ID */
+    hid_t         dsid          = -1;               /* Dataset ID */
+    hid_t         estack        = -1;               /* Error stack ID */
+    hsize_t       dims[2]       = {FILTER_THREADS_DIM, FILTER_THREADS_DIM};
+    hsize_t       chunk_dims[2] = {FILTER_THREADS_CHUNK_DIM, FILTER_THREADS_CHUNK_DIM};
+    hsize_t       offset[2];                        /* Chunk offset */
+    hsize_t       raw_size;                         /* Size of a chunk in the file */
+    unsigned      filter_mask;                      /* Filters skipped for a chunk */
+    unsigned      found[2];                         /* # of error records, # of checksum failures */
+    unsigned char raw[FILTER_THREADS_EDC_RAW_SIZE]; /* Chunk as stored in the file */
+    int *         wbuf   = NULL;                    /* Data written */
+    int *         rbuf   = NULL;                    /* Data read back */
+    size_t        nelmts = FILTER_THREADS_DIM * FILTER_THREADS_DIM;
+    size_t        nbad   = 0; /* # of corrupted elements read */
+    size_t        u, v;
+    herr_t        status;
+
+    TESTING("checksum failures on several filter threads");
+
+    if (NULL == (wbuf = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < nelmts; u++)
+        wbuf[u] = (int)u;
+
+    if ((fapl_local = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_filter_threads(fapl_local, FILTER_THREADS_NTHREADS) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a dataset filtered with Fletcher32 only, so its chunks are
+     * easy to corrupt
+     */
+    h5_fixname(FILENAME[36], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fletcher32(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid = H5Dcreate2(fid, FILTER_THREADS_EDC_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl,
+                           H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Flip the first data byte of every other chunk, leaving the stored
+     * checksum alone
+     */
+    for (u = 0; u < FILTER_THREADS_DIM / FILTER_THREADS_CHUNK_DIM; u++)
+        for (v = u % 2; v < FILTER_THREADS_DIM / FILTER_THREADS_CHUNK_DIM; v += 2) {
+            offset[0] = u * FILTER_THREADS_CHUNK_DIM;
+            offset[1] = v * FILTER_THREADS_CHUNK_DIM;
+            if (H5Dget_chunk_storage_size(dsid, offset, &raw_size) < 0)
+                FAIL_STACK_ERROR
+            if (raw_size != sizeof(raw))
+                FAIL_PUTS_ERROR("    Unexpected size of a chunk in the file.")
+            if (H5Dread_chunk(dsid, H5P_DEFAULT, offset, &filter_mask, raw) < 0)
+                FAIL_STACK_ERROR
+            raw[0] ^= 0xff;
+            if (H5Dwrite_chunk(dsid, H5P_DEFAULT, filter_mask, offset, sizeof(raw), raw) < 0)
+                FAIL_STACK_ERROR
+            nbad++;
+        } /* end for */
+
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Reopen the file and read the dataset, several times over, so that
+     * checksums fail on several threads at once
+     */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid = H5Dopen2(fid, FILTER_THREADS_EDC_DSET_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < FILTER_THREADS_EDC_NREADS; u++) {
+        H5E_BEGIN_TRY
+        {
+            status = H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+        }
+        H5E_END_TRY;
+        if (status >= 0)
+            FAIL_PUTS_ERROR("    Read of corrupted chunks succeeded.")
+
+        /* The failure is reported once, by the serial pipeline */
+        if ((estack = H5Eget_current_stack()) < 0)
+            FAIL_STACK_ERROR
+        found[0] = found[1] = 0;
+        if (H5Ewalk2(estack, H5E_WALK_DOWNWARD, test_filter_threads_edc_cb, found) < 0)
+            FAIL_STACK_ERROR
+        if (H5Eclose_stack(estack) < 0)
+            FAIL_STACK_ERROR
+        estack = -1;
+        if (found[1] != 1)
+            FAIL_PUTS_ERROR("    Checksum failure not reported once on the error stack.")
+        if (found[0] > 16)
+            FAIL_PUTS_ERROR("    Too many records on the error stack.")
+    } /* end for */
+
+    /* The library's own error class and messages are still usable */
+    if (H5Eget_class_name(H5E_ERR_CLS, msg, sizeof(msg)) <= 0)
+        FAIL_STACK_ERROR
+    if (H5Eget_msg(H5E_READERROR, NULL, msg, sizeof(msg)) <= 0)
+        FAIL_STACK_ERROR
+    if (H5Eget_msg(H5E_STORAGE, NULL, msg, sizeof(msg)) <= 0)
+        FAIL_STACK_ERROR
+
+    /* With error detection off the data is read, corrupted where the
+     * chunks were changed
+     */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_edc_check(dxpl, H5Z_DISABLE_EDC) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < nelmts; u++)
+        if (rbuf[u] != wbuf[u])
+            nbad--;
+    if (nbad != 0)
+        FAIL_PUTS_ERROR("    Read unexpected data with error detection off.")
+
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dxpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(fapl_local) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Eclose_stack(estack);
+        H5Dclose(dsid);
+        H5Fclose(fid);
+        H5Sclose(sid);
+        H5Pclose(dxpl);
+        H5Pclose(dcpl);
+        H5Pclose(fapl_local);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_filter_threads_edc() */
+
+/* Parameters for the shared chunk cache test */
+#define SHARED_CACHE_NDSETS     8
+#define SHARED_CACHE_DIM        32
+#define SHARED_CACHE_CHUNK_DIM  8
+#define SHARED_CACHE_NCHUNKS    4
+#define SHARED_CACHE_CHUNK_SIZE (SHARED_CACHE_CHUNK_DIM * SHARED_CACHE_CHUNK_DIM * sizeof(int))
+
+/*-------------------------------------------------------------------------
+ * Function:    test_shared_chunk_cache
+ *
+ * Purpose:     Tests a chunk cache shared by all the datasets of a file:
+ *              the FAPL property, the cache's statistics, preemption of
+ *              one dataset's chunks by another's, and that a dataset with
+ *              chunk cache settings of its own keeps a private cache.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_shared_chunk_cache(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    char     dset_name[32];
+    hid_t    fid        = -1; /* File ID */
+    hid_t    fapl_local = -1; /* Local fapl */
+    hid_t    fapl2      = -1; /* fapl retrieved from the file */
+    hid_t    dcpl       = -1; /* Dataset creation property list ID */
+    hid_t    dapl       = -1; /* Dataset access property list ID */
+    hid_t    sid        = -1; /* Dataspace ID */
+    hid_t    mid        = -1; /* Memory dataspace ID for one row */
+    hid_t    dsid[SHARED_CACHE_NDSETS + 1];
+    hsize_t  dims[2]       = {SHARED_CACHE_DIM, SHARED_CACHE_DIM};
+    hsize_t  chunk_dims[2] = {SHARED_CACHE_CHUNK_DIM, SHARED_CACHE_CHUNK_DIM};
+    hsize_t  row_dims[1]   = {SHARED_CACHE_DIM};
+    hsize_t  start[2], count[2];
+    int *    wbuf   = NULL; /* Data written */
+    int *    rbuf   = NULL; /* Data read back */
+    size_t   budget = SHARED_CACHE_NCHUNKS * SHARED_CACHE_CHUNK_SIZE;
+    size_t   nbytes;                    /* Shared chunk cache size */
+    size_t   nbytes_used, nchunks;      /* Current contents of the shared cache */
+    unsigned hits, misses, evictions;   /* Shared cache statistics */
+    unsigned i, j, k;
+
+    TESTING("chunk cache shared by a file's datasets");
+
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * SHARED_CACHE_DIM * SHARED_CACHE_DIM)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * SHARED_CACHE_DIM * SHARED_CACHE_DIM)))
+        TEST_ERROR
+
+    for (i = 0; i <= SHARED_CACHE_NDSETS; i++)
+        dsid[i] = -1;
+
+    /* Check the default */
+    if ((fapl_local = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_shared_chunk_cache(fapl_local, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (nbytes != 0)
+        FAIL_PUTS_ERROR("    Shared chunk cache is enabled by default.")
+
+    /* A file without a shared cache has no statistics */
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        if (H5Fget_shared_chunk_cache_stats(fid, &hits, &misses, &evictions, &nbytes_used, &nchunks) >= 0)
+            FAIL_PUTS_ERROR("    Got shared chunk cache statistics from a file without the cache.")
+    }
+    H5E_END_TRY;
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    fid = -1;
+
+    /* Share a cache that holds only a few chunks */
+    if (H5Pset_shared_chunk_cache(fapl_local, budget) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_shared_chunk_cache(fapl_local, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (nbytes != budget)
+        FAIL_PUTS_ERROR("    Shared chunk cache size not retrieved from fapl.")
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+
+    /* The setting is reported back by the file */
+    if ((fapl2 = H5Fget_access_plist(fid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_shared_chunk_cache(fapl2, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (nbytes != budget)
+        FAIL_PUTS_ERROR("    Shared chunk cache size not retrieved from file.")
+    if (H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR
+    fapl2 = -1;
+
+    /* Nothing has used the cache yet */
+    if (H5Fget_shared_chunk_cache_stats(fid, &hits, &misses, &evictions, &nbytes_used, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (hits != 0 || misses != 0 || evictions != 0 || nbytes_used != 0 || nchunks != 0)
+        FAIL_PUTS_ERROR("    Unused shared chunk cache has nonzero statistics.")
+
+    /* Create the datasets, the last one with a chunk cache of its own */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((mid = H5Screate_simple(1, row_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)521, 16 * SHARED_CACHE_CHUNK_SIZE, 0.75) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i <= SHARED_CACHE_NDSETS; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", i);
+        if ((dsid[i] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl,
+                                  i < SHARED_CACHE_NDSETS ? H5P_DEFAULT : dapl)) < 0)
+            FAIL_STACK_ERROR
+    }
+
+    /* Write the datasets one row at a time, so each chunk is accessed
+     * several times while it is cached and the dirty chunks of each dataset
+     * are preempted by the next one's */
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = SHARED_CACHE_DIM;
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+        for (j = 0; j < SHARED_CACHE_DIM; j++) {
+            start[0] = j;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            for (k = 0; k < SHARED_CACHE_DIM; k++)
+                wbuf[j * SHARED_CACHE_DIM + k] = (int)(i * 10000 + j * SHARED_CACHE_DIM + k);
+            if (H5Dwrite(dsid[i], H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, wbuf + j * SHARED_CACHE_DIM) < 0)
+                FAIL_STACK_ERROR
+        }
+
+    /* The chunks of all the datasets share the cache's budget */
+    if (H5Fget_shared_chunk_cache_stats(fid, &hits, &misses, &evictions, &nbytes_used, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (hits == 0 || misses == 0 || evictions == 0)
+        FAIL_PUTS_ERROR("    Shared chunk cache statistics not counted.")
+    if (nbytes_used > budget || nchunks > SHARED_CACHE_NCHUNKS ||
+        nbytes_used != nchunks * SHARED_CACHE_CHUNK_SIZE)
+        FAIL_PUTS_ERROR("    Shared chunk cache holds more than its budget.")
+
+    /* Reset the statistics */
+    if (H5Freset_shared_chunk_cache_stats(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fget_shared_chunk_cache_stats(fid, &hits, &misses, &evictions, NULL, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (hits != 0 || misses != 0 || evictions != 0)
+        FAIL_PUTS_ERROR("    Shared chunk cache statistics not reset.")
+
+    /* The dataset with its own cache doesn't use the shared one */
+    HDmemset(wbuf, 0, sizeof(int) * SHARED_CACHE_DIM * SHARED_CACHE_DIM);
+    if (H5Dwrite(dsid[SHARED_CACHE_NDSETS], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fget_shared_chunk_cache_stats(fid, &hits, &misses, &evictions, NULL, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (hits != 0 || misses != 0 || evictions != 0)
+        FAIL_PUTS_ERROR("    Dataset with its own chunk cache used the shared cache.")
+
+    /* Read the datasets back while the file is open */
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+        if (H5Dread(dsid[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (j = 0; j < SHARED_CACHE_DIM; j++)
+            for (k = 0; k < SHARED_CACHE_DIM; k++)
+                if (rbuf[j * SHARED_CACHE_DIM + k] != (int)(i * 10000 + j * SHARED_CACHE_DIM + k)) {
+                    HDprintf("    Read different values than written in dataset %u at (%u, %u)\n", i, j, k);
+                    TEST_ERROR
+                }
+    }
+
+    for (i = 0; i <= SHARED_CACHE_NDSETS; i++) {
+        if (H5Dclose(dsid[i]) < 0)
+            FAIL_STACK_ERROR
+        dsid[i] = -1;
+    }
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file and check the data reached it */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_local)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", i);
+        if ((dsid[i] = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+    }
+    /* Read them one row at a time, so the chunks are read through the cache
+     * rather than around it */
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+        for (j = 0; j < SHARED_CACHE_DIM; j++) {
+            start[0] = j;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dread(dsid[i], H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf + j * SHARED_CACHE_DIM) < 0)
+                FAIL_STACK_ERROR
+            for (k = 0; k < SHARED_CACHE_DIM; k++)
+                if (rbuf[j * SHARED_CACHE_DIM + k] != (int)(i * 10000 + j * SHARED_CACHE_DIM + k)) {
+                    HDprintf("    Read different values than written in dataset %u at (%u, %u)\n", i, j, k);
+                    TEST_ERROR
+                }
+        }
+    if (H5Fget_shared_chunk_cache_stats(fid, &hits, &misses, &evictions, &nbytes_used, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (misses == 0 || evictions == 0 || nbytes_used > budget)
+        FAIL_PUTS_ERROR("    Unexpected shared chunk cache statistics after reading.")
+
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+        if (H5Dclose(dsid[i]) < 0)
+            FAIL_STACK_ERROR
+        dsid[i] = -1;
+    }
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(fapl_local) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i <= SHARED_CACHE_NDSETS; i++)
+            H5Dclose(dsid[i]);
+        H5Fclose(fid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Pclose(fapl2);
+        H5Pclose(fapl_local);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_shared_chunk_cache() */
+
+#define CACHE_POLICY_NPOLICIES  4
+#define CACHE_POLICY_DIM        32
+#define CACHE_POLICY_CHUNK_DIM  8
+#define CACHE_POLICY_NCHUNKS    16
+#define CACHE_POLICY_CHUNK_SIZE (CACHE_POLICY_CHUNK_DIM * CACHE_POLICY_CHUNK_DIM * sizeof(int))
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_cache_policy
+ *
+ * Purpose:     Tests the chunk cache replacement policies and the
+ *              per-dataset chunk cache statistics: the DAPL property,
+ *              that the open hash table of a policy doesn't preempt
+ *              chunks on collisions, which chunk each policy preempts
+ *              when the cache is full, and that dirty chunks preempted
+ *              under each policy reach the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_cache_policy(hid_t fapl)
+{
+    const H5D_chunk_cache_policy_t policies[CACHE_POLICY_NPOLICIES] = {
+        H5D_CHUNK_CACHE_POLICY_DEFAULT, H5D_CHUNK_CACHE_POLICY_LRU, H5D_CHUNK_CACHE_POLICY_CLOCK,
+        H5D_CHUNK_CACHE_POLICY_LFU};
+    char                     filename[FILENAME_BUF_SIZE];
+    char                     dset_name[32];
+    hid_t                    fid  = -1; /* File ID */
+    hid_t                    dcpl = -1; /* Dataset creation property list ID */
+    hid_t                    dapl = -1; /* Dataset access property list ID */
+    hid_t                    sid  = -1; /* Dataspace ID */
+    hid_t                    mid  = -1; /* Memory dataspace ID for one row */
+    hid_t                    cmid = -1; /* Memory dataspace ID for one chunk */
+    hid_t                    dsid = -1; /* Dataset ID */
+    hsize_t                  dims[2]       = {CACHE_POLICY_DIM, CACHE_POLICY_DIM};
+    hsize_t                  chunk_dims[2] = {CACHE_POLICY_CHUNK_DIM, CACHE_POLICY_CHUNK_DIM};
+    hsize_t                  row_dims[1]   = {CACHE_POLICY_DIM};
+    hsize_t                  start[2], count[2];
+    int                      row[CACHE_POLICY_DIM];                                /* One row of data */
+    int *                    rbuf = NULL;                                           /* Data read back */
+    int                      cbuf[CACHE_POLICY_CHUNK_DIM * CACHE_POLICY_CHUNK_DIM]; /* One chunk */
+    H5D_chunk_cache_policy_t policy;                  /* Policy retrieved */
+    unsigned                 hits, misses, evictions; /* Dataset's chunk cache statistics */
+    unsigned                 p, i, j, k;
+    herr_t                   ret;
+
+    TESTING("chunk cache replacement policies");
+
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * CACHE_POLICY_DIM * CACHE_POLICY_DIM)))
+        TEST_ERROR
+
+    /* Check the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_cache_policy(dapl, &policy) < 0)
+        FAIL_STACK_ERROR
+    if (policy != H5D_CHUNK_CACHE_POLICY_DEFAULT)
+        FAIL_PUTS_ERROR("    Wrong default chunk cache policy.")
+    if (H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_LFU) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_cache_policy(dapl, &policy) < 0)
+        FAIL_STACK_ERROR
+    if (policy != H5D_CHUNK_CACHE_POLICY_LFU)
+        FAIL_PUTS_ERROR("    Chunk cache policy not retrieved from dapl.")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_NPOLICIES);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("    Set an invalid chunk cache policy.")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_ERROR);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("    Set an invalid chunk cache policy.")
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((mid = H5Screate_simple(1, row_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((cmid = H5Screate_simple(2, chunk_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    /* A contiguous dataset has no chunk cache statistics */
+    if ((dsid = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dget_chunk_cache_stats(dsid, &hits, &misses, &evictions);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("    Got chunk cache statistics of a contiguous dataset.")
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+    dsid = -1;
+
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write a dataset per policy one row at a time, with a single hash slot
+     * and room for all the chunks: the chunks of a row only preempt each
+     * other with the default policy */
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = CACHE_POLICY_DIM;
+    for (p = 0; p < CACHE_POLICY_NPOLICIES; p++) {
+        if (H5Pset_chunk_cache(dapl, (size_t)1, CACHE_POLICY_NCHUNKS * CACHE_POLICY_CHUNK_SIZE, 0.75) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk_cache_policy(dapl, policies[p]) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", p);
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        for (j = 0; j < CACHE_POLICY_DIM; j++) {
+            start[0] = j;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            for (k = 0; k < CACHE_POLICY_DIM; k++)
+                row[k] = (int)(p * 10000 + j * CACHE_POLICY_DIM + k);
+            if (H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, row) < 0)
+                FAIL_STACK_ERROR
+        }
+
+        if (H5Dget_chunk_cache_stats(dsid, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (misses == 0)
+            FAIL_PUTS_ERROR("    Chunk cache statistics not counted.")
+        if (policies[p] == H5D_CHUNK_CACHE_POLICY_DEFAULT) {
+            if (evictions == 0)
+                FAIL_PUTS_ERROR("    No chunks preempted by collisions in a single slot.")
+        }
+        else if (hits == 0 || evictions != 0)
+            FAIL_PUTS_ERROR("    Chunks preempted although the cache had room for them.")
+
+        /* Reset the statistics */
+        if (H5Dreset_chunk_cache_stats(dsid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_chunk_cache_stats(dsid, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (hits != 0 || misses != 0 || evictions != 0)
+            FAIL_PUTS_ERROR("    Chunk cache statistics not reset.")
+
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        dsid = -1;
+    }
+
+    /* With room for two chunks, use one chunk four times and then two others
+     * once each before coming back to the first: LRU preempts it while CLOCK
+     * and LFU preempt the second chunk instead */
+    count[0] = CACHE_POLICY_CHUNK_DIM;
+    count[1] = CACHE_POLICY_CHUNK_DIM;
+    start[0] = 0;
+    for (p = 1; p < CACHE_POLICY_NPOLICIES; p++) {
+        const hsize_t chunk_col[7] = {0, 0, 0, 0, 1, 2, 0};
+
+        if (H5Pset_chunk_cache(dapl, (size_t)1, 2 * CACHE_POLICY_CHUNK_SIZE, 0.75) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk_cache_policy(dapl, policies[p]) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", p);
+        if ((dsid = H5Dopen2(fid, dset_name, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        for (i = 0; i < 7; i++) {
+            start[1] = chunk_col[i] * CACHE_POLICY_CHUNK_DIM;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dread(dsid, H5T_NATIVE_INT, cmid, sid, H5P_DEFAULT, cbuf) < 0)
+                FAIL_STACK_ERROR
+            if (cbuf[0] != (int)(p * 10000 + start[1]))
+                FAIL_PUTS_ERROR("    Read different values than written.")
+        }
+
+        if (H5Dget_chunk_cache_stats(dsid, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (policies[p] == H5D_CHUNK_CACHE_POLICY_LRU) {
+            if (hits != 3 || misses != 4 || evictions != 2)
+                FAIL_PUTS_ERROR("    LRU policy preempted the wrong chunk.")
+        }
+        else if (hits != 4 || misses != 3 || evictions != 1)
+            FAIL_PUTS_ERROR("    CLOCK or LFU policy preempted the wrong chunk.")
+
+        /* Overwrite the dataset one row at a time, so dirty chunks are
+         * preempted */
+        count[0] = 1;
+        count[1] = CACHE_POLICY_DIM;
+        start[1] = 0;
+        for (j = 0; j < CACHE_POLICY_DIM; j++) {
+            start[0] = j;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            for (k = 0; k < CACHE_POLICY_DIM; k++)
+                row[k] = -(int)(p * 10000 + j * CACHE_POLICY_DIM + k);
+            if (H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, row) < 0)
+                FAIL_STACK_ERROR
+        }
+        count[0] = CACHE_POLICY_CHUNK_DIM;
+        count[1] = CACHE_POLICY_CHUNK_DIM;
+        start[0] = 0;
+
+        if (H5Dget_chunk_cache_stats(dsid, NULL, NULL, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (evictions <= 2)
+            FAIL_PUTS_ERROR("    No chunks preempted from a full cache.")
+
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        dsid = -1;
+    }
+
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file and check the data reached it */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    for (p = 0; p < CACHE_POLICY_NPOLICIES; p++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", p);
+        if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (j = 0; j < CACHE_POLICY_DIM; j++)
+            for (k = 0; k < CACHE_POLICY_DIM; k++)
+                if (rbuf[j * CACHE_POLICY_DIM + k] !=
+                    (p ? -1 : 1) * (int)(p * 10000 + j * CACHE_POLICY_DIM + k)) {
+                    HDprintf("    Read different values than written in dataset %u at (%u, %u)\n", p, j, k);
+                    TEST_ERROR
+                }
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        dsid = -1;
+    }
+
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(cmid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Fclose(fid);
+        H5Sclose(cmid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY;
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_cache_policy() */
+
+#define IDX_CACHE_NDSETS    3
+#define IDX_CACHE_DIM       32
+#define IDX_CACHE_CHUNK_DIM 4
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_index_cache
+ *
+ * Purpose:     Tests keeping the chunk index in memory: the DAPL property,
+ *              and that lookups answered from the in-memory index stay
+ *              correct while chunks are written after it was read and
+ *              removed by shrinking the dataset, for datasets with no,
+ *              one and two unlimited dimensions (i.e. each chunk index
+ *              type with the latest format).
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_index_cache(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    char    dset_name[32];
+    hid_t   fid  = -1; /* File ID */
+    hid_t   dcpl = -1; /* Dataset creation property list ID */
+    hid_t   dapl = -1; /* Dataset access property list ID */
+    hid_t   sid  = -1; /* Dataspace ID */
+    hid_t   mid  = -1; /* Memory dataspace ID for one row */
+    hid_t   dsid = -1; /* Dataset ID */
+    hsize_t dims[2]       = {IDX_CACHE_DIM, IDX_CACHE_DIM};
+    hsize_t half_dims[2]  = {IDX_CACHE_DIM / 2, IDX_CACHE_DIM};
+    hsize_t chunk_dims[2] = {IDX_CACHE_CHUNK_DIM, IDX_CACHE_CHUNK_DIM};
+    hsize_t row_dims[1]   = {IDX_CACHE_DIM};
+    hsize_t max_dims[IDX_CACHE_NDSETS][2] = {
+        {IDX_CACHE_DIM, IDX_CACHE_DIM}, {H5S_UNLIMITED, IDX_CACHE_DIM}, {H5S_UNLIMITED, H5S_UNLIMITED}};
+    hsize_t start[2], count[2];
+    int     row[IDX_CACHE_DIM]; /* One row of data */
+    int *   rbuf = NULL;        /* Data read back */
+    int     val;                /* Value read before writing */
+    hbool_t in_memory;          /* Option retrieved */
+    unsigned d, j, k;
+
+    TESTING("in-memory chunk index");
+
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * IDX_CACHE_DIM * IDX_CACHE_DIM)))
+        TEST_ERROR
+
+    /* Check the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_index_cache(dapl, &in_memory) < 0)
+        FAIL_STACK_ERROR
+    if (in_memory)
+        FAIL_PUTS_ERROR("    Chunk index kept in memory by default.")
+    if (H5Pset_chunk_index_cache(dapl, TRUE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_index_cache(dapl, &in_memory) < 0)
+        FAIL_STACK_ERROR
+    if (!in_memory)
+        FAIL_PUTS_ERROR("    In-memory chunk index option not retrieved from dapl.")
+
+    /* Disable the chunk cache, so every chunk access looks the chunk up */
+    if (H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((mid = H5Screate_simple(1, row_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fletcher32(dcpl) < 0)
+        FAIL_STACK_ERROR
+
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = IDX_CACHE_DIM;
+    for (d = 0; d < IDX_CACHE_NDSETS; d++) {
+        if ((sid = H5Screate_simple(2, dims, max_dims[d])) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", d);
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read an element before anything is written, which reads the
+         * (empty) index into memory */
+        start[0] = 0;
+        if (H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)1, start) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_SCALAR, sid, H5P_DEFAULT, &val) < 0)
+            FAIL_STACK_ERROR
+        if (val != 0)
+            FAIL_PUTS_ERROR("    Read a value from an unwritten chunk.")
+
+        /* Write the rows, last to first */
+        for (j = IDX_CACHE_DIM; j > 0; j--) {
+            start[0] = j - 1;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            for (k = 0; k < IDX_CACHE_DIM; k++)
+                row[k] = (int)(d * 10000 + (j - 1) * IDX_CACHE_DIM + k + 1);
+            if (H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, row) < 0)
+                FAIL_STACK_ERROR
+        }
+
+        /* Read the data back */
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (j = 0; j < IDX_CACHE_DIM; j++)
+            for (k = 0; k < IDX_CACHE_DIM; k++)
+                if (rbuf[j * IDX_CACHE_DIM + k] != (int)(d * 10000 + j * IDX_CACHE_DIM + k + 1)) {
+                    HDprintf("    Read different values than written in dataset %u at (%u, %u)\n", d, j, k);
+                    TEST_ERROR
+                }
+
+        /* Shrink and re-extend an extendible dataset: the removed chunks
+         * must read back as fill values */
+        if (d > 0) {
+            if (H5Dset_extent(dsid, half_dims) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dset_extent(dsid, dims) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for (j = 0; j < IDX_CACHE_DIM; j++)
+                for (k = 0; k < IDX_CACHE_DIM; k++) {
+                    val = j < IDX_CACHE_DIM / 2 ? (int)(d * 10000 + j * IDX_CACHE_DIM + k + 1) : 0;
+                    if (rbuf[j * IDX_CACHE_DIM + k] != val) {
+                        HDprintf("    Read wrong value after shrinking dataset %u at (%u, %u)\n", d, j, k);
+                        TEST_ERROR
+                    }
+                }
+        }
+
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        dsid = -1;
+        if (H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+        sid = -1;
+    }
+
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file and check the index on disk matches, with and
+     * without the in-memory index */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    for (d = 0; d < 2 * IDX_CACHE_NDSETS; d++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", d / 2);
+        if ((dsid = H5Dopen2(fid, dset_name, (d % 2) ? dapl : H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (j = 0; j < IDX_CACHE_DIM; j++)
+            for (k = 0; k < IDX_CACHE_DIM; k++) {
+                /* Only the extendible datasets were shrunk */
+                if (j < IDX_CACHE_DIM / 2 || d / 2 == 0)
+                    val = (int)((d / 2) * 10000 + j * IDX_CACHE_DIM + k + 1);
+                else
+                    val = 0;
+                if (rbuf[j * IDX_CACHE_DIM + k] != val) {
+                    HDprintf("    Read wrong value in dataset %u at (%u, %u)\n", d / 2, j, k);
+                    TEST_ERROR
+                }
+            }
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        dsid = -1;
+    }
+
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Fclose(fid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY;
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_index_cache() */
+
+#define MULTI_DIM       32
+#define MULTI_CHUNK_DIM 8
+#define MULTI_NDSETS    4
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests H5Dread_multi() and H5Dwrite_multi() across
+ *              contiguous and chunked datasets, with and without the
+ *              chunk cache and with datatype conversion, including a
+ *              dataset that appears twice in one write and a sieve
+ *              buffer left dirty by an earlier H5Dwrite().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_dset_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid  = -1;                                /* File ID */
+    hid_t       dcpl = -1;                                /* Dataset creation property list ID */
+    hid_t       dapl = -1;                                /* Dataset access property list ID */
+    hid_t       sid  = -1;                                /* Dataspace ID */
+    hid_t       hid  = -1;                                /* Dataspace ID for half of a dataset */
+    hid_t       pid  = -1;                                /* Dataspace ID for one element */
+    hid_t       dsid[MULTI_NDSETS] = {-1, -1, -1, -1};    /* Dataset IDs */
+    hid_t       multi_dsid[MULTI_NDSETS + 1];             /* Dataset IDs for each operation */
+    hid_t       mem_type[MULTI_NDSETS + 1];               /* Memory datatypes for each operation */
+    hid_t       mem_space[MULTI_NDSETS + 1];              /* Memory dataspaces for each operation */
+    hid_t       file_space[MULTI_NDSETS + 1];             /* File dataspaces for each operation */
+    const void *wbufs[MULTI_NDSETS + 1];                  /* Buffers to write */
+    void *      rbufs[MULTI_NDSETS];                      /* Buffers to read into */
+    int *       wbuf = NULL;                              /* Data written */
+    int *       rbuf = NULL;                              /* Data read back */
+    hsize_t     dims[2]       = {MULTI_DIM, MULTI_DIM};
+    hsize_t     half_dims[2]  = {MULTI_DIM / 2, MULTI_DIM};
+    hsize_t     chunk_dims[2] = {MULTI_CHUNK_DIM, MULTI_CHUNK_DIM};
+    hsize_t     start[2]      = {1, 1};
+    hsize_t     count[2]      = {1, 1};
+    int         val;
+    unsigned    d, j;
+
+    TESTING("multi-dataset I/O");
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((hid = H5Screate_simple(2, half_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((pid = H5Screate_simple(2, count, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    /* A contiguous dataset, a chunked dataset with and without the chunk
+     * cache, and a contiguous dataset whose file datatype needs conversion
+     */
+    if ((dsid[0] = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        FAIL_STACK_ERROR
+    if ((dsid[1] = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid[2] = H5Dcreate2(fid, "chunked_nocache", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid[3] = H5Dcreate2(fid, "conv", H5T_STD_I64BE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    if (NULL == (wbuf = (int *)HDmalloc((MULTI_NDSETS + 1) * MULTI_DIM * MULTI_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(MULTI_NDSETS * MULTI_DIM * MULTI_DIM * sizeof(int))))
+        TEST_ERROR
+    for (d = 0; d < MULTI_NDSETS + 1; d++)
+        for (j = 0; j < MULTI_DIM * MULTI_DIM; j++)
+            wbuf[d * MULTI_DIM * MULTI_DIM + j] = (int)(d * 10000 + j + 1);
+
+    /* Leave a dirty element in the contiguous dataset's sieve buffer */
+    val = -1;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dsid[0], H5T_NATIVE_INT, pid, sid, H5P_DEFAULT, &val) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write all the datasets, then the first half of the contiguous one again */
+    start[0] = start[1] = 0;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, half_dims, NULL) < 0)
+        FAIL_STACK_ERROR
+    for (d = 0; d < MULTI_NDSETS + 1; d++) {
+        multi_dsid[d] = dsid[d % MULTI_NDSETS];
+        mem_type[d]   = H5T_NATIVE_INT;
+        mem_space[d]  = d < MULTI_NDSETS ? H5S_ALL : hid;
+        file_space[d] = d < MULTI_NDSETS ? H5S_ALL : sid;
+        wbufs[d]      = wbuf + d * MULTI_DIM * MULTI_DIM;
+    }
+    if (H5Dwrite_multi((size_t)(MULTI_NDSETS + 1), multi_dsid, mem_type, mem_space, file_space, H5P_DEFAULT,
+                       wbufs) < 0)
+        FAIL_STACK_ERROR
+
+    /* The element in the sieve buffer was overwritten */
+    start[0] = start[1] = 1;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(dsid[0], H5T_NATIVE_INT, pid, sid, H5P_DEFAULT, &val) < 0)
+        FAIL_STACK_ERROR
+    if (val != MULTI_NDSETS * 10000 + MULTI_DIM + 2)
+        FAIL_PUTS_ERROR("    Stale sieve buffer read after multi-dataset write.")
+
+    /* An empty operation does nothing */
+    if (H5Dread_multi((size_t)0, NULL, NULL, NULL, NULL, H5P_DEFAULT, NULL) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read all the datasets back, before and after reopening the file */
+    for (j = 0; j < 2; j++) {
+        HDmemset(rbuf, 0, MULTI_NDSETS * MULTI_DIM * MULTI_DIM * sizeof(int));
+        for (d = 0; d < MULTI_NDSETS; d++)
+            rbufs[d] = rbuf + d * MULTI_DIM * MULTI_DIM;
+        if (H5Dread_multi((size_t)MULTI_NDSETS, dsid, mem_type, mem_space, file_space, H5P_DEFAULT, rbufs) <
+            0)
+            FAIL_STACK_ERROR
+        for (d = 0; d < MULTI_NDSETS * MULTI_DIM * MULTI_DIM; d++) {
+            /* The first half of the contiguous dataset was written twice */
+            if (d < MULTI_DIM * MULTI_DIM / 2)
+                val = (int)(MULTI_NDSETS * 10000 + d + 1);
+            else
+                val = (int)((d / (MULTI_DIM * MULTI_DIM)) * 10000 + d % (MULTI_DIM * MULTI_DIM) + 1);
+            if (rbuf[d] != val) {
+                HDprintf("    Read wrong value in dataset %u at element %u\n", d / (MULTI_DIM * MULTI_DIM),
+                         d % (MULTI_DIM * MULTI_DIM));
+                TEST_ERROR
+            }
+        }
+
+        if (0 == j) {
+            for (d = 0; d < MULTI_NDSETS; d++) {
+                if (H5Dclose(dsid[d]) < 0)
+                    FAIL_STACK_ERROR
+                dsid[d] = -1;
+            }
+            if (H5Fclose(fid) < 0)
+                FAIL_STACK_ERROR
+            if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+                FAIL_STACK_ERROR
+            if ((dsid[0] = H5Dopen2(fid, "contig", H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if ((dsid[1] = H5Dopen2(fid, "chunked", H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if ((dsid[2] = H5Dopen2(fid, "chunked_nocache", dapl)) < 0)
+                FAIL_STACK_ERROR
+            if ((dsid[3] = H5Dopen2(fid, "conv", H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+        }
+    }
+
+    for (d = 0; d < MULTI_NDSETS; d++) {
+        if (H5Dclose(dsid[d]) < 0)
+            FAIL_STACK_ERROR
+        dsid[d] = -1;
+    }
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(pid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(hid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (d = 0; d < MULTI_NDSETS; d++)
+            H5Dclose(dsid[d]);
+        H5Fclose(fid);
+        H5Sclose(pid);
+        H5Sclose(hid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_multi_dset_io() */
+
+/* Dataset and chunk sizes for the coalesced read test, with the chunk cache
+ * disabled, and with the default chunk cache, which the chunks of the larger
+ * dataset (1.6 MB) don't fit in
+ */
+#define COALESCE_DIM              32
+#define COALESCE_CHUNK_DIM        8
+#define COALESCE_CACHED_DIM       640
+#define COALESCE_CACHED_CHUNK_DIM 128
+
+/*-------------------------------------------------------------------------
+ * Function:    test_coalesced_chunk_read
+ *
+ * Purpose:     Tests reading unfiltered chunks that are not in the chunk
+ *              cache, when the chunks are stored out of order and with
+ *              gaps between them, so that H5Dread() reads them in file
+ *              order with merged reads.  Covers datatype conversion,
+ *              partial selections and an element overwritten after the
+ *              chunks were written, which stays in the chunk cache when
+ *              it is enabled.  Runs with the chunk cache disabled, or
+ *              with the default chunk cache and more chunks than it can
+ *              hold.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_coalesced_chunk_read(hid_t fapl, hbool_t default_cache)
+{
+    char       filename[FILENAME_BUF_SIZE];
+    hid_t      fid       = -1;       /* File ID */
+    hid_t      dcpl      = -1;       /* Dataset creation property list ID */
+    hid_t      dapl      = -1;       /* Dataset access property list ID */
+    hid_t      sid       = -1;       /* Dataspace ID */
+    hid_t      cid       = -1;       /* Dataspace ID for one chunk */
+    hid_t      pid       = -1;       /* Dataspace ID for one element */
+    hid_t      dsid[2]   = {-1, -1}; /* Dataset IDs */
+    int *      wbuf      = NULL;     /* Data written to one chunk */
+    int *      rbuf      = NULL;     /* Data read back */
+    long long *lbuf      = NULL;     /* Data read back, converted */
+    int        dim       = default_cache ? COALESCE_CACHED_DIM : COALESCE_DIM;
+    int        chunk_dim = default_cache ? COALESCE_CACHED_CHUNK_DIM : COALESCE_CHUNK_DIM;
+    int        nchunks   = dim / chunk_dim;
+    hsize_t    dims[2], chunk_dims[2];
+    hsize_t    start[2], stride[2], count[2];
+    int        val;
+    int        c, d, i, j;
+
+    if (default_cache) {
+        TESTING("coalesced reads of chunks (default chunk cache)");
+    }
+    else {
+        TESTING("coalesced reads of chunks (chunk cache disabled)");
+    }
+
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * (size_t)(chunk_dim * chunk_dim))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * (size_t)(dim * dim))))
+        TEST_ERROR
+    if (NULL == (lbuf = (long long *)HDmalloc(sizeof(long long) * (size_t)(dim * dim))))
+        TEST_ERROR
+
+    dims[0] = dims[1] = (hsize_t)dim;
+
+    chunk_dims[0] = chunk_dims[1] = (hsize_t)chunk_dim;
+
+    h5_fixname(FILENAME[32], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((cid = H5Screate_simple(2, chunk_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    count[0] = count[1] = 1;
+    if ((pid = H5Screate_simple(2, count, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_INCR) < 0)
+        FAIL_STACK_ERROR
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (!default_cache && H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    for (d = 0; d < 2; d++)
+        if ((dsid[d] = H5Dcreate2(fid, d ? "b" : "a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+    /* Write the chunks of both datasets in turn, so that the chunks of each
+     * dataset have gaps between them, and the chunks of the first one in
+     * reverse order
+     */
+    count[0] = count[1] = (hsize_t)chunk_dim;
+    for (c = 0; c < nchunks * nchunks; c++)
+        for (d = 0; d < 2; d++) {
+            int chunk = d ? c : nchunks * nchunks - 1 - c;
+
+            start[0] = (hsize_t)((chunk / nchunks) * chunk_dim);
+            start[1] = (hsize_t)((chunk % nchunks) * chunk_dim);
+            for (i = 0; i < chunk_dim; i++)
+                for (j = 0; j < chunk_dim; j++)
+                    wbuf[i * chunk_dim + j] = d * 1000000 + ((int)start[0] + i) * dim + (int)start[1] + j;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dwrite(dsid[d], H5T_NATIVE_INT, cid, sid, H5P_DEFAULT, wbuf) < 0)
+                FAIL_STACK_ERROR
+        }
+
+    /* Reopen the datasets, to empty their chunk caches */
+    for (d = 0; d < 2; d++) {
+        if (H5Dclose(dsid[d]) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid[d] = H5Dopen2(fid, d ? "b" : "a", dapl)) < 0)
+            FAIL_STACK_ERROR
+    }
+
+    /* Overwrite one element of the first dataset */
+    val      = -1;
+    start[0] = start[1] = 3;
+    count[0] = count[1] = 1;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dsid[0], H5T_NATIVE_INT, pid, sid, H5P_DEFAULT, &val) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read both datasets whole, with and without datatype conversion */
+    for (d = 0; d < 2; d++) {
+        HDmemset(rbuf, 0, sizeof(int) * (size_t)(dim * dim));
+        HDmemset(lbuf, 0, sizeof(long long) * (size_t)(dim * dim));
+        if (H5Dread(dsid[d], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(dsid[d], H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, lbuf) < 0)
+            FAIL_STACK_ERROR
+        for (i = 0; i < dim; i++)
+            for (j = 0; j < dim; j++) {
+                val = (0 == d && 3 == i && 3 == j) ? -1 : d * 1000000 + i * dim + j;
+                if (rbuf[i * dim + j] != val || lbuf[i * dim + j] != (long long)val) {
+                    HDprintf("    Read wrong value in dataset %d at %d,%d\n", d, i, j);
+                    TEST_ERROR
+                }
+            }
+    }
+
+    /* Read every third column of the second dataset */
+    HDmemset(rbuf, 0, sizeof(int) * (size_t)(dim * dim));
+    start[0] = start[1] = 0;
+    stride[0]           = 1;
+    stride[1]           = 3;
+    count[0]            = (hsize_t)dim;
+    count[1]            = (hsize_t)((dim + 2) / 3);
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(dsid[1], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < dim; i++)
+        for (j = 0; j < dim; j++) {
+            val = (j % 3) ? 0 : 1000000 + i * dim + j;
+            if (rbuf[i * dim + j] != val) {
+                HDprintf("    Read wrong value in selection at %d,%d\n", i, j);
+                TEST_ERROR
+            }
+        }
+
+    for (d = 0; d < 2; d++) {
+        if (H5Dclose(dsid[d]) < 0)
+            FAIL_STACK_ERROR
+        dsid[d] = -1;
+    }
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(pid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(cid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (d = 0; d < 2; d++)
+            H5Dclose(dsid[d]);
+        H5Fclose(fid);
+        H5Sclose(pid);
+        H5Sclose(cid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+    return FAIL;
+} /* end test_coalesced_chunk_read() */
+
+#define SIEVE_BUF_SIZE 1024
+#define SIEVE_NROWS_A  512
+#define SIEVE_NCOLS_A  320
+#define SIEVE_NROWS_B  80
+#define SIEVE_NCOLS_B  2048
+
+/*-------------------------------------------------------------------------
+ * Function:    test_adaptive_sieve
+ *
+ * Purpose:     Tests that the sieve buffer of a contiguous dataset grows
+ *              for column accesses with a stride just larger than the
+ *              buffer, is bypassed for column accesses with a much
+ *              larger stride, and goes back to its nominal size when the
+ *              accesses get closer together, and that the data read and
+ *              written along the way is correct.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_adaptive_sieve(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    my_fapl = -1;                           /* File access property list ID */
+    hid_t    fid     = -1;                           /* File ID */
+    hid_t    dcpl    = -1;                           /* Dataset creation property list ID */
+    hid_t    sid_a   = -1, sid_b = -1;               /* Dataspace IDs of the datasets */
+    hid_t    mid     = -1;                           /* Memory dataspace ID */
+    hid_t    did_a   = -1, did_b = -1, did_c = -1;   /* Dataset IDs */
+    int *    buf     = NULL;                         /* Data written and read back */
+    int *    col     = NULL;                         /* One column of data */
+    hsize_t  dims[2];                                /* Dataset dimensions */
+    hsize_t  start[2], stride[2], count[2];          /* Hyperslab selection */
+    hsize_t  nelmts;                                 /* Number of elements selected */
+    unsigned hits, misses, bypasses;                 /* Sieve buffer statistics */
+    size_t   buf_size;                               /* Sieve buffer size */
+    int      i, j;
+
+    TESTING("adaptive sieve buffer sizing");
+
+    if (NULL == (buf = (int *)HDmalloc(sizeof(int) * SIEVE_NROWS_A * SIEVE_NCOLS_A)))
+        TEST_ERROR
+    if (NULL == (col = (int *)HDmalloc(sizeof(int) * SIEVE_NROWS_A)))
+        TEST_ERROR
+
+    /* Use a small sieve buffer, so that rows are larger than it */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_sieve_buf_size(my_fapl, (size_t)SIEVE_BUF_SIZE) < 0)
+        FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[33], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    dims[0] = SIEVE_NROWS_A;
+    dims[1] = SIEVE_NCOLS_A;
+    if ((sid_a = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    dims[0] = SIEVE_NROWS_B;
+    dims[1] = SIEVE_NCOLS_B;
+    if ((sid_b = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((did_a = H5Dcreate2(fid, "a", H5T_NATIVE_INT, sid_a, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((did_b = H5Dcreate2(fid, "b", H5T_NATIVE_INT, sid_b, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write both datasets whole */
+    for (i = 0; i < SIEVE_NROWS_A * SIEVE_NCOLS_A; i++)
+        buf[i] = i;
+    if (H5Dwrite(did_a, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did_b, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dreset_sieve_stats(did_a) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dreset_sieve_stats(did_b) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read a column of the first dataset, whose rows are just larger than
+     * the sieve buffer
+     */
+    start[0] = 0;
+    start[1] = 5;
+    count[0] = SIEVE_NROWS_A;
+    count[1] = 1;
+    nelmts   = SIEVE_NROWS_A;
+    if ((mid = H5Screate_simple(1, &nelmts, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(sid_a, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(did_a, H5T_NATIVE_INT, mid, sid_a, H5P_DEFAULT, col) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SIEVE_NROWS_A; i++)
+        if (col[i] != i * SIEVE_NCOLS_A + 5) {
+            HDprintf("    Read wrong value in column at row %d\n", i);
+            TEST_ERROR
+        }
+    if (H5Dget_sieve_stats(did_a, &hits, &misses, &bypasses, &buf_size) < 0)
+        FAIL_STACK_ERROR
+
+    /* Only check the statistics if the file driver uses data sieving */
+    if (hits + misses + bypasses > 0) {
+        /* The buffer grew to hold several rows, so that most accesses hit it */
+        if (buf_size != 4 * SIEVE_NCOLS_A * sizeof(int) || hits <= misses || bypasses != 0) {
+            HDprintf("    Unexpected sieve buffer after column read: %u hits, %u misses, %u bypasses, "
+                     "size %zu\n",
+                     hits, misses, bypasses, buf_size);
+            TEST_ERROR
+        }
+
+        /* Read every fourth element of some rows: the grown buffer shrinks back */
+        start[0] = start[1] = 0;
+        stride[0]           = 1;
+        stride[1]           = 4;
+        count[0]            = 4;
+        count[1]            = SIEVE_NCOLS_A / 4;
+        if (H5Sselect_hyperslab(sid_a, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(did_a, H5T_NATIVE_INT, sid_a, sid_a, H5P_DEFAULT, buf) < 0)
+            FAIL_STACK_ERROR
+        for (i = 0; i < 4; i++)
+            for (j = 0; j < SIEVE_NCOLS_A; j += 4)
+                if (buf[i * SIEVE_NCOLS_A + j] != i * SIEVE_NCOLS_A + j) {
+                    HDprintf("    Read wrong value in rows at %d,%d\n", i, j);
+                    TEST_ERROR
+                }
+        if (H5Dget_sieve_stats(did_a, NULL, NULL, NULL, &buf_size) < 0)
+            FAIL_STACK_ERROR
+        if (buf_size != SIEVE_BUF_SIZE) {
+            HDprintf("    Sieve buffer didn't shrink back: size %zu\n", buf_size);
+            TEST_ERROR
+        }
+
+        /* Read a column of the second dataset, whose rows are much larger
+         * than the sieve buffer: the buffer is bypassed
+         */
+        start[0] = 0;
+        start[1] = 7;
+        count[0] = SIEVE_NROWS_B;
+        count[1] = 1;
+        if (H5Sselect_hyperslab(sid_b, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(did_b, H5T_NATIVE_INT, mid, sid_b, H5P_DEFAULT, col) < 0)
+            FAIL_STACK_ERROR
+        for (i = 0; i < SIEVE_NROWS_B; i++)
+            if (col[i] != i * SIEVE_NCOLS_B + 7) {
+                HDprintf("    Read wrong value in bypassed column at row %d\n", i);
+                TEST_ERROR
+            }
+        if (H5Dget_sieve_stats(did_b, &hits, &misses, &bypasses, &buf_size) < 0)
+            FAIL_STACK_ERROR
+        if (buf_size != 0 || hits != 0 || bypasses == 0 || misses + bypasses != SIEVE_NROWS_B) {
+            HDprintf("    Unexpected sieve buffer after bypassed column read: %u hits, %u misses, %u "
+                     "bypasses, size %zu\n",
+                     hits, misses, bypasses, buf_size);
+            TEST_ERROR
+        }
+
+        /* Read every eighth element of a row: the buffer is used again */
+        start[0] = start[1] = 0;
+        stride[0]           = 1;
+        stride[1]           = 8;
+        count[0]            = 1;
+        count[1]            = SIEVE_NCOLS_B / 8;
+        if (H5Sselect_hyperslab(sid_b, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(did_b, H5T_NATIVE_INT, sid_b, sid_b, H5P_DEFAULT, buf) < 0)
+            FAIL_STACK_ERROR
+        for (j = 0; j < SIEVE_NCOLS_B; j += 8)
+            if (buf[j] != j) {
+                HDprintf("    Read wrong value in row at %d\n", j);
+                TEST_ERROR
+            }
+        if (H5Dreset_sieve_stats(did_b) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_sieve_stats(did_b, &hits, &misses, &bypasses, &buf_size) < 0)
+            FAIL_STACK_ERROR
+        if (buf_size != SIEVE_BUF_SIZE || hits != 0 || misses != 0 || bypasses != 0) {
+            HDprintf("    Unexpected sieve buffer after reset: %u hits, %u misses, %u bypasses, "
+                     "size %zu\n",
+                     hits, misses, bypasses, buf_size);
+            TEST_ERROR
+        }
+    } /* end if */
+
+    /* Write a column of the first dataset, growing the buffer while it's
+     * dirty, and read the dataset back whole
+     */
+    for (i = 0; i < SIEVE_NROWS_A; i++)
+        col[i] = -i;
+    start[0] = 0;
+    start[1] = 9;
+    count[0] = SIEVE_NROWS_A;
+    count[1] = 1;
+    if (H5Sselect_all(mid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(sid_a, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did_a, H5T_NATIVE_INT, mid, sid_a, H5P_DEFAULT, col) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(buf, 0, sizeof(int) * SIEVE_NROWS_A * SIEVE_NCOLS_A);
+    if (H5Dread(did_a, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SIEVE_NROWS_A; i++)
+        for (j = 0; j < SIEVE_NCOLS_A; j++)
+            if (buf[i * SIEVE_NCOLS_A + j] != (9 == j ? -i : i * SIEVE_NCOLS_A + j)) {
+                HDprintf("    Read wrong value after column write at %d,%d\n", i, j);
+                TEST_ERROR
+            }
+
+    /* The statistics are only available for contiguous datasets */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    count[0] = count[1] = 16;
+    if (H5Pset_chunk(dcpl, 2, count) < 0)
+        FAIL_STACK_ERROR
+    if ((did_c = H5Dcreate2(fid, "c", H5T_NATIVE_INT, sid_a, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        if (H5Dget_sieve_stats(did_c, &hits, NULL, NULL, NULL) >= 0)
+            FAIL_PUTS_ERROR("    Got sieve buffer statistics of a chunked dataset.")
+    }
+    H5E_END_TRY;
+
+    if (H5Dclose(did_c) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(did_b) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(did_a) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid_b) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid_a) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+    HDfree(buf);
+    HDfree(col);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did_c);
+        H5Dclose(did_b);
+        H5Dclose(did_a);
+        H5Fclose(fid);
+        H5Sclose(mid);
+        H5Sclose(sid_b);
+        H5Sclose(sid_a);
+        H5Pclose(dcpl);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(buf);
+    HDfree(col);
+    return FAIL;
+} /* end test_adaptive_sieve() */
+
+#define ALLOC_BATCH_DIM       81
+#define ALLOC_BATCH_CHUNK_DIM 2
+#define ALLOC_BATCH_NCHUNKS   (41 * 41)
+#define ALLOC_BATCH_ALIGN     64
+#define ALLOC_BATCH_FILL      7
+
+/* Chunk records gathered by alloc_batch_iter_cb() */
+typedef struct alloc_batch_chunks_t {
+    size_t  nchunks;                    /* Number of chunks found */
+    haddr_t addr[ALLOC_BATCH_NCHUNKS];  /* Addresses of the chunks */
+    hsize_t size[ALLOC_BATCH_NCHUNKS];  /* Sizes of the chunks */
+} alloc_batch_chunks_t;
+
+static int
+alloc_batch_iter_cb(const hsize_t H5_ATTR_UNUSED *offset, unsigned H5_ATTR_UNUSED filter_mask, haddr_t addr,
+                    hsize_t size, void *op_data)
+{
+    alloc_batch_chunks_t *chunks = (alloc_batch_chunks_t *)op_data;
+
+    if (chunks->nchunks == ALLOC_BATCH_NCHUNKS)
+        return H5_ITER_ERROR;
+    chunks->addr[chunks->nchunks] = addr;
+    chunks->size[chunks->nchunks] = size;
+    chunks->nchunks++;
+
+    return H5_ITER_CONT;
+} /* end alloc_batch_iter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_alloc_batch
+ *
+ * Purpose:     Tests early allocation of more chunks than are allocated
+ *              and filled in one batch, with and without filters, when
+ *              creating and when extending a dataset, and with and
+ *              without alignment of the chunks in the file.  All the
+ *              chunks must get their own, correctly aligned, space in
+ *              the file and hold the fill value.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_alloc_batch(hid_t fapl)
+{
+    char                  filename[FILENAME_BUF_SIZE];
+    hid_t                 my_fapl = -1;         /* File access property list ID */
+    hid_t                 fid     = -1;         /* File ID */
+    hid_t                 dcpl    = -1;         /* Dataset creation property list ID */
+    hid_t                 sid     = -1;         /* Dataspace ID */
+    hid_t                 did     = -1;         /* Dataset ID */
+    alloc_batch_chunks_t *chunks  = NULL;       /* Chunks of a dataset */
+    int *                 rbuf    = NULL;       /* Data read back */
+    hsize_t               dims[2], max_dims[2]; /* Dataset dimensions */
+    hsize_t               chunk_dims[2] = {ALLOC_BATCH_CHUNK_DIM, ALLOC_BATCH_CHUNK_DIM};
+    int                   fill          = ALLOC_BATCH_FILL;
+    unsigned              align;                /* Whether chunks are aligned */
+    int                   d;                    /* Which dataset */
+    size_t                u, v;
+
+    TESTING("batched allocation of chunks");
+
+    if (NULL == (chunks = (alloc_batch_chunks_t *)HDmalloc(sizeof(alloc_batch_chunks_t))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * ALLOC_BATCH_DIM * ALLOC_BATCH_DIM)))
+        TEST_ERROR
+
+    for (align = FALSE; align <= TRUE; align++) {
+        if ((my_fapl = H5Pcopy(fapl)) < 0)
+            FAIL_STACK_ERROR
+        if (align && H5Pset_alignment(my_fapl, (hsize_t)1, (hsize_t)ALLOC_BATCH_ALIGN) < 0)
+            FAIL_STACK_ERROR
+        h5_fixname(FILENAME[34], fapl, filename, sizeof filename);
+        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Unfiltered, filtered and extended datasets */
+        for (d = 0; d < 3; d++) {
+            if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+                FAIL_STACK_ERROR
+            if (1 == d && H5Pset_fletcher32(dcpl) < 0)
+                FAIL_STACK_ERROR
+            dims[0] = dims[1] = 2 == d ? 10 : ALLOC_BATCH_DIM;
+            max_dims[0] = max_dims[1] = 2 == d ? H5S_UNLIMITED : ALLOC_BATCH_DIM;
+            if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+                FAIL_STACK_ERROR
+            if ((did = H5Dcreate2(fid, 0 == d ? "plain" : (1 == d ? "filtered" : "extended"), H5T_NATIVE_INT,
+                                  sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if (2 == d) {
+                dims[0] = dims[1] = ALLOC_BATCH_DIM;
+                if (H5Dset_extent(did, dims) < 0)
+                    FAIL_STACK_ERROR
+            } /* end if */
+
+            /* All the chunks hold the fill value */
+            HDmemset(rbuf, 0, sizeof(int) * ALLOC_BATCH_DIM * ALLOC_BATCH_DIM);
+            if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for (u = 0; u < ALLOC_BATCH_DIM * ALLOC_BATCH_DIM; u++)
+                if (rbuf[u] != ALLOC_BATCH_FILL) {
+                    HDprintf("    Read wrong value in dataset %d at element %zu\n", d, u);
+                    TEST_ERROR
+                }
+
+            /* All the chunks are allocated, in their own (aligned) space */
+            chunks->nchunks = 0;
+            if (H5Dchunk_iter(did, H5P_DEFAULT, alloc_batch_iter_cb, chunks) < 0)
+                FAIL_STACK_ERROR
+            if (chunks->nchunks != ALLOC_BATCH_NCHUNKS) {
+                HDprintf("    Found %zu chunks in dataset %d\n", chunks->nchunks, d);
+                TEST_ERROR
+            }
+            for (u = 0; u < chunks->nchunks; u++) {
+                if (chunks->size[u] != sizeof(int) * ALLOC_BATCH_CHUNK_DIM * ALLOC_BATCH_CHUNK_DIM +
+                                           (1 == d ? 4 : 0)) {
+                    HDprintf("    Wrong size of chunk %zu in dataset %d\n", u, d);
+                    TEST_ERROR
+                }
+                /* (Only the block holding all the chunks of an implicit index is aligned) */
+                if (align && 0 != d && 0 != chunks->addr[u] % ALLOC_BATCH_ALIGN) {
+                    HDprintf("    Chunk %zu in dataset %d isn't aligned\n", u, d);
+                    TEST_ERROR
+                }
+                for (v = 0; v < u; v++)
+                    if (chunks->addr[u] < chunks->addr[v] + chunks->size[v] &&
+                        chunks->addr[v] < chunks->addr[u] + chunks->size[u]) {
+                        HDprintf("    Chunks %zu and %zu in dataset %d overlap\n", v, u, d);
+                        TEST_ERROR
+                    }
+            } /* end for */
+
+            if (H5Dclose(did) < 0)
+                FAIL_STACK_ERROR
+            did = -1;
+            if (H5Sclose(sid) < 0)
+                FAIL_STACK_ERROR
+            sid = -1;
+            if (H5Pclose(dcpl) < 0)
+                FAIL_STACK_ERROR
+            dcpl = -1;
+        } /* end for */
+
+        if (H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+        fid = -1;
+        if (H5Pclose(my_fapl) < 0)
+            FAIL_STACK_ERROR
+        my_fapl = -1;
+    } /* end for */
+
+    HDfree(rbuf);
+    HDfree(chunks);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(rbuf);
+    HDfree(chunks);
+    return FAIL;
+} /* end test_chunk_alloc_batch() */
+
+#define PREFETCH_DIM       100
+#define PREFETCH_CHUNK_DIM 10
+#define PREFETCH_SEL_START 25
+#define PREFETCH_SEL_DIM   20
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_prefetch
+ *
+ * Purpose:     Tests H5Dprefetch(): the chunks of a prefetched selection
+ *              must be found in the chunk cache when the selection is
+ *              read, no more chunks than fit in the cache may be loaded,
+ *              and datasets that aren't chunked are left alone.  Filtered
+ *              chunks are tested with and without filter threads.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_prefetch(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    my_fapl = -1;                 /* File access property list ID */
+    hid_t    fid     = -1;                 /* File ID */
+    hid_t    dcpl    = -1;                 /* Dataset creation property list ID */
+    hid_t    dapl    = -1;                 /* Dataset access property list ID */
+    hid_t    sid     = -1;                 /* Dataspace ID */
+    hid_t    msid    = -1;                 /* Memory dataspace ID */
+    hid_t    did     = -1;                 /* Dataset ID */
+    int *    wbuf    = NULL;               /* Data written */
+    int *    rbuf    = NULL;               /* Data read back */
+    hsize_t  dims[2] = {PREFETCH_DIM, PREFETCH_DIM};
+    hsize_t  chunk_dims[2] = {PREFETCH_CHUNK_DIM, PREFETCH_CHUNK_DIM};
+    hsize_t  start[2]      = {PREFETCH_SEL_START, PREFETCH_SEL_START};
+    hsize_t  count[2]      = {PREFETCH_SEL_DIM, PREFETCH_SEL_DIM};
+    size_t   chunk_bytes   = sizeof(int) * PREFETCH_CHUNK_DIM * PREFETCH_CHUNK_DIM;
+    unsigned hits, misses, evictions;      /* Chunk cache statistics */
+    unsigned config;                       /* Filters and filter threads */
+    herr_t   ret;                          /* Generic return value */
+    size_t   u, v;
+
+    TESTING("prefetching chunks into the chunk cache");
+
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * PREFETCH_DIM * PREFETCH_DIM)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * PREFETCH_DIM * PREFETCH_DIM)))
+        TEST_ERROR
+    for (u = 0; u < PREFETCH_DIM * PREFETCH_DIM; u++)
+        wbuf[u] = (int)u;
+
+    /* Unfiltered and filtered chunks, without and with filter threads */
+    for (config = 0; config < 3; config++) {
+        if ((my_fapl = H5Pcopy(fapl)) < 0)
+            FAIL_STACK_ERROR
+        if (2 == config && H5Pset_filter_threads(my_fapl, 4) < 0)
+            FAIL_STACK_ERROR
+        h5_fixname(FILENAME[35], fapl, filename, sizeof filename);
+        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+            FAIL_STACK_ERROR
+        if (config > 0 && (H5Pset_shuffle(dcpl) < 0 || H5Pset_fletcher32(dcpl) < 0))
+            FAIL_STACK_ERROR
+        if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        did = -1;
+
+        /* Prefetch a selection into a cache large enough for all the chunks */
+        if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk_cache(dapl, (size_t)1009, 2 * PREFETCH_DIM * PREFETCH_DIM * sizeof(int),
+                               H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dopen2(fid, "chunked", dapl)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dprefetch(did, sid, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_chunk_cache_stats(did, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (hits != 0 || misses != 9 || evictions != 0) {
+            HDprintf("    Prefetch: %u hits, %u misses, %u evictions (config %u)\n", hits, misses, evictions,
+                     config);
+            TEST_ERROR
+        }
+
+        /* Chunks already in the cache aren't loaded again */
+        if (H5Dprefetch(did, sid, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_chunk_cache_stats(did, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (hits != 0 || misses != 9)
+            TEST_ERROR
+
+        /* The selection is read from the cache */
+        if (H5Dreset_chunk_cache_stats(did) < 0)
+            FAIL_STACK_ERROR
+        if ((msid = H5Screate_simple(2, count, NULL)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(int) * PREFETCH_DIM * PREFETCH_DIM);
+        if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_chunk_cache_stats(did, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (hits != 9 || misses != 0) {
+            HDprintf("    Read: %u hits, %u misses (config %u)\n", hits, misses, config);
+            TEST_ERROR
+        }
+        for (u = 0; u < PREFETCH_SEL_DIM; u++)
+            for (v = 0; v < PREFETCH_SEL_DIM; v++)
+                if (rbuf[u * PREFETCH_SEL_DIM + v] !=
+                    wbuf[(u + PREFETCH_SEL_START) * PREFETCH_DIM + v + PREFETCH_SEL_START]) {
+                    HDprintf("    Read wrong value at (%zu, %zu) (config %u)\n", u, v, config);
+                    TEST_ERROR
+                }
+        if (H5Sclose(msid) < 0)
+            FAIL_STACK_ERROR
+        msid = -1;
+
+        /* An empty selection loads nothing */
+        if ((msid = H5Screate_simple(2, dims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_none(msid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dprefetch(did, msid, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sclose(msid) < 0)
+            FAIL_STACK_ERROR
+
+        /* A selection outside the dataset's extent is rejected */
+        dims[0] *= 2;
+        if ((msid = H5Screate_simple(2, dims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        dims[0] /= 2;
+        start[0] += PREFETCH_DIM;
+        if (H5Sselect_hyperslab(msid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        start[0] -= PREFETCH_DIM;
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dprefetch(did, msid, H5P_DEFAULT);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            TEST_ERROR
+        if (H5Sclose(msid) < 0)
+            FAIL_STACK_ERROR
+        msid = -1;
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+
+        /* No more chunks are loaded than fit in the cache */
+        if (H5Pset_chunk_cache(dapl, (size_t)1009, 4 * chunk_bytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dopen2(fid, "chunked", dapl)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dprefetch(did, H5S_ALL, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_chunk_cache_stats(did, &hits, &misses, &evictions) < 0)
+            FAIL_STACK_ERROR
+        if (misses != 4 || evictions != 0) {
+            HDprintf("    Small cache: %u misses, %u evictions (config %u)\n", misses, evictions, config);
+            TEST_ERROR
+        }
+        HDmemset(rbuf, 0, sizeof(int) * PREFETCH_DIM * PREFETCH_DIM);
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(rbuf, wbuf, sizeof(int) * PREFETCH_DIM * PREFETCH_DIM) != 0)
+            TEST_ERROR
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+
+        /* Nothing is done for datasets that aren't chunked */
+        if ((did = H5Dopen2(fid, "contig", H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dprefetch(did, H5S_ALL, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        did = -1;
+
+        if (H5Pclose(dapl) < 0)
+            FAIL_STACK_ERROR
+        dapl = -1;
+        if (H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+        sid = -1;
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR
+        dcpl = -1;
+        if (H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+        fid = -1;
+        if (H5Pclose(my_fapl) < 0)
+            FAIL_STACK_ERROR
+        my_fapl = -1;
+    } /* end for */
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(rbuf);
+    HDfree(wbuf);
+    return FAIL;
+} /* end test_chunk_prefetch() */
+
 /*-------------------------------------------------------------------------
  * Function: test_chunk_fast
  *
@@ -15250,6 +17503,17 @@ main(void)
                 nerrors += (test_huge_chunks(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_chunk_cache(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_big_chunks_bypass_cache(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_filter_threads(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_filter_threads_edc(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_shared_chunk_cache(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_cache_policy(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_index_cache(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_multi_dset_io(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_coalesced_chunk_read(my_fapl, FALSE) < 0 ? 1 : 0);
+                nerrors += (test_coalesced_chunk_read(my_fapl, TRUE) < 0 ? 1 : 0);
+                nerrors += (test_adaptive_sieve(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_alloc_batch(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_prefetch(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_chunk_fast(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_reopen_chunk_fast(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_chunk_fast_bug1(my_fapl) < 0 ? 1 : 0);
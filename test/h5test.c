@@ -1034,6 +1034,13 @@ h5_get_vfd_fapl(hid_t fapl)
          */
         if (H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             goto error;
+#endif
+#ifdef H5_HAVE_URING_VFD
+    }
+    else if (!HDstrcmp(tok, "uring")) {
+        /* Linux io_uring with the default queue depth */
+        if (H5Pset_fapl_uring(fapl, 0) < 0)
+            goto error;
 #endif
     }
     else {
@@ -1383,6 +1390,9 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
             driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_URING_VFD
+            driver == H5FD_URING ||
+#endif /* H5_HAVE_URING_VFD */
             driver == H5FD_LOG) {
             /* Get the file's statistics */
             if (0 == HDstat(filename, &sb))
@@ -1934,38 +1944,40 @@ dummy_vfd_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hi
 
 /* Dummy VFD with the minimum parameters to make a VFD that can be registered */
 static const H5FD_class_t H5FD_dummy_g = {
-    "dummy",             /* name         */
-    1,                   /* maxaddr      */
-    H5F_CLOSE_WEAK,      /* fc_degree    */
-    NULL,                /* terminate    */
-    NULL,                /* sb_size      */
-    NULL,                /* sb_encode    */
-    NULL,                /* sb_decode    */
-    0,                   /* fapl_size    */
-    NULL,                /* fapl_get     */
-    NULL,                /* fapl_copy    */
-    NULL,                /* fapl_free    */
-    0,                   /* dxpl_size    */
-    NULL,                /* dxpl_copy    */
-    NULL,                /* dxpl_free    */
-    dummy_vfd_open,      /* open         */
-    dummy_vfd_close,     /* close        */
-    NULL,                /* cmp          */
-    NULL,                /* query        */
-    NULL,                /* get_type_map */
-    NULL,                /* alloc        */
-    NULL,                /* free         */
-    dummy_vfd_get_eoa,   /* get_eoa      */
-    dummy_vfd_set_eoa,   /* set_eoa      */
-    dummy_vfd_get_eof,   /* get_eof      */
-    NULL,                /* get_handle   */
-    dummy_vfd_read,      /* read         */
-    dummy_vfd_write,     /* write        */
-    NULL,                /* flush        */
-    NULL,                /* truncate     */
-    NULL,                /* lock         */
-    NULL,                /* unlock       */
-    H5FD_FLMAP_DICHOTOMY /* fl_map       */
+    "dummy",              /* name         */
+    1,                    /* maxaddr      */
+    H5F_CLOSE_WEAK,       /* fc_degree    */
+    NULL,                 /* terminate    */
+    NULL,                 /* sb_size      */
+    NULL,                 /* sb_encode    */
+    NULL,                 /* sb_decode    */
+    0,                    /* fapl_size    */
+    NULL,                 /* fapl_get     */
+    NULL,                 /* fapl_copy    */
+    NULL,                 /* fapl_free    */
+    0,                    /* dxpl_size    */
+    NULL,                 /* dxpl_copy    */
+    NULL,                 /* dxpl_free    */
+    dummy_vfd_open,       /* open         */
+    dummy_vfd_close,      /* close        */
+    NULL,                 /* cmp          */
+    NULL,                 /* query        */
+    NULL,                 /* get_type_map */
+    NULL,                 /* alloc        */
+    NULL,                 /* free         */
+    dummy_vfd_get_eoa,    /* get_eoa      */
+    dummy_vfd_set_eoa,    /* set_eoa      */
+    dummy_vfd_get_eof,    /* get_eof      */
+    NULL,                 /* get_handle   */
+    dummy_vfd_read,       /* read         */
+    dummy_vfd_write,      /* write        */
+    NULL,                 /* flush        */
+    NULL,                 /* truncate     */
+    NULL,                 /* lock         */
+    NULL,                 /* unlock       */
+    H5FD_FLMAP_DICHOTOMY, /* fl_map       */
+    NULL,                 /* read_vector  */
+    NULL                  /* write_vector */
 };
 
 /*-------------------------------------------------------------------------
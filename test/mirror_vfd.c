@@ -48,6 +48,13 @@
 
 #define CONCURRENT_COUNT 3 /* Number of files in concurrent test */
 
+/* Write batching configuration used by the batched tests; the batch is
+ * smaller than a DATABUFFER_SIZE x DATABUFFER_SIZE dataset of ints, so that
+ * both batched and stand-alone writes are exercised.
+ */
+#define BATCH_SIZE   (16 * 1024)
+#define BATCH_WINDOW 4
+
 /* Macro: LOGPRINT()
  * Prints logging and debugging messages to the output stream based
  * on the level of verbosity.
@@ -98,7 +105,8 @@ static herr_t _close_chunking_ids(unsigned min_dset, unsigned max_dset, hid_t *d
 static herr_t _populate_filepath(const char *dirname, const char *_basename, hid_t fapl_id, char *path_out,
                                  hbool_t h5suffix);
 
-static hid_t create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *names);
+static hid_t create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *names,
+                                         uint32_t write_batch_size, uint32_t write_window);
 
 static void mybzero(void *dest, size_t size);
 
@@ -236,8 +244,10 @@ test_fapl_configuration(void)
         H5FD_MIRROR_CURR_FAPL_T_VERSION, /* version */
         SERVER_HANDSHAKE_PORT,           /* handhake_port */
         SERVER_IP_ADDRESS,               /* remote_ip "IP address" */
+        BATCH_SIZE,                      /* write_batch_size */
+        BATCH_WINDOW,                    /* write_window */
     };
-    H5FD_mirror_fapl_t fa_out = {0, 0, 0, ""};
+    H5FD_mirror_fapl_t fa_out = {H5FD_MIRROR_FAPL_MAGIC, H5FD_MIRROR_CURR_FAPL_T_VERSION, 0, "", 0, 0};
 
     TESTING("Mirror fapl configuration (set/get)");
 
@@ -265,6 +275,47 @@ test_fapl_configuration(void)
     if (HDstrncmp(SERVER_IP_ADDRESS, (const char *)fa_out.remote_ip, H5FD_MIRROR_MAX_IP_LEN)) {
         TEST_ERROR;
     }
+    if (BATCH_SIZE != fa_out.write_batch_size || BATCH_WINDOW != fa_out.write_window) {
+        TEST_ERROR;
+    }
+
+    /* Batching requires a window */
+    mirror_conf.write_window = 0;
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_mirror(fapl_id, &mirror_conf) >= 0) {
+            TEST_ERROR;
+        }
+    }
+    H5E_END_TRY;
+
+    /* Version 1 structures do not have the batching fields */
+    mirror_conf.version      = 1;
+    mirror_conf.write_window = BATCH_WINDOW;
+    if (H5Pset_fapl_mirror(fapl_id, &mirror_conf) == FAIL) {
+        TEST_ERROR;
+    }
+    if (H5Pget_fapl_mirror(fapl_id, &fa_out) == FAIL) {
+        TEST_ERROR;
+    }
+    if (1 != fa_out.version || 0 != fa_out.write_batch_size || 0 != fa_out.write_window) {
+        TEST_ERROR;
+    }
+
+    /* A version 1 structure does not have its batching fields written */
+    mirror_conf.version = H5FD_MIRROR_CURR_FAPL_T_VERSION;
+    if (H5Pset_fapl_mirror(fapl_id, &mirror_conf) == FAIL) {
+        TEST_ERROR;
+    }
+    fa_out.version          = 1;
+    fa_out.write_batch_size = 0;
+    fa_out.write_window     = 0;
+    if (H5Pget_fapl_mirror(fapl_id, &fa_out) == FAIL) {
+        TEST_ERROR;
+    }
+    if (1 != fa_out.version || 0 != fa_out.write_batch_size || 0 != fa_out.write_window) {
+        TEST_ERROR;
+    }
 
     if (H5Pclose(fapl_id) == FAIL) {
         TEST_ERROR;
@@ -1220,6 +1271,94 @@ test_xmit_encode_decode(void)
 
     } while (0); /* end xmit write en/decode */
 
+    /* Test xmit batch structure encode/decode
+     * Write bogus but easily verifiable data to inside a buffer, and compare.
+     * Then decode the buffer and compare the structure contents.
+     * Then repeat from a different offset in the buffer and compare.
+     */
+    do {
+        unsigned char            buf[H5FD_MIRROR_XMIT_BATCH_SIZE + 8];
+        unsigned char            expected[H5FD_MIRROR_XMIT_BATCH_SIZE + 8];
+        H5FD_mirror_xmit_batch_t xmit_in;
+        H5FD_mirror_xmit_batch_t xmit_out;
+        size_t                   i = 0;
+
+        /* sanity check */
+        if ((14 + 12) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            FAIL_PUTS_ERROR("Header size definition does not match test\n");
+        }
+        if (xmit_mock.op != 0x0D) {
+            FAIL_PUTS_ERROR("shared header structure is not in expected state");
+        }
+
+        /* Populate the expected buffer; expect end padding of 0xFF
+         */
+        HDmemset(expected, 0xFF, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+        for (i = 0; i < H5FD_MIRROR_XMIT_BATCH_SIZE; i++) {
+            expected[i + 2] = (unsigned char)i;
+        }
+
+        /* Set xmit_in
+         */
+        xmit_in.pub   = xmit_mock; /* shared/common */
+        xmit_in.count = 0x0E0F1011;
+        xmit_in.size  = 0x1213141516171819;
+
+        /* Encode, and compare buffer contents
+         * Initial buffer is filled with 0xFF to match expected padding
+         */
+        HDmemset(buf, 0xFF, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+        if (H5FD_mirror_xmit_encode_batch((buf + 2), &xmit_in) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            TEST_ERROR;
+        }
+        if (HDmemcmp(buf, expected, H5FD_MIRROR_XMIT_BATCH_SIZE + 8) != 0) {
+            PRINT_BUFFER_DIFF(buf, expected, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+            TEST_ERROR;
+        }
+
+        /* Decode from buffer
+         */
+        if (H5FD_mirror_xmit_decode_batch(&xmit_out, (buf + 2)) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            TEST_ERROR;
+        }
+        if (xmit_out.pub.magic != xmit_mock.magic)
+            TEST_ERROR;
+        if (xmit_out.pub.version != xmit_mock.version)
+            TEST_ERROR;
+        if (xmit_out.pub.session_token != xmit_mock.session_token)
+            TEST_ERROR;
+        if (xmit_out.pub.xmit_count != xmit_mock.xmit_count)
+            TEST_ERROR;
+        if (xmit_out.pub.op != xmit_mock.op)
+            TEST_ERROR;
+        if (xmit_out.count != 0x0E0F1011)
+            TEST_ERROR;
+        if (xmit_out.size != 0x1213141516171819)
+            TEST_ERROR;
+
+        /* Decode from different offset in buffer
+         * Observe changes when ingesting the padding
+         */
+        if (H5FD_mirror_xmit_decode_batch(&xmit_out, (buf)) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            TEST_ERROR;
+        }
+        if (xmit_out.pub.magic != 0xFFFF0001)
+            TEST_ERROR;
+        if (xmit_out.pub.version != 0x02)
+            TEST_ERROR;
+        if (xmit_out.pub.session_token != 0x03040506)
+            TEST_ERROR;
+        if (xmit_out.pub.xmit_count != 0x0708090A)
+            TEST_ERROR;
+        if (xmit_out.pub.op != 0x0B)
+            TEST_ERROR;
+        if (xmit_out.count != 0x0C0D0E0F)
+            TEST_ERROR;
+        if (xmit_out.size != 0x1011121314151617)
+            TEST_ERROR;
+
+    } while (0); /* end xmit batch en/decode */
+
     PASSED();
     return 0;
 
@@ -1234,6 +1373,8 @@ error:
  *              Creates target files with the given base name -- ideally the
  *              test name -- and creates mirroring/split FAPL set to use the
  *              global mirroring info and a sec2 R/W channel driver.
+ *              The mirror W/O channel batches writes as given; zero
+ *              `write_batch_size` sends every write by itself.
  *
  *              TODO: receive target IP from caller?
  *
@@ -1246,7 +1387,8 @@ error:
  * ---------------------------------------------------------------------------
  */
 static hid_t
-create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *names)
+create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *names,
+                            uint32_t write_batch_size, uint32_t write_window)
 {
     H5FD_splitter_vfd_config_t splitter_config;
     H5FD_mirror_fapl_t         mirror_conf;
@@ -1256,9 +1398,10 @@ create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *
         TEST_ERROR;
     }
 
-    splitter_config.magic          = H5FD_SPLITTER_MAGIC;
-    splitter_config.version        = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
-    splitter_config.ignore_wo_errs = FALSE;
+    splitter_config.magic                = H5FD_SPLITTER_MAGIC;
+    splitter_config.version              = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
+    splitter_config.ignore_wo_errs       = FALSE;
+    splitter_config.wo_write_behind_size = 0;
 
     /* Create Splitter R/W channel driver (sec2)
      */
@@ -1274,7 +1417,9 @@ create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *
      */
     mirror_conf.magic          = H5FD_MIRROR_FAPL_MAGIC;
     mirror_conf.version        = H5FD_MIRROR_CURR_FAPL_T_VERSION;
-    mirror_conf.handshake_port = SERVER_HANDSHAKE_PORT;
+    mirror_conf.handshake_port   = SERVER_HANDSHAKE_PORT;
+    mirror_conf.write_batch_size = write_batch_size;
+    mirror_conf.write_window     = write_window;
     if (HDstrncpy(mirror_conf.remote_ip, SERVER_IP_ADDRESS, H5FD_MIRROR_MAX_IP_LEN) == NULL) {
         TEST_ERROR;
     }
@@ -1364,7 +1509,7 @@ test_create_and_close(void)
 
     /* Create FAPL for Splitter[sec2|mirror]
      */
-    fapl_id = create_mirroring_split_fapl("basic_create", &names);
+    fapl_id = create_mirroring_split_fapl("basic_create", &names, 0, 0);
     if (H5I_INVALID_HID == fapl_id) {
         TEST_ERROR;
     }
@@ -1906,7 +2051,7 @@ test_basic_dataset_write(void)
 
     /* Create FAPL for Splitter[sec2|mirror]
      */
-    fapl_id = create_mirroring_split_fapl("basic_write", &names);
+    fapl_id = create_mirroring_split_fapl("basic_write", &names, 0, 0);
     if (H5I_INVALID_HID == fapl_id) {
         TEST_ERROR;
     }
@@ -2030,7 +2175,7 @@ test_chunked_dataset_write(void)
 
     /* Create FAPL for Splitter[sec2|mirror]
      */
-    fapl_id = create_mirroring_split_fapl("chunked_write", &names);
+    fapl_id = create_mirroring_split_fapl("chunked_write", &names, 0, 0);
     if (H5I_INVALID_HID == fapl_id) {
         TEST_ERROR;
     }
@@ -2117,6 +2262,142 @@ error:
     return -1;
 } /* end test_chunked_dataset_write() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    test_batched_dataset_write
+ *
+ * Purpose:     Write many small chunks and one large dataset through a
+ *              mirror which batches its writes, flushing part way through;
+ *              verify the data and compare the files.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ * ---------------------------------------------------------------------------
+ */
+static int
+test_batched_dataset_write(void)
+{
+    struct mirrortest_filenames names;
+    hid_t                       file_id   = H5I_INVALID_HID;
+    hid_t                       fapl_id   = H5P_DEFAULT;
+    hid_t                       dset_id   = H5I_INVALID_HID;
+    hid_t                       dspace_id = H5I_INVALID_HID;
+    hsize_t                     dims[2]   = {DATABUFFER_SIZE, DATABUFFER_SIZE};
+    int *                       buf       = NULL;
+    int                         i         = 0;
+
+    TESTING("Mirror batched dataset writing");
+
+    /* Create FAPL for Splitter[sec2|mirror(batched)]
+     */
+    fapl_id = create_mirroring_split_fapl("batched_write", &names, BATCH_SIZE, BATCH_WINDOW);
+    if (H5I_INVALID_HID == fapl_id) {
+        TEST_ERROR;
+    }
+
+    buf = (int *)HDmalloc(DATABUFFER_SIZE * DATABUFFER_SIZE * sizeof(int));
+    if (NULL == buf) {
+        TEST_ERROR;
+    }
+    for (i = 0; i < DATABUFFER_SIZE * DATABUFFER_SIZE; i++) {
+        buf[i] = i;
+    }
+
+    file_id = H5Fcreate(names.rw, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    if (H5I_INVALID_HID == file_id) {
+        TEST_ERROR;
+    }
+
+    /* Many small chunk writes, then a flush
+     */
+    if (create_datasets(file_id, 0, MAX_DSET_COUNT / 2) == FAIL) {
+        TEST_ERROR;
+    }
+    if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0) {
+        TEST_ERROR;
+    }
+
+    /* A write too large to be batched, among more small ones
+     */
+    dspace_id = H5Screate_simple(2, dims, NULL);
+    if (H5I_INVALID_HID == dspace_id) {
+        TEST_ERROR;
+    }
+    dset_id = H5Dcreate2(file_id, "large", H5T_NATIVE_INT, dspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if (H5I_INVALID_HID == dset_id) {
+        TEST_ERROR;
+    }
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) == FAIL) {
+        TEST_ERROR;
+    }
+    if (H5Dclose(dset_id) == FAIL) {
+        TEST_ERROR;
+    }
+    dset_id = H5I_INVALID_HID;
+    if (H5Sclose(dspace_id) == FAIL) {
+        TEST_ERROR;
+    }
+    dspace_id = H5I_INVALID_HID;
+
+    if (create_datasets(file_id, MAX_DSET_COUNT / 2 + 1, MAX_DSET_COUNT) == FAIL) {
+        TEST_ERROR;
+    }
+
+    if (H5Fclose(file_id) == FAIL) {
+        TEST_ERROR;
+    }
+    file_id = H5I_INVALID_HID;
+
+    /* Reopen file and verify written data integrity
+     */
+    file_id = H5Fopen(names.rw, H5F_ACC_RDWR, fapl_id);
+    if (H5I_INVALID_HID == file_id) {
+        TEST_ERROR;
+    }
+    if (verify_datasets(file_id, 0, MAX_DSET_COUNT) == FAIL) {
+        TEST_ERROR;
+    }
+
+    /* -------------------- */
+    /* Standard cleanup */
+
+    HDfree(buf);
+    buf = NULL;
+    if (H5Fclose(file_id) == FAIL) {
+        TEST_ERROR;
+    }
+    file_id = H5I_INVALID_HID;
+    if (H5Pclose(fapl_id) == FAIL) {
+        TEST_ERROR;
+    }
+    fapl_id = H5I_INVALID_HID;
+
+    /* -------------------- */
+    /* TEST: Verify that the R/W and W/O files are identical */
+
+    if (h5_compare_file_bytes(names.rw, names.wo) < 0) {
+        TEST_ERROR;
+    }
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        (void)H5Fclose(file_id);
+        (void)H5Dclose(dset_id);
+        (void)H5Sclose(dspace_id);
+        if (fapl_id != H5P_DEFAULT && fapl_id > 0) {
+            (void)H5Pclose(fapl_id);
+        }
+    }
+    H5E_END_TRY;
+    if (buf) {
+        HDfree(buf);
+    }
+    return -1;
+} /* end test_batched_dataset_write() */
+
 /* ---------------------------------------------------------------------------
  * Function:    test_on_disk_zoo
  *
@@ -2146,7 +2427,7 @@ test_on_disk_zoo(void)
 
     /* Create FAPL for Splitter[sec2|mirror]
      */
-    fapl_id = create_mirroring_split_fapl("zoo", &names);
+    fapl_id = create_mirroring_split_fapl("zoo", &names, 0, 0);
     if (H5I_INVALID_HID == fapl_id) {
         TEST_ERROR;
     }
@@ -2269,7 +2550,7 @@ test_vanishing_datasets(void)
 
     /* Create FAPL for Splitter[sec2|mirror]
      */
-    fapl_id = create_mirroring_split_fapl("vanishing", &names);
+    fapl_id = create_mirroring_split_fapl("vanishing", &names, 0, 0);
     if (H5I_INVALID_HID == fapl_id) {
         TEST_ERROR;
     }
@@ -2452,7 +2733,7 @@ test_concurrent_access(void)
         char  _name[16] = "";
         hid_t _fapl_id  = H5I_INVALID_HID;
         HDsnprintf(_name, 15, "concurrent%d", i);
-        _fapl_id = create_mirroring_split_fapl(_name, &bundle[i].names);
+        _fapl_id = create_mirroring_split_fapl(_name, &bundle[i].names, 0, 0);
         if (H5I_INVALID_HID == _fapl_id) {
             TEST_ERROR;
         }
@@ -2612,6 +2893,7 @@ main(void)
         nerrors -= test_create_and_close();
         nerrors -= test_basic_dataset_write();
         nerrors -= test_chunked_dataset_write();
+        nerrors -= test_batched_dataset_write();
         nerrors -= test_on_disk_zoo();
         nerrors -= test_vanishing_datasets();
         nerrors -= test_concurrent_access();
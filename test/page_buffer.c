@@ -51,6 +51,7 @@ static unsigned test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
 static unsigned test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_replacement_policy(hid_t orig_fapl, const char *env_h5_drvr);
 
 /* helper routines */
 static unsigned create_file(char *filename, hid_t fcpl, hid_t fapl);
@@ -1999,6 +2000,242 @@ error:
 
     return 1;
 } /* test_stats_collection */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_replacement_policy()
+ *
+ * Purpose:     Check that with the 2Q and ARC replacement policies, a
+ *              sequential scan of raw data does not evict metadata pages
+ *              that are in use, while it does with LRU.  Also checks the
+ *              page buffer statistics kept by type of page.
+ *
+ *              The page buffer holds 10 pages.  Three B-tree pages are
+ *              written and read, then enough raw data pages are read to
+ *              push them out of the page buffer (under 2Q, they are
+ *              remembered as ghosts), and the B-tree pages are read again.
+ *              This makes them "hot" for 2Q and ARC.  A scan of 40 raw
+ *              data pages then evicts them with LRU only.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_replacement_policy(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char                  filename[FILENAME_LEN]; /* Filename to use */
+    hid_t                 file_id = -1;           /* File ID */
+    hid_t                 fcpl    = -1;
+    hid_t                 fapl    = -1;
+    hid_t                 fapl2   = -1;
+    H5F_page_buf_policy_t policy;
+    H5F_page_buf_policy_t policy_out;
+    herr_t                ret;
+    size_t                page_size = sizeof(int) * 200;
+    size_t                num_raw   = 40;
+    size_t                num_warm  = 12;
+    size_t                num_meta  = 3;
+    haddr_t               meta_addr = HADDR_UNDEF;
+    haddr_t               raw_addr  = HADDR_UNDEF;
+    haddr_t               warm_addr = HADDR_UNDEF;
+    int *                 data      = NULL;
+    H5F_t *               f         = NULL;
+    size_t                i;
+    int                   t;
+
+    TESTING("Page Buffer Replacement Policies");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if ((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    if (set_multi_split(env_h5_drvr, fapl, (hsize_t)page_size) != 0)
+        TEST_ERROR;
+
+    if ((data = (int *)HDcalloc((num_raw + num_warm) * 200, sizeof(int))) == NULL)
+        TEST_ERROR
+
+    if ((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_file_space_page_size(fcpl, (hsize_t)page_size) < 0)
+        TEST_ERROR;
+
+    /* keep 10 pages at max in the page buffer, with no minimum for either type */
+    if (H5Pset_page_buffer_size(fapl, page_size * 10, 0, 0) < 0)
+        TEST_ERROR;
+
+    /* Check the policy property */
+    if (H5Pget_page_buffer_policy(fapl, &policy_out) < 0)
+        TEST_ERROR;
+    if (policy_out != H5F_PAGE_BUF_POLICY_LRU)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_page_buffer_policy(fapl, H5F_PAGE_BUF_POLICY_NTYPES);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    for (t = (int)H5F_PAGE_BUF_POLICY_LRU; t < (int)H5F_PAGE_BUF_POLICY_NTYPES; t++) {
+        unsigned type_hits[H5FD_MEM_NTYPES];
+        unsigned type_misses[H5FD_MEM_NTYPES];
+        unsigned type_evictions[H5FD_MEM_NTYPES];
+        unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+        unsigned sum_hits = 0, sum_misses = 0, sum_evictions = 0;
+
+        policy = (H5F_page_buf_policy_t)t;
+        if (H5Pset_page_buffer_policy(fapl, policy) < 0)
+            TEST_ERROR;
+
+        if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+            FAIL_STACK_ERROR;
+
+        /* The policy is reported by the file's access property list */
+        if ((fapl2 = H5Fget_access_plist(file_id)) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Pget_page_buffer_policy(fapl2, &policy_out) < 0)
+            FAIL_STACK_ERROR;
+        if (policy_out != policy)
+            TEST_ERROR;
+        if (H5Pclose(fapl2) < 0)
+            FAIL_STACK_ERROR;
+        fapl2 = -1;
+
+        /* Get a pointer to the internal file object */
+        if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+            FAIL_STACK_ERROR;
+
+        if (HADDR_UNDEF == (meta_addr = H5MF_alloc(f, H5FD_MEM_BTREE, page_size * num_meta)))
+            FAIL_STACK_ERROR;
+        if (HADDR_UNDEF == (raw_addr = H5MF_alloc(f, H5FD_MEM_DRAW, page_size * (num_raw + num_warm))))
+            FAIL_STACK_ERROR;
+        warm_addr = raw_addr + num_raw * page_size;
+
+        /* Write the raw data (this bypasses the page buffer) */
+        for (i = 0; i < (num_raw + num_warm) * 200; i++)
+            data[i] = (int)i;
+        if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, page_size * (num_raw + num_warm), data) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Write and read the B-tree pages */
+        for (i = 0; i < num_meta; i++)
+            if (H5F_block_write(f, H5FD_MEM_BTREE, meta_addr + i * page_size, sizeof(int) * 100, data) < 0)
+                FAIL_STACK_ERROR;
+        for (i = 0; i < num_meta; i++)
+            if (H5F_block_read(f, H5FD_MEM_BTREE, meta_addr + i * page_size, sizeof(int) * 100, data) < 0)
+                FAIL_STACK_ERROR;
+
+        /* Read 12 other raw data pages: this evicts all the pages loaded
+         * so far, and two of the raw data pages, so the B-tree pages are
+         * among the 5 most recently evicted ones that 2Q remembers
+         */
+        for (i = 0; i < num_warm; i++)
+            if (H5F_block_read(f, H5FD_MEM_DRAW, warm_addr + i * page_size, sizeof(int) * 100, data) < 0)
+                FAIL_STACK_ERROR;
+
+        /* Use the B-tree pages again */
+        for (i = 0; i < num_meta; i++)
+            if (H5F_block_read(f, H5FD_MEM_BTREE, meta_addr + i * page_size, sizeof(int) * 100, data) < 0)
+                FAIL_STACK_ERROR;
+
+        if (H5Freset_page_buffering_stats(file_id) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Scan all the raw data, then use the B-tree pages again */
+        for (i = 0; i < num_raw; i++) {
+            if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + i * page_size, sizeof(int) * 100, data) < 0)
+                FAIL_STACK_ERROR;
+            if (data[0] != (int)(i * 200))
+                TEST_ERROR;
+        } /* end for */
+        for (i = 0; i < num_meta; i++)
+            if (H5F_block_read(f, H5FD_MEM_BTREE, meta_addr + i * page_size, sizeof(int) * 100, data) < 0)
+                FAIL_STACK_ERROR;
+
+        if (H5Fget_page_buffering_type_stats(file_id, type_hits, type_misses, type_evictions) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses) < 0)
+            FAIL_STACK_ERROR;
+
+        if (H5F_PAGE_BUF_POLICY_LRU == policy) {
+            /* The scan evicted the B-tree pages */
+            if (type_hits[H5FD_MEM_BTREE] != 0)
+                TEST_ERROR;
+            if (type_misses[H5FD_MEM_BTREE] != num_meta)
+                TEST_ERROR;
+            if (type_evictions[H5FD_MEM_BTREE] != num_meta)
+                TEST_ERROR;
+        } /* end if */
+        else {
+            /* The B-tree pages survived the scan */
+            if (type_hits[H5FD_MEM_BTREE] != num_meta)
+                TEST_ERROR;
+            if (type_misses[H5FD_MEM_BTREE] != 0)
+                TEST_ERROR;
+            if (type_evictions[H5FD_MEM_BTREE] != 0)
+                TEST_ERROR;
+        } /* end else */
+        if (type_misses[H5FD_MEM_DRAW] != num_raw)
+            TEST_ERROR;
+        if (type_evictions[H5FD_MEM_DRAW] == 0)
+            TEST_ERROR;
+
+        /* The statistics by type add up to the totals */
+        for (i = 0; i < H5FD_MEM_NTYPES; i++) {
+            sum_hits += type_hits[i];
+            sum_misses += type_misses[i];
+            sum_evictions += type_evictions[i];
+        } /* end for */
+        if (sum_hits != hits[0] + hits[1])
+            TEST_ERROR;
+        if (sum_misses != misses[0] + misses[1])
+            TEST_ERROR;
+        if (sum_evictions != evictions[0] + evictions[1])
+            TEST_ERROR;
+
+        /* Resetting the statistics clears the statistics by type */
+        if (H5Freset_page_buffering_stats(file_id) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Fget_page_buffering_type_stats(file_id, type_hits, NULL, type_evictions) < 0)
+            FAIL_STACK_ERROR;
+        if (type_hits[H5FD_MEM_DRAW] != 0 || type_evictions[H5FD_MEM_DRAW] != 0)
+            TEST_ERROR;
+
+        if (H5Fclose(file_id) < 0)
+            FAIL_STACK_ERROR;
+        file_id = -1;
+    } /* end for */
+
+    if (H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(data);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if (data)
+            HDfree(data);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* test_replacement_policy */
 #endif /* #ifndef H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -2175,6 +2412,7 @@ main(void)
     nerrors += test_lru_processing(fapl, env_h5_drvr);
     nerrors += test_min_threshold(fapl, env_h5_drvr);
     nerrors += test_stats_collection(fapl, env_h5_drvr);
+    nerrors += test_replacement_policy(fapl, env_h5_drvr);
 
 #endif /* H5_HAVE_PARALLEL */
 
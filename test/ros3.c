@@ -1704,6 +1704,458 @@ error:
 
 } /* test_H5F_integration */
 
+/*---------------------------------------------------------------------------
+ *
+ * Local HTTP stand-in for S3
+ *
+ * A minimal HTTP/1.1 server, forked from the test process and bound to the
+ * loopback interface, that answers HEAD and (ranged) GET requests for
+ * files in the current directory.  It is just enough for the ros3 driver:
+ * `Content-Length` on every response, `206 Partial Content` for a single
+ * `Range: bytes=a-b` or `bytes=a-`, keep-alive connections, and one
+ * process per connection so that concurrent range GETs are really served
+ * concurrently.
+ *
+ * It lets the block cache, prefetch, and connection pool be exercised
+ * without network access or S3 credentials.
+ *
+ *---------------------------------------------------------------------------
+ */
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5_HAVE_SYS_SOCKET_H) &&                  \
+    defined(H5_HAVE_NETINET_IN_H) && defined(H5_HAVE_ARPA_INET_H)
+#define ROS3_TEST_LOCAL_SERVER 1
+#endif
+
+#define LOCAL_TEST_RESOURCE   "ros3_local_test.dat"
+#define LOCAL_TEST_FILESIZE   ((size_t)(1024 * 1024 + 123))
+#define LOCAL_TEST_BLOCK_SIZE 4096
+#define LOCAL_TEST_NBLOCKS    16
+#define LOCAL_TEST_PREFETCH   10000
+#define LOCAL_TEST_NCONN      4
+
+#ifdef ROS3_TEST_LOCAL_SERVER
+
+/* Write all of `buf` to socket `fd`; return 0 on success, -1 on failure */
+static int
+local_http_send(int fd, const void *buf, size_t len)
+{
+    const char *p = (const char *)buf;
+
+    while (len > 0) {
+        ssize_t n = HDwrite(fd, p, len);
+
+        if (n <= 0)
+            return -1;
+        p += n;
+        len -= (size_t)n;
+    }
+
+    return 0;
+} /* local_http_send */
+
+/* Answer requests on one connection until the client hangs up */
+static void
+local_http_serve_connection(int conn)
+{
+    char   req[4096];
+    size_t req_len = 0;
+
+    for (;;) {
+        char               method[8];
+        char               path[S3_TEST_MAX_URL_SIZE];
+        char               header[256];
+        char               body[65536];
+        char *             hdr_end = NULL;
+        char *             range   = NULL;
+        unsigned long long first   = 0;
+        unsigned long long last    = 0;
+        unsigned long long fsize   = 0;
+        h5_stat_t          sb;
+        size_t             consumed = 0;
+        int                ranged   = 0;
+        int                fd       = -1;
+        int                n        = 0;
+
+        /* Collect a complete request head */
+        req[req_len] = '\0';
+        while (NULL == (hdr_end = HDstrstr(req, "\r\n\r\n"))) {
+            ssize_t nread;
+
+            if (req_len >= sizeof(req) - 1)
+                return;
+            if ((nread = HDread(conn, req + req_len, sizeof(req) - 1 - req_len)) <= 0)
+                return;
+            req_len += (size_t)nread;
+            req[req_len] = '\0';
+        }
+        consumed = (size_t)(hdr_end - req) + 4;
+
+        if (2 != HDsscanf(req, "%7s %255s", method, path))
+            return;
+
+        if (NULL != (range = HDstrstr(req, "\r\nRange: bytes="))) {
+            range += HDstrlen("\r\nRange: bytes=");
+            first = HDstrtoull(range, &range, 10);
+            if (*range++ != '-')
+                return;
+            last   = (*range >= '0' && *range <= '9') ? HDstrtoull(range, NULL, 10) : ~0ULL;
+            ranged = 1;
+        }
+
+        /* Only plain names in the current directory are served */
+        if (path[0] == '/' && path[1] != '\0' && NULL == HDstrchr(path + 1, '/'))
+            fd = HDopen(path + 1, O_RDONLY);
+
+        if (fd < 0 || HDfstat(fd, &sb) < 0) {
+            n = HDsnprintf(header, sizeof(header), "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+            first = 1;
+            last  = 0;
+        }
+        else {
+            fsize = (unsigned long long)sb.st_size;
+            if (!ranged) {
+                first = 0;
+                last  = fsize - 1;
+                n     = HDsnprintf(header, sizeof(header), "HTTP/1.1 200 OK\r\nContent-Length: %llu\r\n\r\n",
+                               fsize);
+            }
+            else {
+                if (last >= fsize)
+                    last = fsize - 1;
+                n = HDsnprintf(header, sizeof(header),
+                               "HTTP/1.1 206 Partial Content\r\nContent-Length: %llu\r\n"
+                               "Content-Range: bytes %llu-%llu/%llu\r\n\r\n",
+                               last - first + 1, first, last, fsize);
+            }
+        }
+
+        if (n <= 0 || local_http_send(conn, header, (size_t)n) < 0)
+            return;
+
+        /* Send the requested bytes for GET */
+        if (fd >= 0 && !HDstrcmp(method, "GET"))
+            while (first <= last) {
+                size_t  want = (size_t)MIN(sizeof(body), last - first + 1);
+                ssize_t got  = HDpread(fd, body, want, (HDoff_t)first);
+
+                if (got <= 0 || local_http_send(conn, body, (size_t)got) < 0)
+                    return;
+                first += (unsigned long long)got;
+            }
+        if (fd >= 0)
+            HDclose(fd);
+
+        /* Keep anything already received of the next request */
+        HDmemmove(req, req + consumed, req_len - consumed);
+        req_len -= consumed;
+    }
+} /* local_http_serve_connection */
+
+/*---------------------------------------------------------------------------
+ *
+ * Function: local_http_server_start()
+ *
+ * Purpose:
+ *
+ *     Fork the local HTTP server, listening on an ephemeral loopback port
+ *     that is returned through `port`.
+ *
+ * Return:
+ *
+ *     Process id of the server, or -1 on failure.
+ *
+ *---------------------------------------------------------------------------
+ */
+static pid_t
+local_http_server_start(unsigned *port)
+{
+    struct sockaddr_in addr;
+    socklen_t          addr_len = (socklen_t)sizeof(addr);
+    int                lsock    = -1;
+    int                one      = 1;
+    pid_t              pid      = -1;
+
+    if ((lsock = HDsocket(AF_INET, SOCK_STREAM, 0)) < 0)
+        return -1;
+    (void)HDsetsockopt(lsock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    HDmemset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = HDhtonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    if (HDbind(lsock, (struct sockaddr *)&addr, addr_len) < 0 || HDlisten(lsock, 16) < 0 ||
+        getsockname(lsock, (struct sockaddr *)&addr, &addr_len) < 0) {
+        HDclose(lsock);
+        return -1;
+    }
+    *port = (unsigned)ntohs(addr.sin_port);
+
+    if ((pid = HDfork()) == 0) {
+        /* Server: one child per connection; children reap themselves */
+        HDsignal(SIGCHLD, SIG_IGN);
+        for (;;) {
+            int conn = HDaccept(lsock, NULL, NULL);
+
+            if (conn < 0)
+                continue;
+            if (HDfork() == 0) {
+                HDclose(lsock);
+                local_http_serve_connection(conn);
+                HDclose(conn);
+                HD_exit(0);
+            }
+            HDclose(conn);
+        }
+    }
+
+    HDclose(lsock);
+    return pid;
+} /* local_http_server_start */
+
+/* Stop the server started by local_http_server_start() */
+static void
+local_http_server_stop(pid_t pid)
+{
+    if (pid > 0) {
+        HDkill(pid, SIGTERM);
+        (void)HDwaitpid(pid, NULL, 0);
+    }
+} /* local_http_server_stop */
+
+/* Contents of byte `i` of the local test resource, version `gen` */
+static unsigned char
+local_test_byte(size_t i, unsigned gen)
+{
+    return (unsigned char)((i * 7 + i / 251 + gen * 101) & 0xff);
+} /* local_test_byte */
+
+/* (Re)write the local test resource, version `gen`; 0 on success */
+static int
+local_test_write_resource(unsigned gen)
+{
+    unsigned char *buf = NULL;
+    FILE *         fp  = NULL;
+    size_t         i   = 0;
+    int            ret = -1;
+
+    if (NULL == (buf = (unsigned char *)HDmalloc(LOCAL_TEST_FILESIZE)))
+        return -1;
+    for (i = 0; i < LOCAL_TEST_FILESIZE; i++)
+        buf[i] = local_test_byte(i, gen);
+    if (NULL != (fp = HDfopen(LOCAL_TEST_RESOURCE, "wb"))) {
+        if (LOCAL_TEST_FILESIZE == HDfwrite(buf, 1, LOCAL_TEST_FILESIZE, fp))
+            ret = 0;
+        if (HDfclose(fp) != 0)
+            ret = -1;
+    }
+    HDfree(buf);
+
+    return ret;
+} /* local_test_write_resource */
+
+/* Check `len` bytes read at `addr` against version `gen`; 0 if they match */
+static int
+local_test_check(const unsigned char *buf, size_t addr, size_t len, unsigned gen)
+{
+    size_t i = 0;
+
+    for (i = 0; i < len; i++)
+        if (buf[i] != local_test_byte(addr + i, gen)) {
+            HDprintf("byte %zu: expected %u, got %u\n", addr + i, (unsigned)local_test_byte(addr + i, gen),
+                     (unsigned)buf[i]);
+            return -1;
+        }
+
+    return 0;
+} /* local_test_check */
+
+#endif /* ROS3_TEST_LOCAL_SERVER */
+
+/*---------------------------------------------------------------------------
+ *
+ * Function: test_cache_and_parallel_reads()
+ *
+ * Purpose:
+ *
+ *     Exercise the block cache, open-time prefetch, and concurrent range
+ *     GETs configured with H5Pset_fapl_ros3_cache() against the local HTTP
+ *     stand-in.
+ *
+ *     Reads that straddle the prefetch region, block boundaries, and the
+ *     end of the file must return the file's contents, as must large reads
+ *     split over several connections.  To show that blocks really are
+ *     served from the cache, the resource is rewritten on disk part way
+ *     through: blocks already cached (and the prefetched region) must keep
+ *     returning the old contents, while blocks never read return the new.
+ *
+ * Return:
+ *
+ *     PASSED : 0
+ *     FAILED : 1
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+test_cache_and_parallel_reads(void)
+{
+#ifdef ROS3_TEST_LOCAL_SERVER
+    struct testcase {
+        size_t addr;
+        size_t len;
+    };
+    struct testcase cases[] = {
+        {0, 512},                                /* prefetched region       */
+        {LOCAL_TEST_PREFETCH - 10, 20},          /* leaves prefetch region  */
+        {5 * LOCAL_TEST_BLOCK_SIZE - 1, 2},      /* block boundary          */
+        {40000, 12000},                          /* several cached blocks   */
+        {LOCAL_TEST_FILESIZE - 100, 100},        /* short last block        */
+        {40000, 12000},                          /* same again, all hits    */
+        {0, LOCAL_TEST_FILESIZE},                /* whole file, concurrent  */
+        {300000, 600000},                        /* bypasses the cache      */
+    };
+    char           url[S3_TEST_MAX_URL_SIZE];
+    unsigned char *buf          = NULL;
+    H5FD_t *       fd           = NULL;
+    hid_t          fapl_id      = H5I_INVALID_HID;
+    pid_t          server       = -1;
+    unsigned       port         = 0;
+    size_t         block_size   = 0;
+    size_t         nblocks      = 0;
+    size_t         prefetch     = 0;
+    unsigned       nconnections = 0;
+    herr_t         ret          = FAIL;
+    size_t         i            = 0;
+#endif /* ROS3_TEST_LOCAL_SERVER */
+
+    TESTING("ROS3 VFD block cache and parallel reads (local server)");
+
+#ifndef ROS3_TEST_LOCAL_SERVER
+    SKIPPED();
+    HDputs("    local HTTP server not supported on this platform");
+    HDfflush(stdout);
+    return 0;
+#else
+
+    /*********
+     * SETUP *
+     *********/
+
+    FAIL_IF(0 != local_test_write_resource(0))
+    FAIL_IF(0 > (server = local_http_server_start(&port)))
+    FAIL_IF(S3_TEST_MAX_URL_SIZE <=
+            HDsnprintf(url, S3_TEST_MAX_URL_SIZE, "http://127.0.0.1:%u/%s", port, LOCAL_TEST_RESOURCE))
+    FAIL_IF(NULL == (buf = (unsigned char *)HDmalloc(LOCAL_TEST_FILESIZE)))
+
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    FAIL_IF(fapl_id < 0)
+
+    /* cache settings need the ros3 driver */
+    H5E_BEGIN_TRY { ret = H5Pset_fapl_ros3_cache(fapl_id, 4096, 16, 0, 1); }
+    H5E_END_TRY;
+    JSVERIFY(FAIL, ret, "cache settings on non-ros3 fapl")
+
+    FAIL_IF(FAIL == H5Pset_fapl_ros3(fapl_id, &anonymous_fa))
+
+    /* defaults: no cache, no prefetch, one connection */
+    FAIL_IF(FAIL == H5Pget_fapl_ros3_cache(fapl_id, &block_size, &nblocks, &prefetch, &nconnections))
+    JSVERIFY(H5FD_ROS3_DEFAULT_BLOCK_SIZE, block_size, NULL)
+    JSVERIFY(0, nblocks, NULL)
+    JSVERIFY(0, prefetch, NULL)
+    JSVERIFY(1, nconnections, NULL)
+
+    /* bad settings are rejected */
+    H5E_BEGIN_TRY { ret = H5Pset_fapl_ros3_cache(fapl_id, 0, 16, 0, 1); }
+    H5E_END_TRY;
+    JSVERIFY(FAIL, ret, "zero block size")
+    H5E_BEGIN_TRY { ret = H5Pset_fapl_ros3_cache(fapl_id, 4096, 16, 0, 0); }
+    H5E_END_TRY;
+    JSVERIFY(FAIL, ret, "zero connections")
+    H5E_BEGIN_TRY { ret = H5Pset_fapl_ros3_cache(fapl_id, 4096, 16, 0, H5FD_ROS3_MAX_CONNECTIONS + 1); }
+    H5E_END_TRY;
+    JSVERIFY(FAIL, ret, "too many connections")
+
+    FAIL_IF(FAIL == H5Pset_fapl_ros3_cache(fapl_id, LOCAL_TEST_BLOCK_SIZE, LOCAL_TEST_NBLOCKS,
+                                           LOCAL_TEST_PREFETCH, LOCAL_TEST_NCONN))
+    FAIL_IF(FAIL == H5Pget_fapl_ros3_cache(fapl_id, &block_size, &nblocks, &prefetch, &nconnections))
+    JSVERIFY(LOCAL_TEST_BLOCK_SIZE, block_size, NULL)
+    JSVERIFY(LOCAL_TEST_NBLOCKS, nblocks, NULL)
+    JSVERIFY(LOCAL_TEST_PREFETCH, prefetch, NULL)
+    JSVERIFY(LOCAL_TEST_NCONN, nconnections, NULL)
+
+    fd = H5FDopen(url, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF);
+    FAIL_IF(NULL == fd)
+    JSVERIFY(LOCAL_TEST_FILESIZE, H5FDget_eof(fd, H5FD_MEM_DEFAULT), NULL)
+    FAIL_IF(FAIL == H5FDset_eoa(fd, H5FD_MEM_DEFAULT, (haddr_t)LOCAL_TEST_FILESIZE))
+
+    /*********
+     * TESTS *
+     *********/
+
+    for (i = 0; i < NELMTS(cases); i++) {
+        HDmemset(buf, 0, LOCAL_TEST_FILESIZE);
+        FAIL_IF(FAIL == H5FDread(fd, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)cases[i].addr, cases[i].len, buf))
+        FAIL_IF(0 != local_test_check(buf, cases[i].addr, cases[i].len, 0))
+    }
+
+    /* Change the resource behind the driver's back */
+    FAIL_IF(0 != local_test_write_resource(1))
+
+    /* cached blocks keep their contents */
+    FAIL_IF(FAIL == H5FDread(fd, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)40000, 100, buf))
+    FAIL_IF(0 != local_test_check(buf, 40000, 100, 0))
+
+    /* so does the prefetched region */
+    FAIL_IF(FAIL == H5FDread(fd, H5FD_MEM_SUPER, H5P_DEFAULT, (haddr_t)0, 100, buf))
+    FAIL_IF(0 != local_test_check(buf, 0, 100, 0))
+
+    /* blocks never read come from the server */
+    FAIL_IF(FAIL == H5FDread(fd, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)700000, 100, buf))
+    FAIL_IF(0 != local_test_check(buf, 700000, 100, 1))
+
+    /* reads past the end of the file still fail */
+    H5E_BEGIN_TRY
+    {
+        ret = H5FDread(fd, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(LOCAL_TEST_FILESIZE - 10), 20, buf);
+    }
+    H5E_END_TRY;
+    JSVERIFY(FAIL, ret, "read past EOF")
+
+    /************
+     * TEARDOWN *
+     ************/
+
+    FAIL_IF(FAIL == H5FDclose(fd))
+    fd = NULL;
+    FAIL_IF(FAIL == H5Pclose(fapl_id))
+    fapl_id = H5I_INVALID_HID;
+
+    local_http_server_stop(server);
+    HDfree(buf);
+    HDremove(LOCAL_TEST_RESOURCE);
+
+    PASSED();
+    return 0;
+
+error:
+    /***********
+     * CLEANUP *
+     ***********/
+
+    if (fd)
+        (void)H5FDclose(fd);
+    if (fapl_id >= 0) {
+        H5E_BEGIN_TRY { (void)H5Pclose(fapl_id); }
+        H5E_END_TRY;
+    }
+    local_http_server_stop(server);
+    HDfree(buf);
+    HDremove(LOCAL_TEST_RESOURCE);
+
+    return 1;
+#endif /* ROS3_TEST_LOCAL_SERVER */
+
+} /* test_cache_and_parallel_reads */
+
 #endif /* H5_HAVE_ROS3_VFD */
 
 /*-------------------------------------------------------------------------
@@ -1810,6 +2262,7 @@ main(void)
     nerrors += test_noops_and_autofails();
     nerrors += test_cmp();
     nerrors += test_H5F_integration();
+    nerrors += test_cache_and_parallel_reads();
 
     if (nerrors > 0) {
         HDprintf("***** %d ros3 TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
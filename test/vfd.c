@@ -24,6 +24,10 @@
 #define FAMILY_NUMBER 4
 #define FAMILY_SIZE   (1 * KB)
 #define FAMILY_SIZE2  (5 * KB)
+
+#define FAMILY_CONCUR_MEMB_SIZE (4 * KB)
+#define FAMILY_CONCUR_FILESIZE  (64 * KB)
+#define FAMILY_CONCUR_NPIECES   6
 #define MULTI_SIZE    128
 #define SPLITTER_SIZE 8 /* dimensions of a dataset */
 
@@ -32,12 +36,18 @@
 #define CORE_DSET_NAME "core dset"
 #define CORE_DSET_DIM1 1024
 #define CORE_DSET_DIM2 32
+#define CORE_HUGE_INCREMENT (2 * 1024 * KB)
 
 #define DSET1_NAME "dset1"
 #define DSET1_DIM1 1024
 #define DSET1_DIM2 32
 #define DSET3_NAME "dset3"
 
+#define VECTOR_NEXTENTS 6
+#define VECTOR_EOA      (16 * KB)
+#define VECTOR_PIECE    512
+#define VECTOR_NPIECES  16
+
 /* Macros for Direct VFD */
 #ifdef H5_HAVE_DIRECT
 #define MBOUNDARY  512
@@ -62,14 +72,31 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "vector_file",        /*14*/
+                          "mmap_file",          /*15*/
+                          "striped_file",       /*16*/
+                          "readahead_file",     /*17*/
+                          "core_paged_file",    /*18*/
+                          "family_concur_",     /*19*/
+                          "log_trace_file",     /*20*/
                           NULL};
 
-#define LOG_FILENAME "log_vfd_out.log"
+#define LOG_FILENAME       "log_vfd_out.log"
+#define LOG_TRACE_FILENAME "log_vfd_trace.bin"
+#define LOG_TRACE_PIECE    512
+#define LOG_TRACE_NWRITES  8
 
 #define COMPAT_BASENAME       "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
 #define SPLITTER_DATASET_NAME "dataset"
 
+/* Splitter write-behind tests: memory budget for queued W/O writes, and the
+ * size and number of the pieces written through the raw VFD interface.
+ */
+#define SPLITTER_WRITE_BEHIND_SIZE 512
+#define SPLITTER_WB_PIECE          1024
+#define SPLITTER_WB_NPIECES        64
+
 /* Macro: HEXPRINT()
  * Helper macro to pretty-print hexadecimal output of a buffer of known size.
  * Each line has the address of the first printed byte, and four columns of
@@ -98,10 +125,12 @@ static int splitter_prepare_file_paths(H5FD_splitter_vfd_config_t *vfd_config, c
 static int splitter_create_single_file_at(const char *filename, hid_t fapl_id,
                                           const struct splitter_dataset_def *data);
 static int splitter_compare_expected_data(hid_t file_id, const struct splitter_dataset_def *data);
-static int run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_errors,
+static int run_splitter_test(const struct splitter_dataset_def *data, size_t wo_write_behind_size,
+                             hbool_t ignore_wo_errors,
                              hbool_t provide_logfile_path, hid_t sub_fapl_ids[2]);
 static int splitter_RO_test(const struct splitter_dataset_def *data, hid_t child_fapl_id);
 static int splitter_tentative_open_test(hid_t child_fapl_id);
+static int splitter_write_behind_test(hid_t child_fapl_id);
 static int file_exists(const char *filename, hid_t fapl_id);
 
 /*-------------------------------------------------------------------------
@@ -219,6 +248,571 @@ error:
     return -1;
 } /* end test_sec2() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_sec2_striping
+ *
+ * Purpose:     Tests the SEC2 driver's striped reads: the property list
+ *              settings, reads split into many slices (including a
+ *              partial last slice and a read past the end of the file),
+ *              and a dataset read through the library.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define STRIPE_SIZE     (4 * KB)
+#define STRIPE_THREADS  4
+#define STRIPE_FILESIZE (256 * KB + 100)
+static herr_t
+test_sec2_striping(void)
+{
+    hid_t          fid         = -1;   /* file ID                      */
+    hid_t          fapl_id     = -1;   /* file access property list ID */
+    hid_t          fapl_id_out = -1;   /* from H5Fget_access_plist     */
+    hid_t          sid         = -1;   /* dataspace ID                 */
+    hid_t          did         = -1;   /* dataset ID                   */
+    H5FD_t *       lf          = NULL; /* VFD struct ptr               */
+    char           filename[1024];     /* filename                     */
+    unsigned char *wbuf = NULL;        /* data written                 */
+    unsigned char *rbuf = NULL;        /* data read back               */
+    size_t         stripe_size = 0;    /* stripe size from the fapl    */
+    unsigned       nthreads    = 0;    /* # of threads from the fapl   */
+    hsize_t        dims[1]     = {STRIPE_FILESIZE};
+    size_t         u;                  /* local index variable         */
+
+    TESTING("SEC2 file driver striped reads");
+
+    if (NULL == (wbuf = (unsigned char *)HDmalloc(STRIPE_FILESIZE)))
+        TEST_ERROR
+    if (NULL == (rbuf = (unsigned char *)HDmalloc(STRIPE_FILESIZE + 8 * KB)))
+        TEST_ERROR
+    for (u = 0; u < STRIPE_FILESIZE; u++)
+        wbuf[u] = (unsigned char)(u % 251);
+
+    /* Check the property list settings */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_striping(fapl_id, &stripe_size, &nthreads) < 0)
+        TEST_ERROR
+    if (stripe_size != H5FD_SEC2_STRIPE_SIZE_DEF || nthreads != 1)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_sec2_striping(fapl_id, STRIPE_SIZE, H5FD_SEC2_STRIPE_THREADS_MAX + 1) >= 0)
+            FAIL_PUTS_ERROR("accepted too many threads");
+    }
+    H5E_END_TRY;
+    if (H5Pset_fapl_sec2_striping(fapl_id, STRIPE_SIZE, STRIPE_THREADS) < 0)
+        TEST_ERROR
+    if (H5FD_SEC2 != H5Pget_driver(fapl_id))
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_striping(fapl_id, &stripe_size, &nthreads) < 0)
+        TEST_ERROR
+    if (stripe_size != STRIPE_SIZE || nthreads != STRIPE_THREADS)
+        TEST_ERROR
+    h5_fixname(FILENAME[16], fapl_id, filename, sizeof(filename));
+
+    /* Reads through the driver */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)(STRIPE_FILESIZE + 8 * KB)) < 0)
+        TEST_ERROR
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, STRIPE_FILESIZE, wbuf) < 0)
+        TEST_ERROR
+
+    /* The whole file, ending with a partial slice */
+    HDmemset(rbuf, 0, STRIPE_FILESIZE);
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, STRIPE_FILESIZE, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, STRIPE_FILESIZE) != 0)
+        TEST_ERROR
+
+    /* An unaligned read with fewer slices than threads */
+    HDmemset(rbuf, 0, STRIPE_FILESIZE);
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 1000, 2 * STRIPE_SIZE + 10, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf + 1000, rbuf, 2 * STRIPE_SIZE + 10) != 0)
+        TEST_ERROR
+
+    /* A read that runs past the end of the file, whose last slices lie
+     * entirely beyond it
+     */
+    HDmemset(rbuf, 0xff, STRIPE_FILESIZE + 8 * KB);
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, STRIPE_FILESIZE + 8 * KB, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, STRIPE_FILESIZE) != 0)
+        TEST_ERROR
+    for (u = STRIPE_FILESIZE; u < STRIPE_FILESIZE + 8 * KB; u++)
+        if (rbuf[u] != 0)
+            TEST_ERROR
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* A contiguous dataset read through the library */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, STRIPE_FILESIZE);
+    if (H5Dread(did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, STRIPE_FILESIZE) != 0)
+        TEST_ERROR
+
+    /* The file keeps the settings */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_striping(fapl_id_out, &stripe_size, &nthreads) < 0)
+        TEST_ERROR
+    if (stripe_size != STRIPE_SIZE || nthreads != STRIPE_THREADS)
+        TEST_ERROR
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[16], fapl_id);
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+} /* end test_sec2_striping() */
+#undef STRIPE_SIZE
+#undef STRIPE_THREADS
+#undef STRIPE_FILESIZE
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sec2_readahead
+ *
+ * Purpose:     Tests the SEC2 driver's read-ahead: the property list
+ *              settings, small sequential reads through the driver, a
+ *              write into data that was read ahead, and the statistics of
+ *              a chunked dataset read through the library.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define RA_MAX      (32 * KB)
+#define RA_READ     (1 * KB)
+#define RA_FILESIZE (256 * KB + 100)
+static herr_t
+test_sec2_readahead(void)
+{
+    hid_t          fid      = -1;   /* file ID                      */
+    hid_t          fapl_id  = -1;   /* file access property list ID */
+    hid_t          dcpl_id  = -1;   /* dataset creation plist ID    */
+    hid_t          sid      = -1;   /* dataspace ID                 */
+    hid_t          did      = -1;   /* dataset ID                   */
+    H5FD_t *       lf       = NULL; /* VFD struct ptr               */
+    char           filename[1024];  /* filename                     */
+    unsigned char *wbuf = NULL;     /* data written                 */
+    unsigned char *rbuf = NULL;     /* data read back               */
+    size_t         max_size    = 0; /* read-ahead size from fapl    */
+    size_t         stripe_size = 0; /* stripe size from the fapl    */
+    unsigned       nthreads    = 0; /* # of threads from the fapl   */
+    hsize_t        reads, hits, fills;
+    hsize_t        dims[1]  = {RA_FILESIZE};
+    hsize_t        cdims[1] = {RA_READ};
+    size_t         u;               /* local index variable         */
+
+    TESTING("SEC2 file driver read-ahead");
+
+    if (NULL == (wbuf = (unsigned char *)HDmalloc(RA_FILESIZE)))
+        TEST_ERROR
+    if (NULL == (rbuf = (unsigned char *)HDmalloc(RA_FILESIZE)))
+        TEST_ERROR
+    for (u = 0; u < RA_FILESIZE; u++)
+        wbuf[u] = (unsigned char)(u % 251);
+
+    /* Check the property list settings */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_readahead(fapl_id, &max_size) < 0)
+        TEST_ERROR
+    if (max_size != 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2_striping(fapl_id, 4 * KB, 2) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2_readahead(fapl_id, RA_MAX) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_readahead(fapl_id, &max_size) < 0)
+        TEST_ERROR
+    if (max_size != RA_MAX)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_striping(fapl_id, &stripe_size, &nthreads) < 0)
+        TEST_ERROR
+    if (stripe_size != 4 * KB || nthreads != 2)
+        TEST_ERROR
+    h5_fixname(FILENAME[17], fapl_id, filename, sizeof(filename));
+
+    /* Small sequential reads through the driver */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)RA_FILESIZE) < 0)
+        TEST_ERROR
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, RA_FILESIZE, wbuf) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, RA_FILESIZE);
+    for (u = 0; u < RA_FILESIZE; u += RA_READ)
+        if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)u, MIN(RA_READ, RA_FILESIZE - u), rbuf + u) < 0)
+            TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, RA_FILESIZE) != 0)
+        TEST_ERROR
+
+    /* Overwrite data that was just read ahead, then read it again */
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, RA_READ, rbuf) < 0)
+        TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, RA_READ, RA_READ, rbuf) < 0)
+        TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 2 * RA_READ, RA_READ, rbuf) < 0)
+        TEST_ERROR
+    for (u = 0; u < RA_READ; u++)
+        wbuf[3 * RA_READ + u] = (unsigned char)~wbuf[3 * RA_READ + u];
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 3 * RA_READ, RA_READ, wbuf + 3 * RA_READ) < 0)
+        TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 3 * RA_READ, RA_READ, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf + 3 * RA_READ, rbuf, RA_READ) != 0)
+        TEST_ERROR
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* A chunked dataset read through the library */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, RA_FILESIZE);
+    if (H5Dread(did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, RA_FILESIZE) != 0)
+        TEST_ERROR
+
+    /* Most chunks come from read-ahead data */
+    if (H5Fget_readahead_stats(fid, &reads, &hits, &fills) < 0)
+        TEST_ERROR
+    if (reads < RA_FILESIZE / RA_READ || hits > reads || hits < reads / 2 || 0 == fills)
+        TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* Without read-ahead the statistics stay at zero */
+    if (H5Pset_fapl_sec2_readahead(fapl_id, 0) < 0)
+        TEST_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dread(did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if (H5Fget_readahead_stats(fid, &reads, &hits, &fills) < 0)
+        TEST_ERROR
+    if (reads != 0 || hits != 0 || fills != 0)
+        TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[17], fapl_id);
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(dcpl_id);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+} /* end test_sec2_readahead() */
+#undef RA_MAX
+#undef RA_READ
+#undef RA_FILESIZE
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Writes a vector of extents through H5FDwrite_vector() and
+ *              checks that they can be read back with H5FDread() and with
+ *              H5FDread_vector(), using a different split of the same
+ *              byte range.  Also checks that a vector read past the end
+ *              of the file returns zeros.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(const char *driver_name, hid_t fapl_id)
+{
+    H5FD_t *       lf = NULL;              /* VFD struct ptr               */
+    char           filename[1024];         /* filename                     */
+    H5FD_mem_t     types[VECTOR_NPIECES];  /* memory types of extents      */
+    haddr_t        addrs[VECTOR_NPIECES];  /* addresses of extents         */
+    size_t         sizes[VECTOR_NPIECES];  /* sizes of extents             */
+    const void *   wbufs[VECTOR_NEXTENTS]; /* write buffers                */
+    void *         rbufs[VECTOR_NPIECES];  /* read buffers                 */
+    unsigned char *wbuf = NULL;            /* data written                 */
+    unsigned char *rbuf = NULL;            /* data read back               */
+    size_t         u;                      /* local index variable         */
+
+    /* Three adjacent extents, a gap, two more adjacent extents and a
+     * zero-sized extent
+     */
+    const haddr_t ext_addrs[VECTOR_NEXTENTS] = {0, KB, 2 * KB, 4 * KB, 4 * KB + 512, 5 * KB};
+    const size_t  ext_sizes[VECTOR_NEXTENTS] = {KB, KB, KB, 512, 512, 0};
+
+    HDprintf("    %-6s", driver_name);
+
+    h5_fixname(FILENAME[14], fapl_id, filename, sizeof(filename));
+
+    if (NULL == (wbuf = (unsigned char *)HDmalloc(8 * KB)))
+        TEST_ERROR
+    if (NULL == (rbuf = (unsigned char *)HDcalloc(1, 8 * KB)))
+        TEST_ERROR
+    for (u = 0; u < 8 * KB; u++)
+        wbuf[u] = (unsigned char)(u % 251);
+
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)VECTOR_EOA) < 0)
+        TEST_ERROR
+
+    /* Write the extents, each from the same offset of the write buffer */
+    for (u = 0; u < VECTOR_NEXTENTS; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = ext_addrs[u];
+        sizes[u] = ext_sizes[u];
+        wbufs[u] = wbuf + ext_addrs[u];
+    } /* end for */
+    if (H5FDwrite_vector(lf, H5P_DEFAULT, VECTOR_NEXTENTS, types, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+
+    /* The addresses must not have been changed */
+    for (u = 0; u < VECTOR_NEXTENTS; u++)
+        if (addrs[u] != ext_addrs[u])
+            TEST_ERROR
+
+    /* Read each extent back with a plain read */
+    for (u = 0; u < VECTOR_NEXTENTS; u++)
+        if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, ext_addrs[u], ext_sizes[u], rbuf + ext_addrs[u]) < 0)
+            TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, 3 * KB) != 0 || HDmemcmp(wbuf + 4 * KB, rbuf + 4 * KB, KB) != 0)
+        TEST_ERROR
+
+    /* Read the first 8 KB back as a vector of adjacent pieces, in reverse
+     * buffer order so that the memory buffers are not contiguous
+     */
+    HDmemset(rbuf, 0, 8 * KB);
+    for (u = 0; u < VECTOR_NPIECES; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = (haddr_t)(u * VECTOR_PIECE);
+        sizes[u] = VECTOR_PIECE;
+        rbufs[u] = rbuf + (VECTOR_NPIECES - 1 - u) * VECTOR_PIECE;
+    } /* end for */
+    if (H5FDread_vector(lf, H5P_DEFAULT, VECTOR_NPIECES, types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    for (u = 0; u < VECTOR_NPIECES; u++) {
+        const unsigned char *expected = wbuf + u * VECTOR_PIECE;
+        hbool_t              written  = (u < 6) || (u == 8) || (u == 9);
+
+        if (written && HDmemcmp(rbufs[u], expected, VECTOR_PIECE) != 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Read past the end of the file (but within the EOA) */
+    HDmemset(rbuf, 0xff, 8 * KB);
+    types[0] = H5FD_MEM_DRAW;
+    addrs[0] = VECTOR_EOA - 2 * KB;
+    sizes[0] = KB;
+    rbufs[0] = rbuf;
+    types[1] = H5FD_MEM_DRAW;
+    addrs[1] = VECTOR_EOA - KB;
+    sizes[1] = KB;
+    rbufs[1] = rbuf + 4 * KB;
+    if (H5FDread_vector(lf, H5P_DEFAULT, 2, types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    for (u = 0; u < KB; u++)
+        if (rbuf[u] != 0 || rbuf[4 * KB + u] != 0)
+            TEST_ERROR
+
+    /* Reading past the EOA must fail */
+    addrs[0] = VECTOR_EOA - 512;
+    sizes[0] = KB;
+    H5E_BEGIN_TRY
+    {
+        if (H5FDread_vector(lf, H5P_DEFAULT, 1, types, addrs, sizes, rbufs) >= 0)
+            TEST_ERROR
+    }
+    H5E_END_TRY;
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+    h5_delete_test_file(FILENAME[14], fapl_id);
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+} /* end test_vector_io_driver() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests the vector I/O calls against drivers with native
+ *              vector I/O callbacks (sec2 and, when it is built, io_uring)
+ *              and against drivers that rely on the library's fallback to
+ *              one read/write per extent.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t fapl_id = H5I_INVALID_HID; /* file access property list ID */
+    int   nerrors = 0;
+
+    HDputs("Testing vector I/O");
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("sec2", fapl_id) < 0 ? 1 : 0;
+
+    if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("core", fapl_id) < 0 ? 1 : 0;
+
+    if (H5Pset_fapl_stdio(fapl_id) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("stdio", fapl_id) < 0 ? 1 : 0;
+
+#ifdef H5_HAVE_URING_VFD
+    {
+        unsigned queue_depth = 0;
+
+        /* Use a queue shorter than the vectors, so requests are refilled */
+        if (H5Pset_fapl_uring(fapl_id, 4) < 0)
+            TEST_ERROR
+        if (H5Pget_fapl_uring(fapl_id, &queue_depth) < 0)
+            TEST_ERROR
+        if (4 != queue_depth)
+            TEST_ERROR
+        nerrors += test_vector_io_driver("uring", fapl_id) < 0 ? 1 : 0;
+    }
+#endif /* H5_HAVE_URING_VFD */
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    return nerrors ? -1 : 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    return -1;
+} /* end test_vector_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_core
  *
@@ -544,16 +1138,185 @@ test_core(void)
         TEST_ERROR;
     if (H5Dclose(did) < 0)
         TEST_ERROR;
-
+
+    HDfree(data_w);
+    HDfree(data_r);
+
+    /* Close and delete the file */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[1], fapl_id);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+
+    if (data_w)
+        HDfree(data_w);
+    if (data_r)
+        HDfree(data_r);
+
+    return -1;
+} /* end test_core() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_core_paged
+ *
+ * Purpose:     Tests the paged store of the CORE driver, with both small
+ *              (malloc'd) and huge (mapped) pages.  Data written across
+ *              many pages must survive growth of the file, flushing to
+ *              the backing store, and reopening with and without pages.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_core_paged(void)
+{
+    hid_t   fid     = -1;     /* file ID                      */
+    hid_t   fapl_id = -1;     /* file access property list ID */
+    hid_t   did     = -1;     /* dataset ID                   */
+    hid_t   sid     = -1;     /* dataspace ID                 */
+    char    filename[1024];   /* filename                     */
+    void *  os_file_handle;   /* OS file handle               */
+    hbool_t paged;            /* paged store flag             */
+    int *   data_w = NULL;    /* data written to the dataset  */
+    int *   data_r = NULL;    /* data read from the dataset   */
+    hsize_t dims[2];          /* dataspace dimensions         */
+    size_t  increments[2] = {CORE_INCREMENT, CORE_HUGE_INCREMENT};
+    herr_t  ret;              /* generic return value         */
+    int     i, u;             /* iterators                    */
+
+    TESTING("CORE file driver paged store");
+
+    /* Get a file access property list and fix up the file name */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[18], fapl_id, filename, sizeof(filename));
+
+    /* The paged store needs the core VFD to be set */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_core_paged_store(fapl_id, TRUE);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("paged store set without the core VFD");
+
+    /* Set up the data */
+    if (NULL == (data_w = (int *)HDmalloc(CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for input array");
+    if (NULL == (data_r = (int *)HDmalloc(CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for output array");
+    for (i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+        data_w[i] = i;
+    dims[0] = CORE_DSET_DIM1;
+    dims[1] = CORE_DSET_DIM2;
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    for (u = 0; u < 2; u++) {
+        /* Set up a paged store with the backing store on */
+        if (H5Pset_fapl_core(fapl_id, increments[u], TRUE) < 0)
+            TEST_ERROR;
+        if (H5Pget_core_paged_store(fapl_id, &paged) < 0)
+            TEST_ERROR;
+        if (FALSE != paged)
+            FAIL_PUTS_ERROR("paged store should be off by default");
+        if (H5Pset_core_paged_store(fapl_id, TRUE) < 0)
+            TEST_ERROR;
+        if (H5Pget_core_paged_store(fapl_id, &paged) < 0)
+            TEST_ERROR;
+        if (TRUE != paged)
+            FAIL_PUTS_ERROR("paged store flag not set");
+
+        /* Create the file and write a dataset which spans many pages */
+        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+            TEST_ERROR;
+        if ((did = H5Dcreate2(fid, CORE_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+            TEST_ERROR;
+        if (H5Dclose(did) < 0)
+            TEST_ERROR;
+
+        /* A paged store has no single buffer to return */
+        H5E_BEGIN_TRY
+        {
+            ret = H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            FAIL_PUTS_ERROR("memory handle returned for a paged store");
+
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR;
+
+        /* Reopen with pages, read the data back, and grow the file */
+        if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+            TEST_ERROR;
+        if ((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(data_w, data_r, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("data read from paged store differs from data written");
+        if (H5Dclose(did) < 0)
+            TEST_ERROR;
+        if ((did = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+            0)
+            TEST_ERROR;
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+            TEST_ERROR;
+        if (H5Dclose(did) < 0)
+            TEST_ERROR;
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR;
+
+        /* Reopen without pages and check both datasets reached the backing store */
+        if (H5Pset_fapl_core(fapl_id, increments[u], FALSE) < 0)
+            TEST_ERROR;
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+            TEST_ERROR;
+        for (i = 0; i < 2; i++) {
+            if ((did = H5Dopen2(fid, i ? "dset2" : CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+            if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+                TEST_ERROR;
+            if (HDmemcmp(data_w, data_r, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int)) != 0)
+                FAIL_PUTS_ERROR("data in backing store differs from data written");
+            if (H5Dclose(did) < 0)
+                TEST_ERROR;
+        } /* end for */
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    /* Clean up */
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR;
     HDfree(data_w);
     HDfree(data_r);
-
-    /* Close and delete the file */
-    if (H5Fclose(fid) < 0)
-        TEST_ERROR;
-    h5_delete_test_file(FILENAME[1], fapl_id);
-
-    /* Close the fapl */
+    h5_delete_test_file(FILENAME[18], fapl_id);
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR;
 
@@ -565,7 +1328,6 @@ error:
     {
         H5Sclose(sid);
         H5Dclose(did);
-        H5Pclose(fapl_id_out);
         H5Pclose(fapl_id);
         H5Fclose(fid);
     }
@@ -577,7 +1339,7 @@ error:
         HDfree(data_r);
 
     return -1;
-} /* end test_core() */
+} /* end test_core_paged() */
 
 /*-------------------------------------------------------------------------
  * Function:    test_direct
@@ -1310,6 +2072,148 @@ error:
     return FAIL;
 } /* end test_family_member_fapl() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_family_concurrency
+ *
+ * Purpose:     Tests family member I/O issued from several threads: a
+ *              request spanning many members, and a vector of requests
+ *              over several members, must transfer the same bytes as
+ *              serial member I/O.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_family_concurrency(void)
+{
+    hid_t          fapl_id = -1; /* file access property list ID */
+    H5FD_t *       lf      = NULL;
+    char           filename[1024];
+    unsigned char *wbuf = NULL, *rbuf = NULL;
+    unsigned       nthreads;
+    herr_t         ret;
+    size_t         u;
+
+    /* Extents of a vector read, several of them spanning members */
+    H5FD_mem_t types[FAMILY_CONCUR_NPIECES];
+    haddr_t    addrs[FAMILY_CONCUR_NPIECES] = {100, 4000, 9000, 20480, 30000, 50000};
+    size_t     sizes[FAMILY_CONCUR_NPIECES] = {200, 5000, 3000, 4096, 12000, 14000};
+    void *     bufs[FAMILY_CONCUR_NPIECES];
+
+    TESTING("FAMILY file driver concurrent member I/O");
+
+    if (NULL == (wbuf = (unsigned char *)HDmalloc(FAMILY_CONCUR_FILESIZE)))
+        TEST_ERROR
+    if (NULL == (rbuf = (unsigned char *)HDmalloc(FAMILY_CONCUR_FILESIZE)))
+        TEST_ERROR
+    for (u = 0; u < FAMILY_CONCUR_FILESIZE; u++)
+        wbuf[u] = (unsigned char)(u % 253);
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+
+    /* The concurrency can only be set with the family driver */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_family_concurrency(fapl_id, 4);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    /* Check the property list settings */
+    if (H5Pset_fapl_family(fapl_id, (hsize_t)FAMILY_CONCUR_MEMB_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_family_concurrency(fapl_id, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 1)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_family_concurrency(fapl_id, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+    if (H5Pset_fapl_family_concurrency(fapl_id, 4) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_family_concurrency(fapl_id, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 4)
+        TEST_ERROR
+    h5_fixname(FILENAME[19], fapl_id, filename, sizeof(filename));
+
+    /* Write and read the whole file, which spans 16 members, at once */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)FAMILY_CONCUR_FILESIZE) < 0)
+        TEST_ERROR
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, FAMILY_CONCUR_FILESIZE, wbuf) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, FAMILY_CONCUR_FILESIZE);
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, FAMILY_CONCUR_FILESIZE, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, FAMILY_CONCUR_FILESIZE) != 0)
+        TEST_ERROR
+
+    /* A vector read over several members */
+    HDmemset(rbuf, 0, FAMILY_CONCUR_FILESIZE);
+    for (u = 0; u < FAMILY_CONCUR_NPIECES; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        bufs[u]  = rbuf + addrs[u];
+    } /* end for */
+    if (H5FDread_vector(lf, H5P_DEFAULT, FAMILY_CONCUR_NPIECES, types, addrs, sizes, bufs) < 0)
+        TEST_ERROR
+    for (u = 0; u < FAMILY_CONCUR_NPIECES; u++)
+        if (HDmemcmp(wbuf + addrs[u], rbuf + addrs[u], sizes[u]) != 0)
+            TEST_ERROR
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Serial member I/O sees the same bytes */
+    if (H5Pset_fapl_family_concurrency(fapl_id, 1) < 0)
+        TEST_ERROR
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)FAMILY_CONCUR_FILESIZE) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, FAMILY_CONCUR_FILESIZE);
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 0, FAMILY_CONCUR_FILESIZE, rbuf) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, FAMILY_CONCUR_FILESIZE) != 0)
+        TEST_ERROR
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    h5_delete_test_file(FILENAME[19], fapl_id);
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return -1;
+} /* end test_family_concurrency() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_multi_opens
  *
@@ -1764,37 +2668,298 @@ test_multi_compat(void)
         TEST_ERROR;
     h5_delete_test_file(FILENAME[9], fapl);
 
-    /* Close the fapl */
-    if (H5Pclose(fapl) < 0)
-        TEST_ERROR;
+    /* Close the fapl */
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    HDfree(buf);
+    HDfree(buf_data);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    HDfree(buf);
+    HDfree(buf_data);
+
+    return FAIL;
+} /* end test_multi_compat() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_log
+ *
+ * Purpose:     Tests the file handle interface for log driver
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Dana Robinson
+ *              Tuesday, March 22, 2011
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_log(void)
+{
+    hid_t         file         = -1;
+    hid_t         fapl         = -1;
+    hid_t         access_fapl  = -1;
+    hid_t         driver_id    = -1; /* ID for this VFD              */
+    unsigned long driver_flags = 0;  /* VFD feature flags            */
+    char          filename[1024];
+    int *         fhandle   = NULL;
+    hsize_t       file_size = 0;
+    unsigned int  flags     = H5FD_LOG_ALL;
+    size_t        buf_size  = 4 * KB;
+
+    TESTING("LOG file driver");
+
+    /* Set property list and file name for log driver. */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_log(fapl, LOG_FILENAME, flags, buf_size) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+
+    /* Check that the VFD feature flags are correct */
+    if ((driver_id = H5Pget_driver(fapl)) < 0)
+        TEST_ERROR
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_AGGREGATE_METADATA))
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_ACCUMULATE_METADATA))
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_DATA_SIEVE))
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_AGGREGATE_SMALLDATA))
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE))
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO))
+        TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR
+    /* Check for extra flags not accounted for above */
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_SUPPORTS_SWMR_IO | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR
+
+    /* Create the test file */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list... */
+    if ((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if (H5FD_LOG != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+
+    /* ...and close the property list */
+    if (H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if (*fhandle < 0)
+        TEST_ERROR;
+
+    /* Check file size API */
+    if (H5Fget_filesize(file, &file_size) < 0)
+        TEST_ERROR;
+
+    /* There is no guarantee the size of metadata in file is constant.
+     * Just try to check if it's reasonable.  It's 2KB right now.
+     */
+    if (file_size < 1 * KB || file_size > 4 * KB)
+        TEST_ERROR;
+
+    /* Close and delete the file */
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[6], fapl);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_log_binary_trace
+ *
+ * Purpose:     Tests the binary trace mode of the log driver: the trace
+ *              file holds a header and one record per read, write and
+ *              truncate, in the order they were issued.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_log_binary_trace(void)
+{
+    hid_t                   fapl_id = H5I_INVALID_HID;
+    hid_t                   fid     = H5I_INVALID_HID;
+    H5FD_t *                lf      = NULL;
+    FILE *                  fp      = NULL;
+    char                    filename[1024];
+    unsigned char           buf[LOG_TRACE_PIECE];
+    H5FD_log_trace_header_t header;
+    H5FD_log_trace_record_t rec;
+    uint64_t                last_start = 0;
+    unsigned                nrecs      = 0;
+    unsigned                u;
+
+    TESTING("LOG file driver binary trace");
+
+    /* A log file name is required in binary trace mode */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_log(fapl_id, NULL, H5FD_LOG_BINARY_TRACE, 0) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[20], fapl_id, filename, sizeof(filename));
+    H5E_BEGIN_TRY
+    {
+        lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF);
+    }
+    H5E_END_TRY;
+    if (lf)
+        TEST_ERROR
+
+    /* Room for three records, so the buffer is written out several times.
+     * The text logging flags are ignored.
+     */
+    if (H5Pset_fapl_log(fapl_id, LOG_TRACE_FILENAME, H5FD_LOG_BINARY_TRACE | H5FD_LOG_ALL,
+                        3 * sizeof(H5FD_log_trace_record_t)) < 0)
+        TEST_ERROR
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)(LOG_TRACE_NWRITES * LOG_TRACE_PIECE)) < 0)
+        TEST_ERROR
+    HDmemset(buf, 0xA5, sizeof(buf));
+    for (u = 0; u < LOG_TRACE_NWRITES; u++)
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(u * LOG_TRACE_PIECE), LOG_TRACE_PIECE, buf) <
+            0)
+            TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_OHDR, H5P_DEFAULT, (haddr_t)LOG_TRACE_PIECE, LOG_TRACE_PIECE / 2, buf) < 0)
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)(2 * LOG_TRACE_PIECE)) < 0)
+        TEST_ERROR
+    if (H5FDtruncate(lf, H5P_DEFAULT, FALSE) < 0)
+        TEST_ERROR
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Check the trace */
+    if (NULL == (fp = HDfopen(LOG_TRACE_FILENAME, "rb")))
+        TEST_ERROR
+    if (1 != HDfread(&header, sizeof(header), 1, fp))
+        TEST_ERROR
+    if (HDmemcmp(header.magic, H5FD_LOG_TRACE_MAGIC, H5FD_LOG_TRACE_MAGIC_LEN) != 0)
+        TEST_ERROR
+    if (header.version != H5FD_LOG_TRACE_VERSION || header.record_size != sizeof(rec) ||
+        header.byte_order != H5FD_LOG_TRACE_BYTE_ORDER)
+        TEST_ERROR
+    while (1 == HDfread(&rec, sizeof(rec), 1, fp)) {
+        if (rec.start_ns < last_start)
+            TEST_ERROR
+        last_start = rec.start_ns;
+
+        if (nrecs < LOG_TRACE_NWRITES) {
+            if (rec.op != H5FD_LOG_TRACE_OP_WRITE || rec.type != H5FD_MEM_DRAW ||
+                rec.addr != nrecs * LOG_TRACE_PIECE || rec.size != LOG_TRACE_PIECE)
+                TEST_ERROR
+        }
+        else if (nrecs == LOG_TRACE_NWRITES) {
+            if (rec.op != H5FD_LOG_TRACE_OP_READ || rec.type != H5FD_MEM_OHDR ||
+                rec.addr != LOG_TRACE_PIECE || rec.size != LOG_TRACE_PIECE / 2)
+                TEST_ERROR
+        }
+        else if (nrecs == LOG_TRACE_NWRITES + 1) {
+            if (rec.op != H5FD_LOG_TRACE_OP_TRUNCATE || rec.addr != 2 * LOG_TRACE_PIECE || rec.size != 0)
+                TEST_ERROR
+        }
+        nrecs++;
+    }
+    if (nrecs != LOG_TRACE_NWRITES + 2)
+        TEST_ERROR
+    HDfclose(fp);
+    fp = NULL;
+
+    /* A file traced through the library with the default buffer size */
+    if (H5Pset_fapl_log(fapl_id, LOG_TRACE_FILENAME, H5FD_LOG_BINARY_TRACE, 0) < 0)
+        TEST_ERROR
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = H5I_INVALID_HID;
+    if (NULL == (fp = HDfopen(LOG_TRACE_FILENAME, "rb")))
+        TEST_ERROR
+    if (1 != HDfread(&header, sizeof(header), 1, fp))
+        TEST_ERROR
+    for (nrecs = 0; 1 == HDfread(&rec, sizeof(rec), 1, fp); nrecs++)
+        if (rec.op != H5FD_LOG_TRACE_OP_WRITE && rec.op != H5FD_LOG_TRACE_OP_READ &&
+            rec.op != H5FD_LOG_TRACE_OP_TRUNCATE)
+            TEST_ERROR
+    if (0 == nrecs)
+        TEST_ERROR
+    HDfclose(fp);
+    fp = NULL;
 
-    HDfree(buf);
-    HDfree(buf_data);
+    h5_delete_test_file(FILENAME[20], fapl_id);
+    HDremove(LOG_TRACE_FILENAME);
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
 
     PASSED();
-
-    return SUCCEED;
+    return 0;
 
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(space);
-        H5Dclose(dset);
-        H5Pclose(fapl);
-        H5Fclose(file);
+        H5Fclose(fid);
+        H5Pclose(fapl_id);
+        H5FDclose(lf);
     }
     H5E_END_TRY;
-
-    HDfree(buf);
-    HDfree(buf_data);
-
-    return FAIL;
-} /* end test_multi_compat() */
+    if (fp)
+        HDfclose(fp);
+    return -1;
+}
 
 /*-------------------------------------------------------------------------
- * Function:    test_log
+ * Function:    test_stdio
  *
- * Purpose:     Tests the file handle interface for log driver
+ * Purpose:     Tests the file handle interface for STDIO driver
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -1805,7 +2970,7 @@ error:
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_log(void)
+test_stdio(void)
 {
     hid_t         file         = -1;
     hid_t         fapl         = -1;
@@ -1813,19 +2978,17 @@ test_log(void)
     hid_t         driver_id    = -1; /* ID for this VFD              */
     unsigned long driver_flags = 0;  /* VFD feature flags            */
     char          filename[1024];
-    int *         fhandle   = NULL;
+    FILE *        fhandle   = NULL;
     hsize_t       file_size = 0;
-    unsigned int  flags     = H5FD_LOG_ALL;
-    size_t        buf_size  = 4 * KB;
 
-    TESTING("LOG file driver");
+    TESTING("STDIO file driver");
 
-    /* Set property list and file name for log driver. */
+    /* Set property list and file name for STDIO driver. */
     if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR;
-    if (H5Pset_fapl_log(fapl, LOG_FILENAME, flags, buf_size) < 0)
+    if (H5Pset_fapl_stdio(fapl) < 0)
         TEST_ERROR;
-    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+    h5_fixname(FILENAME[7], fapl, filename, sizeof filename);
 
     /* Check that the VFD feature flags are correct */
     if ((driver_id = H5Pget_driver(fapl)) < 0)
@@ -1840,19 +3003,13 @@ test_log(void)
         TEST_ERROR
     if (!(driver_flags & H5FD_FEAT_AGGREGATE_SMALLDATA))
         TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE))
-        TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO))
-        TEST_ERROR
     if (!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
         TEST_ERROR
     /* Check for extra flags not accounted for above */
     if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
-                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
-                         H5FD_FEAT_SUPPORTS_SWMR_IO | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
         TEST_ERROR
 
-    /* Create the test file */
     if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
         TEST_ERROR;
 
@@ -1861,7 +3018,7 @@ test_log(void)
         TEST_ERROR;
 
     /* Check that the driver is correct */
-    if (H5FD_LOG != H5Pget_driver(access_fapl))
+    if (H5FD_STDIO != H5Pget_driver(access_fapl))
         TEST_ERROR;
 
     /* ...and close the property list */
@@ -1871,7 +3028,7 @@ test_log(void)
     /* Check file handle API */
     if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
         TEST_ERROR;
-    if (*fhandle < 0)
+    if (NULL == fhandle)
         TEST_ERROR;
 
     /* Check file size API */
@@ -1887,7 +3044,7 @@ test_log(void)
     /* Close and delete the file */
     if (H5Fclose(file) < 0)
         TEST_ERROR;
-    h5_delete_test_file(FILENAME[6], fapl);
+    h5_delete_test_file(FILENAME[7], fapl);
 
     /* Close the fapl */
     if (H5Pclose(fapl) < 0)
@@ -1907,98 +3064,201 @@ error:
 }
 
 /*-------------------------------------------------------------------------
- * Function:    test_stdio
+ * Function:    test_mmap
  *
- * Purpose:     Tests the file handle interface for STDIO driver
+ * Purpose:     Tests the read-only memory-mapped file driver, and access
+ *              to raw data in the mapping with H5Dget_mapped_ptr().
  *
  * Return:      Success:        0
  *              Failure:        -1
  *
- * Programmer:  Dana Robinson
- *              Tuesday, March 22, 2011
- *
  *-------------------------------------------------------------------------
  */
+#define MMAP_NELMTS     1000
+#define MMAP_CHUNK_SIZE 100
 static herr_t
-test_stdio(void)
+test_mmap(void)
 {
+#ifdef H5_HAVE_MMAP
+
     hid_t         file         = -1;
     hid_t         fapl         = -1;
+    hid_t         mmap_fapl    = -1;
     hid_t         access_fapl  = -1;
+    hid_t         space        = -1;
+    hid_t         dcpl         = -1;
+    hid_t         contig       = -1;
+    hid_t         chunked      = -1;
     hid_t         driver_id    = -1; /* ID for this VFD              */
     unsigned long driver_flags = 0;  /* VFD feature flags            */
     char          filename[1024];
-    FILE *        fhandle   = NULL;
-    hsize_t       file_size = 0;
+    int *         fhandle   = NULL;
+    int *         wbuf      = NULL;
+    int *         rbuf      = NULL;
+    const void *  ptr       = NULL;
+    size_t        size      = 0;
+    hsize_t       dims[1]   = {MMAP_NELMTS};
+    hsize_t       cdims[1]  = {MMAP_CHUNK_SIZE};
+    hsize_t       offset[1] = {2 * MMAP_CHUNK_SIZE};
+    herr_t        ret;
+    int           i;
 
-    TESTING("STDIO file driver");
+#endif /* H5_HAVE_MMAP */
 
-    /* Set property list and file name for STDIO driver. */
+    TESTING("MMAP file driver");
+
+#ifndef H5_HAVE_MMAP
+
+    SKIPPED();
+    return 0;
+
+#else /* H5_HAVE_MMAP */
+
+    if (NULL == (wbuf = (int *)HDmalloc(MMAP_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = (int *)HDmalloc(MMAP_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < MMAP_NELMTS; i++)
+        wbuf[i] = i;
+
+    /* Create the file with the sec2 driver */
     if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR;
-    if (H5Pset_fapl_stdio(fapl) < 0)
+    if (H5Pset_fapl_sec2(fapl) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[15], fapl, filename, sizeof filename);
+
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((contig = H5Dcreate2(file, "contig", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl, 1, cdims) < 0)
+        TEST_ERROR;
+    if ((chunked = H5Dcreate2(file, "chunked", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(contig, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(chunked, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+
+    /* Without the mmap driver there is nothing to point to */
+    if (H5Dget_mapped_ptr(contig, H5T_NATIVE_INT, NULL, &ptr, &size) < 0)
+        TEST_ERROR;
+    if (ptr != NULL || size != 0)
+        TEST_ERROR;
+
+    if (H5Dclose(contig) < 0)
+        TEST_ERROR;
+    if (H5Dclose(chunked) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Set property list for the mmap driver */
+    if ((mmap_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mmap(mmap_fapl) < 0)
         TEST_ERROR;
-    h5_fixname(FILENAME[7], fapl, filename, sizeof filename);
 
     /* Check that the VFD feature flags are correct */
-    if ((driver_id = H5Pget_driver(fapl)) < 0)
+    if ((driver_id = H5Pget_driver(mmap_fapl)) < 0)
         TEST_ERROR
     if (H5FDdriver_query(driver_id, &driver_flags) < 0)
         TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_AGGREGATE_METADATA))
-        TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_ACCUMULATE_METADATA))
-        TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_DATA_SIEVE))
-        TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_AGGREGATE_SMALLDATA))
-        TEST_ERROR
-    if (!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
-        TEST_ERROR
-    /* Check for extra flags not accounted for above */
-    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
-                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+    if (driver_flags != H5FD_FEAT_POSIX_COMPAT_HANDLE)
         TEST_ERROR
 
-    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-        TEST_ERROR;
+    /* The driver can't create or write files */
+    H5E_BEGIN_TRY
+    {
+        file = H5Fopen(filename, H5F_ACC_RDWR, mmap_fapl);
+    }
+    H5E_END_TRY;
+    if (file >= 0)
+        FAIL_PUTS_ERROR("opened file read-write with the mmap driver");
 
-    /* Retrieve the access property list... */
-    if ((access_fapl = H5Fget_access_plist(file)) < 0)
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, mmap_fapl)) < 0)
         TEST_ERROR;
 
     /* Check that the driver is correct */
-    if (H5FD_STDIO != H5Pget_driver(access_fapl))
+    if ((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if (H5FD_MMAP != H5Pget_driver(access_fapl))
         TEST_ERROR;
-
-    /* ...and close the property list */
     if (H5Pclose(access_fapl) < 0)
         TEST_ERROR;
 
     /* Check file handle API */
     if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
         TEST_ERROR;
-    if (NULL == fhandle)
+    if (*fhandle < 0)
         TEST_ERROR;
 
-    /* Check file size API */
-    if (H5Fget_filesize(file, &file_size) < 0)
+    if ((contig = H5Dopen2(file, "contig", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((chunked = H5Dopen2(file, "chunked", H5P_DEFAULT)) < 0)
         TEST_ERROR;
 
-    /* There is no guarantee the size of metadata in file is constant.
-     * Just try to check if it's reasonable.  It's 2KB right now.
-     */
-    if (file_size < 1 * KB || file_size > 4 * KB)
+    /* Read through the driver */
+    HDmemset(rbuf, 0, MMAP_NELMTS * sizeof(int));
+    if (H5Dread(contig, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, MMAP_NELMTS * sizeof(int)) != 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, MMAP_NELMTS * sizeof(int));
+    if (H5Dread(chunked, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, MMAP_NELMTS * sizeof(int)) != 0)
+        TEST_ERROR;
+
+    /* Access the raw data in place */
+    if (H5Dget_mapped_ptr(contig, H5T_NATIVE_INT, NULL, &ptr, &size) < 0)
         TEST_ERROR;
+    if (ptr == NULL || size != MMAP_NELMTS * sizeof(int))
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, ptr, size) != 0)
+        TEST_ERROR;
+
+    if (H5Dget_mapped_ptr(chunked, H5T_NATIVE_INT, offset, &ptr, &size) < 0)
+        TEST_ERROR;
+    if (ptr == NULL || size != MMAP_CHUNK_SIZE * sizeof(int))
+        TEST_ERROR;
+    if (HDmemcmp(wbuf + offset[0], ptr, size) != 0)
+        TEST_ERROR;
+
+    /* A memory type that needs conversion is refused */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dget_mapped_ptr(contig, H5T_NATIVE_DOUBLE, NULL, &ptr, &size);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("got pointer to data needing conversion");
 
     /* Close and delete the file */
+    if (H5Dclose(contig) < 0)
+        TEST_ERROR;
+    if (H5Dclose(chunked) < 0)
+        TEST_ERROR;
     if (H5Fclose(file) < 0)
         TEST_ERROR;
-    h5_delete_test_file(FILENAME[7], fapl);
+    h5_delete_test_file(FILENAME[15], fapl);
 
-    /* Close the fapl */
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(mmap_fapl) < 0)
+        TEST_ERROR;
     if (H5Pclose(fapl) < 0)
         TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
 
     PASSED();
     return 0;
@@ -2006,12 +3266,23 @@ test_stdio(void)
 error:
     H5E_BEGIN_TRY
     {
+        H5Dclose(contig);
+        H5Dclose(chunked);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Pclose(mmap_fapl);
         H5Pclose(fapl);
         H5Fclose(file);
     }
     H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
     return -1;
-}
+
+#endif /* H5_HAVE_MMAP */
+} /* end test_mmap() */
+#undef MMAP_NELMTS
+#undef MMAP_CHUNK_SIZE
 
 /*-------------------------------------------------------------------------
  * Function:    test_windows
@@ -2310,6 +3581,9 @@ compare_splitter_config_info(hid_t fapl_id, H5FD_splitter_vfd_config_t *info)
         HEXPRINT(H5FD_SPLITTER_PATH_MAX, fetched_info->wo_path);
         SPLITTER_TEST_FAULT("Write-Only file path mismatch\n");
     }
+    if (info->wo_write_behind_size != fetched_info->wo_write_behind_size) {
+        SPLITTER_TEST_FAULT("Write-Only write-behind size mismatch\n");
+    }
 
 done:
     HDfree(fetched_info);
@@ -2331,12 +3605,14 @@ done:
  *              if they exist.
  *              After writing, compares read-write and write-only files.
  *              Includes FAPL sanity testing.
+ *              A non-zero `wo_write_behind_size` queues the W/O channel's
+ *              writes to a background thread.
  *
  *-------------------------------------------------------------------------
  */
 static int
-run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_errors,
-                  hbool_t provide_logfile_path, hid_t sub_fapl_ids[2])
+run_splitter_test(const struct splitter_dataset_def *data, size_t wo_write_behind_size,
+                  hbool_t ignore_wo_errors, hbool_t provide_logfile_path, hid_t sub_fapl_ids[2])
 {
     hid_t                       file_id     = H5I_INVALID_HID;
     hid_t                       fapl_id     = H5I_INVALID_HID;
@@ -2356,9 +3632,10 @@ run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_err
 
     vfd_config->magic          = H5FD_SPLITTER_MAGIC;
     vfd_config->version        = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
-    vfd_config->ignore_wo_errs = ignore_wo_errors;
-    vfd_config->rw_fapl_id     = sub_fapl_ids[0];
-    vfd_config->wo_fapl_id     = sub_fapl_ids[1];
+    vfd_config->ignore_wo_errs       = ignore_wo_errors;
+    vfd_config->rw_fapl_id           = sub_fapl_ids[0];
+    vfd_config->wo_fapl_id           = sub_fapl_ids[1];
+    vfd_config->wo_write_behind_size = wo_write_behind_size;
 
     if (splitter_prepare_file_paths(vfd_config, filename_rw) < 0) {
         SPLITTER_TEST_FAULT("can't prepare file paths\n");
@@ -3160,6 +4437,155 @@ done:
     return ret_value;
 } /* end splitter_tentative_open_test() */
 
+/*-------------------------------------------------------------------------
+ * Function:    splitter_write_behind_test()
+ *
+ * Purpose:     Verify W/O channel write-behind with the raw VFD interface.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Description:
+ *              Write many pieces through a Splitter file whose W/O writes
+ *              are queued to a background thread, with a memory budget
+ *              small enough that writes must wait for the queue, and one
+ *              piece larger than the whole budget.  Some pieces are then
+ *              rewritten, to check that queued writes stay in order.
+ *              After closing, the R/W and W/O files must be identical.
+ *
+ *              Also checks that version 1 configuration structures,
+ *              which don't have the write-behind size, are still accepted.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+splitter_write_behind_test(hid_t child_fapl_id)
+{
+    H5FD_splitter_vfd_config_t *vfd_config  = NULL;
+    hid_t                       fapl_id     = H5I_INVALID_HID;
+    H5FD_t *                    lf          = NULL;
+    char *                      filename_rw = NULL;
+    unsigned char *             buf         = NULL;
+    haddr_t                     eoa         = (SPLITTER_WB_NPIECES + 8) * SPLITTER_WB_PIECE;
+    int                         i           = 0;
+    int                         ret_value   = 0;
+
+    if (NULL == (vfd_config = HDcalloc(1, sizeof(H5FD_splitter_vfd_config_t))))
+        SPLITTER_TEST_FAULT("memory allocation for vfd_config struct failed");
+    if (NULL == (filename_rw = HDcalloc(H5FD_SPLITTER_PATH_MAX + 1, sizeof(char))))
+        SPLITTER_TEST_FAULT("memory allocation for filename_rw string failed");
+    if (NULL == (buf = HDmalloc(8 * SPLITTER_WB_PIECE)))
+        SPLITTER_TEST_FAULT("memory allocation for buffer failed");
+
+    vfd_config->magic                = H5FD_SPLITTER_MAGIC;
+    vfd_config->version              = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
+    vfd_config->ignore_wo_errs       = FALSE;
+    vfd_config->rw_fapl_id           = child_fapl_id;
+    vfd_config->wo_fapl_id           = child_fapl_id;
+    vfd_config->wo_write_behind_size = 4 * SPLITTER_WB_PIECE;
+
+    if (splitter_prepare_file_paths(vfd_config, filename_rw) < 0) {
+        SPLITTER_TEST_FAULT("can't prepare splitter file paths\n");
+    }
+    vfd_config->log_file_path[0] = '\0';
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) == H5I_INVALID_HID) {
+        SPLITTER_TEST_FAULT("can't create FAPL ID\n");
+    }
+
+    /* A version 1 structure is accepted, and leaves write-behind off */
+    vfd_config->version = 1;
+    if (H5Pset_fapl_splitter(fapl_id, vfd_config) < 0) {
+        SPLITTER_TEST_FAULT("can't set splitter FAPL from version 1 config\n");
+    }
+    vfd_config->version              = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
+    vfd_config->wo_write_behind_size = 0;
+    if (compare_splitter_config_info(fapl_id, vfd_config) < 0) {
+        SPLITTER_TEST_FAULT("version 1 config information mismatch\n");
+    }
+
+    vfd_config->wo_write_behind_size = 4 * SPLITTER_WB_PIECE;
+    if (H5Pset_fapl_splitter(fapl_id, vfd_config) < 0) {
+        SPLITTER_TEST_FAULT("can't set splitter FAPL\n");
+    }
+    if (compare_splitter_config_info(fapl_id, vfd_config) < 0) {
+        SPLITTER_TEST_FAULT("information mismatch\n");
+    }
+
+    if (NULL == (lf = H5FDopen(filename_rw, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, eoa))) {
+        SPLITTER_TEST_FAULT("can't open splitter file\n");
+    }
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eoa) < 0) {
+        SPLITTER_TEST_FAULT("can't set EOA\n");
+    }
+
+    /* Many pieces, more than fit within the budget at once */
+    for (i = 0; i < SPLITTER_WB_NPIECES; i++) {
+        HDmemset(buf, i + 1, SPLITTER_WB_PIECE);
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)i * SPLITTER_WB_PIECE, SPLITTER_WB_PIECE,
+                      buf) < 0) {
+            SPLITTER_TEST_FAULT("can't write piece\n");
+        }
+    }
+
+    /* One piece larger than the whole budget */
+    HDmemset(buf, 0xAA, 8 * SPLITTER_WB_PIECE);
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)SPLITTER_WB_NPIECES * SPLITTER_WB_PIECE,
+                  8 * SPLITTER_WB_PIECE, buf) < 0) {
+        SPLITTER_TEST_FAULT("can't write large piece\n");
+    }
+
+    /* Rewrite every fourth piece, in two halves; the latest data must win */
+    for (i = 0; i < SPLITTER_WB_NPIECES; i += 4) {
+        HDmemset(buf, 0xF0, SPLITTER_WB_PIECE);
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)i * SPLITTER_WB_PIECE, SPLITTER_WB_PIECE / 2,
+                      buf) < 0) {
+            SPLITTER_TEST_FAULT("can't rewrite piece\n");
+        }
+        HDmemset(buf, 0x0F, SPLITTER_WB_PIECE);
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)i * SPLITTER_WB_PIECE, SPLITTER_WB_PIECE,
+                      buf) < 0) {
+            SPLITTER_TEST_FAULT("can't rewrite piece\n");
+        }
+    }
+
+    /* Flushing waits for the queued writes */
+    if (H5FDflush(lf, H5P_DEFAULT, FALSE) < 0) {
+        SPLITTER_TEST_FAULT("can't flush splitter file\n");
+    }
+    if (h5_compare_file_bytes(filename_rw, vfd_config->wo_path) < 0) {
+        SPLITTER_TEST_FAULT("files are not byte-for-byte equivalent after flush\n");
+    }
+
+    /* Queue a few more writes, and let closing wait for them */
+    for (i = 1; i < SPLITTER_WB_NPIECES; i += 4) {
+        HDmemset(buf, 0x55, SPLITTER_WB_PIECE);
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)i * SPLITTER_WB_PIECE, SPLITTER_WB_PIECE,
+                      buf) < 0) {
+            SPLITTER_TEST_FAULT("can't write piece\n");
+        }
+    }
+    if (H5FDclose(lf) < 0) {
+        SPLITTER_TEST_FAULT("can't close splitter file\n");
+    }
+    lf = NULL;
+
+    if (h5_compare_file_bytes(filename_rw, vfd_config->wo_path) < 0) {
+        SPLITTER_TEST_FAULT("files are not byte-for-byte equivalent\n");
+    }
+
+done:
+    if (lf)
+        H5FDclose(lf);
+    if (fapl_id != H5I_INVALID_HID)
+        H5Pclose(fapl_id);
+    HDfree(vfd_config);
+    HDfree(filename_rw);
+    HDfree(buf);
+
+    return ret_value;
+} /* end splitter_write_behind_test() */
+
 /*-------------------------------------------------------------------------
  * Function:    file_exists()
  *
@@ -3263,12 +4689,20 @@ test_splitter(void)
         TEST_ERROR;
     }
 
+    /* Test W/O channel write-behind through the raw VFD interface.
+     */
+    if (splitter_write_behind_test(child_fapl_id) < 0) {
+        TEST_ERROR;
+    }
+
     /* Test file creation, utilizing different child FAPLs (default vs.
-     * specified), logfile, and Write Channel error ignoring behavior.
+     * specified), logfile, Write Channel error ignoring behavior, and
+     * write-behind on the Write Channel.
      */
-    for (i = 0; i < 4; i++) {
+    for (i = 0; i < 8; i++) {
         hbool_t ignore_wo_errors     = (i & 1) ? TRUE : FALSE;
         hbool_t provide_logfile_path = (i & 2) ? TRUE : FALSE;
+        size_t  wo_write_behind_size = (i & 4) ? SPLITTER_WRITE_BEHIND_SIZE : 0;
         hid_t   child_fapl_ids[2]    = {H5P_DEFAULT, H5P_DEFAULT};
 
         /* Test child driver definition/default combination */
@@ -3277,7 +4711,8 @@ test_splitter(void)
             child_fapl_ids[0] = (j & 1) ? child_fapl_id : H5P_DEFAULT;
             child_fapl_ids[1] = (j & 2) ? child_fapl_id : H5P_DEFAULT;
 
-            if (run_splitter_test(&data, ignore_wo_errors, provide_logfile_path, child_fapl_ids) < 0) {
+            if (run_splitter_test(&data, wo_write_behind_size, ignore_wo_errors, provide_logfile_path,
+                                  child_fapl_ids) < 0) {
                 TEST_ERROR;
             }
 
@@ -3323,15 +4758,22 @@ main(void)
     HDprintf("Testing basic Virtual File Driver functionality.\n");
 
     nerrors += test_sec2() < 0 ? 1 : 0;
+    nerrors += test_sec2_striping() < 0 ? 1 : 0;
+    nerrors += test_sec2_readahead() < 0 ? 1 : 0;
+    nerrors += test_vector_io() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
+    nerrors += test_core_paged() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
+    nerrors += test_family_concurrency() < 0 ? 1 : 0;
     nerrors += test_multi() < 0 ? 1 : 0;
     nerrors += test_multi_compat() < 0 ? 1 : 0;
     nerrors += test_log() < 0 ? 1 : 0;
+    nerrors += test_log_binary_trace() < 0 ? 1 : 0;
     nerrors += test_stdio() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
     nerrors += test_splitter() < 0 ? 1 : 0;
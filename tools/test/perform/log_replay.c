@@ -0,0 +1,512 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Replays a binary I/O trace recorded by the log driver
+ *              (H5FD_LOG_BINARY_TRACE) against any virtual file driver and
+ *              reports the throughput and latency of the replayed reads,
+ *              writes and truncates next to the ones in the trace.
+ *
+ *              Operations are issued through the public H5FD interface, so
+ *              the replay measures the driver alone, without the metadata
+ *              cache, the page buffer or any other library layer on top.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME "log_replay"
+
+/* Number of trace records read from the trace file at a time */
+#define NRECORDS 4096
+
+/* Number of latency histogram buckets.  Bucket 0 counts operations that
+ * took less than 1 microsecond, bucket B > 0 those that took between
+ * 2^(B-1) and 2^B microseconds and the last bucket everything slower.
+ */
+#define NBUCKETS 32
+
+/* Width of the longest histogram bar */
+#define BAR_WIDTH 40
+
+/* Number of operation types in a trace */
+#define NOPS H5FD_LOG_TRACE_OP_TRUNCATE
+
+/* Statistics for one type of operation */
+typedef struct replay_stats_t {
+    unsigned long long nops;           /* Number of operations                 */
+    unsigned long long nbytes;         /* Number of bytes transferred          */
+    uint64_t           recorded_ns;    /* Time spent, according to the trace   */
+    uint64_t           replay_ns;      /* Time spent during the replay         */
+    uint64_t           min_ns;         /* Fastest replayed operation           */
+    uint64_t           max_ns;         /* Slowest replayed operation           */
+    unsigned long long hist[NBUCKETS]; /* Replay latency histogram (see above) */
+} replay_stats_t;
+
+static const char *op_names[NOPS] = {"read", "write", "truncate"};
+
+/* Command-line options: short and long form */
+static const char *        s_opts   = "hd:n:p";
+static struct long_options l_opts[] = {{"help", no_arg, 'h'},
+                                       {"vfd", require_arg, 'd'},
+                                       {"iterations", require_arg, 'n'},
+                                       {"pace", no_arg, 'p'},
+                                       {NULL, 0, '\0'}};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Print a usage message.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] TRACE_FILE TARGET_FILE\n", PROGRAMNAME);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help              Print this usage message and exit\n");
+    HDfprintf(stdout, "     -d D, --vfd=D           Virtual file driver to replay with [default: sec2]\n");
+    HDfprintf(stdout, "     -n N, --iterations=N    Number of times to replay the trace [default: 1]\n");
+    HDfprintf(stdout, "     -p, --pace              Issue each operation no earlier than its recorded\n");
+    HDfprintf(stdout, "                             start time, instead of back-to-back\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  TRACE_FILE is a trace written by the log driver with the\n");
+    HDfprintf(stdout, "  H5FD_LOG_BINARY_TRACE flag.  TARGET_FILE is opened read-write, and\n");
+    HDfprintf(stdout, "  created when it does not exist.  Writes in the trace overwrite its\n");
+    HDfprintf(stdout, "  contents, so replay against a copy of the original file.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  D - sec2, stdio, core, log, direct, family, split or multi\n");
+    HDfflush(stdout);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    now_ns
+ *
+ * Purpose:     Read a monotonic clock.
+ *
+ * Return:      Current time, in nanoseconds
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+now_ns(void)
+{
+#if defined(H5_HAVE_CLOCK_GETTIME)
+    struct timespec ts;
+
+    HDclock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * (uint64_t)1000000000) + (uint64_t)ts.tv_nsec;
+#else
+    return H5_now_usec() * (uint64_t)1000;
+#endif
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    swap_bytes
+ *
+ * Purpose:     Reverse the byte order of the low NBYTES bytes of V, for
+ *              traces written on a machine of the other endianness.
+ *
+ * Return:      The swapped value
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+swap_bytes(uint64_t v, unsigned nbytes)
+{
+    uint64_t r = 0;
+    unsigned u;
+
+    for (u = 0; u < nbytes; u++) {
+        r = (r << 8) | (v & 0xff);
+        v >>= 8;
+    }
+
+    return r;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    latency_bucket
+ *
+ * Purpose:     Map a latency onto its histogram bucket.
+ *
+ * Return:      Bucket index, in [0, NBUCKETS)
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+latency_bucket(uint64_t ns)
+{
+    uint64_t us     = ns / 1000;
+    unsigned bucket = 0;
+
+    while (us > 0 && bucket < NBUCKETS - 1) {
+        us >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    mb_per_sec
+ *
+ * Purpose:     Compute a throughput from a byte count and a duration.
+ *
+ * Return:      Throughput in MiB/s, 0.0 for an empty duration
+ *-------------------------------------------------------------------------
+ */
+static double
+mb_per_sec(unsigned long long nbytes, uint64_t ns)
+{
+    if (0 == ns)
+        return 0.0;
+
+    return ((double)nbytes / (1024.0 * 1024.0)) / ((double)ns / 1.0E9);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    report
+ *
+ * Purpose:     Print the throughput table and the latency histograms.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+report(const replay_stats_t *stats, const char *vfd_name, unsigned iterations, uint64_t wall_ns)
+{
+    unsigned long long total_ops = 0;
+    unsigned           op, b;
+
+    for (op = 0; op < NOPS; op++)
+        total_ops += stats[op].nops;
+
+    HDfprintf(stdout, "Replayed %llu operations with the %s driver (%u iteration%s) in %.6f s\n", total_ops,
+              vfd_name, iterations, iterations > 1 ? "s" : "", (double)wall_ns / 1.0E9);
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "%-9s %12s %14s %14s %14s %10s %10s %10s\n", "op", "count", "bytes", "trace MiB/s",
+              "replay MiB/s", "min us", "mean us", "max us");
+    for (op = 0; op < NOPS; op++) {
+        const replay_stats_t *s = &stats[op];
+
+        if (0 == s->nops)
+            continue;
+        HDfprintf(stdout, "%-9s %12llu %14llu %14.2f %14.2f %10.2f %10.2f %10.2f\n", op_names[op], s->nops,
+                  s->nbytes, mb_per_sec(s->nbytes, s->recorded_ns), mb_per_sec(s->nbytes, s->replay_ns),
+                  (double)s->min_ns / 1.0E3, ((double)s->replay_ns / (double)s->nops) / 1.0E3,
+                  (double)s->max_ns / 1.0E3);
+    }
+
+    for (op = 0; op < NOPS; op++) {
+        const replay_stats_t *s        = &stats[op];
+        unsigned long long    max_hist = 0;
+
+        if (0 == s->nops)
+            continue;
+
+        for (b = 0; b < NBUCKETS; b++)
+            max_hist = MAX(max_hist, s->hist[b]);
+
+        HDfprintf(stdout, "\nReplay latency histogram (%s):\n", op_names[op]);
+        for (b = 0; b < NBUCKETS; b++) {
+            unsigned width, w;
+
+            if (0 == s->hist[b])
+                continue;
+
+            if (0 == b)
+                HDfprintf(stdout, "  %10s - %-10llu us %12llu |", "0", 1ULL, s->hist[b]);
+            else if (NBUCKETS - 1 == b)
+                HDfprintf(stdout, "  %10llu - %-10s us %12llu |", 1ULL << (b - 1), "inf", s->hist[b]);
+            else
+                HDfprintf(stdout, "  %10llu - %-10llu us %12llu |", 1ULL << (b - 1), 1ULL << b, s->hist[b]);
+
+            width = (unsigned)((s->hist[b] * BAR_WIDTH + max_hist - 1) / max_hist);
+            for (w = 0; w < width; w++)
+                HDfputc('#', stdout);
+            HDfputc('\n', stdout);
+        }
+    }
+    HDfflush(stdout);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    replay
+ *
+ * Purpose:     Issue every operation in the trace once against the target
+ *              file, adding the timings to STATS.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static int
+replay(FILE *trace, hbool_t swap, const char *target, hid_t fapl_id, hbool_t pace, replay_stats_t *stats)
+{
+    H5FD_log_trace_record_t *recs    = NULL;
+    unsigned char *          buf     = NULL;
+    size_t                   buf_len = 0;
+    H5FD_t *                 lf      = NULL;
+    haddr_t                  eoa;
+    uint64_t                 t0;
+    size_t                   nrecs, u;
+    int                      ret_value = 0;
+
+    if (NULL == (recs = (H5FD_log_trace_record_t *)HDmalloc(NRECORDS * sizeof(H5FD_log_trace_record_t)))) {
+        error_msg("unable to allocate trace buffer\n");
+        goto error;
+    }
+
+    if (NULL == (lf = H5FDopen(target, H5F_ACC_RDWR | H5F_ACC_CREAT, fapl_id, HADDR_UNDEF))) {
+        error_msg("unable to open target file \"%s\"\n", target);
+        goto error;
+    }
+    eoa = H5FDget_eof(lf, H5FD_MEM_DEFAULT);
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eoa) < 0) {
+        error_msg("unable to set EOA of target file\n");
+        goto error;
+    }
+
+    if (HDfseek(trace, (HDoff_t)sizeof(H5FD_log_trace_header_t), SEEK_SET) < 0) {
+        error_msg("unable to seek in trace file\n");
+        goto error;
+    }
+
+    t0 = now_ns();
+    while ((nrecs = HDfread(recs, sizeof(H5FD_log_trace_record_t), NRECORDS, trace)) > 0) {
+        for (u = 0; u < nrecs; u++) {
+            H5FD_log_trace_record_t *rec = &recs[u];
+            replay_stats_t *         s;
+            H5FD_mem_t               type;
+            uint64_t                 start, end;
+            herr_t                   status;
+
+            if (swap) {
+                rec->start_ns    = swap_bytes(rec->start_ns, 8);
+                rec->duration_ns = swap_bytes(rec->duration_ns, 8);
+                rec->addr        = swap_bytes(rec->addr, 8);
+                rec->size        = swap_bytes(rec->size, 8);
+            }
+
+            if (rec->op < H5FD_LOG_TRACE_OP_READ || rec->op > H5FD_LOG_TRACE_OP_TRUNCATE) {
+                error_msg("unknown operation %u in trace\n", (unsigned)rec->op);
+                goto error;
+            }
+            if ((uint64_t)((size_t)rec->size) != rec->size) {
+                error_msg("operation size %llu is too large\n", (unsigned long long)rec->size);
+                goto error;
+            }
+            type = rec->type < H5FD_MEM_NTYPES ? (H5FD_mem_t)rec->type : H5FD_MEM_DEFAULT;
+
+            /* Keep the recorded spacing between operations */
+            if (pace) {
+                uint64_t elapsed = now_ns() - t0;
+
+                if (rec->start_ns > elapsed) {
+                    struct timespec delay;
+
+                    delay.tv_sec  = (time_t)((rec->start_ns - elapsed) / 1000000000);
+                    delay.tv_nsec = (long)((rec->start_ns - elapsed) % 1000000000);
+                    HDnanosleep(&delay, NULL);
+                }
+            }
+
+            /* Grow the buffer and the address space for the operation */
+            if (rec->op != H5FD_LOG_TRACE_OP_TRUNCATE) {
+                if ((size_t)rec->size > buf_len) {
+                    unsigned char *tmp;
+
+                    if (NULL == (tmp = (unsigned char *)HDrealloc(buf, (size_t)rec->size))) {
+                        error_msg("unable to allocate %llu byte I/O buffer\n", (unsigned long long)rec->size);
+                        goto error;
+                    }
+                    HDmemset(tmp + buf_len, 0xAB, (size_t)rec->size - buf_len);
+                    buf     = tmp;
+                    buf_len = (size_t)rec->size;
+                }
+                if (rec->addr + rec->size > eoa) {
+                    eoa = (haddr_t)(rec->addr + rec->size);
+                    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eoa) < 0) {
+                        error_msg("unable to set EOA of target file\n");
+                        goto error;
+                    }
+                }
+            }
+            else {
+                eoa = (haddr_t)rec->addr;
+                if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eoa) < 0) {
+                    error_msg("unable to set EOA of target file\n");
+                    goto error;
+                }
+            }
+
+            start = now_ns();
+            if (H5FD_LOG_TRACE_OP_READ == rec->op)
+                status = H5FDread(lf, type, H5P_DEFAULT, (haddr_t)rec->addr, (size_t)rec->size, buf);
+            else if (H5FD_LOG_TRACE_OP_WRITE == rec->op)
+                status = H5FDwrite(lf, type, H5P_DEFAULT, (haddr_t)rec->addr, (size_t)rec->size, buf);
+            else
+                status = H5FDtruncate(lf, H5P_DEFAULT, FALSE);
+            end = now_ns();
+            if (status < 0) {
+                error_msg("%s of %llu bytes at address %llu failed\n", op_names[rec->op - 1],
+                          (unsigned long long)rec->size, (unsigned long long)rec->addr);
+                goto error;
+            }
+
+            s = &stats[rec->op - 1];
+            if (0 == s->nops || end - start < s->min_ns)
+                s->min_ns = end - start;
+            if (end - start > s->max_ns)
+                s->max_ns = end - start;
+            s->nops++;
+            s->nbytes += rec->size;
+            s->recorded_ns += rec->duration_ns;
+            s->replay_ns += end - start;
+            s->hist[latency_bucket(end - start)]++;
+        }
+    }
+    if (HDferror(trace)) {
+        error_msg("unable to read trace file\n");
+        goto error;
+    }
+
+done:
+    if (lf && H5FDclose(lf) < 0) {
+        error_msg("unable to close target file\n");
+        ret_value = -1;
+    }
+    HDfree(buf);
+    HDfree(recs);
+
+    return ret_value;
+
+error:
+    ret_value = -1;
+    goto done;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Parse the command line, check the trace header and replay
+ *              the trace the requested number of times.
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, const char *argv[])
+{
+    h5tools_vfd_info_t      vfd_info;
+    H5FD_log_trace_header_t header;
+    replay_stats_t          stats[NOPS];
+    FILE *                  trace      = NULL;
+    hid_t                   fapl_id    = H5I_INVALID_HID;
+    unsigned                iterations = 1;
+    hbool_t                 pace       = FALSE;
+    hbool_t                 swap       = FALSE;
+    uint64_t                wall_ns;
+    unsigned                u;
+    int                     opt;
+    int                     ret_value = EXIT_SUCCESS;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* Initialize h5tools lib */
+    h5tools_init();
+
+    vfd_info.info = NULL;
+    vfd_info.name = "sec2";
+
+    while ((opt = get_option(argc, argv, s_opts, l_opts)) > 0) {
+        switch ((char)opt) {
+            case 'd':
+                vfd_info.name = opt_arg;
+                break;
+            case 'n':
+                iterations = (unsigned)HDstrtoul(opt_arg, NULL, 10);
+                if (0 == iterations) {
+                    error_msg("invalid number of iterations \"%s\"\n", opt_arg);
+                    usage();
+                    goto error;
+                }
+                break;
+            case 'p':
+                pace = TRUE;
+                break;
+            case 'h':
+                usage();
+                goto done;
+            case '?':
+            default:
+                usage();
+                goto error;
+        }
+    }
+    if (argc - opt_ind != 2) {
+        usage();
+        goto error;
+    }
+
+    /* Check the trace header */
+    if (NULL == (trace = HDfopen(argv[opt_ind], "rb"))) {
+        error_msg("unable to open trace file \"%s\"\n", argv[opt_ind]);
+        goto error;
+    }
+    if (1 != HDfread(&header, sizeof(header), 1, trace) ||
+        HDmemcmp(header.magic, H5FD_LOG_TRACE_MAGIC, H5FD_LOG_TRACE_MAGIC_LEN) != 0) {
+        error_msg("\"%s\" is not a log driver trace file\n", argv[opt_ind]);
+        goto error;
+    }
+    if (header.byte_order != H5FD_LOG_TRACE_BYTE_ORDER) {
+        swap               = TRUE;
+        header.version     = (uint32_t)swap_bytes(header.version, 4);
+        header.record_size = (uint32_t)swap_bytes(header.record_size, 4);
+    }
+    if (header.version != H5FD_LOG_TRACE_VERSION ||
+        header.record_size != (uint32_t)sizeof(H5FD_log_trace_record_t)) {
+        error_msg("unsupported trace version %u (record size %u)\n", header.version, header.record_size);
+        goto error;
+    }
+
+    if ((fapl_id = h5tools_get_fapl(H5P_DEFAULT, NULL, &vfd_info)) < 0) {
+        error_msg("unable to set up the \"%s\" driver\n", vfd_info.name);
+        goto error;
+    }
+
+    HDmemset(stats, 0, sizeof(stats));
+    wall_ns = now_ns();
+    for (u = 0; u < iterations; u++)
+        if (replay(trace, swap, argv[opt_ind + 1], fapl_id, pace, stats) < 0)
+            goto error;
+    wall_ns = now_ns() - wall_ns;
+
+    report(stats, vfd_info.name, iterations, wall_ns);
+
+done:
+    if (fapl_id >= 0)
+        H5Pclose(fapl_id);
+    if (trace)
+        HDfclose(trace);
+    h5tools_close();
+
+    return ret_value;
+
+error:
+    ret_value = EXIT_FAILURE;
+    goto done;
+}
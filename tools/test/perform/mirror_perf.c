@@ -0,0 +1,261 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Measures the throughput of the mirror driver against a
+ *              running mirror server, writing the same sequence of small
+ *              writes once with every write sent by itself and once with
+ *              writes gathered into batches (H5FD_mirror_fapl_t
+ *              write_batch_size and write_window).
+ *
+ *              Writes are issued through the public H5FD interface, so only
+ *              the driver and the remote Writer are measured. Each timing
+ *              includes closing the file, which waits for the Writer to
+ *              acknowledge everything sent.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME "mirror_perf"
+
+#ifdef H5_HAVE_MIRROR_VFD
+
+/* Command-line options: short and long form */
+static const char *        s_opts   = "hi:p:n:s:b:w:";
+static struct long_options l_opts[] = {{"help", no_arg, 'h'},
+                                       {"ip", require_arg, 'i'},
+                                       {"port", require_arg, 'p'},
+                                       {"nwrites", require_arg, 'n'},
+                                       {"size", require_arg, 's'},
+                                       {"batch", require_arg, 'b'},
+                                       {"window", require_arg, 'w'},
+                                       {NULL, 0, '\0'}};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Print a usage message.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] [REMOTE_FILE]\n", PROGRAMNAME);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help              Print this usage message and exit\n");
+    HDfprintf(stdout, "     -i A, --ip=A            Mirror server IP address [default: 127.0.0.1]\n");
+    HDfprintf(stdout, "     -p P, --port=P          Mirror server port [default: 3000]\n");
+    HDfprintf(stdout, "     -n N, --nwrites=N       Number of writes [default: 20000]\n");
+    HDfprintf(stdout, "     -s S, --size=S          Bytes per write [default: 512]\n");
+    HDfprintf(stdout, "     -b B, --batch=B         Batch size in bytes [default: 1048576]\n");
+    HDfprintf(stdout, "     -w W, --window=W        Batches in flight [default: 4]\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  REMOTE_FILE is created by the Writer, relative to the server's\n");
+    HDfprintf(stdout, "  working directory [default: mirror_perf.h5].\n");
+    HDfflush(stdout);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    run_writes
+ *
+ * Purpose:     Create NAME through the mirror driver, write NWRITES
+ *              consecutive pieces of SIZE bytes and close it.
+ *
+ * Return:      Elapsed time in seconds, or a negative value on failure
+ *-------------------------------------------------------------------------
+ */
+static double
+run_writes(const H5FD_mirror_fapl_t *fa, const char *name, unsigned long nwrites, size_t size)
+{
+    H5FD_mirror_fapl_t fa_copy;
+    hid_t              fapl_id = H5I_INVALID_HID;
+    H5FD_t *           file    = NULL;
+    unsigned char *    buf     = NULL;
+    unsigned long      i;
+    double             start;
+    double             ret_value = -1.0;
+
+    HDmemcpy(&fa_copy, fa, sizeof(fa_copy));
+
+    if (NULL == (buf = (unsigned char *)HDmalloc(size)))
+        goto done;
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto done;
+    if (H5Pset_fapl_mirror(fapl_id, &fa_copy) < 0)
+        goto done;
+
+    start = H5_get_time();
+
+    if (NULL == (file = H5FDopen(name, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        goto done;
+    if (H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)(nwrites * size)) < 0)
+        goto done;
+    for (i = 0; i < nwrites; i++) {
+        HDmemset(buf, (int)(i & 0xFF), size);
+        if (H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(i * size), size, buf) < 0)
+            goto done;
+    }
+    if (H5FDclose(file) < 0) {
+        file = NULL;
+        goto done;
+    }
+    file = NULL;
+
+    ret_value = H5_get_time() - start;
+
+done:
+    if (file)
+        H5FDclose(file);
+    if (fapl_id >= 0)
+        H5Pclose(fapl_id);
+    HDfree(buf);
+
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    report
+ *
+ * Purpose:     Print one line of results.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+report(const char *label, double secs, unsigned long nwrites, size_t size)
+{
+    double mib = ((double)nwrites * (double)size) / (1024.0 * 1024.0);
+
+    HDfprintf(stdout, "%-28s %10.3f s %10.2f MiB/s %12.0f writes/s\n", label, secs,
+              secs > 0.0 ? mib / secs : 0.0, secs > 0.0 ? (double)nwrites / secs : 0.0);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Run the writes unbatched, then batched, and compare.
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, const char *argv[])
+{
+    H5FD_mirror_fapl_t fa;
+    const char *       name    = "mirror_perf.h5";
+    unsigned long      nwrites = 20000;
+    size_t             size    = 512;
+    double             plain_secs;
+    double             batch_secs;
+    char               label[64];
+    int                opt;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+    h5tools_init();
+
+    HDmemset(&fa, 0, sizeof(fa));
+    fa.magic            = H5FD_MIRROR_FAPL_MAGIC;
+    fa.version          = H5FD_MIRROR_CURR_FAPL_T_VERSION;
+    fa.handshake_port   = 3000;
+    fa.write_batch_size = 1024 * 1024;
+    fa.write_window     = 4;
+    HDstrncpy(fa.remote_ip, "127.0.0.1", H5FD_MIRROR_MAX_IP_LEN);
+
+    while ((opt = get_option(argc, argv, s_opts, l_opts)) > 0) {
+        switch ((char)opt) {
+            case 'h':
+                usage();
+                h5tools_close();
+                HDexit(EXIT_SUCCESS);
+                break;
+            case 'i':
+                HDstrncpy(fa.remote_ip, opt_arg, H5FD_MIRROR_MAX_IP_LEN);
+                break;
+            case 'p':
+                fa.handshake_port = HDatoi(opt_arg);
+                break;
+            case 'n':
+                nwrites = HDstrtoul(opt_arg, NULL, 0);
+                break;
+            case 's':
+                size = (size_t)HDstrtoul(opt_arg, NULL, 0);
+                break;
+            case 'b':
+                fa.write_batch_size = (uint32_t)HDstrtoul(opt_arg, NULL, 0);
+                break;
+            case 'w':
+                fa.write_window = (uint32_t)HDstrtoul(opt_arg, NULL, 0);
+                break;
+            default:
+                usage();
+                h5tools_close();
+                HDexit(EXIT_FAILURE);
+        }
+    }
+    if (opt_ind < argc)
+        name = argv[opt_ind];
+    if (0 == nwrites || 0 == size || 0 == fa.write_batch_size || 0 == fa.write_window) {
+        usage();
+        h5tools_close();
+        HDexit(EXIT_FAILURE);
+    }
+
+    HDfprintf(stdout, "%lu writes of %zu bytes to %s:%d\n", nwrites, size, fa.remote_ip, fa.handshake_port);
+
+    {
+        H5FD_mirror_fapl_t plain = fa;
+
+        plain.write_batch_size = 0;
+        plain.write_window     = 0;
+        if ((plain_secs = run_writes(&plain, name, nwrites, size)) < 0.0) {
+            HDfprintf(stderr, "%s: unbatched run failed\n", PROGRAMNAME);
+            goto error;
+        }
+    }
+    report("unbatched", plain_secs, nwrites, size);
+
+    if ((batch_secs = run_writes(&fa, name, nwrites, size)) < 0.0) {
+        HDfprintf(stderr, "%s: batched run failed\n", PROGRAMNAME);
+        goto error;
+    }
+    HDsnprintf(label, sizeof(label), "batched (%lu B, window %lu)", (unsigned long)fa.write_batch_size,
+               (unsigned long)fa.write_window);
+    report(label, batch_secs, nwrites, size);
+
+    if (batch_secs > 0.0)
+        HDfprintf(stdout, "speedup: %.2fx\n", plain_secs / batch_secs);
+
+    h5tools_close();
+    return EXIT_SUCCESS;
+
+error:
+    h5tools_close();
+    return EXIT_FAILURE;
+}
+
+#else /* H5_HAVE_MIRROR_VFD */
+
+int
+main(void)
+{
+    HDfprintf(stdout, "%s: the mirror driver is not built\n", PROGRAMNAME);
+    return EXIT_SUCCESS;
+}
+
+#endif /* H5_HAVE_MIRROR_VFD */
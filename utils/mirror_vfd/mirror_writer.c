@@ -154,7 +154,8 @@ struct mirror_writer_opts {
     char *   logpath;
 };
 
-static void mybzero(void *dest, size_t size);
+static void    mybzero(void *dest, size_t size);
+static ssize_t read_exactly(int sockfd, void *buf, size_t size);
 
 static int do_open(struct mirror_session *session, const H5FD_mirror_xmit_open_t *xmit_open);
 
@@ -419,6 +420,174 @@ reply_error(struct mirror_session *session, const char *msg)
     return _xmit_reply(session);
 } /* end reply_error() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    read_exactly
+ *
+ * Purpose:     Read `size` bytes from the socket, looping over short reads.
+ *              The Driver may send several transmissions without waiting
+ *              for replies, so no more than one transmission may be read
+ *              at a time.
+ *
+ * Return:      Number of bytes read, which is less than `size` only if the
+ *              Driver closed the connection; -1 if error.
+ * ---------------------------------------------------------------------------
+ */
+static ssize_t
+read_exactly(int sockfd, void *buf, size_t size)
+{
+    size_t  n_read   = 0;
+    ssize_t read_ret = 0;
+
+    while (n_read < size) {
+        read_ret = HDread(sockfd, (char *)buf + n_read, size - n_read);
+        if (read_ret < 0) {
+            if (EINTR == errno)
+                continue;
+            return -1;
+        }
+        if (0 == read_ret)
+            break; /* end of stream */
+        n_read += (size_t)read_ret;
+    }
+
+    return (ssize_t)n_read;
+} /* end read_exactly() */
+
+/* ---------------------------------------------------------------------------
+ * Function:    do_batch
+ *
+ * Purpose:     Handle a BATCH operation.
+ *              Receives the payload and applies each write and set-eoa record
+ *              in order, then sends a single reply.
+ *
+ * Return:      0 on success, -1 if error.
+ * ---------------------------------------------------------------------------
+ */
+static int
+do_batch(struct mirror_session *session, const unsigned char *xmit_buf)
+{
+    size_t                   decode_ret = 0;
+    unsigned char *          buf        = NULL;
+    const unsigned char *    p          = NULL;
+    size_t                   remaining  = 0;
+    uint32_t                 i          = 0;
+    uint8_t                  op         = 0;
+    uint8_t                  type       = 0;
+    uint64_t                 addr       = 0;
+    uint64_t                 size       = 0;
+    H5FD_mirror_xmit_batch_t xmit_batch;
+
+    HDassert(session && (session->magic == MW_SESSION_MAGIC) && xmit_buf);
+
+    mirror_log(session->loginfo, V_INFO, "do_batch()");
+
+    if (NULL == session->file) {
+        mirror_log(session->loginfo, V_ERR, "no open file!");
+        reply_error(session, "no file open on remote");
+        return -1;
+    }
+
+    decode_ret = H5FD_mirror_xmit_decode_batch(&xmit_batch, xmit_buf);
+    if (H5FD_MIRROR_XMIT_BATCH_SIZE != decode_ret) {
+        mirror_log(session->loginfo, V_ERR, "can't decode batch xmit");
+        reply_error(session, "remote xmit_batch_t decoding size failure");
+        return -1;
+    }
+
+    if (!H5FD_mirror_xmit_is_batch(&xmit_batch)) {
+        mirror_log(session->loginfo, V_ERR, "not a batch xmit");
+        reply_error(session, "remote xmit_batch_t decode failure");
+        return -1;
+    }
+
+    if (xmit_batch.size > H5FD_MIRROR_WRITE_BATCH_MAX) {
+        mirror_log(session->loginfo, V_ERR, "batch too large: %" PRIu64, xmit_batch.size);
+        reply_error(session, "batch payload too large");
+        return -1;
+    }
+
+    buf = (unsigned char *)HDmalloc((size_t)xmit_batch.size + 1);
+    if (NULL == buf) {
+        mirror_log(session->loginfo, V_ERR, "can't allocate batch buffer");
+        reply_error(session, "can't allocate buffer for receiving batch");
+        return -1;
+    }
+
+    if (read_exactly(session->sockfd, buf, (size_t)xmit_batch.size) != (ssize_t)xmit_batch.size) {
+        mirror_log(session->loginfo, V_ERR, "can't read batch payload");
+        reply_error(session, "can't read batch payload");
+        goto error;
+    }
+
+    mirror_log(session->loginfo, V_INFO, "batch of %" PRIu32 " records, %" PRIu64 " bytes", xmit_batch.count,
+               xmit_batch.size);
+
+    p         = buf;
+    remaining = (size_t)xmit_batch.size;
+    for (i = 0; i < xmit_batch.count; i++) {
+        if (remaining < H5FD_MIRROR_BATCH_RECORD_SIZE) {
+            mirror_log(session->loginfo, V_ERR, "batch record %" PRIu32 " truncated", i);
+            reply_error(session, "malformed batch");
+            goto error;
+        }
+        p += H5FD__mirror_xmit_decode_uint8(&op, p);
+        p += H5FD__mirror_xmit_decode_uint8(&type, p);
+        p += H5FD__mirror_xmit_decode_uint64(&addr, p);
+        p += H5FD__mirror_xmit_decode_uint64(&size, p);
+        remaining -= H5FD_MIRROR_BATCH_RECORD_SIZE;
+        if (size > remaining) {
+            mirror_log(session->loginfo, V_ERR, "batch record %" PRIu32 " data truncated", i);
+            reply_error(session, "malformed batch");
+            goto error;
+        }
+
+        switch (op) {
+            case H5FD_MIRROR_OP_WRITE:
+                if (H5FDwrite(session->file, (H5FD_mem_t)type, H5P_DEFAULT, (haddr_t)addr, (size_t)size, p) <
+                    0) {
+                    mirror_log(session->loginfo, V_ERR, "H5FDwrite()");
+                    reply_error(session, "remote H5FDwrite() failure");
+                    goto error;
+                }
+                break;
+            case H5FD_MIRROR_OP_SET_EOA:
+                if (H5FDset_eoa(session->file, (H5FD_mem_t)type, (haddr_t)addr) < 0) {
+                    mirror_log(session->loginfo, V_ERR, "H5FDset_eoa()");
+                    reply_error(session, "remote H5FDset_eoa() failure");
+                    goto error;
+                }
+                break;
+            default:
+                mirror_log(session->loginfo, V_ERR, "unrecognized batch record op %u", (unsigned)op);
+                reply_error(session, "unrecognized batch record");
+                goto error;
+        } /* end switch (op) */
+
+        p += size;
+        remaining -= (size_t)size;
+    } /* end for each record */
+
+    if (remaining != 0) {
+        mirror_log(session->loginfo, V_ERR, "%zu bytes left over in batch", remaining);
+        reply_error(session, "malformed batch");
+        goto error;
+    }
+
+    HDfree(buf);
+
+    if (reply_ok(session) < 0) {
+        mirror_log(session->loginfo, V_ERR, "can't reply");
+        reply_error(session, "ok reply failed; session contaminated");
+        return -1;
+    }
+
+    return 0;
+
+error:
+    HDfree(buf);
+    return -1;
+} /* end do_batch() */
+
 /* ---------------------------------------------------------------------------
  * Function:    do_close
  *
@@ -730,6 +899,7 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
     H5FD_mem_t               type              = 0;
     char *                   buf               = NULL;
     ssize_t                  nbytes_in_packet  = 0;
+    size_t                   nbytes_to_read    = 0;
     H5FD_mirror_xmit_write_t xmit_write;
 
     HDassert(session && (session->magic == MW_SESSION_MAGIC) && xmit_buf);
@@ -785,8 +955,13 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
      */
     sum_bytes_written = 0;
     do {
-        nbytes_in_packet = HDread(session->sockfd, buf, H5FD_MIRROR_DATA_BUFFER_MAX);
-        if (-1 == nbytes_in_packet) {
+        /* Never read past this write's data, into a following xmit */
+        nbytes_to_read = H5FD_MIRROR_DATA_BUFFER_MAX;
+        if ((uint64_t)nbytes_to_read > xmit_write.size - sum_bytes_written)
+            nbytes_to_read = (size_t)(xmit_write.size - sum_bytes_written);
+
+        nbytes_in_packet = HDread(session->sockfd, buf, nbytes_to_read);
+        if (nbytes_in_packet <= 0) {
             mirror_log(session->loginfo, V_ERR, "can't read into databuffer");
             reply_error(session, "can't read data buffer");
             return -1;
@@ -830,6 +1005,8 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
  *
  * Purpose:     Accept bytes from the socket, check for emergency shutdown, and
  *              sanity-check received bytes.
+ *              Exactly one xmit is read: the header, then as many bytes as
+ *              the header's op requires.
  *              The raw bytes read are stored in the sock_comm structure at
  *              comm->raw.
  *              The raw bytes are decoded and a xmit_t (header) struct pointer
@@ -843,7 +1020,8 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
 {
     ssize_t             read_ret = 0;
     size_t              decode_ret;
-    H5FD_mirror_xmit_t *X = comm->xmit_recd;
+    size_t              xmit_size = H5FD_MIRROR_XMIT_HEADER_SIZE;
+    H5FD_mirror_xmit_t *X         = comm->xmit_recd;
 
     HDassert((session != NULL) && (session->magic == MW_SESSION_MAGIC) && (comm != NULL) &&
              (comm->magic == MW_SOCK_COMM_MAGIC) && (comm->xmit_recd != NULL) && (comm->raw != NULL) &&
@@ -856,7 +1034,15 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
 
     mirror_log(session->loginfo, V_INFO, "ready to receive"); /* TODO */
 
-    read_ret = HDread(session->sockfd, comm->raw, H5FD_MIRROR_XMIT_BUFFER_MAX);
+    /* Read the "GOODBYE"-sized start of the header first, so that a bare
+     * kill message is not waited on for more bytes.
+     */
+    read_ret = read_exactly(session->sockfd, comm->raw, 7);
+    if (7 == read_ret && HDstrncmp("GOODBYE", comm->raw, 7)) {
+        ssize_t rest_ret = read_exactly(session->sockfd, comm->raw + 7, H5FD_MIRROR_XMIT_HEADER_SIZE - 7);
+
+        read_ret = (rest_ret < 0) ? rest_ret : read_ret + rest_ret;
+    }
     if (-1 == read_ret) {
         mirror_log(session->loginfo, V_ERR, "read:%zd", read_ret);
         goto error;
@@ -885,6 +1071,11 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
         goto error;
     }
 
+    if (read_ret < H5FD_MIRROR_XMIT_HEADER_SIZE) {
+        mirror_log(session->loginfo, V_ERR, "connection closed mid-header");
+        goto error;
+    }
+
     if (!H5FD_mirror_xmit_is_xmit(X)) {
         mirror_log(session->loginfo, V_ERR, "bad magic: 0x%X", X->magic);
         /* Try to tell Driver that it should stop */
@@ -892,6 +1083,41 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
         goto error;
     }
 
+    /* Ingest the remainder of the xmit */
+    switch (X->op) {
+        case H5FD_MIRROR_OP_BATCH:
+            xmit_size = H5FD_MIRROR_XMIT_BATCH_SIZE;
+            break;
+        case H5FD_MIRROR_OP_LOCK:
+            xmit_size = H5FD_MIRROR_XMIT_LOCK_SIZE;
+            break;
+        case H5FD_MIRROR_OP_OPEN:
+            xmit_size = H5FD_MIRROR_XMIT_OPEN_SIZE;
+            break;
+        case H5FD_MIRROR_OP_SET_EOA:
+            xmit_size = H5FD_MIRROR_XMIT_EOA_SIZE;
+            break;
+        case H5FD_MIRROR_OP_WRITE:
+            xmit_size = H5FD_MIRROR_XMIT_WRITE_SIZE;
+            break;
+        default: /* header only */
+            break;
+    } /* end switch (X->op) */
+    if (xmit_size > H5FD_MIRROR_XMIT_HEADER_SIZE) {
+        read_ret = read_exactly(session->sockfd, comm->raw + H5FD_MIRROR_XMIT_HEADER_SIZE,
+                                xmit_size - H5FD_MIRROR_XMIT_HEADER_SIZE);
+        if (read_ret != (ssize_t)(xmit_size - H5FD_MIRROR_XMIT_HEADER_SIZE)) {
+            mirror_log(session->loginfo, V_ERR, "short xmit: read:%zd", read_ret);
+            goto error;
+        }
+        if (HEXDUMP_XMITS) {
+            mirror_log(session->loginfo, V_ALL, "```");
+            mirror_log_bytes(session->loginfo, V_ALL, (size_t)read_ret,
+                             (const unsigned char *)comm->raw + H5FD_MIRROR_XMIT_HEADER_SIZE);
+            mirror_log(session->loginfo, V_ALL, "```");
+        }
+    }
+
     if (session->xmit_count != X->xmit_count) {
         mirror_log(session->loginfo, V_ERR, "xmit_count mismatch exp:%d recd:%d", session->xmit_count,
                    X->xmit_count);
@@ -954,6 +1180,11 @@ process_instructions(struct mirror_session *session)
         }
 
         switch (xmit_recd.op) {
+            case H5FD_MIRROR_OP_BATCH:
+                if (do_batch(session, (const unsigned char *)xmit_buf) < 0) {
+                    return -1;
+                }
+                break;
             case H5FD_MIRROR_OP_CLOSE:
                 if (do_close(session) < 0) {
                     return -1;